@@ -0,0 +1,21 @@
+// DO NOT EDIT. Automagically generated by the configure script.
+// Will be removed by  make clean_all
+
+#include "commands/AddComponentCommand.h"
+#include "commands/BackwardStepCommand.h"
+#include "commands/CloseCommand.h"
+#include "commands/ContinueBackwardsCommand.h"
+#include "commands/ContinueCommand.h"
+#include "commands/CopyComponentCommand.h"
+#include "commands/HelpCommand.h"
+#include "commands/ListComponentsCommand.h"
+#include "commands/LoadCommand.h"
+#include "commands/MoveComponentCommand.h"
+#include "commands/PauseCommand.h"
+#include "commands/QuitCommand.h"
+#include "commands/RemoveComponentCommand.h"
+#include "commands/ResetCommand.h"
+#include "commands/SaveCommand.h"
+#include "commands/StatusCommand.h"
+#include "commands/StepCommand.h"
+#include "commands/VersionCommand.h"
@@ -0,0 +1,25 @@
+/*
+ *  THIS FILE IS AUTOMATICALLY CREATED BY configure!
+ *  DON'T EDIT THIS FILE MANUALLY, IT WILL BE OVERWRITTEN.
+ */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#define VERSION "repo"
+#define UNSTABLE_DEVEL
+#define WITHUNITTESTS
+#define COMPILE_DATE "compiled on Linux/x86_64, Sun Oct 18 21:31:33 UTC 2026"
+#define ADD_ALL_CPU_FAMILIES     add_cpu_family(arm_cpu_family_init, ARCH_ARM); add_cpu_family(m88k_cpu_family_init, ARCH_M88K); add_cpu_family(mips_cpu_family_init, ARCH_MIPS); add_cpu_family(ppc_cpu_family_init, ARCH_PPC); add_cpu_family(sh_cpu_family_init, ARCH_SH);
+#define WITH_X11
+#define WITH_ZLIB
+#define WITH_LZMA
+#define WITH_PTHREADS
+#define strlcpy mystrlcpy
+#define strlcat mystrlcat
+#define USE_STRLCPY_REPLACEMENTS
+#define mkstemp mymkstemp
+#define HAVE___FUNCTION__
+#define HOST_LITTLE_ENDIAN
+
+#endif  /*  CONFIG_H  */
@@ -0,0 +1,268 @@
+/*
+ *  GXemul demo:  Benchmark suite
+ *
+ *  This file is in the Public Domain.
+ *
+ *  A set of small, deterministic microbenchmarks. Each benchmark is run
+ *  once, and a line of the following form is printed for each:
+ *
+ *	bench NAME NINSTRS0 NINSTRS1 SEC0 USEC0 SEC1 USEC1
+ *
+ *  where all numbers are in hex. NINSTRS is the emulated cpu's instruction
+ *  count (as reported by the mp device), and SEC/USEC is the host's time
+ *  of day (as reported by the rtc device), before and after the benchmark.
+ *  test/bench.sh turns these lines into MIPS and ns/instruction figures.
+ *
+ *  Only integer arithmetic without division is used outside of the fp
+ *  benchmark, so that no compiler support library is needed. The fp
+ *  benchmark is only built if BENCH_FP is defined.
+ */
+
+#include "dev_cons.h"
+#include "dev_disk.h"
+#include "dev_fb.h"
+#include "dev_mp.h"
+#include "dev_rtc.h"
+
+
+#ifdef MIPS
+/*  Note: The ugly cast to a signed int (32-bit) causes the address to be
+	sign-extended correctly on MIPS when compiled in 64-bit mode  */
+#define PHYSADDR_OFFSET         ((signed int)0xa0000000)
+#else
+#define PHYSADDR_OFFSET         0
+#endif
+
+
+#define PUTCHAR_ADDRESS		(PHYSADDR_OFFSET +              \
+				DEV_CONS_ADDRESS + DEV_CONS_PUTGETCHAR)
+#define HALT_ADDRESS            (PHYSADDR_OFFSET +              \
+				DEV_CONS_ADDRESS + DEV_CONS_HALT)
+#define MP_ADDRESS		(PHYSADDR_OFFSET + DEV_MP_ADDRESS)
+#define RTC_ADDRESS		(PHYSADDR_OFFSET + DEV_RTC_ADDRESS)
+#define DISK_ADDRESS            (PHYSADDR_OFFSET + DEV_DISK_ADDRESS)
+#define FB_BASE			(PHYSADDR_OFFSET + DEV_FB_ADDRESS)
+#define FBCTRL_BASE		(PHYSADDR_OFFSET + DEV_FBCTRL_ADDRESS)
+
+
+/*  Scale factor for all benchmarks:  */
+#define	BENCH_SCALE		16
+
+#define	COPY_WORDS		16384
+#define	STRIDE_PAGES		1024
+#define	PAGE_SIZE		4096
+#define	XRES			640
+#define	YRES			480
+#define	DISK_SECTORS		2048
+
+
+static unsigned int copy_src[COPY_WORDS];
+static unsigned int copy_dst[COPY_WORDS];
+static unsigned char pages[STRIDE_PAGES * PAGE_SIZE];
+
+volatile unsigned int sink;
+
+
+void printchar(char ch)
+{
+	*((volatile unsigned char *) PUTCHAR_ADDRESS) = ch;
+}
+
+
+void printstr(char *s)
+{
+	while (*s)
+		printchar(*s++);
+}
+
+
+void printhex(unsigned int x)
+{
+	int i;
+
+	printstr(" 0x");
+	for (i = 28; i >= 0; i -= 4)
+		printchar("0123456789abcdef"[(x >> i) & 15]);
+}
+
+
+void halt(void)
+{
+	*((volatile unsigned char *) HALT_ADDRESS) = 0;
+}
+
+
+unsigned int ninstrs(void)
+{
+	return *((volatile unsigned int *) (MP_ADDRESS + DEV_MP_NCYCLES));
+}
+
+
+/*
+ *  Runs one benchmark, and prints its instruction count and the host time
+ *  before and after.
+ */
+void run(char *name, void (*func)(void))
+{
+	unsigned int n0, n1, sec0, usec0, sec1, usec1;
+
+	*((volatile int *) (RTC_ADDRESS + DEV_RTC_TRIGGER_READ)) = 0;
+	sec0 = *((volatile int *) (RTC_ADDRESS + DEV_RTC_SEC));
+	usec0 = *((volatile int *) (RTC_ADDRESS + DEV_RTC_USEC));
+	n0 = ninstrs();
+
+	func();
+
+	n1 = ninstrs();
+	*((volatile int *) (RTC_ADDRESS + DEV_RTC_TRIGGER_READ)) = 0;
+	sec1 = *((volatile int *) (RTC_ADDRESS + DEV_RTC_SEC));
+	usec1 = *((volatile int *) (RTC_ADDRESS + DEV_RTC_USEC));
+
+	printstr("bench ");
+	printstr(name);
+	printhex(n0);
+	printhex(n1);
+	printhex(sec0);
+	printhex(usec0);
+	printhex(sec1);
+	printhex(usec1);
+	printstr("\n");
+}
+
+
+/*  Integer ALU loop, with a loop-carried dependency:  */
+void bench_intloop(void)
+{
+	unsigned int i, a = 1, b = 0x12345678;
+
+	for (i = 0; i < BENCH_SCALE * 1000000; i++) {
+		a = (a << 3) ^ (a >> 5) ^ b;
+		b += a | i;
+	}
+
+	sink = a + b;
+}
+
+
+/*  Word copy loop, 64 KB at a time:  */
+void bench_memcpy(void)
+{
+	int i, j;
+
+	for (i = 0; i < BENCH_SCALE * 32; i++)
+		for (j = 0; j < COPY_WORDS; j++)
+			copy_dst[j] = copy_src[j];
+
+	sink = copy_dst[COPY_WORDS - 1];
+}
+
+
+/*
+ *  Touch one byte in each of many pages, over and over. On the test
+ *  machines there is no guest MMU setup, so this mostly stresses the
+ *  emulator's own virtual to host page translation caches.
+ */
+void bench_pagestride(void)
+{
+	int i, j;
+
+	for (i = 0; i < BENCH_SCALE * 256; i++)
+		for (j = 0; j < STRIDE_PAGES; j++)
+			pages[j * PAGE_SIZE + (i & (PAGE_SIZE - 1))] += j;
+
+	sink = pages[0];
+}
+
+
+#ifdef BENCH_FP
+void bench_fp(void)
+{
+	double x = 1.0, y = 0.5;
+	int i;
+
+	for (i = 0; i < BENCH_SCALE * 250000; i++) {
+		x = x * 0.999999 + y;
+		y = y * 1.000001 - x * 0.000001;
+	}
+
+	sink = (unsigned int) x;
+}
+#endif
+
+
+/*  Poll a device register, similar to a driver waiting for a status bit:  */
+void bench_mmio(void)
+{
+	unsigned int i, x = 0;
+
+	for (i = 0; i < BENCH_SCALE * 20000; i++)
+		x += *((volatile unsigned int *) (MP_ADDRESS + DEV_MP_NCPUS));
+
+	sink = x;
+}
+
+
+/*  Fill the whole framebuffer, one byte at a time:  */
+void bench_fbfill(void)
+{
+	int i, j;
+
+	*(volatile int *)(FBCTRL_BASE + DEV_FBCTRL_PORT) =
+	    DEV_FBCTRL_PORT_X1;
+	*(volatile int *)(FBCTRL_BASE + DEV_FBCTRL_DATA) = XRES;
+	*(volatile int *)(FBCTRL_BASE + DEV_FBCTRL_PORT) =
+	    DEV_FBCTRL_PORT_Y1;
+	*(volatile int *)(FBCTRL_BASE + DEV_FBCTRL_DATA) = YRES;
+	*(volatile int *)(FBCTRL_BASE + DEV_FBCTRL_PORT) =
+	    DEV_FBCTRL_PORT_COMMAND;
+	*(volatile int *)(FBCTRL_BASE + DEV_FBCTRL_DATA) =
+	    DEV_FBCTRL_COMMAND_SET_RESOLUTION;
+
+	for (i = 0; i < BENCH_SCALE; i++)
+		for (j = 0; j < XRES * YRES * 3; j++)
+			*((volatile unsigned char *) FB_BASE + j) = i + j;
+}
+
+
+/*  Read sectors from disk ID 0, and copy them out of the device buffer:  */
+void bench_disk(void)
+{
+	int i, j;
+	unsigned int x = 0;
+
+	for (i = 0; i < BENCH_SCALE * DISK_SECTORS; i++) {
+		*((volatile int *) (DISK_ADDRESS + DEV_DISK_OFFSET)) =
+		    (i & (DISK_SECTORS - 1)) * 512;
+		*((volatile int *) (DISK_ADDRESS + DEV_DISK_ID)) = 0;
+		*((volatile int *) (DISK_ADDRESS + DEV_DISK_START_OPERATION)) =
+		    DEV_DISK_OPERATION_READ;
+
+		if (*((volatile int *) (DISK_ADDRESS + DEV_DISK_STATUS)) == 0) {
+			printstr("bench disk: read failed\n");
+			return;
+		}
+
+		for (j = 0; j < 512; j += 4)
+			x += *((volatile unsigned int *)
+			    (DISK_ADDRESS + DEV_DISK_BUFFER + j));
+	}
+
+	sink = x;
+}
+
+
+void f(void)
+{
+	run("intloop", bench_intloop);
+	run("memcpy", bench_memcpy);
+	run("pagestride", bench_pagestride);
+#ifdef BENCH_FP
+	run("fp", bench_fp);
+#endif
+	run("mmio", bench_mmio);
+	run("fbfill", bench_fbfill);
+	run("disk", bench_disk);
+
+	printstr("bench done\n");
+	halt();
+}
@@ -25,6 +25,8 @@
  *  SUCH DAMAGE.
  */
 
+#include <algorithm>
+
 #include "components/MainbusComponent.h"
 #include "GXemul.h"
 
@@ -33,6 +35,7 @@ MainbusComponent::MainbusComponent()
 	: Component("mainbus", "mainbus")
 	, m_memoryMapFailed(false)
 	, m_memoryMapValid(false)
+	, m_lastHitEntry(NULL)
 	, m_currentAddressDataBus(NULL)
 {
 }
@@ -66,6 +69,7 @@ void MainbusComponent::FlushCachedStateForComponent()
 	m_memoryMap.clear();
 	m_memoryMapValid = false;
 	m_memoryMapFailed = false;
+	m_lastHitEntry = NULL;
 
 	m_currentAddressDataBus = NULL;
 	
@@ -94,6 +98,7 @@ bool MainbusComponent::MakeSureMemoryMapExists(GXemul* gxemul)
 		return true;
 
 	m_memoryMap.clear();
+	m_lastHitEntry = NULL;
 
 	m_memoryMapValid = true;
 	m_memoryMapFailed = false;
@@ -168,10 +173,42 @@ bool MainbusComponent::MakeSureMemoryMapExists(GXemul* gxemul)
 		m_memoryMap.push_back(mmEntry);
 	}
 
+	std::sort(m_memoryMap.begin(), m_memoryMap.end());
+
 	return true;
 }
 
 
+const MainbusComponent::MemoryMapEntry* MainbusComponent::FindMemoryMapEntry(
+	uint64_t address)
+{
+	// Most accesses hit the same component as the previous access.
+	if (m_lastHitEntry != NULL && address >= m_lastHitEntry->base &&
+	    address - m_lastHitEntry->base < m_lastHitEntry->size)
+		return m_lastHitEntry;
+
+	// Binary search for the last entry with base <= address:
+	size_t lo = 0, hi = m_memoryMap.size();
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		if (m_memoryMap[mid].base <= address)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo == 0)
+		return NULL;
+
+	const MemoryMapEntry& mmEntry = m_memoryMap[lo - 1];
+	if (address - mmEntry.base >= mmEntry.size)
+		return NULL;
+
+	m_lastHitEntry = &mmEntry;
+	return m_lastHitEntry;
+}
+
+
 AddressDataBus* MainbusComponent::AsAddressDataBus()
 {
 	return this;
@@ -180,43 +217,25 @@ AddressDataBus* MainbusComponent::AsAddressDataBus()
 
 void MainbusComponent::AddressSelect(uint64_t address)
 {
-	MakeSureMemoryMapExists();
-
 	m_currentAddressDataBus = NULL;
 
-	if (!m_memoryMapValid)
+	if (!m_memoryMapValid && !MakeSureMemoryMapExists())
 		return;
 
-	// Note: This is a linear O(n) scan of the list of memory-mapped
-	// components. For small n, this should be ok.
-	//
-	// In practice, my hope is that the bulk of all memory access will be
-	// using direct-mapped pages anyway, so this should not be that much
-	// of a problem.
-
-	for (size_t i=0; i<m_memoryMap.size(); ++i) {
-		MemoryMapEntry& mmEntry = m_memoryMap[i];
-
-		// If this memory map entry contains the address we wish to
-		// select, then...
-		if (address >= mmEntry.base &&
-		    address < mmEntry.base + mmEntry.size) {
-			// ... tell the corresponding component which address
-			// within it we wish to select.
-			m_currentAddressDataBus = mmEntry.addressDataBus;
-			m_currentAddressDataBus->AddressSelect(
-			    (address - mmEntry.base) / mmEntry.addrMul);
-			break;
-		}
-	}
+	const MemoryMapEntry* mmEntry = FindMemoryMapEntry(address);
+	if (mmEntry == NULL)
+		return;
+
+	// Tell the corresponding component which address within it we wish
+	// to select.
+	m_currentAddressDataBus = mmEntry->addressDataBus;
+	m_currentAddressDataBus->AddressSelect(
+	    (address - mmEntry->base) / mmEntry->addrMul);
 }
 
 
 bool MainbusComponent::ReadData(uint8_t& data, Endianness endianness)
 {
-	if (!MakeSureMemoryMapExists())
-		return false;
-
 	if (m_currentAddressDataBus != NULL)
 		return m_currentAddressDataBus->ReadData(data, endianness);
 	else
@@ -226,9 +245,6 @@ bool MainbusComponent::ReadData(uint8_t& data, Endianness endianness)
 
 bool MainbusComponent::ReadData(uint16_t& data, Endianness endianness)
 {
-	if (!MakeSureMemoryMapExists())
-		return false;
-
 	if (m_currentAddressDataBus != NULL)
 		return m_currentAddressDataBus->ReadData(data, endianness);
 	else
@@ -238,9 +254,6 @@ bool MainbusComponent::ReadData(uint16_t& data, Endianness endianness)
 
 bool MainbusComponent::ReadData(uint32_t& data, Endianness endianness)
 {
-	if (!MakeSureMemoryMapExists())
-		return false;
-
 	if (m_currentAddressDataBus != NULL)
 		return m_currentAddressDataBus->ReadData(data, endianness);
 	else
@@ -250,9 +263,6 @@ bool MainbusComponent::ReadData(uint32_t& data, Endianness endianness)
 
 bool MainbusComponent::ReadData(uint64_t& data, Endianness endianness)
 {
-	if (!MakeSureMemoryMapExists())
-		return false;
-
 	if (m_currentAddressDataBus != NULL)
 		return m_currentAddressDataBus->ReadData(data, endianness);
 	else
@@ -262,9 +272,6 @@ bool MainbusComponent::ReadData(uint64_t& data, Endianness endianness)
 
 bool MainbusComponent::WriteData(const uint8_t& data, Endianness endianness)
 {
-	if (!MakeSureMemoryMapExists())
-		return false;
-
 	if (m_currentAddressDataBus != NULL)
 		return m_currentAddressDataBus->WriteData(data, endianness);
 	else
@@ -274,9 +281,6 @@ bool MainbusComponent::WriteData(const uint8_t& data, Endianness endianness)
 
 bool MainbusComponent::WriteData(const uint16_t& data, Endianness endianness)
 {
-	if (!MakeSureMemoryMapExists())
-		return false;
-
 	if (m_currentAddressDataBus != NULL)
 		return m_currentAddressDataBus->WriteData(data, endianness);
 	else
@@ -286,9 +290,6 @@ bool MainbusComponent::WriteData(const uint16_t& data, Endianness endianness)
 
 bool MainbusComponent::WriteData(const uint32_t& data, Endianness endianness)
 {
-	if (!MakeSureMemoryMapExists())
-		return false;
-
 	if (m_currentAddressDataBus != NULL)
 		return m_currentAddressDataBus->WriteData(data, endianness);
 	else
@@ -298,9 +299,6 @@ bool MainbusComponent::WriteData(const uint32_t& data, Endianness endianness)
 
 bool MainbusComponent::WriteData(const uint64_t& data, Endianness endianness)
 {
-	if (!MakeSureMemoryMapExists())
-		return false;
-
 	if (m_currentAddressDataBus != NULL)
 		return m_currentAddressDataBus->WriteData(data, endianness);
 	else
@@ -308,6 +306,27 @@ bool MainbusComponent::WriteData(const uint64_t& data, Endianness endianness)
 }
 
 
+uint8_t* MainbusComponent::LookupHostPage(uint64_t address, size_t pageSize,
+	bool writeAccess, bool& writable)
+{
+	if (!m_memoryMapValid && !MakeSureMemoryMapExists())
+		return NULL;
+
+	const MemoryMapEntry* mmEntry = FindMemoryMapEntry(address);
+	if (mmEntry == NULL)
+		return NULL;
+
+	// Only pages which are entirely within a component, and which are
+	// not spread out using addrMul, can be accessed directly.
+	if (mmEntry->addrMul != 1 ||
+	    address - mmEntry->base + pageSize > mmEntry->size)
+		return NULL;
+
+	return mmEntry->addressDataBus->LookupHostPage(
+	    address - mmEntry->base, pageSize, writeAccess, writable);
+}
+
+
 /*****************************************************************************/
 
 
@@ -444,6 +463,68 @@ static void Test_MainbusComponent_Multiple_NonOverlapping()
 	}
 }
 
+static void Test_MainbusComponent_Multiple_Unsorted_WithGaps()
+{
+	refcount_ptr<Component> mainbus =
+	    ComponentFactory::CreateComponent("mainbus");
+	refcount_ptr<Component> ram0 =
+	    ComponentFactory::CreateComponent("ram");
+	refcount_ptr<Component> ram1 =
+	    ComponentFactory::CreateComponent("ram");
+	refcount_ptr<Component> ram2 =
+	    ComponentFactory::CreateComponent("ram");
+
+	mainbus->AddChild(ram0);
+	mainbus->AddChild(ram1);
+	mainbus->AddChild(ram2);
+	ram0->SetVariableValue("memoryMappedSize", "0x100");
+	ram0->SetVariableValue("memoryMappedBase", "0x3000");
+	ram1->SetVariableValue("memoryMappedSize", "0x100");
+	ram1->SetVariableValue("memoryMappedBase", "0x1000");
+	ram2->SetVariableValue("memoryMappedSize", "0x100");
+	ram2->SetVariableValue("memoryMappedBase", "0x2000");
+
+	AddressDataBus* bus = mainbus->AsAddressDataBus();
+
+	uint8_t dataByte = 1;
+	bus->AddressSelect(0x1080);
+	UnitTest::Assert("write to ram1 should succeed",
+	    bus->WriteData(dataByte));
+	dataByte = 2;
+	bus->AddressSelect(0x2080);
+	UnitTest::Assert("write to ram2 should succeed",
+	    bus->WriteData(dataByte));
+	dataByte = 3;
+	bus->AddressSelect(0x3080);
+	UnitTest::Assert("write to ram0 should succeed",
+	    bus->WriteData(dataByte));
+
+	bus->AddressSelect(0x0fff);
+	UnitTest::Assert("read below the first component should fail",
+	    bus->ReadData(dataByte) == false);
+	bus->AddressSelect(0x1100);
+	UnitTest::Assert("read in a gap should fail",
+	    bus->ReadData(dataByte) == false);
+	bus->AddressSelect(0x3100);
+	UnitTest::Assert("read after the last component should fail",
+	    bus->ReadData(dataByte) == false);
+
+	bus->AddressSelect(0x2080);
+	bus->ReadData(dataByte);
+	UnitTest::Assert("ram2 mismatch", dataByte, 2);
+	bus->AddressSelect(0x1080);
+	bus->ReadData(dataByte);
+	UnitTest::Assert("ram1 mismatch", dataByte, 1);
+	bus->AddressSelect(0x3080);
+	bus->ReadData(dataByte);
+	UnitTest::Assert("ram0 mismatch", dataByte, 3);
+
+	AddressDataBus* ram0bus = ram0->AsAddressDataBus();
+	ram0bus->AddressSelect(0x80);
+	ram0bus->ReadData(dataByte);
+	UnitTest::Assert("ram0 should have been written to", dataByte, 3);
+}
+
 static void Test_MainbusComponent_Simple_With_AddrMul()
 {
 	refcount_ptr<Component> mainbus =
@@ -518,6 +599,40 @@ static void Test_MainbusComponent_Simple_With_AddrMul()
 	    "written to it yet! [3]", dataByte, 0);
 }
 
+static void Test_MainbusComponent_LookupHostPage()
+{
+	refcount_ptr<Component> mainbus =
+	    ComponentFactory::CreateComponent("mainbus");
+	refcount_ptr<Component> ram0 =
+	    ComponentFactory::CreateComponent("ram");
+
+	mainbus->AddChild(ram0);
+	ram0->SetVariableValue("memoryMappedSize", "0x10000");
+	ram0->SetVariableValue("memoryMappedBase", "0x4000");
+
+	AddressDataBus* bus = mainbus->AsAddressDataBus();
+
+	uint8_t dataByte = 42;
+	bus->AddressSelect(0x5010);
+	bus->WriteData(dataByte);
+
+	bool writable = false;
+	uint8_t* page = bus->LookupHostPage(0x5000, 0x1000, true, writable);
+	UnitTest::Assert("lookup should succeed", page != NULL);
+	UnitTest::Assert("page should be writable", writable);
+	UnitTest::Assert("host page contents", page[0x10], 42);
+
+	UnitTest::Assert("unmapped page should fail",
+	    bus->LookupHostPage(0x1000, 0x1000, true, writable) == NULL);
+	UnitTest::Assert("partially mapped page should fail",
+	    bus->LookupHostPage(0x13800, 0x1000, true, writable) == NULL);
+
+	ram0->SetVariableValue("memoryMappedAddrMul", "2");
+	mainbus->FlushCachedState();
+	UnitTest::Assert("addrmul != 1 should fail",
+	    bus->LookupHostPage(0x5000, 0x1000, true, writable) == NULL);
+}
+
 static void Test_MainbusComponent_PreRunCheck()
 {
 	GXemul gxemul;
@@ -551,7 +666,9 @@ UNITTESTS(MainbusComponent)
 	UNITTEST(Test_MainbusComponent_Simple);
 	UNITTEST(Test_MainbusComponent_Remapping);
 	UNITTEST(Test_MainbusComponent_Multiple_NonOverlapping);
+	UNITTEST(Test_MainbusComponent_Multiple_Unsorted_WithGaps);
 	UNITTEST(Test_MainbusComponent_Simple_With_AddrMul);
+	UNITTEST(Test_MainbusComponent_LookupHostPage);
 
 	// TODO: Write outside of mapped space
 	// TODO: Write PARTIALLY outside of mapped space!!! e.g. 64-bit
@@ -64,6 +64,8 @@ CPUComponent::CPUComponent(const string& className, const string& cpuArchitectur
 	AddVariable("showFunctionTraceReturn", &m_showFunctionTraceReturn);
 	AddVariable("functionCallTraceDepth", &m_functionCallTraceDepth);
 	AddVariable("nrOfTracedFunctionCalls", &m_nrOfTracedFunctionCalls);
+
+	HostTLBInvalidate();
 }
 
 
@@ -92,6 +94,10 @@ void CPUComponent::ResetState()
 
 	m_symbolRegistry.Clear();
 
+	// Memory (e.g. RAM) may be reset as well, so any cached host pages
+	// are no longer valid.
+	HostTLBInvalidate();
+
 	Component::ResetState();
 }
 
@@ -434,6 +440,7 @@ AddressDataBus * CPUComponent::AsAddressDataBus()
 void CPUComponent::FlushCachedStateForComponent()
 {
 	m_addressDataBus = NULL;
+	HostTLBInvalidate();
 
 	Component::FlushCachedStateForComponent();
 }
@@ -502,6 +509,47 @@ bool CPUComponent::LookupAddressDataBus(GXemul* gxemul)
 }
 
 
+void CPUComponent::HostTLBInvalidate()
+{
+	for (size_t i=0; i<HostTLBSize; ++i)
+		m_hostTLB[i].valid = false;
+}
+
+
+void CPUComponent::HostTLBFill(HostTLBEntry& entry, uint64_t vaddrPage,
+	bool writeAccess)
+{
+	entry.valid = true;
+	entry.writable = false;
+	entry.filledForWrite = writeAccess;
+	entry.vaddrPage = vaddrPage;
+	entry.hostPage = NULL;
+
+	if (!LookupAddressDataBus())
+		return;
+
+	uint64_t paddr;
+	bool writable;
+	if (!VirtualToPhysical(vaddrPage << HostTLBPageShift, paddr, writable))
+		return;
+
+	// Don't ask for a writable page if the virtual page is read-only
+	// anyway; that would only cause a shared page to be copied.
+	bool hostWritable = false;
+	uint8_t* hostPage = m_addressDataBus->LookupHostPage(paddr,
+	    HostTLBPageSize, writeAccess && writable, hostWritable);
+
+	// Note: The lookup may have flushed cached state (e.g. when a shared
+	// page was copied), which invalidates all entries, including this
+	// one. The entry is therefore filled in again afterwards.
+	entry.valid = true;
+	entry.filledForWrite = writeAccess;
+	entry.vaddrPage = vaddrPage;
+	entry.hostPage = hostPage;
+	entry.writable = writable && hostWritable;
+}
+
+
 void CPUComponent::ShowRegisters(GXemul* gxemul, const vector<string>& arguments) const
 {
 	gxemul->GetUI()->ShowDebugMessage("The registers method has not yet "
@@ -311,10 +311,7 @@ void CPUDyntransComponent::DyntransToBeTranslatedBegin(struct DyntransIC* ic)
 
 bool CPUDyntransComponent::DyntransReadInstruction(uint16_t& iword)
 {
-	// TODO: Fast lookup.
-
-	AddressSelect(PCtoInstructionAddress(m_pc));
-	bool readable = ReadData(iword, m_isBigEndian? BigEndian : LittleEndian);
+	bool readable = MemoryReadData(PCtoInstructionAddress(m_pc), iword);
 
 	if (!readable) {
 		UI* ui = GetUI();
@@ -335,10 +332,7 @@ bool CPUDyntransComponent::DyntransReadInstruction(uint16_t& iword)
 
 bool CPUDyntransComponent::DyntransReadInstruction(uint32_t& iword)
 {
-	// TODO: Fast lookup.
-
-	AddressSelect(PCtoInstructionAddress(m_pc));
-	bool readable = ReadData(iword, m_isBigEndian? BigEndian : LittleEndian);
+	bool readable = MemoryReadData(PCtoInstructionAddress(m_pc), iword);
 
 	if (!readable) {
 		UI* ui = GetUI();
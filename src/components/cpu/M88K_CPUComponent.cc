@@ -1646,7 +1646,6 @@ template<bool store, typename T, bool doubleword, bool regofs, bool scaled, bool
 {
 	DYNTRANS_INSTR_HEAD(M88K_CPUComponent)
 
-	// TODO: fast lookups
 	// TODO: usr access
 
 	// TODO: place in M88K's "ongoing memory transaction" registers!
@@ -1661,16 +1660,14 @@ template<bool store, typename T, bool doubleword, bool regofs, bool scaled, bool
 		return;
 	}
 
-	cpu->AddressSelect(addr);
-
 	if (store) {
 		T data = REG32(ic->arg[0]);
-		if (!cpu->WriteData(data, cpu->m_isBigEndian? BigEndian : LittleEndian)) {
+		if (!cpu->MemoryWriteData(addr, data)) {
 			// TODO: failed to access memory was probably an exception. Handle this!
 		}
 	} else {
 		T data;
-		if (!cpu->ReadData(data, cpu->m_isBigEndian? BigEndian : LittleEndian)) {
+		if (!cpu->MemoryReadData(addr, data)) {
 			// TODO: failed to access memory was probably an exception. Handle this!
 		}
 
@@ -1688,14 +1685,12 @@ template<bool store, typename T, bool doubleword, bool regofs, bool scaled, bool
 	if (doubleword) {
 		if (store) {
 			uint32_t data2 = (* (((uint32_t*)(ic->arg[0].p)) + 1) );
-			cpu->AddressSelect(addr + sizeof(uint32_t));
-			if (!cpu->WriteData(data2, cpu->m_isBigEndian? BigEndian : LittleEndian)) {
+			if (!cpu->MemoryWriteData(addr + sizeof(uint32_t), data2)) {
 				// TODO: failed to access memory was probably an exception. Handle this!
 			}
 		} else {
 			uint32_t data2;
-			cpu->AddressSelect(addr + sizeof(uint32_t));
-			if (!cpu->ReadData(data2, cpu->m_isBigEndian? BigEndian : LittleEndian)) {
+			if (!cpu->MemoryReadData(addr + sizeof(uint32_t), data2)) {
 				// TODO: failed to access memory was probably an exception. Handle this!
 			}
 
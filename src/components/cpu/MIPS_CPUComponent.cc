@@ -1148,8 +1148,6 @@ template<bool store, typename addressType, typename T, bool signedLoad> void MIP
 {
 	DYNTRANS_INSTR_HEAD(MIPS_CPUComponent)
 
-	// TODO: fast lookups
-
 	uint64_t addr;
 
 	if (sizeof(addressType) == sizeof(uint64_t))
@@ -1165,16 +1163,14 @@ template<bool store, typename addressType, typename T, bool signedLoad> void MIP
 		return;
 	}
 
-	cpu->AddressSelect(addr);
-
 	if (store) {
 		T data = REG64(ic->arg[0]);
-		if (!cpu->WriteData(data, cpu->m_isBigEndian? BigEndian : LittleEndian)) {
+		if (!cpu->MemoryWriteData(addr, data)) {
 			// TODO: failed to access memory was probably an exception. Handle this!
 		}
 	} else {
 		T data;
-		if (!cpu->ReadData(data, cpu->m_isBigEndian? BigEndian : LittleEndian)) {
+		if (!cpu->MemoryReadData(addr, data)) {
 			// TODO: failed to access memory was probably an exception. Handle this!
 		}
 
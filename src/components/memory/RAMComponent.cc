@@ -32,6 +32,10 @@
 #include "components/RAMComponent.h"
 #include "GXemul.h"
 
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif
+
 
 RAMComponent::RAMComponent(const string& visibleClassName)
 	: MemoryMappedComponent("ram", visibleClassName)
@@ -42,6 +46,7 @@ RAMComponent::RAMComponent(const string& visibleClassName)
 	, m_lastDumpAddr(0)
 	, m_addressSelect(0)
 	, m_selectedHostMemoryBlock(NULL)
+	, m_selectedWritableHostMemoryBlock(NULL)
 	, m_selectedOffsetWithinBlock(0)
 {
 	AddVariable("writeProtect", &m_writeProtected);
@@ -56,14 +61,20 @@ RAMComponent::~RAMComponent()
 }
 
 
+RAMComponent::MemoryBlock::~MemoryBlock()
+{
+	munmap(data, m_size);
+}
+
+
 void RAMComponent::ReleaseAllBlocks()
 {
-	for (size_t i=0; i<m_memoryBlocks.size(); ++i) {
-		if (m_memoryBlocks[i] != NULL) {
-			munmap(m_memoryBlocks[i], m_blockSize);
-			m_memoryBlocks[i] = NULL;
-		}
-	}
+	// Blocks which are shared with clones are only unmapped when the
+	// last owner releases them.
+	m_memoryBlocks.clear();
+
+	m_selectedHostMemoryBlock = NULL;
+	m_selectedWritableHostMemoryBlock = NULL;
 }
 
 
@@ -197,6 +208,17 @@ void RAMComponent::ExecuteMethod(GXemul* gxemul, const string& methodName,
 }
 
 
+bool RAMComponent::CheckVariableWrite(StateVariable& var, const string& oldValue)
+{
+	// CPUs may have cached host pages as writable (or as read-only, when
+	// write protection is removed), so their host TLBs must be flushed.
+	if (var.GetName() == "writeProtect")
+		FlushCachedHostPages();
+
+	return MemoryMappedComponent::CheckVariableWrite(var, oldValue);
+}
+
+
 AddressDataBus* RAMComponent::AsAddressDataBus()
 {
 	return this;
@@ -209,16 +231,22 @@ void RAMComponent::AddressSelect(uint64_t address)
 
 	uint64_t blockNr = address >> m_blockSizeShift;
 
-	if (blockNr+1 > m_memoryBlocks.size())
+	if (blockNr >= m_memoryBlocks.size() ||
+	    m_memoryBlocks[blockNr].IsNULL()) {
 		m_selectedHostMemoryBlock = NULL;
-	else
-		m_selectedHostMemoryBlock = m_memoryBlocks[blockNr];
+		m_selectedWritableHostMemoryBlock = NULL;
+	} else {
+		const MemoryBlock* block = m_memoryBlocks[blockNr];
+		m_selectedHostMemoryBlock = block->data;
+		m_selectedWritableHostMemoryBlock =
+		    block->get_refcount() == 1? block->data : NULL;
+	}
 
 	m_selectedOffsetWithinBlock = address & (m_blockSize-1);
 }
 
 
-void* RAMComponent::AllocateBlock()
+void* RAMComponent::AllocateBlock(uint64_t blockNr)
 {
 	void * p = mmap(NULL, m_blockSize, PROT_WRITE | PROT_READ,
 	    MAP_ANON | MAP_PRIVATE, -1, 0);
@@ -229,17 +257,205 @@ void* RAMComponent::AllocateBlock()
 		throw std::exception();
 	}
 
-	uint64_t blockNr = m_addressSelect >> m_blockSizeShift;
-
 	if (blockNr+1 > m_memoryBlocks.size())
 		m_memoryBlocks.resize(blockNr + 1);
 
-	m_memoryBlocks[blockNr] = p;
+	m_memoryBlocks[blockNr] = new MemoryBlock(p, m_blockSize);
 
 	return p;
 }
 
 
+void* RAMComponent::GetWritableBlock(uint64_t blockNr)
+{
+	void* p;
+	if (blockNr >= m_memoryBlocks.size() ||
+	    m_memoryBlocks[blockNr].IsNULL()) {
+		p = AllocateBlock(blockNr);
+	} else if (m_memoryBlocks[blockNr]->get_refcount() > 1) {
+		// Copy-on-write: the other owners keep the original.
+		refcount_ptr<MemoryBlock> shared = m_memoryBlocks[blockNr];
+		p = AllocateBlock(blockNr);
+		memcpy(p, shared->data, m_blockSize);
+
+		// Read-only pointers to the shared block may have been
+		// handed out by LookupHostPage.
+		FlushCachedHostPages();
+	} else {
+		return m_memoryBlocks[blockNr]->data;
+	}
+
+	// The selected block may have been the one that was replaced.
+	AddressSelect(m_addressSelect);
+
+	return p;
+}
+
+
+void RAMComponent::FlushCachedHostPages()
+{
+	Component* root = this;
+	while (root->GetParent() != NULL)
+		root = root->GetParent();
+
+	root->FlushCachedState();
+}
+
+
+void RAMComponent::RAMDataHandler::CopyValueFrom(
+	CustomStateVariableHandler* other)
+{
+	// Clone() only copies variables between components of the same
+	// class, so the other handler is always a RAMDataHandler.
+	RAMComponent& otherRAM = static_cast<RAMDataHandler*>(other)->m_ram;
+
+	m_ram.ReleaseAllBlocks();
+	m_ram.m_memoryBlocks = otherRAM.m_memoryBlocks;
+
+	m_ram.AddressSelect(m_ram.m_addressSelect);
+	otherRAM.AddressSelect(otherRAM.m_addressSelect);
+
+	// The blocks are now shared, so any pointers to them which were
+	// handed out as writable (e.g. cached by CPUs via LookupHostPage)
+	// must be forgotten.
+	otherRAM.FlushCachedHostPages();
+}
+
+
+// Binary RAM data is stored as a sequence of pages. Each page is preceded
+// by its offset within the RAM component, and its stored length. Pages which
+// only contain zeroes are not stored at all. If the stored length is less
+// than the page size, the page is zlib-compressed. The sequence ends with
+// an offset of all ones.
+static const size_t binaryPageSize = 4096;
+static const uint64_t binaryEndOfData = (uint64_t) -1;
+
+
+void RAMComponent::RAMDataHandler::SerializeBinary(ostream& os) const
+{
+#ifdef WITH_ZLIB
+	vector<Bytef> compressed(compressBound(binaryPageSize));
+#endif
+
+	for (size_t i=0; i<m_ram.m_memoryBlocks.size(); ++i) {
+		if (m_ram.m_memoryBlocks[i].IsNULL())
+			continue;
+
+		const uint8_t* block = (const uint8_t*) m_ram.m_memoryBlocks[i]->data;
+
+		for (size_t offset = 0; offset < m_ram.m_blockSize;
+		    offset += binaryPageSize) {
+			const uint8_t* page = block + offset;
+
+			bool allZeroes = true;
+			for (size_t k=0; k<binaryPageSize; k++)
+				if (page[k] != 0x00) {
+					allZeroes = false;
+					break;
+				}
+
+			if (allZeroes)
+				continue;
+
+			BinarySerialization::WriteUInt64(os,
+			    ((uint64_t) i << m_ram.m_blockSizeShift) + offset);
+
+#ifdef WITH_ZLIB
+			uLongf compressedLen = compressed.size();
+			if (compress2(&compressed[0], &compressedLen, page,
+			    binaryPageSize, Z_BEST_SPEED) == Z_OK &&
+			    compressedLen < binaryPageSize) {
+				BinarySerialization::WriteUInt32(os, compressedLen);
+				os.write((const char*) &compressed[0], compressedLen);
+				continue;
+			}
+#endif
+
+			BinarySerialization::WriteUInt32(os, binaryPageSize);
+			os.write((const char*) page, binaryPageSize);
+		}
+	}
+
+	BinarySerialization::WriteUInt64(os, binaryEndOfData);
+}
+
+
+bool RAMComponent::RAMDataHandler::DeserializeBinary(std::istream& is)
+{
+	// The pages are loaded into new blocks, which only replace the
+	// current contents if all of the data could be loaded.
+	BlockNrToMemoryBlockVector oldBlocks;
+	oldBlocks.swap(m_ram.m_memoryBlocks);
+
+	bool ok = DeserializePages(is);
+	if (!ok)
+		m_ram.m_memoryBlocks.swap(oldBlocks);
+
+	// Make sure the cached block pointer is not stale, and that no CPU
+	// keeps on using pointers to the old blocks.
+	m_ram.AddressSelect(m_ram.m_addressSelect);
+	if (ok)
+		m_ram.FlushCachedHostPages();
+
+	return ok;
+}
+
+
+bool RAMComponent::RAMDataHandler::DeserializePages(std::istream& is)
+{
+	// Note: Custom variables are deserialized after ordinary variables,
+	// so the size has already been restored at this point.
+	const uint64_t memorySize =
+	    m_ram.GetVariable("memoryMappedSize")->ToInteger();
+
+	vector<char> buf(binaryPageSize);
+
+	while (true) {
+		uint64_t addr;
+		if (!BinarySerialization::ReadUInt64(is, addr))
+			return false;
+
+		if (addr == binaryEndOfData)
+			break;
+
+		// Reject pages outside of the RAM, before allocating
+		// anything for them.
+		uint32_t len;
+		if (!BinarySerialization::ReadUInt32(is, len) ||
+		    len > binaryPageSize || (addr & (binaryPageSize-1)) != 0 ||
+		    addr >= memorySize)
+			return false;
+
+		uint8_t* block = (uint8_t*) m_ram.GetWritableBlock(
+		    addr >> m_ram.m_blockSizeShift);
+
+		uint8_t* page = block + (addr & (m_ram.m_blockSize-1));
+
+		if (len == binaryPageSize) {
+			if (!is.read((char*) page, binaryPageSize))
+				return false;
+			continue;
+		}
+
+		if (!is.read(&buf[0], len))
+			return false;
+
+#ifdef WITH_ZLIB
+		uLongf uncompressedLen = binaryPageSize;
+		if (uncompress(page, &uncompressedLen, (const Bytef*) &buf[0],
+		    len) != Z_OK || uncompressedLen != binaryPageSize)
+			return false;
+#else
+		std::cerr << "RAMComponent: compressed RAM data cannot be"
+		    " loaded, since zlib support was not compiled in.\n";
+		return false;
+#endif
+	}
+
+	return true;
+}
+
+
 bool RAMComponent::ReadData(uint8_t& data, Endianness endianness)
 {
 	if (m_selectedHostMemoryBlock == NULL)
@@ -314,10 +530,11 @@ bool RAMComponent::WriteData(const uint8_t& data, Endianness endianness)
 	if (m_writeProtected)
 		return false;
 
-	if (m_selectedHostMemoryBlock == NULL)
-		m_selectedHostMemoryBlock = AllocateBlock();
+	if (m_selectedWritableHostMemoryBlock == NULL)
+		m_selectedWritableHostMemoryBlock =
+		    GetWritableBlock(m_addressSelect >> m_blockSizeShift);
 
-	(((uint8_t*)m_selectedHostMemoryBlock)
+	(((uint8_t*)m_selectedWritableHostMemoryBlock)
 	    [m_selectedOffsetWithinBlock]) = data;
 
 	return true;
@@ -331,8 +548,9 @@ bool RAMComponent::WriteData(const uint16_t& data, Endianness endianness)
 	if (m_writeProtected)
 		return false;
 
-	if (m_selectedHostMemoryBlock == NULL)
-		m_selectedHostMemoryBlock = AllocateBlock();
+	if (m_selectedWritableHostMemoryBlock == NULL)
+		m_selectedWritableHostMemoryBlock =
+		    GetWritableBlock(m_addressSelect >> m_blockSizeShift);
 
 	uint16_t d;
 	if (endianness == BigEndian)
@@ -340,7 +558,7 @@ bool RAMComponent::WriteData(const uint16_t& data, Endianness endianness)
 	else
 		d = LE16_TO_HOST(data);
 
-	(((uint16_t*)m_selectedHostMemoryBlock)
+	(((uint16_t*)m_selectedWritableHostMemoryBlock)
 	    [m_selectedOffsetWithinBlock >> 1]) = d;
 
 	return true;
@@ -354,8 +572,9 @@ bool RAMComponent::WriteData(const uint32_t& data, Endianness endianness)
 	if (m_writeProtected)
 		return false;
 
-	if (m_selectedHostMemoryBlock == NULL)
-		m_selectedHostMemoryBlock = AllocateBlock();
+	if (m_selectedWritableHostMemoryBlock == NULL)
+		m_selectedWritableHostMemoryBlock =
+		    GetWritableBlock(m_addressSelect >> m_blockSizeShift);
 
 	uint32_t d;
 	if (endianness == BigEndian)
@@ -363,7 +582,7 @@ bool RAMComponent::WriteData(const uint32_t& data, Endianness endianness)
 	else
 		d = LE32_TO_HOST(data);
 
-	(((uint32_t*)m_selectedHostMemoryBlock)
+	(((uint32_t*)m_selectedWritableHostMemoryBlock)
 	    [m_selectedOffsetWithinBlock >> 2]) = d;
 
 	return true;
@@ -377,8 +596,9 @@ bool RAMComponent::WriteData(const uint64_t& data, Endianness endianness)
 	if (m_writeProtected)
 		return false;
 
-	if (m_selectedHostMemoryBlock == NULL)
-		m_selectedHostMemoryBlock = AllocateBlock();
+	if (m_selectedWritableHostMemoryBlock == NULL)
+		m_selectedWritableHostMemoryBlock =
+		    GetWritableBlock(m_addressSelect >> m_blockSizeShift);
 
 	uint64_t d;
 	if (endianness == BigEndian)
@@ -386,13 +606,44 @@ bool RAMComponent::WriteData(const uint64_t& data, Endianness endianness)
 	else
 		d = LE64_TO_HOST(data);
 
-	(((uint64_t*)m_selectedHostMemoryBlock)
+	(((uint64_t*)m_selectedWritableHostMemoryBlock)
 	    [m_selectedOffsetWithinBlock >> 3]) = d;
 
 	return true;
 }
 
 
+uint8_t* RAMComponent::LookupHostPage(uint64_t address, size_t pageSize,
+	bool writeAccess, bool& writable)
+{
+	// The page must not cross a host memory block boundary.
+	uint64_t blockNr = address >> m_blockSizeShift;
+	size_t offsetWithinBlock = address & (m_blockSize-1);
+	if (offsetWithinBlock + pageSize > m_blockSize)
+		return NULL;
+
+	// A block which is shared with a clone is handed out read-only, and
+	// is only copied when the caller actually wants to write to it.
+	// (If the block is copied, cached pointers to the shared block are
+	// flushed by GetWritableBlock.)
+	if (!writeAccess && blockNr < m_memoryBlocks.size() &&
+	    !m_memoryBlocks[blockNr].IsNULL() &&
+	    m_memoryBlocks[blockNr]->get_refcount() > 1) {
+		writable = false;
+		return (uint8_t*)m_memoryBlocks[blockNr]->data +
+		    offsetWithinBlock;
+	}
+
+	// Allocate the block, if necessary. Since blocks are anonymous
+	// mmap()ed memory, this does not use up host RAM until the block is
+	// actually touched.
+	void* block = GetWritableBlock(blockNr);
+
+	writable = !m_writeProtected;
+	return (uint8_t*)block + offsetWithinBlock;
+}
+
+
 /*****************************************************************************/
 
 
@@ -560,6 +811,48 @@ static void Test_RAMComponent_WriteProtect()
 	UnitTest::Assert("16-bit read", data16_a, 0x5678);
 }
 
+static void Test_RAMComponent_WriteProtectFlushesHostTLB()
+{
+	GXemul gxemul;
+	gxemul.GetCommandInterpreter().RunCommand("add testmips");
+
+	refcount_ptr<Component> cpu = gxemul.GetRootComponent()->LookupPath("root.machine0.mainbus0.cpu0");
+	refcount_ptr<Component> ram = gxemul.GetRootComponent()->LookupPath("root.machine0.mainbus0.ram0");
+	UnitTest::Assert("huh? no cpu or ram?", !cpu.IsNULL() && !ram.IsNULL());
+
+	AddressDataBus* bus = cpu->AsAddressDataBus();
+
+	uint32_t data32 = 0xafbd0010;	// sw sp,16(sp)
+	bus->AddressSelect(0xffffffff80004000ULL);
+	bus->WriteData(data32, BigEndian);
+
+	data32 = 0xafbd0014;		// sw sp,20(sp)
+	bus->AddressSelect(0xffffffff80004004ULL);
+	bus->WriteData(data32, BigEndian);
+
+	cpu->SetVariableValue("pc", "0xffffffff80004000");
+
+	// The first store makes the CPU cache the stack page as writable.
+	gxemul.SetRunState(GXemul::SingleStepping);
+	gxemul.Execute(1);
+
+	ram->SetVariableValue("writeProtect", "true");
+
+	gxemul.SetRunState(GXemul::SingleStepping);
+	gxemul.Execute(1);
+
+	AddressDataBus* ramBus = ram->AsAddressDataBus();
+	ramBus->AddressSelect(0x7f10);
+	ramBus->ReadData(data32, BigEndian);
+	UnitTest::Assert("first store should have succeeded",
+	    data32, 0xa0007f00);
+
+	ramBus->AddressSelect(0x7f14);
+	ramBus->ReadData(data32, BigEndian);
+	UnitTest::Assert("store to write protected RAM should have failed",
+	    data32, 0);
+}
+
 static void Test_RAMComponent_ClearOnReset()
 {
 	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
@@ -585,6 +878,7 @@ static void Test_RAMComponent_ClearOnReset()
 static void Test_RAMComponent_Clone()
 {
 	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
+	ram->SetVariableValue("memoryMappedSize", "0x100000");
 	AddressDataBus* bus = ram->AsAddressDataBus();
 
 	uint32_t data32 = 0x89abcdef;
@@ -611,6 +905,53 @@ static void Test_RAMComponent_Clone()
 	UnitTest::Assert("16-bit read", data16_a, 0x3412);
 }
 
+static void Test_RAMComponent_CopyOnWriteClone()
+{
+	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
+	AddressDataBus* bus = ram->AsAddressDataBus();
+
+	uint32_t data32 = 0x11111111;
+	bus->AddressSelect(0x100);
+	bus->WriteData(data32, BigEndian);
+
+	refcount_ptr<Component> clone = ram->Clone();
+	AddressDataBus* cloneBus = clone->AsAddressDataBus();
+
+	bool writable;
+	UnitTest::Assert("original and clone should have separate pages"
+	    " once looked up for writing",
+	    bus->LookupHostPage(0, 0x1000, true, writable) !=
+	    cloneBus->LookupHostPage(0, 0x1000, true, writable));
+
+	data32 = 0x22222222;
+	bus->AddressSelect(0x100);
+	bus->WriteData(data32, BigEndian);
+
+	data32 = 0x33333333;
+	cloneBus->AddressSelect(0x104);
+	cloneBus->WriteData(data32, BigEndian);
+
+	cloneBus->AddressSelect(0x100);
+	cloneBus->ReadData(data32, BigEndian);
+	UnitTest::Assert("clone should not see writes to the original",
+	    data32, 0x11111111);
+
+	bus->AddressSelect(0x104);
+	bus->ReadData(data32, BigEndian);
+	UnitTest::Assert("original should not see writes to the clone",
+	    data32, 0);
+
+	// A clone of the clone, which is then released, should not affect
+	// the clone.
+	{
+		refcount_ptr<Component> clone2 = clone->Clone();
+	}
+
+	cloneBus->AddressSelect(0x104);
+	cloneBus->ReadData(data32, BigEndian);
+	UnitTest::Assert("clone should be intact", data32, 0x33333333);
+}
+
 static void Test_RAMComponent_ManualSerialization()
 {
 	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
@@ -645,6 +986,209 @@ static void Test_RAMComponent_ManualSerialization()
 	UnitTest::Assert("16-bit read", data16_a, 0x3512);
 }
 
+static void Test_RAMComponent_BinarySerialization()
+{
+	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
+	ram->SetVariableValue("memoryMappedSize", "0x2000000");
+	AddressDataBus* bus = ram->AsAddressDataBus();
+
+	uint32_t data32 = 0x89abcde5;
+	bus->AddressSelect(4);
+	bus->WriteData(data32, BigEndian);
+
+	uint64_t data64 = ((uint64_t)0x01234567 << 32) | 0x89abcdef;
+	bus->AddressSelect(0x1234560);
+	bus->WriteData(data64, LittleEndian);
+
+	// Touch a page, but leave it all zeroes.
+	uint8_t data8 = 0;
+	bus->AddressSelect(0x802000);
+	bus->WriteData(data8, BigEndian);
+
+	stringstream ss;
+	ram->SerializeBinary(ss);
+
+	// Only two non-zero pages, i.e. much less than the 12 MB allocated.
+	UnitTest::Assert("binary form should be compact",
+	    ss.str().length() < 3 * 4096);
+
+	stringstream messages;
+	refcount_ptr<Component> ram2 = Component::DeserializeBinary(messages, ss);
+	UnitTest::Assert("deserialization failed?", !ram2.IsNULL());
+	bus = ram2->AsAddressDataBus();
+
+	data32 = 0x22222222;
+	bus->AddressSelect(4);
+	bus->ReadData(data32, LittleEndian);
+	UnitTest::Assert("32-bit read", data32, 0xe5cdab89);
+
+	data64 = 0;
+	bus->AddressSelect(0x1234560);
+	bus->ReadData(data64, LittleEndian);
+	UnitTest::Assert("64-bit read", data64,
+	    ((uint64_t)0x01234567 << 32) | 0x89abcdef);
+
+	data8 = 0xff;
+	bus->AddressSelect(0x802000);
+	bus->ReadData(data8, BigEndian);
+	UnitTest::Assert("zero page should still read as zero", data8, 0);
+
+	stringstream truncated(ss.str().substr(0, ss.str().length() - 4));
+	UnitTest::Assert("truncated stream should fail",
+	    Component::DeserializeBinary(messages, truncated).IsNULL());
+}
+
+static void Test_RAMComponent_BinarySerialization_OutOfRange()
+{
+	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
+	ram->SetVariableValue("memoryMappedSize", "0x2000000");
+	AddressDataBus* bus = ram->AsAddressDataBus();
+
+	uint32_t data32 = 0x12345678;
+	bus->AddressSelect(0x1fff000);
+	bus->WriteData(data32, BigEndian);
+
+	stringstream ss;
+	ram->SerializeBinary(ss);
+
+	// Shrink the stored RAM size, so that the page is out of range.
+	// (The size is stored as 64-bit little endian, after its name and
+	// type.)
+	string str = ss.str();
+	string sizeName = "memoryMappedSize";
+	size_t pos = str.find(sizeName);
+	UnitTest::Assert("size not found?", pos != string::npos);
+	pos += sizeName.length() + 1;
+	UnitTest::Assert("stored size", (uint8_t)str[pos+3], 0x02);
+	str[pos+3] = 0x01;
+
+	// The data is rejected, which fails the entire load.
+	stringstream modified(str);
+	stringstream messages;
+	UnitTest::Assert("deserialization should have failed",
+	    Component::DeserializeBinary(messages, modified).IsNULL());
+	UnitTest::Assert("the variable should have been reported",
+	    messages.str().find("'data'") != string::npos);
+}
+
+static void Test_RAMComponent_BinarySerialization_Rejected()
+{
+	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
+	ram->SetVariableValue("memoryMappedSize", "0x2000000");
+	AddressDataBus* bus = ram->AsAddressDataBus();
+
+	uint32_t data32 = 0x12345678;
+	bus->AddressSelect(0x1004);
+	bus->WriteData(data32, BigEndian);
+
+	// A value with one valid page at address 0, followed by a page
+	// which is outside of the RAM.
+	stringstream ss;
+	BinarySerialization::WriteUInt64(ss, 2 * (8 + 4 + 4096) + 8);
+	BinarySerialization::WriteUInt64(ss, 0);
+	BinarySerialization::WriteUInt32(ss, 4096);
+	ss << string(4096, '\x55');
+	BinarySerialization::WriteUInt64(ss, 0x40000000);
+	BinarySerialization::WriteUInt32(ss, 4096);
+	ss << string(4096, '\x55');
+	BinarySerialization::WriteUInt64(ss, (uint64_t) -1);
+
+	UnitTest::Assert("the value should have been rejected",
+	    !ram->GetVariable("data")->DeserializeBinaryValue(ss));
+
+	data32 = 0;
+	bus->AddressSelect(0x1004);
+	bus->ReadData(data32, BigEndian);
+	UnitTest::Assert("the old contents should have been kept",
+	    data32, 0x12345678);
+
+	data32 = 0;
+	bus->AddressSelect(0);
+	bus->ReadData(data32, BigEndian);
+	UnitTest::Assert("the valid page should not have been loaded",
+	    data32, 0);
+}
+
+static void Test_RAMComponent_LookupHostPage()
+{
+	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
+	AddressDataBus* bus = ram->AsAddressDataBus();
+
+	uint32_t data32 = 0x89abcdef;
+	bus->AddressSelect(0x1004);
+	bus->WriteData(data32, BigEndian);
+
+	bool writable = false;
+	uint8_t* page = bus->LookupHostPage(0x1000, 0x1000, true, writable);
+	UnitTest::Assert("lookup should succeed", page != NULL);
+	UnitTest::Assert("page should be writable", writable);
+	UnitTest::Assert("host page contents", page[5], 0xab);
+
+	page[7] = 0x42;
+	bus->ReadData(data32, BigEndian);
+	UnitTest::Assert("direct write should be visible", data32, 0x89abcd42);
+
+	UnitTest::Assert("pages crossing a block boundary can not be looked up",
+	    bus->LookupHostPage(0x3ff800, 0x1000, false, writable) == NULL);
+
+	ram->SetVariableValue("writeProtect", "true");
+	bus->LookupHostPage(0x1000, 0x1000, true, writable);
+	UnitTest::Assert("write protected page should not be writable",
+	    !writable);
+}
+
+static void Test_RAMComponent_ReadAfterSnapshotKeepsBlockShared()
+{
+	refcount_ptr<Component> mainbus =
+	    ComponentFactory::CreateComponent("mainbus");
+	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
+	mainbus->AddChild(ram);
+	ram->SetVariableValue("memoryMappedSize", "0x100000");
+
+	AddressDataBus* bus = mainbus->AsAddressDataBus();
+
+	uint32_t data32 = 0x11223344;
+	bus->AddressSelect(0x2000);
+	bus->WriteData(data32, BigEndian);
+
+	refcount_ptr<Component> snapshot = mainbus->Clone();
+	AddressDataBus* snapshotBus = snapshot->AsAddressDataBus();
+
+	// Read through the bus, both the slow way and via a host page.
+	data32 = 0;
+	bus->AddressSelect(0x2000);
+	bus->ReadData(data32, BigEndian);
+	UnitTest::Assert("read after snapshot", data32, 0x11223344);
+
+	bool writable = true;
+	uint8_t* page = bus->LookupHostPage(0x2000, 0x1000, false, writable);
+	UnitTest::Assert("read lookup should succeed", page != NULL);
+	UnitTest::Assert("shared page should not be writable", !writable);
+	UnitTest::Assert("host page contents", page[3], 0x44);
+
+	uint8_t* snapshotPage =
+	    snapshotBus->LookupHostPage(0x2000, 0x1000, false, writable);
+	UnitTest::Assert("reads should not unshare the block",
+	    page == snapshotPage);
+
+	// Only a write lookup should cause the block to be copied.
+	uint8_t* writablePage =
+	    bus->LookupHostPage(0x2000, 0x1000, true, writable);
+	UnitTest::Assert("write lookup should be writable", writable);
+	UnitTest::Assert("write lookup should unshare the block",
+	    writablePage != snapshotPage);
+	UnitTest::Assert("copied contents", writablePage[3], 0x44);
+
+	writablePage[3] = 0x55;
+	snapshotBus->AddressSelect(0x2000);
+	snapshotBus->ReadData(data32, BigEndian);
+	UnitTest::Assert("snapshot should be unaffected", data32, 0x11223344);
+
+	// The snapshot is now the only owner of the old block.
+	snapshotBus->LookupHostPage(0x2000, 0x1000, false, writable);
+	UnitTest::Assert("unshared block should be writable", writable);
+}
+
 static void Test_RAMComponent_Methods_Reexecutableness()
 {
 	refcount_ptr<Component> ram = ComponentFactory::CreateComponent("ram");
@@ -664,9 +1208,16 @@ UNITTESTS(RAMComponent)
 	UNITTEST(Test_RAMComponent_WriteThenRead);
 	UNITTEST(Test_RAMComponent_WriteThenRead_ReverseEndianness);
 	UNITTEST(Test_RAMComponent_WriteProtect);
+	UNITTEST(Test_RAMComponent_WriteProtectFlushesHostTLB);
 	UNITTEST(Test_RAMComponent_ClearOnReset);
 	UNITTEST(Test_RAMComponent_Clone);
+	UNITTEST(Test_RAMComponent_CopyOnWriteClone);
 	UNITTEST(Test_RAMComponent_ManualSerialization);
+	UNITTEST(Test_RAMComponent_BinarySerialization);
+	UNITTEST(Test_RAMComponent_BinarySerialization_OutOfRange);
+	UNITTEST(Test_RAMComponent_BinarySerialization_Rejected);
+	UNITTEST(Test_RAMComponent_LookupHostPage);
+	UNITTEST(Test_RAMComponent_ReadAfterSnapshotKeepsBlockShared);
 	UNITTEST(Test_RAMComponent_Methods_Reexecutableness);
 }
 
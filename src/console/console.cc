@@ -50,6 +50,19 @@
  *
  *  xterms are opened up "on demand", when output is sent to them.
  *
+ *  Instead of xterms, slave consoles can be made available as sockets (the
+ *  -L command line option), either on consecutive TCP ports on the loopback
+ *  interface, or as UNIX domain sockets. One client at a time may connect
+ *  to each console; output while no client is connected is discarded.
+ *
+ *  Output to slaves is buffered per handle, and written out on newlines,
+ *  when the buffer is full, or when console_flush() is called. Input is
+ *  not polled separately for each handle and read attempt. Instead,
+ *  console_poll() checks all input descriptors with a single poll() call,
+ *  and remembers which ones have data; console_charavail() only calls
+ *  read() on those. The emulator's main loop calls console_flush() and
+ *  console_poll() at regular intervals.
+ *
  *  The MAIN console handle (fixed as handle nr 0) is the one used by the
  *  default terminal window. A machine which registers a serial controller,
  *  which should be used as the main way of communicating with guest operating
@@ -67,8 +80,14 @@
 #include <string.h>
 #include <termios.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <sys/select.h>
+#include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
 #include <time.h>
 
 #include "console.h"
@@ -94,6 +113,21 @@ static struct settings *console_settings = NULL;
 static int console_stdout_pending;
 
 #define	CONSOLE_FIFO_LEN	4096
+#define	CONSOLE_OUTBUF_LEN	1024
+
+/*
+ *  If console_charavail() is called this many times without any call to
+ *  console_poll() in between, then it polls by itself. (This keeps code
+ *  which busy-waits for input outside of the main loop working.)
+ */
+#define	CONSOLE_POLL_FALLBACK	10000
+
+static int console_stdin_ready = 0;
+static int console_charavail_calls = 0;
+
+/*  For -L: a TCP port number, or a UNIX domain socket path prefix.  */
+static char *console_socket_spec = NULL;
+static int console_n_sockets = 0;
 
 static int console_mouse_x;		/*  absolute x, 0-based  */
 static int console_mouse_y;		/*  absolute y, 0-based  */
@@ -116,16 +150,29 @@ struct console_handle {
 
 	int		w_descriptor;
 	int		r_descriptor;
+	int		input_ready;
+
+	/*  For slaves using sockets instead of xterms:  */
+	int		using_socket;
+	int		listen_descriptor;
+	char		*socket_name;
 
 	unsigned char	fifo[CONSOLE_FIFO_LEN];
 	int		fifo_head;
 	int		fifo_tail;
+
+	unsigned char	outbuf[CONSOLE_OUTBUF_LEN];
+	int		outbuf_len;
 };
 
 #define	NOT_USING_XTERM				0
 #define	USING_XTERM_BUT_NOT_YET_OPEN		1
 #define	USING_XTERM				2
 
+#define	NOT_USING_SOCKET			0
+#define	USING_SOCKET_NOT_CONNECTED		1
+#define	USING_SOCKET				2
+
 /*  A simple array of console_handles  */
 static struct console_handle *console_handles = NULL;
 static int n_console_handles = 0;
@@ -141,8 +188,20 @@ void console_deinit_main(void)
 	if (!console_initialized)
 		return;
 
+	console_flush();
+
 	tcsetattr(STDIN_FILENO, TCSANOW, &console_oldtermios);
 
+	/*  Remove any UNIX domain sockets:  */
+	if (console_socket_spec != NULL &&
+	    !(console_socket_spec[0] >= '0' && console_socket_spec[0] <= '9')) {
+		int i;
+		for (i=0; i<n_console_handles; i++)
+			if (console_handles[i].in_use &&
+			    console_handles[i].using_socket)
+				unlink(console_handles[i].socket_name);
+	}
+
 	console_initialized = 0;
 }
 
@@ -269,6 +328,114 @@ static void start_xterm(int handle)
 }
 
 
+/*
+ *  start_socket():
+ *
+ *  Used instead of start_xterm() when console_socket_spec is set (the -L
+ *  command line option). Creates a listening socket for the console handle,
+ *  either on the next free TCP port on the loopback interface, or as a
+ *  UNIX domain socket. Clients are accepted by console_poll().
+ */
+static void start_socket(int handle)
+{
+	struct console_handle *chp = &console_handles[handle];
+	const char *spec = console_socket_spec;
+	size_t mlen = strlen(spec) + 30;
+	int d, one = 1;
+
+	CHECK_ALLOCATION(chp->socket_name = (char *) malloc(mlen));
+
+	if (spec[0] >= '0' && spec[0] <= '9') {
+		struct sockaddr_in sin;
+		int port = atoi(spec) + console_n_sockets;
+
+		d = socket(AF_INET, SOCK_STREAM, 0);
+		if (d < 0) {
+			perror("start_socket(): socket");
+			exit(1);
+		}
+
+		setsockopt(d, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+		memset(&sin, 0, sizeof(sin));
+		sin.sin_family = AF_INET;
+		sin.sin_port = htons(port);
+		sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+		if (bind(d, (struct sockaddr *) &sin, sizeof(sin)) < 0) {
+			fprintf(stderr, "start_socket(): could not bind to "
+			    "port %i: %s\n", port, strerror(errno));
+			exit(1);
+		}
+
+		snprintf(chp->socket_name, mlen, "127.0.0.1:%i", port);
+	} else {
+		struct sockaddr_un sunaddr;
+
+		snprintf(chp->socket_name, mlen, "%s.%i", spec,
+		    console_n_sockets);
+
+		memset(&sunaddr, 0, sizeof(sunaddr));
+		sunaddr.sun_family = AF_UNIX;
+		if (strlen(chp->socket_name) >= sizeof(sunaddr.sun_path)) {
+			fprintf(stderr, "start_socket(): socket path too "
+			    "long: %s\n", chp->socket_name);
+			exit(1);
+		}
+		strlcpy(sunaddr.sun_path, chp->socket_name,
+		    sizeof(sunaddr.sun_path));
+
+		d = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (d < 0) {
+			perror("start_socket(): socket");
+			exit(1);
+		}
+
+		unlink(chp->socket_name);
+		if (bind(d, (struct sockaddr *) &sunaddr, sizeof(sunaddr)) < 0) {
+			fprintf(stderr, "start_socket(): could not bind to "
+			    "%s: %s\n", chp->socket_name, strerror(errno));
+			exit(1);
+		}
+	}
+
+	if (listen(d, 1) < 0) {
+		perror("start_socket(): listen");
+		exit(1);
+	}
+
+	fcntl(d, F_SETFL, fcntl(d, F_GETFL) | O_NONBLOCK);
+
+	console_n_sockets ++;
+
+	chp->listen_descriptor = d;
+	chp->using_socket = USING_SOCKET_NOT_CONNECTED;
+
+	fatal("[ console \"%s %s\": listening on %s ]\n",
+	    chp->machine_name, chp->name, chp->socket_name);
+}
+
+
+/*
+ *  socket_disconnect():
+ *
+ *  Closes the connection to a socket console's client (if any), and starts
+ *  accepting a new client.
+ */
+static void socket_disconnect(int handle)
+{
+	struct console_handle *chp = &console_handles[handle];
+
+	if (chp->using_socket == USING_SOCKET)
+		close(chp->r_descriptor);
+
+	chp->using_socket = USING_SOCKET_NOT_CONNECTED;
+	chp->r_descriptor = chp->w_descriptor = -1;
+	chp->input_ready = 0;
+	chp->outbuf_len = 0;
+}
+
+
 /*
  *  d_avail():
  *
@@ -309,8 +476,8 @@ void console_makeavail(int handle, char ch)
 /*
  *  console_stdin_avail():
  *
- *  Returns 1 if a char is available from a handle's read descriptor,
- *  0 otherwise.
+ *  Returns 1 if the last console_poll() found a char to be available from
+ *  a handle's read descriptor (and it has not been read yet), 0 otherwise.
  */
 static int console_stdin_avail(int handle)
 {
@@ -318,13 +485,139 @@ static int console_stdin_avail(int handle)
 		return 0;
 
 	if (!allow_slaves)
-		return d_avail(STDIN_FILENO);
+		return console_stdin_ready;
 
 	if (console_handles[handle].using_xterm ==
-	    USING_XTERM_BUT_NOT_YET_OPEN)
+	    USING_XTERM_BUT_NOT_YET_OPEN ||
+	    console_handles[handle].using_socket ==
+	    USING_SOCKET_NOT_CONNECTED)
 		return 0;
 
-	return d_avail(console_handles[handle].r_descriptor);
+	return console_handles[handle].input_ready;
+}
+
+
+/*
+ *  console_flush_handle():
+ *
+ *  Writes out a handle's buffered output.
+ */
+static void console_flush_handle(int handle)
+{
+	struct console_handle *chp = &console_handles[handle];
+	unsigned char *p = chp->outbuf;
+	int len = chp->outbuf_len;
+
+	chp->outbuf_len = 0;
+
+	while (len > 0) {
+		ssize_t res = write(chp->w_descriptor, p, len);
+		if (res <= 0) {
+			if (res < 0 && errno == EINTR)
+				continue;
+			if (chp->using_socket)
+				socket_disconnect(handle);
+			else
+				perror("error writing to console handle");
+			return;
+		}
+
+		p += res;
+		len -= res;
+	}
+}
+
+
+/*
+ *  console_poll(), console_poll_wait():
+ *
+ *  Checks all console input descriptors (stdin, slave xterms, and sockets)
+ *  using a single poll() call, and remembers which of them have data
+ *  available. New clients are accepted on listening sockets.
+ *
+ *  console_poll_wait() blocks for at most timeout_ms milliseconds, until
+ *  input is available or a signal (e.g. the timer's SIGALRM) arrives. It is
+ *  used to let the host sleep while all emulated cpus are idle.
+ */
+void console_poll(void)
+{
+	console_poll_wait(0);
+}
+
+
+void console_poll_wait(int timeout_ms)
+{
+	struct pollfd *fds;
+	int *handles;
+	int i, n = 0, res;
+
+	console_charavail_calls = 0;
+
+	CHECK_ALLOCATION(fds = (struct pollfd *) malloc(
+	    sizeof(struct pollfd) * (n_console_handles + 1)));
+	CHECK_ALLOCATION(handles = (int *) malloc(
+	    sizeof(int) * (n_console_handles + 1)));
+
+	if (!allow_slaves) {
+		fds[n].fd = STDIN_FILENO;
+		handles[n++] = -1;
+	} else {
+		for (i=0; i<n_console_handles; i++) {
+			struct console_handle *chp = &console_handles[i];
+
+			if (!chp->in_use)
+				continue;
+
+			if (chp->using_socket == USING_SOCKET_NOT_CONNECTED)
+				fds[n].fd = chp->listen_descriptor;
+			else if (chp->in_use_for_input &&
+			    chp->using_xterm != USING_XTERM_BUT_NOT_YET_OPEN)
+				fds[n].fd = chp->r_descriptor;
+			else
+				continue;
+
+			handles[n++] = i;
+		}
+	}
+
+	for (i=0; i<n; i++) {
+		fds[i].events = POLLIN;
+		fds[i].revents = 0;
+	}
+
+	res = poll(fds, n, timeout_ms);
+
+	for (i=0; res > 0 && i<n; i++) {
+		struct console_handle *chp;
+		int d;
+
+		if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+			continue;
+
+		if (handles[i] < 0) {
+			console_stdin_ready = 1;
+			continue;
+		}
+
+		chp = &console_handles[handles[i]];
+
+		if (chp->using_socket != USING_SOCKET_NOT_CONNECTED) {
+			chp->input_ready = 1;
+			continue;
+		}
+
+		/*  A new client connected to a socket console:  */
+		d = accept(chp->listen_descriptor, NULL, NULL);
+		if (d < 0)
+			continue;
+
+		chp->r_descriptor = chp->w_descriptor = d;
+		chp->using_socket = USING_SOCKET;
+		chp->input_ready = 0;
+	}
+
+	free(handles);
+	free(fds);
 }
 
 
@@ -335,18 +628,36 @@ static int console_stdin_avail(int handle)
  */
 int console_charavail(int handle)
 {
-	while (console_stdin_avail(handle)) {
-		unsigned char ch[100];		/* = getchar(); */
+	if (++ console_charavail_calls >= CONSOLE_POLL_FALLBACK)
+		console_poll();
+
+	if (console_stdin_avail(handle)) {
+		unsigned char ch[256];		/* = getchar(); */
 		ssize_t len;
 		int i, d;
 
-		if (!allow_slaves)
+		if (!allow_slaves) {
 			d = STDIN_FILENO;
-		else
+			console_stdin_ready = 0;
+		} else {
 			d = console_handles[handle].r_descriptor;
+			console_handles[handle].input_ready = 0;
+		}
 
 		len = read(d, ch, sizeof(ch));
 
+		/*  There may be more to read, if the buffer was filled:  */
+		if (len == sizeof(ch)) {
+			if (!allow_slaves)
+				console_stdin_ready = 1;
+			else
+				console_handles[handle].input_ready = 1;
+		}
+
+		/*  The client of a socket console went away:  */
+		if (len <= 0 && console_handles[handle].using_socket)
+			socket_disconnect(handle);
+
 		for (i=0; i<len; i++) {
 			/*  printf("[ %i: %i ]\n", i, ch[i]);  */
 
@@ -393,11 +704,10 @@ int console_readchar(int handle)
  *  console_putchar():
  *
  *  Prints a char to stdout, and sets the console_stdout_pending flag.
+ *  When using slaves, the char is added to the handle's output buffer.
  */
 void console_putchar(int handle, int ch)
 {
-	char buf[1];
-
 	if (!console_handles[handle].in_use_for_input &&
 	    !console_handles[handle].outputonly)
 		console_change_inputability(handle, 1);
@@ -425,9 +735,16 @@ void console_putchar(int handle, int ch)
 	    USING_XTERM_BUT_NOT_YET_OPEN)
 		start_xterm(handle);
 
-	buf[0] = ch;
-	if (write(console_handles[handle].w_descriptor, buf, 1) != 1)
-		perror("error writing to console handle");
+	/*  Output to a socket with no client connected is discarded:  */
+	if (console_handles[handle].using_socket == USING_SOCKET_NOT_CONNECTED)
+		return;
+
+	console_handles[handle].outbuf[console_handles[handle].outbuf_len++]
+	    = ch;
+
+	if (ch == '\n' || console_handles[handle].outbuf_len >=
+	    CONSOLE_OUTBUF_LEN)
+		console_flush_handle(handle);
 }
 
 
@@ -435,13 +752,21 @@ void console_putchar(int handle, int ch)
  *  console_flush():
  *
  *  Flushes stdout, if necessary, and resets console_stdout_pending to zero.
+ *  Buffered output to slaves is also written out.
  */
 void console_flush(void)
 {
+	int i;
+
 	if (console_stdout_pending)
 		fflush(stdout);
 
 	console_stdout_pending = 0;
+
+	for (i=0; i<n_console_handles; i++)
+		if (console_handles[i].in_use &&
+		    console_handles[i].outbuf_len > 0)
+			console_flush_handle(i);
 }
 
 
@@ -684,7 +1009,9 @@ int console_start_slave(struct machine *machine, const char *consolename,
 
 	CHECK_ALLOCATION(chp->name = strdup(consolename));
 
-	if (allow_slaves)
+	if (console_socket_spec != NULL)
+		start_socket(handle);
+	else if (allow_slaves)
 		chp->using_xterm = USING_XTERM_BUT_NOT_YET_OPEN;
 
 	return handle;
@@ -833,8 +1160,8 @@ void console_debug_dump(struct machine *machine)
 	if (verbose < 2)
 		return;
 
-	debug("console slaves (xterms): %s\n", allow_slaves?
-	    "yes" : "no");
+	debug("console slaves (%s): %s\n", console_socket_spec != NULL?
+	    "sockets" : "xterms", allow_slaves? "yes" : "no");
 
 	debug("console handles:\n");
 	debug_indentation(iadd);
@@ -845,6 +1172,8 @@ void console_debug_dump(struct machine *machine)
 		debug("%i: \"%s\"", i, console_handles[i].name);
 		if (console_handles[i].using_xterm)
 			debug(" [xterm]");
+		if (console_handles[i].using_socket)
+			debug(" [%s]", console_handles[i].socket_name);
 		if (console_handles[i].inputonly)
 			debug(" [inputonly]");
 		if (console_handles[i].outputonly)
@@ -875,6 +1204,24 @@ void console_allow_slaves(int allow)
 }
 
 
+/*
+ *  console_use_sockets():
+ *
+ *  Makes slave consoles available as sockets, instead of opening up xterms.
+ *  spec is either a TCP port number (the first console uses that port on
+ *  the loopback interface, the next console uses the port after that, and
+ *  so on), or a path prefix for UNIX domain sockets (path.0, path.1, ...).
+ */
+void console_use_sockets(const char *spec)
+{
+	CHECK_ALLOCATION(console_socket_spec = strdup(spec));
+	allow_slaves = 1;
+
+	/*  Writing to a socket whose client went away should not be fatal:  */
+	signal(SIGPIPE, SIG_IGN);
+}
+
+
 /*
  *  console_are_slaves_allowed():
  *
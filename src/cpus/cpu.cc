@@ -40,6 +40,8 @@
 #include "settings.h"
 #include "timer.h"
 
+#include "thirdparty/ppc_spr.h"
+
 
 extern size_t dyntrans_cache_size;
 
@@ -220,7 +222,7 @@ void cpu_functioncall_trace(struct cpu *cpu, uint64_t f)
 {
 	int show_symbolic_function_name = 1;
 	int i, n_args = -1;
-	char *symbol;
+	char *symbol, symbuf[100];
 	uint64_t offset;
 
 	/*  Special hack for M88K userspace:  */
@@ -239,8 +241,8 @@ void cpu_functioncall_trace(struct cpu *cpu, uint64_t f)
 	cpu->trace_tree_depth ++;
 
 	fatal("<");
-	symbol = get_symbol_name_and_n_args(&cpu->machine->symbol_context,
-	    f, &offset, &n_args);
+	symbol = get_symbol_name_and_n_args_r(&cpu->machine->symbol_context,
+	    f, &offset, &n_args, symbuf, sizeof(symbuf));
 	if (symbol != NULL && show_symbolic_function_name)
 		fatal("%s", symbol);
 	else {
@@ -280,6 +282,72 @@ void cpu_functioncall_trace_return(struct cpu *cpu)
 }
 
 
+/*
+ *  cpu_profile_sample():
+ *
+ *  Called (from the dyntrans run loop) when the profile countdown has
+ *  expired. Records the current program counter, and if return addresses
+ *  are also wanted, the contents of the link register (or equivalent).
+ *  Only a single level is recorded; walking the guest's stack frames is
+ *  too ABI dependant to do reliably.
+ */
+void cpu_profile_sample(struct cpu *cpu)
+{
+	struct profile *p = &cpu->machine->profile;
+	uint64_t values[2];
+
+	p->countdown = p->interval;
+
+	values[0] = cpu->pc;
+	values[1] = 0;
+
+	if (p->callers) {
+		switch (cpu->machine->arch) {
+		case ARCH_ARM:
+			values[1] = cpu->cd.arm.r[ARM_LR];
+			break;
+		case ARCH_M88K:
+			values[1] = cpu->cd.m88k.r[M88K_RETURN_REG];
+			break;
+		case ARCH_MIPS:
+			values[1] = cpu->cd.mips.gpr[MIPS_GPR_RA];
+			break;
+		case ARCH_PPC:
+			values[1] = cpu->cd.ppc.spr[SPR_LR];
+			break;
+		case ARCH_SH:
+			values[1] = cpu->cd.sh.pr;
+			break;
+		}
+	}
+
+	machine_profile_add(cpu->machine, values);
+}
+
+
+/*
+ *  cpu_idle():
+ *
+ *  Called from the instruction implementations of architectural wait
+ *  states (MIPS wait, SH sleep, ARM wait-for-interrupt, PowerPC MSR[POW],
+ *  and known guest OS idle loops), when no interrupt is pending.
+ *
+ *  The rest of the current run is skipped in one go: it is accounted for
+ *  as executed instructions, so that instruction driven clocks (and the
+ *  emulated time in deterministic mode) keep advancing at the same rate
+ *  as when the cpu is busy. When all cpus in all machines are idle, the
+ *  main loop lets the host sleep until the next timer deadline.
+ */
+void cpu_idle(struct cpu *cpu)
+{
+	cpu->is_idle = 1;
+	cpu->has_been_idling = 1;
+
+	if (cpu->n_translated_instrs < N_SAFE_DYNTRANS_LIMIT)
+		cpu->n_translated_instrs = N_SAFE_DYNTRANS_LIMIT;
+}
+
+
 /*
  *  cpu_create_or_reset_tc():
  *
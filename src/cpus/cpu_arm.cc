@@ -165,7 +165,7 @@ int arm_cpu_new(struct cpu *cpu, struct memory *mem,
 		store_32bit_word(cpu, cpu->cd.arm.of_emul_addr, 0xef8c64be);
 	}
 
-	cpu->cd.arm.flags = cpu->cd.arm.cpsr >> 28;
+	ARM_FLAGS(cpu) = cpu->cd.arm.cpsr >> 28;
 
 	CPU_SETTINGS_ADD_REGISTER64("pc", cpu->pc);
 	for (i=0; i<N_ARM_REGS - 1; i++)
@@ -338,7 +338,7 @@ void arm_cpu_register_dump(struct cpu *cpu, int gprs, int coprocs)
 	int i, x = cpu->cpu_id;
 
 	cpu->cd.arm.cpsr &= 0x0fffffff;
-	cpu->cd.arm.cpsr |= (cpu->cd.arm.flags << 28);
+	cpu->cd.arm.cpsr |= (ARM_FLAGS(cpu) << 28);
 
 	if (gprs) {
 		symbol = get_symbol_name(&cpu->machine->symbol_context,
@@ -485,6 +485,52 @@ void arm_cpu_register_dump(struct cpu *cpu, int gprs, int coprocs)
 }
 
 
+/*
+ *  arm_materialize_flags():
+ *
+ *  Calculates the N, Z, C, and V flags from the operation recorded by the
+ *  last flag-setting data processing instruction, if any. (Use ARM_FLAGS(cpu)
+ *  instead of calling this function directly.)
+ *
+ *  Returns a pointer to the (now up to date) flags field.
+ */
+size_t *arm_materialize_flags(struct cpu *cpu)
+{
+	uint32_t a = cpu->cd.arm.lazy_flags_a, b = cpu->cd.arm.lazy_flags_b;
+	uint32_t result = cpu->cd.arm.lazy_flags_result;
+	size_t f = 0;
+
+	switch (cpu->cd.arm.lazy_flags_op) {
+	case ARM_LAZY_NONE:
+		return &cpu->cd.arm.flags;
+	case ARM_LAZY_LOGIC:
+		f = cpu->cd.arm.flags & (ARM_F_C | ARM_F_V);
+		break;
+	case ARM_LAZY_ADD:
+		if (result < a)
+			f |= ARM_F_C;
+		if ((a ^ result) & (b ^ result) & 0x80000000)
+			f |= ARM_F_V;
+		break;
+	case ARM_LAZY_SUB:
+		if (a >= b)
+			f |= ARM_F_C;
+		if ((a ^ b) & (a ^ result) & 0x80000000)
+			f |= ARM_F_V;
+		break;
+	}
+
+	if (result == 0)
+		f |= ARM_F_Z;
+	if (result & 0x80000000)
+		f |= ARM_F_N;
+
+	cpu->cd.arm.flags = f;
+	cpu->cd.arm.lazy_flags_op = ARM_LAZY_NONE;
+	return &cpu->cd.arm.flags;
+}
+
+
 /*
  *  arm_save_register_bank():
  */
@@ -594,6 +640,12 @@ void arm_exception(struct cpu *cpu, int exception_nr)
 
 	retaddr = cpu->pc;
 
+	/*  Interrupted wfi? Then return to the instruction after it.  */
+	if (cpu->is_halted) {
+		cpu->is_halted = 0;
+		retaddr += sizeof(uint32_t);
+	}
+
 	if (!quiet_mode) {
 		debug("[ arm_exception(): ");
 		switch (exception_nr) {
@@ -638,7 +690,7 @@ void arm_exception(struct cpu *cpu, int exception_nr)
 	arm_save_register_bank(cpu);
 
 	cpu->cd.arm.cpsr &= 0x0fffffff;
-	cpu->cd.arm.cpsr |= (cpu->cd.arm.flags << 28);
+	cpu->cd.arm.cpsr |= (ARM_FLAGS(cpu) << 28);
 
 	switch (arm_exception_to_mode[exception_nr]) {
 	case ARM_MODE_SVC32:
@@ -725,6 +777,7 @@ void arm_irq_interrupt_assert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.arm.irq_asserted = 1;
+	cpu->is_idle = 0;
 }
 void arm_irq_interrupt_deassert(struct interrupt *interrupt)
 {
@@ -131,59 +131,59 @@ uint8_t condition_gt[16] = { 1,0,1,0, 0,0,0,0, 0,1,0,1, 0,0,0,0 };
 
 #define Y(n) void arm_instr_ ## n ## __eq(struct cpu *cpu,		\
 			struct arm_instr_call *ic)			\
-	{  if (cpu->cd.arm.flags & ARM_F_Z)				\
+	{  if (ARM_FLAGS_Z(cpu))				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __ne(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (!(cpu->cd.arm.flags & ARM_F_Z))				\
+	{  if (!(ARM_FLAGS_Z(cpu)))				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __cs(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (cpu->cd.arm.flags & ARM_F_C)				\
+	{  if (ARM_FLAGS(cpu) & ARM_F_C)				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __cc(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (!(cpu->cd.arm.flags & ARM_F_C))				\
+	{  if (!(ARM_FLAGS(cpu) & ARM_F_C))				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __mi(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (cpu->cd.arm.flags & ARM_F_N)				\
+	{  if (ARM_FLAGS_N(cpu))				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __pl(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (!(cpu->cd.arm.flags & ARM_F_N))				\
+	{  if (!(ARM_FLAGS_N(cpu)))				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __vs(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (cpu->cd.arm.flags & ARM_F_V)				\
+	{  if (ARM_FLAGS(cpu) & ARM_F_V)				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __vc(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (!(cpu->cd.arm.flags & ARM_F_V))				\
+	{  if (!(ARM_FLAGS(cpu) & ARM_F_V))				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __hi(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (condition_hi[cpu->cd.arm.flags])				\
+	{  if (condition_hi[ARM_FLAGS(cpu)])				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __ls(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (!condition_hi[cpu->cd.arm.flags])			\
+	{  if (!condition_hi[ARM_FLAGS(cpu)])			\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __ge(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (condition_ge[cpu->cd.arm.flags])				\
+	{  if (condition_ge[ARM_FLAGS(cpu)])				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __lt(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (!condition_ge[cpu->cd.arm.flags])			\
+	{  if (!condition_ge[ARM_FLAGS(cpu)])			\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __gt(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (condition_gt[cpu->cd.arm.flags])				\
+	{  if (condition_gt[ARM_FLAGS(cpu)])				\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void arm_instr_ ## n ## __le(struct cpu *cpu,			\
 			struct arm_instr_call *ic)			\
-	{  if (!condition_gt[cpu->cd.arm.flags])			\
+	{  if (!condition_gt[ARM_FLAGS(cpu)])			\
 		arm_instr_ ## n (cpu, ic);		}		\
 	void (*arm_cond_instr_ ## n  [16])(struct cpu *,		\
 			struct arm_instr_call *) = {			\
@@ -258,62 +258,62 @@ X(b_samepage) {
 }
 X(b_samepage__eq) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[cpu->cd.arm.flags & ARM_F_Z? 0 : 1];
+	    ic->arg[ARM_FLAGS_Z(cpu)? 0 : 1];
 }
 X(b_samepage__ne) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[cpu->cd.arm.flags & ARM_F_Z? 1 : 0];
+	    ic->arg[ARM_FLAGS_Z(cpu)? 1 : 0];
 }
 X(b_samepage__cs) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[cpu->cd.arm.flags & ARM_F_C? 0 : 1];
+	    ic->arg[ARM_FLAGS(cpu) & ARM_F_C? 0 : 1];
 }
 X(b_samepage__cc) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[cpu->cd.arm.flags & ARM_F_C? 1 : 0];
+	    ic->arg[ARM_FLAGS(cpu) & ARM_F_C? 1 : 0];
 }
 X(b_samepage__mi) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[cpu->cd.arm.flags & ARM_F_N? 0 : 1];
+	    ic->arg[ARM_FLAGS_N(cpu)? 0 : 1];
 }
 X(b_samepage__pl) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[cpu->cd.arm.flags & ARM_F_N? 1 : 0];
+	    ic->arg[ARM_FLAGS_N(cpu)? 1 : 0];
 }
 X(b_samepage__vs) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[cpu->cd.arm.flags & ARM_F_V? 0 : 1];
+	    ic->arg[ARM_FLAGS(cpu) & ARM_F_V? 0 : 1];
 }
 X(b_samepage__vc) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[cpu->cd.arm.flags & ARM_F_V? 1 : 0];
+	    ic->arg[ARM_FLAGS(cpu) & ARM_F_V? 1 : 0];
 }
 X(b_samepage__hi) {
-	cpu->cd.arm.next_ic = (condition_hi[cpu->cd.arm.flags])?
+	cpu->cd.arm.next_ic = (condition_hi[ARM_FLAGS(cpu)])?
 	    (struct arm_instr_call *) ic->arg[0] :
 	    (struct arm_instr_call *) ic->arg[1];
 }
 X(b_samepage__ls) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[condition_hi[cpu->cd.arm.flags]];
+	    ic->arg[condition_hi[ARM_FLAGS(cpu)]];
 }
 X(b_samepage__ge) {
-	cpu->cd.arm.next_ic = (condition_ge[cpu->cd.arm.flags])?
+	cpu->cd.arm.next_ic = (condition_ge[ARM_FLAGS(cpu)])?
 	    (struct arm_instr_call *) ic->arg[0] :
 	    (struct arm_instr_call *) ic->arg[1];
 }
 X(b_samepage__lt) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[condition_ge[cpu->cd.arm.flags]];
+	    ic->arg[condition_ge[ARM_FLAGS(cpu)]];
 }
 X(b_samepage__gt) {
-	cpu->cd.arm.next_ic = (condition_gt[cpu->cd.arm.flags])?
+	cpu->cd.arm.next_ic = (condition_gt[ARM_FLAGS(cpu)])?
 	    (struct arm_instr_call *) ic->arg[0] :
 	    (struct arm_instr_call *) ic->arg[1];
 }
 X(b_samepage__le) {
 	cpu->cd.arm.next_ic = (struct arm_instr_call *)
-	    ic->arg[condition_gt[cpu->cd.arm.flags]];
+	    ic->arg[condition_gt[ARM_FLAGS(cpu)]];
 }
 void (*arm_cond_instr_b_samepage[16])(struct cpu *,
 	struct arm_instr_call *) = {
@@ -517,11 +517,11 @@ X(muls)
 {
 	uint32_t result;
 	result = reg(ic->arg[1]) * reg(ic->arg[2]);
-	cpu->cd.arm.flags &= ~(ARM_F_Z | ARM_F_N);
+	ARM_FLAGS(cpu) &= ~(ARM_F_Z | ARM_F_N);
 	if (result == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (result & 0x80000000)
-		cpu->cd.arm.flags |= ARM_F_N;
+		ARM_FLAGS(cpu) |= ARM_F_N;
 	reg(ic->arg[0]) = result;
 }
 Y(muls)
@@ -552,11 +552,11 @@ X(mlas)
 	rs = (iw >> 8) & 15;  rm = iw & 15;
 	cpu->cd.arm.r[rd] = cpu->cd.arm.r[rm] * cpu->cd.arm.r[rs]
 	    + cpu->cd.arm.r[rn];
-	cpu->cd.arm.flags &= ~(ARM_F_Z | ARM_F_N);
+	ARM_FLAGS(cpu) &= ~(ARM_F_Z | ARM_F_N);
 	if (cpu->cd.arm.r[rd] == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (cpu->cd.arm.r[rd] & 0x80000000)
-		cpu->cd.arm.flags |= ARM_F_N;
+		ARM_FLAGS(cpu) |= ARM_F_N;
 }
 Y(mlas)
 
@@ -710,7 +710,7 @@ X(msr_imm)
 	uint32_t new_value = ic->arg[0];
 
 	cpu->cd.arm.cpsr &= 0x0fffffff;
-	cpu->cd.arm.cpsr |= (cpu->cd.arm.flags << 28);
+	cpu->cd.arm.cpsr |= (ARM_FLAGS(cpu) << 28);
 
 	if (switch_register_banks)
 		arm_save_register_bank(cpu);
@@ -718,7 +718,7 @@ X(msr_imm)
 	cpu->cd.arm.cpsr &= ~mask;
 	cpu->cd.arm.cpsr |= (new_value & mask);
 
-	cpu->cd.arm.flags = cpu->cd.arm.cpsr >> 28;
+	ARM_FLAGS(cpu) = cpu->cd.arm.cpsr >> 28;
 
 	if (switch_register_banks)
 		arm_load_register_bank(cpu);
@@ -786,7 +786,7 @@ Y(msr_spsr)
 X(mrs)
 {
 	cpu->cd.arm.cpsr &= 0x0fffffff;
-	cpu->cd.arm.cpsr |= (cpu->cd.arm.flags << 28);
+	cpu->cd.arm.cpsr |= (ARM_FLAGS(cpu) << 28);
 	reg(ic->arg[0]) = cpu->cd.arm.cpsr;
 }
 Y(mrs)
@@ -839,6 +839,32 @@ X(cdp) {
 Y(cdp)
 
 
+/*
+ *  wfi:  Wait for interrupt  (mcr p15,0,rd,c7,c0,4)
+ *
+ *  If no interrupt is asserted, the instruction is re-run later. is_halted
+ *  makes arm_exception() return to the instruction following the wfi.
+ */
+X(wfi) {
+	uint32_t low_pc;
+
+	if (cpu->cd.arm.irq_asserted) {
+		cpu->is_halted = 0;
+		return;
+	}
+
+	low_pc = ((size_t)ic - (size_t)
+	    cpu->cd.arm.cur_ic_page) / sizeof(struct arm_instr_call);
+	cpu->pc &= ~((ARM_IC_ENTRIES_PER_PAGE-1) << ARM_INSTR_ALIGNMENT_SHIFT);
+	cpu->pc += (low_pc << ARM_INSTR_ALIGNMENT_SHIFT);
+
+	cpu->is_halted = 1;
+	cpu_idle(cpu);
+	cpu->cd.arm.next_ic = &nothing_call;
+}
+Y(wfi)
+
+
 /*
  *  openfirmware:
  */
@@ -1172,7 +1198,7 @@ X(bdt_load)
 			arm_save_register_bank(cpu);
 
 		cpu->cd.arm.cpsr = new_cpsr;
-		cpu->cd.arm.flags = cpu->cd.arm.cpsr >> 28;
+		ARM_FLAGS(cpu) = cpu->cd.arm.cpsr >> 28;
 
 		if (switch_register_banks)
 			arm_load_register_bank(cpu);
@@ -1341,8 +1367,8 @@ X(netbsd_memset)
 
 		instr(subs)(cpu, ic);
 
-		if (((cpu->cd.arm.flags & ARM_F_N)?1:0) !=
-		    ((cpu->cd.arm.flags & ARM_F_V)?1:0)) {
+		if (((ARM_FLAGS_N(cpu))?1:0) !=
+		    ((ARM_FLAGS(cpu) & ARM_F_V)?1:0)) {
 			cpu->n_translated_instrs += 16;
 			/*  Skip the store multiples:  */
 			cpu->cd.arm.next_ic = &ic[17];
@@ -1371,9 +1397,9 @@ X(netbsd_memset)
 
 		/*  Branch back if greater:  */
 		cpu->n_translated_instrs += 1;
-	} while (((cpu->cd.arm.flags & ARM_F_N)?1:0) ==
-	    ((cpu->cd.arm.flags & ARM_F_V)?1:0) &&
-	    !(cpu->cd.arm.flags & ARM_F_Z));
+	} while (((ARM_FLAGS_N(cpu))?1:0) ==
+	    ((ARM_FLAGS(cpu) & ARM_F_V)?1:0) &&
+	    !(ARM_FLAGS_Z(cpu)));
 
 	/*  Continue at the instruction after the bgt:  */
 	cpu->cd.arm.next_ic = &ic[18];
@@ -1431,8 +1457,8 @@ X(netbsd_memcpy)
 
 		/*  Loop while greater or equal:  */
 		cpu->n_translated_instrs ++;
-	} while (((cpu->cd.arm.flags & ARM_F_N)?1:0) ==
-	    ((cpu->cd.arm.flags & ARM_F_V)?1:0));
+	} while (((ARM_FLAGS_N(cpu))?1:0) ==
+	    ((ARM_FLAGS(cpu) & ARM_F_V)?1:0));
 
 	/*  Continue at the instruction after the bge:  */
 	cpu->cd.arm.next_ic = &ic[6];
@@ -1507,9 +1533,9 @@ X(netbsd_scanc)
 	cpu->cd.arm.r[3] = page[t & 0xfff];
 
 	t = cpu->cd.arm.r[3] & cpu->cd.arm.r[ARM_IP];
-	cpu->cd.arm.flags &= ~(ARM_F_Z | ARM_F_N);
+	ARM_FLAGS(cpu) &= ~(ARM_F_Z | ARM_F_N);
 	if (t == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 
 	cpu->n_translated_instrs += 2;
 	cpu->cd.arm.next_ic = &ic[3];
@@ -1551,8 +1577,6 @@ X(netbsd_idle)
 	}
 
 	if (rZ == 0) {
-		static int x = 0;
-
 		/*  Synch the program counter.  */
 		uint32_t low_pc = ((size_t)ic - (size_t)
 		    cpu->cd.arm.cur_ic_page) / sizeof(struct arm_instr_call);
@@ -1561,13 +1585,7 @@ X(netbsd_idle)
 		cpu->pc += (low_pc << ARM_INSTR_ALIGNMENT_SHIFT);
 
 		/*  Quasi-idle for a while:  */
-		cpu->has_been_idling = 1;
-	        if (cpu->machine->ncpus == 1 && (++x) == 100) {
-			usleep(50);
-			x = 0;
-		}
-
-		cpu->n_translated_instrs += N_SAFE_DYNTRANS_LIMIT / 6;
+		cpu_idle(cpu);
 		cpu->cd.arm.next_ic = &nothing_call;
 		return;
 	}
@@ -1603,9 +1621,9 @@ X(strlen)
 		n_loops ++;
 
 		/*  Compare rY to zero:  */
-		cpu->cd.arm.flags = ARM_F_C;
+		ARM_FLAGS(cpu) = ARM_F_C;
 		if (rY == 0)
-			cpu->cd.arm.flags |= ARM_F_Z;
+			ARM_FLAGS(cpu) |= ARM_F_Z;
 	} while (rY != 0);
 
 	cpu->n_translated_instrs += (n_loops * 3) - 1;
@@ -1708,10 +1726,10 @@ X(cmps0_beq_samepage)
 	uint32_t a = reg(ic->arg[0]);
 	cpu->n_translated_instrs ++;
 	if (a == 0) {
-		cpu->cd.arm.flags = ARM_F_Z | ARM_F_C;
+		ARM_FLAGS(cpu) = ARM_F_Z | ARM_F_C;
 	} else {
 		/*  Semi-ugly hack which sets the negative-bit if a < 0:  */
-		cpu->cd.arm.flags = ARM_F_C | ((a >> 28) & 8);
+		ARM_FLAGS(cpu) = ARM_F_C | ((a >> 28) & 8);
 	}
 	if (a == 0)
 		cpu->cd.arm.next_ic = (struct arm_instr_call *) ic[1].arg[0];
@@ -1727,17 +1745,17 @@ X(cmps_beq_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if (((int32_t)a >= 0 && (int32_t)b < 0 && (int32_t)c < 0) ||
 	    ((int32_t)a < 0 && (int32_t)b >= 0 && (int32_t)c >= 0))
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if (c == 0) {
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 		cpu->cd.arm.next_ic = (struct arm_instr_call *) ic[1].arg[0];
 	} else {
 		cpu->cd.arm.next_ic = &ic[2];
 		if (c & 0x80000000)
-			cpu->cd.arm.flags |= ARM_F_N;
+			ARM_FLAGS(cpu) |= ARM_F_N;
 	}
 }
 
@@ -1750,13 +1768,13 @@ X(cmps_0_beq)
 	uint32_t a = reg(ic->arg[0]);
 	cpu->n_translated_instrs ++;
 	if (a == 0) {
-		cpu->cd.arm.flags = ARM_F_Z | ARM_F_C;
+		ARM_FLAGS(cpu) = ARM_F_Z | ARM_F_C;
 		cpu->pc = (uint32_t)(((uint32_t)cpu->pc & 0xfffff000)
 		    + (int32_t)ic[1].arg[0]);
 		quick_pc_to_pointers(cpu);
 	} else {
 		/*  Semi-ugly hack which sets the negative-bit if a < 0:  */
-		cpu->cd.arm.flags = ARM_F_C | ((a >> 28) & 8);
+		ARM_FLAGS(cpu) = ARM_F_C | ((a >> 28) & 8);
 		cpu->cd.arm.next_ic = &ic[2];
 	}
 }
@@ -1764,36 +1782,36 @@ X(cmps_pos_beq)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if ((int32_t)a < 0 && (int32_t)c >= 0)
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if (c == 0) {
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 		cpu->pc = (uint32_t)(((uint32_t)cpu->pc & 0xfffff000)
 		    + (int32_t)ic[1].arg[0]);
 		quick_pc_to_pointers(cpu);
 	} else {
 		cpu->cd.arm.next_ic = &ic[2];
 		if (c & 0x80000000)
-			cpu->cd.arm.flags |= ARM_F_N;
+			ARM_FLAGS(cpu) |= ARM_F_N;
 	}
 }
 X(cmps_neg_beq)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if ((int32_t)a >= 0 && (int32_t)c < 0)
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if (c == 0) {
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 		cpu->pc = (uint32_t)(((uint32_t)cpu->pc & 0xfffff000)
 		    + (int32_t)ic[1].arg[0]);
 		quick_pc_to_pointers(cpu);
 	} else {
 		cpu->cd.arm.next_ic = &ic[2];
 		if (c & 0x80000000)
-			cpu->cd.arm.flags |= ARM_F_N;
+			ARM_FLAGS(cpu) |= ARM_F_N;
 	}
 }
 
@@ -1806,10 +1824,10 @@ X(cmps0_bne_samepage)
 	uint32_t a = reg(ic->arg[0]);
 	cpu->n_translated_instrs ++;
 	if (a == 0) {
-		cpu->cd.arm.flags = ARM_F_Z | ARM_F_C;
+		ARM_FLAGS(cpu) = ARM_F_Z | ARM_F_C;
 	} else {
 		/*  Semi-ugly hack which sets the negative-bit if a < 0:  */
-		cpu->cd.arm.flags = ARM_F_C | ((a >> 28) & 8);
+		ARM_FLAGS(cpu) = ARM_F_C | ((a >> 28) & 8);
 	}
 	if (a == 0)
 		cpu->cd.arm.next_ic = &ic[2];
@@ -1825,16 +1843,16 @@ X(cmps_bne_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if (((int32_t)a >= 0 && (int32_t)b < 0 && (int32_t)c < 0) ||
 	    ((int32_t)a < 0 && (int32_t)b >= 0 && (int32_t)c >= 0))
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if (c == 0) {
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 		cpu->cd.arm.next_ic = &ic[2];
 	} else {
 		if (c & 0x80000000)
-			cpu->cd.arm.flags |= ARM_F_N;
+			ARM_FLAGS(cpu) |= ARM_F_N;
 		cpu->cd.arm.next_ic = (struct arm_instr_call *) ic[1].arg[0];
 	}
 }
@@ -1847,14 +1865,14 @@ X(cmps_bcc_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if (c & 0x80000000)
-		cpu->cd.arm.flags |= ARM_F_N;
+		ARM_FLAGS(cpu) |= ARM_F_N;
 	else if (c == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (((int32_t)a >= 0 && (int32_t)b < 0 && (int32_t)c < 0) ||
 	    ((int32_t)a < 0 && (int32_t)b >= 0 && (int32_t)c >= 0))
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if (a >= b)
 		cpu->cd.arm.next_ic = &ic[2];
 	else
@@ -1869,14 +1887,14 @@ X(cmps_reg_bcc_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = reg(ic->arg[1]), c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if (c & 0x80000000)
-		cpu->cd.arm.flags |= ARM_F_N;
+		ARM_FLAGS(cpu) |= ARM_F_N;
 	else if (c == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (((int32_t)a >= 0 && (int32_t)b < 0 && (int32_t)c < 0) ||
 	    ((int32_t)a < 0 && (int32_t)b >= 0 && (int32_t)c >= 0))
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if (a >= b)
 		cpu->cd.arm.next_ic = &ic[2];
 	else
@@ -1891,14 +1909,14 @@ X(cmps_bhi_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if (c & 0x80000000)
-		cpu->cd.arm.flags |= ARM_F_N;
+		ARM_FLAGS(cpu) |= ARM_F_N;
 	else if (c == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (((int32_t)a >= 0 && (int32_t)b < 0 && (int32_t)c < 0) ||
 	    ((int32_t)a < 0 && (int32_t)b >= 0 && (int32_t)c >= 0))
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if (a > b)
 		cpu->cd.arm.next_ic = (struct arm_instr_call *) ic[1].arg[0];
 	else
@@ -1913,14 +1931,14 @@ X(cmps_reg_bhi_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = reg(ic->arg[1]), c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if (c & 0x80000000)
-		cpu->cd.arm.flags |= ARM_F_N;
+		ARM_FLAGS(cpu) |= ARM_F_N;
 	else if (c == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (((int32_t)a >= 0 && (int32_t)b < 0 && (int32_t)c < 0) ||
 	    ((int32_t)a < 0 && (int32_t)b >= 0 && (int32_t)c >= 0))
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if (a > b)
 		cpu->cd.arm.next_ic = (struct arm_instr_call *) ic[1].arg[0];
 	else
@@ -1935,14 +1953,14 @@ X(cmps_bgt_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if (c & 0x80000000)
-		cpu->cd.arm.flags |= ARM_F_N;
+		ARM_FLAGS(cpu) |= ARM_F_N;
 	else if (c == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (((int32_t)a >= 0 && (int32_t)b < 0 && (int32_t)c < 0) ||
 	    ((int32_t)a < 0 && (int32_t)b >= 0 && (int32_t)c >= 0))
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if ((int32_t)a > (int32_t)b)
 		cpu->cd.arm.next_ic = (struct arm_instr_call *) ic[1].arg[0];
 	else
@@ -1957,14 +1975,14 @@ X(cmps_ble_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a - b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
+	ARM_FLAGS(cpu) = ((uint32_t)a >= (uint32_t)b)? ARM_F_C : 0;
 	if (c & 0x80000000)
-		cpu->cd.arm.flags |= ARM_F_N;
+		ARM_FLAGS(cpu) |= ARM_F_N;
 	else if (c == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (((int32_t)a >= 0 && (int32_t)b < 0 && (int32_t)c < 0) ||
 	    ((int32_t)a < 0 && (int32_t)b >= 0 && (int32_t)c >= 0))
-		cpu->cd.arm.flags |= ARM_F_V;
+		ARM_FLAGS(cpu) |= ARM_F_V;
 	if ((int32_t)a <= (int32_t)b)
 		cpu->cd.arm.next_ic = (struct arm_instr_call *) ic[1].arg[0];
 	else
@@ -1979,14 +1997,14 @@ X(teqs_beq_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a ^ b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags &= ~(ARM_F_Z | ARM_F_N);
+	ARM_FLAGS(cpu) &= ~(ARM_F_Z | ARM_F_N);
 	if (c == 0) {
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 		cpu->cd.arm.next_ic = (struct arm_instr_call *)
 		    ic[1].arg[0];
 	} else {
 		if (c & 0x80000000)
-			cpu->cd.arm.flags |= ARM_F_N;
+			ARM_FLAGS(cpu) |= ARM_F_N;
 		cpu->cd.arm.next_ic = &ic[2];
 	}
 }
@@ -2000,9 +2018,9 @@ X(tsts_lo_beq_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a & b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags &= ~(ARM_F_Z | ARM_F_N);
+	ARM_FLAGS(cpu) &= ~(ARM_F_Z | ARM_F_N);
 	if (c == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (c == 0)
 		cpu->cd.arm.next_ic = (struct arm_instr_call *)
 		    ic[1].arg[0];
@@ -2018,12 +2036,12 @@ X(teqs_bne_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a ^ b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags &= ~(ARM_F_Z | ARM_F_N);
+	ARM_FLAGS(cpu) &= ~(ARM_F_Z | ARM_F_N);
 	if (c == 0) {
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	} else {
 		if (c & 0x80000000)
-			cpu->cd.arm.flags |= ARM_F_N;
+			ARM_FLAGS(cpu) |= ARM_F_N;
 	}
 	if (c == 0)
 		cpu->cd.arm.next_ic = &ic[2];
@@ -2041,9 +2059,9 @@ X(tsts_lo_bne_samepage)
 {
 	uint32_t a = reg(ic->arg[0]), b = ic->arg[1], c = a & b;
 	cpu->n_translated_instrs ++;
-	cpu->cd.arm.flags &= ~(ARM_F_Z | ARM_F_N);
+	ARM_FLAGS(cpu) &= ~(ARM_F_Z | ARM_F_N);
 	if (c == 0)
-		cpu->cd.arm.flags |= ARM_F_Z;
+		ARM_FLAGS(cpu) |= ARM_F_Z;
 	if (c == 0)
 		cpu->cd.arm.next_ic = &ic[2];
 	else
@@ -3113,7 +3131,10 @@ X(to_be_translated)
 				fatal("TODO: mia* DSP instructions!\n");
 			goto bad;
 		}
-		if (iword & 0x10) {
+		if ((iword & 0x0fff0fff) == 0x0e070f90) {
+			/*  mcr p15,0,rd,c7,c0,4: Wait for interrupt  */
+			ic->f = cond_instr(wfi);
+		} else if (iword & 0x10) {
 			/*  xxxx1110 oooLNNNN ddddpppp qqq1MMMM  MCR/MRC  */
 			ic->arg[0] = iword;
 			ic->f = cond_instr(mcr_mrc);
@@ -123,9 +123,9 @@ void A__NAME(struct cpu *cpu, struct arm_instr_call *ic)
 	 */
 	if (VAR_B > 255) {
 		if (VAR_B & 0x80000000)
-			cpu->cd.arm.flags |= ARM_F_C;
+			ARM_FLAGS(cpu) |= ARM_F_C;
 		else
-			cpu->cd.arm.flags &= ~ARM_F_C;
+			ARM_FLAGS(cpu) &= ~ARM_F_C;
 	}
 #endif
 #endif
@@ -159,10 +159,10 @@ void A__NAME(struct cpu *cpu, struct arm_instr_call *ic)
 	c64 = a + b;
 #endif
 #if defined(A__ADC)
-	c64 = a + b + (cpu->cd.arm.flags & ARM_F_C? 1 : 0);
+	c64 = a + b + (ARM_FLAGS(cpu) & ARM_F_C? 1 : 0);
 #endif
 #if defined(A__SBC) || defined(A__RSC)
-	b += (cpu->cd.arm.flags & ARM_F_C? 0 : 1);
+	b += (ARM_FLAGS(cpu) & ARM_F_C? 0 : 1);
 	c64 = a - b;
 #endif
 #if defined(A__ORR)
@@ -206,7 +206,7 @@ void A__NAME(struct cpu *cpu, struct arm_instr_call *ic)
 		case ARM_MODE_UND32:
 			cpu->cd.arm.cpsr = cpu->cd.arm.spsr_und; break;
 		}
-		cpu->cd.arm.flags = cpu->cd.arm.cpsr >> 28;
+		ARM_FLAGS(cpu) = cpu->cd.arm.cpsr >> 28;
 		arm_load_register_bank(cpu);
 #else
 		if ((old_pc & ~mask_within_page) ==
@@ -228,26 +228,39 @@ void A__NAME(struct cpu *cpu, struct arm_instr_call *ic)
 
 	/*
 	 *  Status flag update (if the S-bit is set):
+	 *
+	 *  For the most common cases, the flags are not calculated here.
+	 *  Only the operation, the operands and the result are recorded, and
+	 *  the flags are calculated later, if and when they are needed.
+	 *  (See arm_materialize_flags() in cpu_arm.cc.)
 	 */
 #ifdef A__S
 	c32 = c64;
-	cpu->cd.arm.flags
-#if defined(A__CMP) || defined(A__CMN) || defined(A__ADC) || defined(A__ADD) \
- || defined(A__RSB) || defined(A__RSC) || defined(A__SBC) || defined(A__SUB)
-	    = 0;
+#if defined(A__ADD) || defined(A__CMN)
+	cpu->cd.arm.lazy_flags_op = ARM_LAZY_ADD;
+	cpu->cd.arm.lazy_flags_a = a;
+	cpu->cd.arm.lazy_flags_b = b;
+	cpu->cd.arm.lazy_flags_result = c32;
 #else
-	    &= ~(ARM_F_Z | ARM_F_N);
-#endif
+#if defined(A__CMP) || defined(A__RSB) || defined(A__SUB)
+	cpu->cd.arm.lazy_flags_op = ARM_LAZY_SUB;
+	cpu->cd.arm.lazy_flags_a = a;
+	cpu->cd.arm.lazy_flags_b = b;
+	cpu->cd.arm.lazy_flags_result = c32;
+#else
+#if defined(A__ADC) || defined(A__RSC) || defined(A__SBC)
+	/*
+	 *  These depend on the carry-in, and are calculated directly. (The
+	 *  carry-in was read via ARM_FLAGS(), so 'flags' is up to date.)
+	 */
+	cpu->cd.arm.flags = 0;
 
-#if defined(A__CMP) || defined(A__RSB) || defined(A__SUB) || \
-    defined(A__RSC) || defined(A__SBC)
+#if defined(A__RSC) || defined(A__SBC)
 	if ((uint32_t)a >= (uint32_t)b)
 		cpu->cd.arm.flags |= ARM_F_C;
 #else
-#if defined(A__ADC) || defined(A__ADD) || defined(A__CMN)
 	if (c32 != c64)
 		cpu->cd.arm.flags |= ARM_F_C;
-#endif
 #endif
 
 	if (c32 == 0)
@@ -257,29 +270,32 @@ void A__NAME(struct cpu *cpu, struct arm_instr_call *ic)
 		cpu->cd.arm.flags |= ARM_F_N;
 
 	/*  Calculate the Overflow bit:  */
-#if defined(A__CMP) || defined(A__CMN) || defined(A__ADC) || defined(A__ADD) \
- || defined(A__RSB) || defined(A__RSC) || defined(A__SBC) || defined(A__SUB)
 	{
 		int v = 0;
-#if defined(A__ADD) || defined(A__CMN)
+#if defined(A__ADC)
 		if (((int32_t)a >= 0 && (int32_t)b >= 0 &&
 		    (int32_t)c32 < 0) ||
 		    ((int32_t)a < 0 && (int32_t)b < 0 &&
 		    (int32_t)c32 >= 0))
 			v = 1;
 #else
-#if defined(A__SUB) || defined(A__RSB) || defined(A__CMP) || \
-    defined(A__RSC) || defined(A__SBC)
 		if (((int32_t)a >= 0 && (int32_t)b < 0 &&
 		    (int32_t)c32 < 0) ||
 		    ((int32_t)a < 0 && (int32_t)b >= 0 &&
 		    (int32_t)c32 >= 0))
 			v = 1;
-#endif
 #endif
 		if (v)
 			cpu->cd.arm.flags |= ARM_F_V;
 	}
+#else
+	/*  Logical operations: C and V are kept as they are.  */
+	if (cpu->cd.arm.lazy_flags_op >= ARM_LAZY_ADD)
+		arm_materialize_flags(cpu);
+	cpu->cd.arm.lazy_flags_op = ARM_LAZY_LOGIC;
+	cpu->cd.arm.lazy_flags_result = c32;
+#endif
+#endif
 #endif
 #endif	/*  A__S  */
 
@@ -289,21 +305,21 @@ void A__NAME(struct cpu *cpu, struct arm_instr_call *ic)
 
 
 void A__NAME__eq(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (cpu->cd.arm.flags & ARM_F_Z) A__NAME(cpu, ic); }
+{ if (ARM_FLAGS_Z(cpu)) A__NAME(cpu, ic); }
 void A__NAME__ne(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (!(cpu->cd.arm.flags & ARM_F_Z)) A__NAME(cpu, ic); }
+{ if (!(ARM_FLAGS_Z(cpu))) A__NAME(cpu, ic); }
 void A__NAME__cs(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (cpu->cd.arm.flags & ARM_F_C) A__NAME(cpu, ic); }
+{ if (ARM_FLAGS(cpu) & ARM_F_C) A__NAME(cpu, ic); }
 void A__NAME__cc(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (!(cpu->cd.arm.flags & ARM_F_C)) A__NAME(cpu, ic); }
+{ if (!(ARM_FLAGS(cpu) & ARM_F_C)) A__NAME(cpu, ic); }
 void A__NAME__mi(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (cpu->cd.arm.flags & ARM_F_N) A__NAME(cpu, ic); }
+{ if (ARM_FLAGS_N(cpu)) A__NAME(cpu, ic); }
 void A__NAME__pl(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (!(cpu->cd.arm.flags & ARM_F_N)) A__NAME(cpu, ic); }
+{ if (!(ARM_FLAGS_N(cpu))) A__NAME(cpu, ic); }
 void A__NAME__vs(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (cpu->cd.arm.flags & ARM_F_V) A__NAME(cpu, ic); }
+{ if (ARM_FLAGS(cpu) & ARM_F_V) A__NAME(cpu, ic); }
 void A__NAME__vc(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (!(cpu->cd.arm.flags & ARM_F_V)) A__NAME(cpu, ic); }
+{ if (!(ARM_FLAGS(cpu) & ARM_F_V)) A__NAME(cpu, ic); }
 
 #ifndef BLAHURG
 #define BLAHURG
@@ -313,15 +329,15 @@ extern uint8_t condition_gt[16];
 #endif
 
 void A__NAME__hi(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (condition_hi[cpu->cd.arm.flags]) A__NAME(cpu, ic); }
+{ if (condition_hi[ARM_FLAGS(cpu)]) A__NAME(cpu, ic); }
 void A__NAME__ls(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (!condition_hi[cpu->cd.arm.flags]) A__NAME(cpu, ic); }
+{ if (!condition_hi[ARM_FLAGS(cpu)]) A__NAME(cpu, ic); }
 void A__NAME__ge(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (condition_ge[cpu->cd.arm.flags]) A__NAME(cpu, ic); }
+{ if (condition_ge[ARM_FLAGS(cpu)]) A__NAME(cpu, ic); }
 void A__NAME__lt(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (!condition_ge[cpu->cd.arm.flags]) A__NAME(cpu, ic); }
+{ if (!condition_ge[ARM_FLAGS(cpu)]) A__NAME(cpu, ic); }
 void A__NAME__gt(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (condition_gt[cpu->cd.arm.flags]) A__NAME(cpu, ic); }
+{ if (condition_gt[ARM_FLAGS(cpu)]) A__NAME(cpu, ic); }
 void A__NAME__le(struct cpu *cpu, struct arm_instr_call *ic)
-{ if (!condition_gt[cpu->cd.arm.flags]) A__NAME(cpu, ic); }
+{ if (!condition_gt[ARM_FLAGS(cpu)]) A__NAME(cpu, ic); }
 
@@ -38,17 +38,26 @@
 #define	STATIC_STUFF
 /*
  *  gather_statistics():
+ *
+ *  Called for every executed instruction (or every n:th instruction, if a
+ *  sample interval was given). The values of the selected fields are
+ *  either counted in-process, written as a binary record, or written as
+ *  a line of text.
  */
 static void gather_statistics(struct cpu *cpu)
 {
+	struct statistics *st = &cpu->machine->statistics;
 	char ch, buf[60];
 	struct DYNTRANS_IC *ic = cpu->cd.DYNTRANS_ARCH.next_ic;
+	uint64_t values[STATISTICS_MAX_FIELDS];
 	int i = 0;
 	uint64_t a;
 	int low_pc = ((size_t)cpu->cd.DYNTRANS_ARCH.next_ic - (size_t)
 	    cpu->cd.DYNTRANS_ARCH.cur_ic_page) / sizeof(struct DYNTRANS_IC);
 
-	if (cpu->machine->statistics.file == NULL) {
+	st->sample_countdown = st->sample_interval;
+
+	if (st->file == NULL) {
 		fatal("statistics gathering with no filename set is"
 		    " meaningless\n");
 		return;
@@ -58,16 +67,10 @@ static void gather_statistics(struct cpu *cpu)
 	if (low_pc < 0 || low_pc > DYNTRANS_IC_ENTRIES_PER_PAGE)
 		return;
 
-	buf[0] = '\0';
-
-	while ((ch = cpu->machine->statistics.fields[i]) != '\0') {
-		if (i != 0)
-			strlcat(buf, " ", sizeof(buf));
-
+	while ((ch = st->fields[i]) != '\0') {
 		switch (ch) {
 		case 'i':
-			snprintf(buf + strlen(buf), sizeof(buf),
-			    "%p", (void *)ic->f);
+			a = (size_t)ic->f;
 			break;
 		case 'p':
 			/*  Physical program counter address:  */
@@ -77,35 +80,55 @@ static void gather_statistics(struct cpu *cpu)
 			a &= ~((DYNTRANS_IC_ENTRIES_PER_PAGE-1) <<
 			    DYNTRANS_INSTR_ALIGNMENT_SHIFT);
 			a += low_pc << DYNTRANS_INSTR_ALIGNMENT_SHIFT;
-			if (cpu->is_32bit)
-				snprintf(buf + strlen(buf), sizeof(buf),
-				    "0x%08"PRIx32, (uint32_t)a);
-			else
-				snprintf(buf + strlen(buf), sizeof(buf),
-				    "0x%016"PRIx64, (uint64_t)a);
 			break;
-		case 'v':
+		default:
 			/*  Virtual program counter address:  */
 			a = cpu->pc;
 			a &= ~((DYNTRANS_IC_ENTRIES_PER_PAGE-1) <<
 			    DYNTRANS_INSTR_ALIGNMENT_SHIFT);
 			a += low_pc << DYNTRANS_INSTR_ALIGNMENT_SHIFT;
-			if (cpu->is_32bit)
-				snprintf(buf + strlen(buf), sizeof(buf),
-				    "0x%08"PRIx32, (uint32_t)a);
-			else
-				snprintf(buf + strlen(buf), sizeof(buf),
-				    "0x%016"PRIx64, (uint64_t)a);
 			break;
 		}
-		i++;
+		if (cpu->is_32bit && ch != 'i')
+			a = (uint32_t)a;
+		values[i++] = a;
+	}
+
+	if (st->aggregate) {
+		machine_statistics_add(cpu->machine, values);
+		return;
+	}
+
+	if (st->binary) {
+		int j;
+		for (j=0; j<i; j++)
+			values[j] = LE64_TO_HOST(values[j]);
+		fwrite(values, sizeof(uint64_t), i, st->file);
+		return;
+	}
+
+	buf[0] = '\0';
+	for (i=0; (ch = st->fields[i]) != '\0'; i++) {
+		if (i != 0)
+			strlcat(buf, " ", sizeof(buf));
+
+		if (ch == 'i')
+			snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf),
+			    "%p", (void *)(size_t)values[i]);
+		else if (cpu->is_32bit)
+			snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf),
+			    "0x%08"PRIx32, (uint32_t)values[i]);
+		else
+			snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf),
+			    "0x%016"PRIx64, (uint64_t)values[i]);
 	}
 
-	fprintf(cpu->machine->statistics.file, "%s\n", buf);
+	fprintf(st->file, "%s\n", buf);
 }
 
 
-#define S		gather_statistics(cpu)
+#define S	if (--cpu->machine->statistics.sample_countdown <= 0)	\
+			gather_statistics(cpu)
 
 
 #if 1
@@ -317,6 +340,12 @@ int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 		I;
 
 		n_instrs = 1;
+#ifdef DYNTRANS_PPC
+	} else if (cpu->cd.ppc.msr & PPC_MSR_POW) {
+		/*  Dozing (MSR[POW] set) until the next interrupt:  */
+		cpu_idle(cpu);
+		n_instrs = 0;
+#endif
 	} else if (cpu->machine->statistics.enabled) {
 		/*  Gather statistics while executing multiple instructions:  */
 		n_instrs = 0;
@@ -369,6 +398,10 @@ int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 
 	n_instrs += cpu->n_translated_instrs;
 
+	/*  Host time slept while idle (see machine_idle_slept()):  */
+	n_instrs += cpu->idle_credit;
+	cpu->idle_credit = 0;
+
 	/*  Synchronize the program counter:  */
 	low_pc = ((size_t)cpu->cd.DYNTRANS_ARCH.next_ic - (size_t)
 	    cpu->cd.DYNTRANS_ARCH.cur_ic_page) / sizeof(struct DYNTRANS_IC);
@@ -391,6 +424,13 @@ int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 		    DYNTRANS_INSTR_ALIGNMENT_SHIFT);
 	}
 
+	/*  Sampling profiler; only checked once per run, to keep it cheap:  */
+	if (cpu->machine->profile.enabled) {
+		cpu->machine->profile.countdown -= n_instrs;
+		if (cpu->machine->profile.countdown <= 0)
+			cpu_profile_sample(cpu);
+	}
+
 #ifdef DYNTRANS_MIPS
 	/*  Update the count register (on everything except EXC3K):  */
 	if (cpu->cd.mips.cpu_type.exc_model != EXC3K) {
@@ -405,7 +445,9 @@ int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 		if (cpu->cd.mips.compare_register_set) {
 #if 1
 /*  Not yet.  TODO  */
-			if (cpu->machine->emulated_hz > 0) {
+			/*  (In deterministic mode, COUNT is exact already.)  */
+			if (cpu->machine->emulated_hz > 0 &&
+			    !timer_is_deterministic()) {
 				if (cpu->cd.mips.compare_interrupts_pending > 0)
 					INTERRUPT_ASSERT(
 					    cpu->cd.mips.irq_compare);
@@ -425,12 +467,22 @@ int DYNTRANS_RUN_INSTR_DEF(struct cpu *cpu)
 		uint32_t old = cpu->cd.ppc.spr[SPR_DEC];
 		cpu->cd.ppc.spr[SPR_DEC] = (uint32_t) (old - n_instrs);
 		if ((old >> 31) == 0 && (cpu->cd.ppc.spr[SPR_DEC] >> 31) == 1
-		    && !(cpu->cd.ppc.cpu_type.flags & PPC_NO_DEC))
+		    && !(cpu->cd.ppc.cpu_type.flags & PPC_NO_DEC)) {
 			cpu->cd.ppc.dec_intr_pending = 1;
+			cpu->is_idle = 0;
+		}
 		old = cpu->cd.ppc.spr[SPR_TBL];
 		cpu->cd.ppc.spr[SPR_TBL] += n_instrs;
 		if ((old >> 31) == 1 && (cpu->cd.ppc.spr[SPR_TBL] >> 31) == 0)
 			cpu->cd.ppc.spr[SPR_TBU] ++;
+
+		/*  The decrementer interrupts when it becomes negative:  */
+		if ((cpu->cd.ppc.spr[SPR_DEC] >> 31) == 0 &&
+		    !(cpu->cd.ppc.cpu_type.flags & PPC_NO_DEC))
+			cpu->ninstrs_till_event =
+			    (int64_t) cpu->cd.ppc.spr[SPR_DEC] + 1;
+		else
+			cpu->ninstrs_till_event = 0;
 	}
 #endif
 
@@ -1411,6 +1463,19 @@ void DYNTRANS_UPDATE_TRANSLATION_TABLE(struct cpu *cpu, uint64_t vaddr_page,
 	assert((vaddr_page & (DYNTRANS_PAGESIZE-1)) == 0);
 	assert((paddr_page & (DYNTRANS_PAGESIZE-1)) == 0);
 
+	/*
+	 *  Pages with watchpoints are kept out of the fast arrays (or are
+	 *  only entered as readonly), so that accesses to them go through
+	 *  memory_rw(), where the watchpoints are checked.
+	 */
+	if (cpu->machine->watchpoints.n > 0) {
+		int watched = machine_watched_page(cpu, vaddr_page);
+		if (watched & WATCHPOINT_READ)
+			return;
+		if (watched & WATCHPOINT_WRITE)
+			writeflag &= ~MEM_WRITE;
+	}
+
 	if (writeflag & MEMORY_USER_ACCESS) {
 		writeflag &= ~MEMORY_USER_ACCESS;
 		useraccess = 1;
@@ -1656,9 +1721,11 @@ cpu->cd.DYNTRANS_ARCH.vph_tlb_entry[r].valid);
 
 #ifdef DYNTRANS_TO_BE_TRANSLATED_HEAD
 	/*
-	 *  Check for breakpoints.
+	 *  Check for breakpoints. Only pages which hash to a bucket with
+	 *  breakpoints in it need to be scanned.
 	 */
-	if (!single_step_breakpoint && !cpu->translation_readahead) {
+	if (!single_step_breakpoint && !cpu->translation_readahead &&
+	    cpu->machine->breakpoints.page_count[DEBUG_PAGE_HASH(cpu->pc)]) {
 		MODE_uint_t curpc = cpu->pc;
 		int i;
 		for (i=0; i<cpu->machine->breakpoints.n; i++)
@@ -1734,10 +1801,43 @@ cpu->cd.DYNTRANS_ARCH.vph_tlb_entry[r].valid);
 #ifdef DYNTRANS_DELAYSLOT
 	    && !in_crosspage_delayslot
 #endif
-	    && cpu->cd.DYNTRANS_ARCH.combination_check != NULL
 	    && cpu->machine->allow_instruction_combinations) {
-		cpu->cd.DYNTRANS_ARCH.combination_check(cpu, ic,
-		    addr & (DYNTRANS_PAGESIZE - 1));
+		if (cpu->cd.DYNTRANS_ARCH.combination_check != NULL)
+			cpu->cd.DYNTRANS_ARCH.combination_check(cpu, ic,
+			    addr & (DYNTRANS_PAGESIZE - 1));
+
+#ifdef DYNTRANS_COMBINATIONS
+		/*
+		 *  Table-driven combinations: Find a sequence in the
+		 *  arch's DYNTRANS_COMBINATIONS table which ends with the
+		 *  instruction that was just translated, and which matches
+		 *  the preceding instruction calls in the same page.
+		 */
+		{
+			int n_back = (addr & (DYNTRANS_PAGESIZE - 1))
+			    >> DYNTRANS_INSTR_ALIGNMENT_SHIFT;
+			const struct DYNTRANS_COMBINATION *c;
+
+			for (c = DYNTRANS_COMBINATIONS; c->n != 0; c++) {
+				struct DYNTRANS_IC *first = ic - (c->n - 1);
+				int i;
+
+				if (c->n - 1 > n_back ||
+				    c->f[c->n - 1] != ic->f)
+					continue;
+				for (i = 0; i < c->n - 1; i++)
+					if (first[i].f != c->f[i])
+						break;
+				if (i < c->n - 1)
+					continue;
+				if (c->check != NULL && !c->check(cpu, first))
+					continue;
+
+				first->f = c->combined;
+				break;
+			}
+		}
+#endif
 	}
 
 	cpu->cd.DYNTRANS_ARCH.combination_check = NULL;
@@ -408,6 +408,7 @@ void m88k_irq_interrupt_assert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.m88k.irq_asserted = 1;
+	cpu->is_idle = 0;
 }
 void m88k_irq_interrupt_deassert(struct interrupt *interrupt)
 {
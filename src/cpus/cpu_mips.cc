@@ -33,6 +33,7 @@
 #include <string.h>
 #include <sys/types.h>
 #include <ctype.h>
+#include <math.h>
 #include <unistd.h>
 
 #include "../../config.h"
@@ -50,6 +51,7 @@
 #include "opcodes_mips.h"
 #include "settings.h"
 #include "symbol.h"
+#include "timer.h"
 
 
 static const char *exception_names[] = EXCEPTION_NAMES;
@@ -1688,6 +1690,7 @@ void mips_cpu_interrupt_assert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.mips.coproc[0]->reg[COP0_CAUSE] |= interrupt->line;
+	cpu->is_idle = 0;
 }
 void mips_cpu_interrupt_deassert(struct interrupt *interrupt)
 {
@@ -751,7 +751,8 @@ void coproc_register_write(struct cpu *cpu,
 			unimpl = 0;
 			break;
 		case COP0_COMPARE:
-			if (cpu->machine->emulated_hz > 0) {
+			if (cpu->machine->emulated_hz > 0 &&
+			    !timer_is_deterministic()) {
 				int32_t compare_diff = tmp -
 				    cp->reg[COP0_COMPARE];
 				double hz;
@@ -1978,6 +1978,383 @@ X(cop1_slow)
 }
 
 
+/*
+ *  Pre-decoded cop1 arithmetic:
+ *
+ *  arg[0] = pointer to the fs register
+ *  arg[1] = pointer to the ft register
+ *  arg[2] = pointer to the fd register  (or cond | (cc << 4) for c.cond)
+ *
+ *  The FPU registers are used in 32-bit mode, like in the legacy code in
+ *  cpu_mips_coproc.cc: double precision values are kept in even/odd register
+ *  pairs (low word in the even register), and each 32-bit half is stored
+ *  sign-extended.
+ *
+ *  The host's IEEE arithmetic is used directly as long as the rounding mode
+ *  is round-to-nearest, and all operands and results are normal numbers or
+ *  zero. Everything else (NaNs, infinities, denormals, division by zero,
+ *  overflow, underflow, and other rounding modes) is handed over to the
+ *  legacy code, by re-encoding the instruction word.
+ */
+#ifndef	COP1_HELPERS_INCLUDED
+#define	COP1_HELPERS_INCLUDED
+#define	COP1_FD(ic)	((uint64_t *)(ic)->arg[2] - cpu->cd.mips.coproc[1]->reg)
+
+static void cop1_fallback(struct cpu *cpu, struct mips_instr_call *ic,
+	int fmt, int fd, int function)
+{
+	struct mips_coproc *cp = cpu->cd.mips.coproc[1];
+	int fs = (uint64_t *)ic->arg[0] - cp->reg;
+	int ft = (uint64_t *)ic->arg[1] - cp->reg;
+
+	coproc_function(cpu, cp, 1, (fmt << 21) | (ft << 16) | (fs << 11) |
+	    (fd << 6) | function, 0, 1);
+}
+
+static inline float cop1_get_s(uint64_t *reg)
+{
+	uint32_t x = *reg;
+	float f;
+	memcpy(&f, &x, sizeof(f));
+	return f;
+}
+
+static inline double cop1_get_d(uint64_t *reg)
+{
+	uint64_t x = (uint32_t)reg[0] | ((uint64_t)reg[1] << 32);
+	double d;
+	memcpy(&d, &x, sizeof(d));
+	return d;
+}
+
+static inline void cop1_set_s(uint64_t *reg, float f)
+{
+	uint32_t x;
+	memcpy(&x, &f, sizeof(x));
+	reg[0] = (int32_t)x;
+}
+
+static inline void cop1_set_d(uint64_t *reg, double d)
+{
+	uint64_t x;
+	memcpy(&x, &d, sizeof(x));
+	reg[0] = (int32_t)x;
+	reg[1] = (int32_t)(x >> 32);
+}
+
+/*  Returns 1 if f is a normal number or zero.  */
+static inline int cop1_ok_s(float f)
+{
+	int c = fpclassify(f);
+	return c == FP_NORMAL || c == FP_ZERO;
+}
+
+static inline int cop1_ok_d(double d)
+{
+	int c = fpclassify(d);
+	return c == FP_NORMAL || c == FP_ZERO;
+}
+
+static inline int cop1_round_to_nearest(struct cpu *cpu)
+{
+	return (cpu->cd.mips.coproc[1]->fcr[MIPS_FPU_FCSR] &
+	    MIPS_FCSR_RM_MASK) == 0;
+}
+
+static inline void cop1_arith_s(struct cpu *cpu, struct mips_instr_call *ic,
+	int function)
+{
+	float a, b, r;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = cop1_get_s((uint64_t *)ic->arg[0]);
+	b = cop1_get_s((uint64_t *)ic->arg[1]);
+	switch (function) {
+	case 0:	r = a + b; break;
+	case 1:	r = a - b; break;
+	case 2:	r = a * b; break;
+	default:r = a / b;
+	}
+
+	if (!cop1_ok_s(a) || !cop1_ok_s(b) || !cop1_ok_s(r) ||
+	    !cop1_round_to_nearest(cpu))
+		cop1_fallback(cpu, ic, COP1_FMT_S, COP1_FD(ic), function);
+	else
+		cop1_set_s((uint64_t *)ic->arg[2], r);
+}
+
+static inline void cop1_arith_d(struct cpu *cpu, struct mips_instr_call *ic,
+	int function)
+{
+	double a, b, r;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = cop1_get_d((uint64_t *)ic->arg[0]);
+	b = cop1_get_d((uint64_t *)ic->arg[1]);
+	switch (function) {
+	case 0:	r = a + b; break;
+	case 1:	r = a - b; break;
+	case 2:	r = a * b; break;
+	default:r = a / b;
+	}
+
+	if (!cop1_ok_d(a) || !cop1_ok_d(b) || !cop1_ok_d(r) ||
+	    !cop1_round_to_nearest(cpu))
+		cop1_fallback(cpu, ic, COP1_FMT_D, COP1_FD(ic), function);
+	else
+		cop1_set_d((uint64_t *)ic->arg[2], r);
+}
+
+
+/*
+ *  abs, mov, neg:  These only affect the sign bit, so they don't depend on
+ *                  the rounding mode.
+ */
+static inline void cop1_unary_s(struct cpu *cpu, struct mips_instr_call *ic,
+	int function)
+{
+	float a;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = cop1_get_s((uint64_t *)ic->arg[0]);
+	if (!cop1_ok_s(a)) {
+		cop1_fallback(cpu, ic, COP1_FMT_S, COP1_FD(ic), function);
+		return;
+	}
+
+	cop1_set_s((uint64_t *)ic->arg[2],
+	    function == 5? fabsf(a) : function == 7? -a : a);
+}
+
+static inline void cop1_unary_d(struct cpu *cpu, struct mips_instr_call *ic,
+	int function)
+{
+	double a;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = cop1_get_d((uint64_t *)ic->arg[0]);
+	if (!cop1_ok_d(a)) {
+		cop1_fallback(cpu, ic, COP1_FMT_D, COP1_FD(ic), function);
+		return;
+	}
+
+	cop1_set_d((uint64_t *)ic->arg[2],
+	    function == 5? fabs(a) : function == 7? -a : a);
+}
+
+static inline void cop1_set_cc(struct mips_coproc *cp, int cc, int cond_true)
+{
+	int bit = cc == 0? 1 << MIPS_FCSR_FCC0_SHIFT :
+	    1 << (MIPS_FCSR_FCC1_SHIFT + cc-1);
+
+	cp->fcr[MIPS_FPU_FCCR] &= ~(1 << cc);
+	cp->fcr[MIPS_FPU_FCSR] &= ~bit;
+	if (cond_true) {
+		cp->fcr[MIPS_FPU_FCCR] |= (1 << cc);
+		cp->fcr[MIPS_FPU_FCSR] |= bit;
+	}
+}
+#endif
+
+X(add_s) { cop1_arith_s(cpu, ic, 0); }
+X(sub_s) { cop1_arith_s(cpu, ic, 1); }
+X(mul_s) { cop1_arith_s(cpu, ic, 2); }
+X(div_s) { cop1_arith_s(cpu, ic, 3); }
+X(add_d) { cop1_arith_d(cpu, ic, 0); }
+X(sub_d) { cop1_arith_d(cpu, ic, 1); }
+X(mul_d) { cop1_arith_d(cpu, ic, 2); }
+X(div_d) { cop1_arith_d(cpu, ic, 3); }
+
+X(abs_s) { cop1_unary_s(cpu, ic, 5); }
+X(mov_s) { cop1_unary_s(cpu, ic, 6); }
+X(neg_s) { cop1_unary_s(cpu, ic, 7); }
+X(abs_d) { cop1_unary_d(cpu, ic, 5); }
+X(mov_d) { cop1_unary_d(cpu, ic, 6); }
+X(neg_d) { cop1_unary_d(cpu, ic, 7); }
+
+
+/*
+ *  cvt.s.d, cvt.d.s, cvt.s.w, cvt.d.w:
+ *
+ *  (Conversions to fixed point formats depend on the rounding mode in ways
+ *  that are not worth duplicating here; they always use the legacy code.)
+ */
+X(cvt_s_d)
+{
+	double a;
+	float r;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = cop1_get_d((uint64_t *)ic->arg[0]);
+	r = a;
+	if (!cop1_ok_d(a) || !cop1_ok_s(r) || !cop1_round_to_nearest(cpu))
+		cop1_fallback(cpu, ic, COP1_FMT_D, COP1_FD(ic), 0x20);
+	else
+		cop1_set_s((uint64_t *)ic->arg[2], r);
+}
+
+X(cvt_d_s)
+{
+	float a;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = cop1_get_s((uint64_t *)ic->arg[0]);
+	if (!cop1_ok_s(a))
+		cop1_fallback(cpu, ic, COP1_FMT_S, COP1_FD(ic), 0x21);
+	else
+		cop1_set_d((uint64_t *)ic->arg[2], a);
+}
+
+X(cvt_s_w)
+{
+	int32_t a;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = *(uint64_t *)ic->arg[0];
+	if (!cop1_round_to_nearest(cpu))
+		cop1_fallback(cpu, ic, COP1_FMT_W, COP1_FD(ic), 0x20);
+	else
+		cop1_set_s((uint64_t *)ic->arg[2], (float)a);
+}
+
+X(cvt_d_w)
+{
+	int32_t a;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = *(uint64_t *)ic->arg[0];
+	cop1_set_d((uint64_t *)ic->arg[2], (double)a);
+}
+
+
+/*
+ *  c.cond.s, c.cond.d:  Floating-point compare.
+ *
+ *  Since unordered (NaN) operands are left to the legacy code, only the
+ *  "equal" and "less than" bits of the condition need to be considered.
+ */
+X(c_s)
+{
+	int cond = ic->arg[2] & 15, cc = ic->arg[2] >> 4;
+	float a, b;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = cop1_get_s((uint64_t *)ic->arg[0]);
+	b = cop1_get_s((uint64_t *)ic->arg[1]);
+	if (!cop1_ok_s(a) || !cop1_ok_s(b)) {
+		cop1_fallback(cpu, ic, COP1_FMT_S, cc << 2, 0x30 | cond);
+		return;
+	}
+
+	cop1_set_cc(cpu->cd.mips.coproc[1], cc,
+	    (cond & 2 && a == b) || (cond & 4 && a < b));
+}
+
+X(c_d)
+{
+	int cond = ic->arg[2] & 15, cc = ic->arg[2] >> 4;
+	double a, b;
+
+	COPROC_AVAILABILITY_CHECK(1);
+
+	a = cop1_get_d((uint64_t *)ic->arg[0]);
+	b = cop1_get_d((uint64_t *)ic->arg[1]);
+	if (!cop1_ok_d(a) || !cop1_ok_d(b)) {
+		cop1_fallback(cpu, ic, COP1_FMT_D, cc << 2, 0x30 | cond);
+		return;
+	}
+
+	cop1_set_cc(cpu->cd.mips.coproc[1], cc,
+	    (cond & 2 && a == b) || (cond & 4 && a < b));
+}
+
+
+/*
+ *  cop1_translate:
+ *
+ *  Translates common S, D and W format cop1 instructions into the
+ *  pre-decoded functions above. Returns 1 on success, 0 if the instruction
+ *  should be handled by cop1_slow instead.
+ */
+static int instr(cop1_translate)(struct cpu *cpu, struct mips_instr_call *ic,
+	uint32_t iword)
+{
+	struct mips_coproc *cp = cpu->cd.mips.coproc[1];
+	int fmt = (iword >> 21) & 31, ft = (iword >> 16) & 31;
+	int fs = (iword >> 11) & 31, fd = (iword >> 6) & 31;
+	int function = iword & 63, is_double = fmt == COP1_FMT_D;
+
+	if (fmt != COP1_FMT_S && fmt != COP1_FMT_D && fmt != COP1_FMT_W)
+		return 0;
+
+	ic->arg[0] = (size_t) &cp->reg[fs];
+	ic->arg[1] = (size_t) &cp->reg[ft];
+	ic->arg[2] = (size_t) &cp->reg[fd];
+
+	/*  c.cond.fmt: The fd field contains the condition code number.  */
+	if ((function & 0x30) == 0x30 && fmt != COP1_FMT_W && (fd & 3) == 0) {
+		if (is_double && (fs & 1 || ft & 1))
+			return 0;
+		ic->f = is_double? instr(c_d) : instr(c_s);
+		ic->arg[2] = (function & 15) | ((fd >> 2) << 4);
+		return 1;
+	}
+
+	/*  Double precision values are kept in even/odd register pairs.  */
+	if (is_double && (fs & 1 || ft & 1 || fd & 1))
+		return 0;
+
+	if (fmt == COP1_FMT_W) {
+		if (ft != 0)
+			return 0;
+		if (function == 0x20)
+			ic->f = instr(cvt_s_w);
+		else if (function == 0x21 && !(fd & 1))
+			ic->f = instr(cvt_d_w);
+		else
+			return 0;
+		return 1;
+	}
+
+	switch (function) {
+	case 0:	ic->f = is_double? instr(add_d) : instr(add_s); break;
+	case 1:	ic->f = is_double? instr(sub_d) : instr(sub_s); break;
+	case 2:	ic->f = is_double? instr(mul_d) : instr(mul_s); break;
+	case 3:	ic->f = is_double? instr(div_d) : instr(div_s); break;
+	case 6:	ic->f = is_double? instr(mov_d) : instr(mov_s); break;
+	case 5:
+	case 7:
+	case 0x20:
+	case 0x21:
+		if (ft != 0)
+			return 0;
+		if (function == 5)
+			ic->f = is_double? instr(abs_d) : instr(abs_s);
+		else if (function == 7)
+			ic->f = is_double? instr(neg_d) : instr(neg_s);
+		else if (function == 0x20 && is_double)
+			ic->f = instr(cvt_s_d);
+		else if (function == 0x21 && !is_double && !(fd & 1))
+			ic->f = instr(cvt_d_s);
+		else
+			return 0;
+		break;
+	default:return 0;
+	}
+
+	return 1;
+}
+
+
 /*
  *  syscall, break:  Synchronize the PC and cause an exception.
  */
@@ -2191,7 +2568,7 @@ X(idle)
 {
 	/*
 	 *  If there is an interrupt, then just return. Otherwise
-	 *  re-run the wait instruction (after a delay).
+	 *  re-run the wait instruction (after skipping ahead).
 	 */
 	uint32_t status = cpu->cd.mips.coproc[0]->reg[COP0_STATUS];
 	uint32_t cause = cpu->cd.mips.coproc[0]->reg[COP0_CAUSE];
@@ -2208,29 +2585,10 @@ X(idle)
 	if (status & STATUS_IE && (status & cause & STATUS_IM_MASK))
 		return;
 
+	/*  There was no interrupt. Re-run the wait instruction later.  */
 	cpu->cd.mips.next_ic = ic;
 	cpu->is_halted = 1;
-	cpu->has_been_idling = 1;
-
-	/*
-	 *  There was no interrupt. Go to sleep.
-	 *
-	 *  TODO:
-	 *
-	 *  Think about how to actually implement this usleep stuff,
-	 *  in an SMP and/or timing accurate environment.
-	 */
-
-	if (cpu->machine->ncpus == 1) {
-		static int x = 0;
-
-		if ((++x) == 300) {
-			usleep(20);
-			x = 0;
-		}
-
-		cpu->n_translated_instrs += N_SAFE_DYNTRANS_LIMIT / 6;
-	}
+	cpu_idle(cpu);
 }
 
 
@@ -4220,6 +4578,9 @@ X(to_be_translated)
 		case COPz_CTCz:
 		case COPz_MFCz:
 		case COPz_MTCz:
+			if (instr(cop1_translate)(cpu, ic, iword))
+				break;
+
 			/*  Fallback to slow pre-dyntrans code, for now.  */
 			/*  TODO: Fix/optimize/rewrite.  */
 			ic->f = instr(cop1_slow);
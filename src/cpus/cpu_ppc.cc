@@ -365,8 +365,9 @@ void ppc_exception(struct cpu *cpu, int exception_nr)
 		    exception_nr, cpu->pc);
 
 	/*  Disable External Interrupts, Recoverable Interrupt Mode,
-	    and go to Supervisor mode  */
-	cpu->cd.ppc.msr &= ~(PPC_MSR_EE | PPC_MSR_RI | PPC_MSR_PR);
+	    and go to Supervisor mode. (This also ends any doze state.)  */
+	cpu->cd.ppc.msr &= ~(PPC_MSR_EE | PPC_MSR_RI | PPC_MSR_PR |
+	    PPC_MSR_POW);
 
 	cpu->pc = exception_nr * 0x100;
 	if (cpu->cd.ppc.msr & PPC_MSR_IP)
@@ -605,6 +606,7 @@ void ppc_irq_interrupt_assert(struct interrupt *interrupt)
 {
 	struct cpu *cpu = (struct cpu *) interrupt->extra;
 	cpu->cd.ppc.irq_asserted = 1;
+	cpu->is_idle = 0;
 }
 
 
@@ -1830,8 +1830,16 @@ X(mtmsr)
 	 *  exception while accessing the msr), then we _decrease_ the PC by 4
 	 *  again. This is because the next ic could be an end_of_page.
 	 */
-	if ((MODE_uint_t)cpu->pc == old_pc)
+	if ((MODE_uint_t)cpu->pc == old_pc) {
+		/*  MSR[POW] set? Then doze until the next interrupt.  */
+		if (cpu->cd.ppc.msr & PPC_MSR_POW) {
+			cpu_idle(cpu);
+			cpu->cd.ppc.next_ic = &nothing_call;
+			return;
+		}
+
 		cpu->pc -= 4;
+	}
 }
 
 
@@ -2661,6 +2669,231 @@ X(tlbld)
 /*****************************************************************************/
 
 
+/*
+ *  li_ori:   li/lis followed by ori
+ *  li_addi:  li/lis followed by addi
+ *
+ *  Load-immediate pairs, typically used to construct 32-bit constants.
+ */
+X(li_ori)
+{
+	reg(ic[0].arg[2]) = (int32_t)ic[0].arg[1];
+	reg(ic[1].arg[2]) = reg(ic[1].arg[0]) | (uint32_t)ic[1].arg[1];
+	cpu->n_translated_instrs ++;
+	cpu->cd.ppc.next_ic = &ic[2];
+}
+X(li_addi)
+{
+	reg(ic[0].arg[2]) = (int32_t)ic[0].arg[1];
+	reg(ic[1].arg[2]) = reg(ic[1].arg[0]) + (int32_t)ic[1].arg[1];
+	cpu->n_translated_instrs ++;
+	cpu->cd.ppc.next_ic = &ic[2];
+}
+
+
+/*
+ *  cmp*_bc_samepage_simple[01]:  A compare, followed by a conditional
+ *                                branch (within the same page) which only
+ *                                tests a single CR bit.
+ */
+#define CMP_BC_SAMEPAGE(cmp,b) X(cmp ## _bc_samepage_simple ## b) {	\
+	instr(cmp)(cpu, ic);						\
+	cpu->n_translated_instrs ++;					\
+	if (((cpu->cd.ppc.cr >> ic[1].arg[2]) & 1) == b)		\
+		cpu->cd.ppc.next_ic = (struct ppc_instr_call *) ic[1].arg[0];\
+	else								\
+		cpu->cd.ppc.next_ic = &ic[2];				\
+	}
+CMP_BC_SAMEPAGE(cmpw,0)
+CMP_BC_SAMEPAGE(cmpw,1)
+CMP_BC_SAMEPAGE(cmpw_cr0,0)
+CMP_BC_SAMEPAGE(cmpw_cr0,1)
+CMP_BC_SAMEPAGE(cmplw,0)
+CMP_BC_SAMEPAGE(cmplw,1)
+CMP_BC_SAMEPAGE(cmpwi,0)
+CMP_BC_SAMEPAGE(cmpwi,1)
+CMP_BC_SAMEPAGE(cmpwi_cr0,0)
+CMP_BC_SAMEPAGE(cmpwi_cr0,1)
+CMP_BC_SAMEPAGE(cmplwi,0)
+CMP_BC_SAMEPAGE(cmplwi,1)
+
+
+/*
+ *  stwu_bdnz_samepage:  memset-style loop, "stwu rs,4(ra)" followed by a
+ *                       bdnz back to the stwu.
+ *  stbu_bdnz_samepage:  The same thing, but with "stbu rs,1(ra)".
+ *
+ *  All iterations which fit within the current host page are executed at
+ *  once. If that isn't possible, a single store is executed as usual.
+ */
+X(stwu_bdnz_samepage)
+{
+	MODE_uint_t ctr = cpu->cd.ppc.spr[SPR_CTR];
+	uint32_t addr = reg(ic[0].arg[1]) + 4, value = reg(ic[0].arg[0]);
+	unsigned char *page = cpu->cd.ppc.host_store[addr >> 12];
+	int i, n = (0x1000 - (addr & 0xfff)) >> 2;
+
+	if (!cpu->is_32bit || page == NULL || (addr & 3) || ctr == 0) {
+		instr(stwu)(cpu, ic);
+		return;
+	}
+
+	if ((MODE_uint_t)n > ctr)
+		n = ctr;
+
+	page += (addr & 0xfff);
+	for (i=0; i<n; i++) {
+		page[0] = value >> 24; page[1] = value >> 16;
+		page[2] = value >> 8;  page[3] = value;
+		page += 4;
+	}
+
+	reg(ic[0].arg[1]) = addr + 4 * (n-1);
+	cpu->cd.ppc.spr[SPR_CTR] -= n;
+	cpu->n_translated_instrs += 2 * n - 1;
+	if ((MODE_uint_t)cpu->cd.ppc.spr[SPR_CTR] == 0)
+		cpu->cd.ppc.next_ic = &ic[2];
+	else
+		cpu->cd.ppc.next_ic = &ic[0];
+}
+X(stbu_bdnz_samepage)
+{
+	MODE_uint_t ctr = cpu->cd.ppc.spr[SPR_CTR];
+	uint32_t addr = reg(ic[0].arg[1]) + 1;
+	unsigned char *page = cpu->cd.ppc.host_store[addr >> 12];
+	int n = 0x1000 - (addr & 0xfff);
+
+	if (!cpu->is_32bit || page == NULL || ctr == 0) {
+		instr(stbu)(cpu, ic);
+		return;
+	}
+
+	if ((MODE_uint_t)n > ctr)
+		n = ctr;
+
+	memset(page + (addr & 0xfff), reg(ic[0].arg[0]), n);
+
+	reg(ic[0].arg[1]) = addr + n - 1;
+	cpu->cd.ppc.spr[SPR_CTR] -= n;
+	cpu->n_translated_instrs += 2 * n - 1;
+	if ((MODE_uint_t)cpu->cd.ppc.spr[SPR_CTR] == 0)
+		cpu->cd.ppc.next_ic = &ic[2];
+	else
+		cpu->cd.ppc.next_ic = &ic[0];
+}
+
+
+/*
+ *  lwzu_stwu_bdnz_samepage:  memcpy-style loop, "lwzu rt,4(rs)" and
+ *                            "stwu rt,4(rd)", followed by a bdnz back to
+ *                            the lwzu.
+ *
+ *  The words are copied one at a time, so overlapping source and
+ *  destination areas behave exactly like in the non-combined loop.
+ */
+X(lwzu_stwu_bdnz_samepage)
+{
+	MODE_uint_t ctr = cpu->cd.ppc.spr[SPR_CTR];
+	uint32_t src = reg(ic[0].arg[1]) + 4, dst = reg(ic[1].arg[1]) + 4;
+	unsigned char *src_page = cpu->cd.ppc.host_load[src >> 12];
+	unsigned char *dst_page = cpu->cd.ppc.host_store[dst >> 12];
+	int i, n = (0x1000 - (src & 0xfff)) >> 2,
+	    n_dst = (0x1000 - (dst & 0xfff)) >> 2;
+
+	if (!cpu->is_32bit || src_page == NULL || dst_page == NULL ||
+	    ((src | dst) & 3) || ctr == 0) {
+		instr(lwzu)(cpu, ic);
+		return;
+	}
+
+	if (n > n_dst)
+		n = n_dst;
+	if ((MODE_uint_t)n > ctr)
+		n = ctr;
+
+	src_page += (src & 0xfff);
+	dst_page += (dst & 0xfff);
+	for (i=0; i<n; i++)
+		memcpy(dst_page + 4*i, src_page + 4*i, 4);
+
+	/*  The last word loaded is also the last word stored:  */
+	dst_page += 4 * (n-1);
+	reg(ic[0].arg[0]) = (dst_page[0] << 24) + (dst_page[1] << 16) +
+	    (dst_page[2] << 8) + dst_page[3];
+
+	reg(ic[0].arg[1]) = src + 4 * (n-1);
+	reg(ic[1].arg[1]) = dst + 4 * (n-1);
+	cpu->cd.ppc.spr[SPR_CTR] -= n;
+	cpu->n_translated_instrs += 3 * n - 1;
+	if ((MODE_uint_t)cpu->cd.ppc.spr[SPR_CTR] == 0)
+		cpu->cd.ppc.next_ic = &ic[3];
+	else
+		cpu->cd.ppc.next_ic = &ic[0];
+}
+
+
+/*
+ *  Argument checks for the combinations below. ic points to the first
+ *  instruction call in the sequence.
+ */
+static int COMBINE(check_bdnz)(struct ppc_instr_call *ic, int n)
+{
+	/*  bdnz, possibly with a branch prediction hint, back to ic[0]:  */
+	return (ic[n].arg[1] & ~1) == 16 && ic[n].arg[0] == (size_t)&ic[0];
+}
+static int COMBINE(check_stwu_bdnz)(struct cpu *cpu, struct ppc_instr_call *ic)
+{
+	return ic[0].arg[2] == 4 && ic[0].arg[0] != ic[0].arg[1] &&
+	    COMBINE(check_bdnz)(ic, 1);
+}
+static int COMBINE(check_stbu_bdnz)(struct cpu *cpu, struct ppc_instr_call *ic)
+{
+	return ic[0].arg[2] == 1 && ic[0].arg[0] != ic[0].arg[1] &&
+	    COMBINE(check_bdnz)(ic, 1);
+}
+static int COMBINE(check_lwzu_stwu_bdnz)(struct cpu *cpu,
+	struct ppc_instr_call *ic)
+{
+	return ic[0].arg[2] == 4 && ic[1].arg[2] == 4 &&
+	    ic[0].arg[0] == ic[1].arg[0] && ic[0].arg[0] != ic[0].arg[1] &&
+	    ic[1].arg[0] != ic[1].arg[1] && ic[0].arg[1] != ic[1].arg[1] &&
+	    COMBINE(check_bdnz)(ic, 2);
+}
+
+
+/*
+ *  Instruction combinations, checked by the generic code in cpu_dyntrans.cc
+ *  after each instruction has been translated. The first match is used, so
+ *  longer sequences must come before shorter ones.
+ */
+static struct ppc_combination COMBINE(table)[] = {
+	{ 3, { instr(lwzu), instr(stwu), instr(bc_samepage) },
+	    COMBINE(check_lwzu_stwu_bdnz), instr(lwzu_stwu_bdnz_samepage) },
+
+#define CMP_BC(cmp) \
+	{ 2, { instr(cmp), instr(bc_samepage_simple0) }, NULL,	\
+	    instr(cmp ## _bc_samepage_simple0) },			\
+	{ 2, { instr(cmp), instr(bc_samepage_simple1) }, NULL,	\
+	    instr(cmp ## _bc_samepage_simple1) }
+	CMP_BC(cmpw), CMP_BC(cmpw_cr0), CMP_BC(cmplw),
+	CMP_BC(cmpwi), CMP_BC(cmpwi_cr0), CMP_BC(cmplwi),
+#undef CMP_BC
+
+	{ 2, { instr(stwu), instr(bc_samepage) },
+	    COMBINE(check_stwu_bdnz), instr(stwu_bdnz_samepage) },
+	{ 2, { instr(stbu), instr(bc_samepage) },
+	    COMBINE(check_stbu_bdnz), instr(stbu_bdnz_samepage) },
+
+	{ 2, { instr(li), instr(ori) }, NULL, instr(li_ori) },
+	{ 2, { instr(li), instr(addi) }, NULL, instr(li_addi) },
+
+	{ 0, { NULL }, NULL, NULL }
+};
+
+
+/*****************************************************************************/
+
+
 X(end_of_page)
 {
 	/*  Update the PC:  (offset 0, but on the next page)  */
@@ -3896,8 +4129,10 @@ X(to_be_translated)
 	}
 
 
+#define	DYNTRANS_COMBINATIONS	COMBINE(table)
 #define	DYNTRANS_TO_BE_TRANSLATED_TAIL
 #include "cpu_dyntrans.cc"
 #undef	DYNTRANS_TO_BE_TRANSLATED_TAIL
+#undef	DYNTRANS_COMBINATIONS
 }
 
@@ -202,6 +202,18 @@ int sh_cpu_new(struct cpu *cpu, struct memory *mem, struct machine *machine,
 	if (cpu->cd.sh.cpu_type.arch == 4) {
 		cpu->cd.sh.pcic_pcibus = (struct pci_data *) device_add(machine, "sh4");
 
+		/*  DMAC transfer end interrupts:  */
+		for (i=0; i<N_SH4_DMA_INTERRUPTS; i++) {
+			char name[100];
+			snprintf(name, sizeof(name), "%s.irq[0x%x]", cpu->path,
+			    SH4_INTEVT_DMAC_DMTE0 + 0x20 * i);
+			if (!interrupt_handler_lookup(name,
+			    &cpu->cd.sh.dmac_irq[i])) {
+				fatal("Could not find interrupt '%s'.\n", name);
+				exit(1);
+			}
+		}
+
 		/*
 		 *  Interrupt Controller initial values, according to the
 		 *  SH7760 manual:
@@ -274,6 +286,12 @@ void sh_update_interrupt_priorities(struct cpu *cpu)
 	cpu->cd.sh.int_prio_and_pending[SH_INTEVT_TMU2_TUNI2 / 0x20] |=
 	    (cpu->cd.sh.intc_ipra >> 4) & 0xf;
 
+	for (i=SH4_INTEVT_DMAC_DMTE0; i<=SH4_INTEVT_DMAC_DMAE; i+=0x20) {
+		cpu->cd.sh.int_prio_and_pending[i/0x20] &= ~SH_INT_PRIO_MASK;
+		cpu->cd.sh.int_prio_and_pending[i/0x20] |=
+		    (cpu->cd.sh.intc_iprc >> 8) & 0xf;
+	}
+
 	for (i=SH4_INTEVT_SCIF_ERI; i<=SH4_INTEVT_SCIF_TXI; i+=0x20) {
 		cpu->cd.sh.int_prio_and_pending[i/0x20] &= ~SH_INT_PRIO_MASK;
 		cpu->cd.sh.int_prio_and_pending[i/0x20] |=
@@ -320,6 +338,8 @@ void sh_cpu_interrupt_assert(struct interrupt *interrupt)
 		cpu->cd.sh.int_to_assert = irq_nr;
 		cpu->cd.sh.int_level = prio;
 	}
+
+	cpu->is_idle = 0;
 }
 
 
@@ -78,36 +78,17 @@ X(sleep)
 
 	/*
 	 *  If there is an interrupt, then just return. Otherwise
-	 *  re-run the sleep instruction (after a delay).
+	 *  re-run the sleep instruction (after skipping ahead).
 	 */
 	if (cpu->cd.sh.int_to_assert > 0 && !(cpu->cd.sh.sr & SH_SR_BL)
 	    && ((cpu->cd.sh.sr & SH_SR_IMASK) >> SH_SR_IMASK_SHIFT)
 	    < cpu->cd.sh.int_level)
 		return;
 
+	/*  There was no interrupt. Re-run the sleep instruction later.  */
 	cpu->cd.sh.next_ic = ic;
 	cpu->is_halted = 1;
-	cpu->has_been_idling = 1;
-
-	/*
-	 *  There was no interrupt. Let the host sleep for a while.
-	 *
-	 *  TODO:
-	 *
-	 *  Think about how to actually implement this usleep stuff,
-	 *  in an SMP and/or timing accurate environment.
-	 */
-
-	if (cpu->machine->ncpus == 1) {
-		static int x = 0;
-
-		if ((++x) == 600) {
-			usleep(10);
-			x = 0;
-		}
-
-		cpu->n_translated_instrs += N_SAFE_DYNTRANS_LIMIT / 6;
-	}
+	cpu_idle(cpu);
 }
 
 
@@ -2852,6 +2833,258 @@ X(prom_emul)
 /*****************************************************************************/
 
 
+/*
+ *  Instruction combinations:
+ *
+ *  Note: Any of these may end up being executed in a delay slot, if the
+ *  instruction before is a delayed branch. In that case, only the first
+ *  instruction of the combination is executed.
+ */
+
+
+/*
+ *  mov_imm_rn_x2:  Two mov #imm,Rn in a row. (mov.l @(disp,pc),Rn is also
+ *                  translated into mov_imm_rn, when the constant is within
+ *                  the same page, so this covers most constant loads.)
+ */
+X(mov_imm_rn_x2)
+{
+	reg(ic[0].arg[1]) = ic[0].arg[0];
+	if (cpu->delay_slot != NOT_DELAYED)
+		return;
+	reg(ic[1].arg[1]) = ic[1].arg[0];
+	cpu->n_translated_instrs ++;
+	cpu->cd.sh.next_ic = &ic[2];
+}
+
+
+/*
+ *  cmp*_bt_samepage, cmp*_bf_samepage:  A compare (or tst, or dt) which
+ *                                       sets the T bit, followed by bt or
+ *                                       bf to within the same page.
+ */
+#define CMP_B_SAMEPAGE(cmp,b,t) X(cmp ## _ ## b ## _samepage) {		\
+	instr(cmp)(cpu, ic);						\
+	if (cpu->delay_slot != NOT_DELAYED)				\
+		return;							\
+	cpu->n_translated_instrs ++;					\
+	if (((cpu->cd.sh.sr & SH_SR_T)? 1 : 0) == t)			\
+		cpu->cd.sh.next_ic = (struct sh_instr_call *) ic[1].arg[1];\
+	else								\
+		cpu->cd.sh.next_ic = &ic[2];				\
+	}
+#define CMP_BT_BF_SAMEPAGE(cmp)						\
+	CMP_B_SAMEPAGE(cmp,bt,1)					\
+	CMP_B_SAMEPAGE(cmp,bf,0)
+CMP_BT_BF_SAMEPAGE(cmpeq_imm_r0)
+CMP_BT_BF_SAMEPAGE(cmpeq_rm_rn)
+CMP_BT_BF_SAMEPAGE(cmphs_rm_rn)
+CMP_BT_BF_SAMEPAGE(cmpge_rm_rn)
+CMP_BT_BF_SAMEPAGE(cmphi_rm_rn)
+CMP_BT_BF_SAMEPAGE(cmpgt_rm_rn)
+CMP_BT_BF_SAMEPAGE(cmppz_rn)
+CMP_BT_BF_SAMEPAGE(cmppl_rn)
+CMP_BT_BF_SAMEPAGE(tst_imm_r0)
+CMP_BT_BF_SAMEPAGE(tst_rm_rn)
+CMP_BT_BF_SAMEPAGE(tst_rm)
+CMP_BT_BF_SAMEPAGE(dt_rn)
+
+
+/*
+ *  mov_l_fill_loop:  memset-style loop:
+ *
+ *	loop:	mov.l	rm,@-rn
+ *		dt	rc
+ *		bf	loop
+ *
+ *  mov_b_fill_loop:  The same thing, but with mov.b.
+ *
+ *  All iterations which fit within the current host page are executed at
+ *  once. If that isn't possible, a single store is executed as usual.
+ */
+X(mov_l_fill_loop)
+{
+	uint32_t addr = reg(ic[0].arg[1]) - sizeof(uint32_t);
+	uint32_t count = reg(ic[1].arg[1]), data = reg(ic[0].arg[0]);
+	uint32_t *p = (uint32_t *) cpu->cd.sh.host_store[addr >> 12];
+	int i, n = ((addr & 0xfff) >> 2) + 1;
+
+	if (cpu->delay_slot != NOT_DELAYED || p == NULL || (addr & 3) ||
+	    count == 0) {
+		instr(mov_l_rm_predec_rn)(cpu, ic);
+		return;
+	}
+
+	if ((uint32_t)n > count)
+		n = count;
+
+	if (cpu->byte_order == EMUL_LITTLE_ENDIAN)
+		data = LE32_TO_HOST(data);
+	else
+		data = BE32_TO_HOST(data);
+
+	p += (addr & 0xfff) >> 2;
+	for (i=0; i<n; i++)
+		p[-i] = data;
+
+	reg(ic[0].arg[1]) = addr - sizeof(uint32_t) * (n-1);
+	reg(ic[1].arg[1]) = count - n;
+	cpu->n_translated_instrs += 3 * n - 1;
+	if (count == (uint32_t)n) {
+		cpu->cd.sh.sr |= SH_SR_T;
+		cpu->cd.sh.next_ic = &ic[3];
+	} else {
+		cpu->cd.sh.sr &= ~SH_SR_T;
+		cpu->cd.sh.next_ic = &ic[0];
+	}
+}
+X(mov_b_fill_loop)
+{
+	uint32_t addr = reg(ic[0].arg[1]) - sizeof(uint8_t);
+	uint32_t count = reg(ic[1].arg[1]);
+	unsigned char *p = cpu->cd.sh.host_store[addr >> 12];
+	int n = (addr & 0xfff) + 1;
+
+	if (cpu->delay_slot != NOT_DELAYED || p == NULL || count == 0) {
+		instr(mov_b_rm_predec_rn)(cpu, ic);
+		return;
+	}
+
+	if ((uint32_t)n > count)
+		n = count;
+
+	memset(p + (addr & 0xfff) - (n-1), (uint8_t)reg(ic[0].arg[0]), n);
+
+	reg(ic[0].arg[1]) = addr - (n-1);
+	reg(ic[1].arg[1]) = count - n;
+	cpu->n_translated_instrs += 3 * n - 1;
+	if (count == (uint32_t)n) {
+		cpu->cd.sh.sr |= SH_SR_T;
+		cpu->cd.sh.next_ic = &ic[3];
+	} else {
+		cpu->cd.sh.sr &= ~SH_SR_T;
+		cpu->cd.sh.next_ic = &ic[0];
+	}
+}
+
+
+/*
+ *  mov_l_copy_loop:  memcpy-style loop:
+ *
+ *	loop:	mov.l	@rs+,rt
+ *		mov.l	rt,@rd
+ *		add	#4,rd
+ *		dt	rc
+ *		bf	loop
+ *
+ *  The words are copied one at a time, so overlapping source and
+ *  destination areas behave exactly like in the non-combined loop.
+ */
+X(mov_l_copy_loop)
+{
+	uint32_t src = reg(ic[0].arg[1]), dst = reg(ic[1].arg[1]);
+	uint32_t count = reg(ic[3].arg[1]);
+	uint32_t *src_p = (uint32_t *) cpu->cd.sh.host_load[src >> 12];
+	uint32_t *dst_p = (uint32_t *) cpu->cd.sh.host_store[dst >> 12];
+	int i, n = (0x1000 - (src & 0xfff)) >> 2,
+	    n_dst = (0x1000 - (dst & 0xfff)) >> 2;
+	uint32_t data;
+
+	if (cpu->delay_slot != NOT_DELAYED || src_p == NULL ||
+	    dst_p == NULL || ((src | dst) & 3) || count == 0) {
+		instr(mov_l_arg1_postinc_to_arg0)(cpu, ic);
+		return;
+	}
+
+	if (n > n_dst)
+		n = n_dst;
+	if ((uint32_t)n > count)
+		n = count;
+
+	src_p += (src & 0xfff) >> 2;
+	dst_p += (dst & 0xfff) >> 2;
+	for (i=0; i<n; i++)
+		dst_p[i] = src_p[i];
+
+	/*  The last word loaded is also the last word stored:  */
+	data = dst_p[n-1];
+	if (cpu->byte_order == EMUL_LITTLE_ENDIAN)
+		data = LE32_TO_HOST(data);
+	else
+		data = BE32_TO_HOST(data);
+	reg(ic[0].arg[0]) = data;
+
+	reg(ic[0].arg[1]) = src + sizeof(uint32_t) * n;
+	reg(ic[1].arg[1]) = dst + sizeof(uint32_t) * n;
+	reg(ic[3].arg[1]) = count - n;
+	cpu->n_translated_instrs += 5 * n - 1;
+	if (count == (uint32_t)n) {
+		cpu->cd.sh.sr |= SH_SR_T;
+		cpu->cd.sh.next_ic = &ic[5];
+	} else {
+		cpu->cd.sh.sr &= ~SH_SR_T;
+		cpu->cd.sh.next_ic = &ic[0];
+	}
+}
+
+
+/*
+ *  Argument checks for the combinations below. ic points to the first
+ *  instruction call in the sequence.
+ */
+static int COMBINE(check_fill_loop)(struct cpu *cpu, struct sh_instr_call *ic)
+{
+	return ic[0].arg[0] != ic[0].arg[1] && ic[1].arg[1] != ic[0].arg[0] &&
+	    ic[1].arg[1] != ic[0].arg[1] && ic[2].arg[1] == (size_t)&ic[0];
+}
+static int COMBINE(check_copy_loop)(struct cpu *cpu, struct sh_instr_call *ic)
+{
+	size_t rt = ic[0].arg[0], rs = ic[0].arg[1], rd = ic[1].arg[1],
+	    rc = ic[3].arg[1];
+
+	return ic[1].arg[0] == rt && ic[2].arg[1] == rd &&
+	    rt != rs && rt != rd && rt != rc && rs != rd && rs != rc &&
+	    rd != rc && ic[4].arg[1] == (size_t)&ic[0];
+}
+
+
+/*
+ *  Instruction combinations, checked by the generic code in cpu_dyntrans.cc
+ *  after each instruction has been translated. The first match is used, so
+ *  longer sequences must come before shorter ones.
+ */
+static struct sh_combination COMBINE(table)[] = {
+	{ 5, { instr(mov_l_arg1_postinc_to_arg0), instr(mov_l_store_rm_rn),
+	    instr(add_4_rn), instr(dt_rn), instr(bf_samepage) },
+	    COMBINE(check_copy_loop), instr(mov_l_copy_loop) },
+	{ 3, { instr(mov_l_rm_predec_rn), instr(dt_rn), instr(bf_samepage) },
+	    COMBINE(check_fill_loop), instr(mov_l_fill_loop) },
+	{ 3, { instr(mov_b_rm_predec_rn), instr(dt_rn), instr(bf_samepage) },
+	    COMBINE(check_fill_loop), instr(mov_b_fill_loop) },
+
+#define CMP_BT_BF(cmp)							\
+	{ 2, { instr(cmp), instr(bt_samepage) }, NULL,			\
+	    instr(cmp ## _bt_samepage) },				\
+	{ 2, { instr(cmp), instr(bf_samepage) }, NULL,			\
+	    instr(cmp ## _bf_samepage) }
+	CMP_BT_BF(cmpeq_imm_r0), CMP_BT_BF(cmpeq_rm_rn),
+	CMP_BT_BF(cmphs_rm_rn), CMP_BT_BF(cmpge_rm_rn),
+	CMP_BT_BF(cmphi_rm_rn), CMP_BT_BF(cmpgt_rm_rn),
+	CMP_BT_BF(cmppz_rn), CMP_BT_BF(cmppl_rn),
+	CMP_BT_BF(tst_imm_r0), CMP_BT_BF(tst_rm_rn), CMP_BT_BF(tst_rm),
+	CMP_BT_BF(dt_rn),
+#undef CMP_BT_BF
+
+	{ 2, { instr(mov_imm_rn), instr(mov_imm_rn) }, NULL,
+	    instr(mov_imm_rn_x2) },
+
+	{ 0, { NULL }, NULL, NULL }
+};
+
+
+/*****************************************************************************/
+
+
 X(end_of_page)
 {
 	/*  Update the PC:  (offset 0, but on the next page)  */
@@ -3961,8 +4194,10 @@ X(to_be_translated)
 	}
 
 
+#define	DYNTRANS_COMBINATIONS	COMBINE(table)
 #define	DYNTRANS_TO_BE_TRANSLATED_TAIL
 #include "cpu_dyntrans.cc"
 #undef	DYNTRANS_TO_BE_TRANSLATED_TAIL
+#undef	DYNTRANS_COMBINATIONS
 }
 
@@ -73,9 +73,9 @@ void f(int s, int func, int only_name)
 				printf("cpu->cd.arm.r[%i]", rm);
 			printf(";\n");
 			if (c != 0) {
-				printf("cpu->cd.arm.flags &= ~ARM_F_C;\n");
+				printf("ARM_FLAGS(cpu) &= ~ARM_F_C;\n");
 				printf("if (x & 0x%x)\n"
-				    "\tcpu->cd.arm.flags |= ARM_F_C;\n",
+				    "\tARM_FLAGS(cpu) |= ARM_F_C;\n",
 				    (int)(0x80000000 >> (c-1)));
 				printf("x <<= %i;\n", c);
 			}
@@ -101,11 +101,11 @@ void f(int s, int func, int only_name)
 			printf(";\n");
 			printf("  uint32_t y = cpu->cd.arm.r[%i] & 255;\n", rc);
 			printf("  if (y != 0) {\n");
-			printf("    cpu->cd.arm.flags &= ~ARM_F_C;\n");
+			printf("    ARM_FLAGS(cpu) &= ~ARM_F_C;\n");
 			printf("    if (y >= 32) return 0;\n");
 			printf("    x <<= (y - 1);\n");
 			printf("    if (x & 0x80000000)\n"
-			    "\tcpu->cd.arm.flags |= ARM_F_C;\n");
+			    "\tARM_FLAGS(cpu) |= ARM_F_C;\n");
 			printf("    x <<= 1;\n");
 			printf(" }\n");
 			printf(" return x; }\n");
@@ -133,9 +133,9 @@ void f(int s, int func, int only_name)
 			printf(";\n");
 			if (c == 0)
 				c = 32;
-			printf("cpu->cd.arm.flags &= ~ARM_F_C;\n");
+			printf("ARM_FLAGS(cpu) &= ~ARM_F_C;\n");
 			printf("if (x & 0x%x)\n"
-			    "\tcpu->cd.arm.flags |= ARM_F_C;\n",
+			    "\tARM_FLAGS(cpu) |= ARM_F_C;\n",
 			    (int)(1 << (c-1)));
 			if (c == 32)
 				printf("x = 0;\n");
@@ -164,11 +164,11 @@ void f(int s, int func, int only_name)
 				printf("cpu->cd.arm.r[%i]", rm);
 			printf(",y=cpu->cd.arm.r[%i]&255;\n", rc);
 			printf("if(y==0) return x;\n");
-			printf("cpu->cd.arm.flags &= ~ARM_F_C;\n");
+			printf("ARM_FLAGS(cpu) &= ~ARM_F_C;\n");
 			printf("if(y>31) y=32;\n");
 			printf("y--; x >>= y;\n");
 			printf("if (x & 1) "
-			    "cpu->cd.arm.flags |= ARM_F_C;\n");
+			    "ARM_FLAGS(cpu) |= ARM_F_C;\n");
 			printf(" return x >> 1; }\n");
 		} else {
 			printf("{ uint32_t y=cpu->cd.arm.r[%i]&255;\n", rc);
@@ -194,9 +194,9 @@ void f(int s, int func, int only_name)
 			printf(";\n");
 			if (c == 0)
 				c = 32;
-			printf("cpu->cd.arm.flags &= ~ARM_F_C;\n");
+			printf("ARM_FLAGS(cpu) &= ~ARM_F_C;\n");
 			printf("if (x & 0x%x)\n"
-			    "\tcpu->cd.arm.flags |= ARM_F_C;\n",
+			    "\tARM_FLAGS(cpu) |= ARM_F_C;\n",
 			    (int)(1 << (c-1)));
 			if (c == 32)
 				printf("x = (x<0)? 0xffffffff : 0;\n");
@@ -231,11 +231,11 @@ void f(int s, int func, int only_name)
 				printf("cpu->cd.arm.r[%i]", rm);
 			printf(",y=cpu->cd.arm.r[%i]&255;\n", rc);
 			printf("if(y==0) return x;\n");
-			printf("cpu->cd.arm.flags &= ~ARM_F_C;\n");
+			printf("ARM_FLAGS(cpu) &= ~ARM_F_C;\n");
 			printf("if(y>31) y=31;\n");
 			printf("y--; x >>= y;\n");
 			printf("if (x & 1) "
-			    "cpu->cd.arm.flags |= ARM_F_C;\n");
+			    "ARM_FLAGS(cpu) |= ARM_F_C;\n");
 			printf(" return (int32_t)x >> 1; }\n");
 		} else {
 			printf("{ int32_t y=cpu->cd.arm.r[%i]&255;\n", rc);
@@ -258,11 +258,11 @@ void f(int s, int func, int only_name)
 				printf("tmp");
 			else
 				printf("cpu->cd.arm.r[%i]",rm);
-			printf("; if (cpu->cd.arm.flags & ARM_F_C)"
+			printf("; if (ARM_FLAGS(cpu) & ARM_F_C)"
 			    " x |= 0x100000000ULL;");
 			if (s) {
-				printf("cpu->cd.arm.flags &= ~ARM_F_C;"
-				    "if(x&1) cpu->cd.arm.flags |= "
+				printf("ARM_FLAGS(cpu) &= ~ARM_F_C;"
+				    "if(x&1) ARM_FLAGS(cpu) |= "
 				    "ARM_F_C;");
 			}
 			printf("return x >> 1; }\n");
@@ -273,9 +273,9 @@ void f(int s, int func, int only_name)
 			else
 				printf("cpu->cd.arm.r[%i]", rm);
 			printf("; x |= (x << 32);\n");
-			printf("cpu->cd.arm.flags &= ~ARM_F_C;\n");
+			printf("ARM_FLAGS(cpu) &= ~ARM_F_C;\n");
 			printf("if (x & 0x%x)\n"
-			    "\tcpu->cd.arm.flags |= ARM_F_C;\n",
+			    "\tARM_FLAGS(cpu) |= ARM_F_C;\n",
 			    (int)(1 << (c-1)));
 			printf(" return x >> %i; }\n", c);
 		} else {
@@ -299,9 +299,9 @@ void f(int s, int func, int only_name)
 			printf("; int y=cpu->cd.arm.r[%i]&255;\n", rc);
 			printf("if(y==0) return x;\n");
 			printf("y --; y &= 31; x >>= y;\n");
-			printf("cpu->cd.arm.flags &= ~ARM_F_C;\n");
+			printf("ARM_FLAGS(cpu) &= ~ARM_F_C;\n");
 			printf("if (x & 1) "
-			    "cpu->cd.arm.flags |= ARM_F_C;\n");
+			    "ARM_FLAGS(cpu) |= ARM_F_C;\n");
 			printf(" return x >> 1; }\n");
 		} else {
 			printf("{ int y=cpu->cd.arm.r[%i]&31;\n", rc);
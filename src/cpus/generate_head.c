@@ -112,6 +112,7 @@ int main(int argc, char *argv[])
 	printf("#define DYNTRANS_PC_TO_POINTERS_GENERIC "
 	    "%s_pc_to_pointers_generic\n", a);
 	printf("#define COMBINE_INSTRUCTIONS %s_combine_instructions\n", a);
+	printf("#define DYNTRANS_COMBINATION %s_combination\n", a);
 	printf("#define DISASSEMBLE %s_cpu_disassemble_instr\n", a);
 
 	printf("\nextern volatile int single_step, single_step_breakpoint;"
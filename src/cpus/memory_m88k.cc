@@ -94,6 +94,65 @@ void m8820x_mark_page_as_modified(struct cpu *cpu,
 }
 
 
+/*
+ *  m8820x_batc_update():
+ *
+ *  Rebuilds the BATC range table of a CMMU. This must be called whenever
+ *  any of the BATC registers are modified.
+ *
+ *  The entries are processed in reverse order, so that if several valid
+ *  BATC entries map the same block, the lowest numbered one wins (which is
+ *  what a linear search would have found).
+ */
+void m8820x_batc_update(struct m8820x_cmmu *cmmu)
+{
+	int i;
+
+	memset(cmmu->batc_index, 0, sizeof(cmmu->batc_index));
+
+	for (i=N_M88200_BATC_REGS-1; i>=0; i--) {
+		uint32_t batc = cmmu->batc[i];
+
+		if (!(batc & BATC_V))
+			continue;
+
+		cmmu->batc_index[batc & BATC_SO? 1 : 0][batc >> 19] = i + 1;
+	}
+}
+
+
+/*
+ *  m8820x_patc_hash_remove():
+ *  m8820x_patc_hash_insert():
+ *
+ *  Unlink/link PATC entry i from/into the hash chain for the virtual page
+ *  currently stored in that entry.
+ */
+static void m8820x_patc_hash_remove(struct m8820x_cmmu *cmmu, int i)
+{
+	uint8_t *p = &cmmu->patc_hash[M8820X_PATC_HASH(
+	    cmmu->patc_v_and_control[i])];
+
+	while (*p != 0) {
+		if (*p == i + 1) {
+			*p = cmmu->patc_hash_next[i];
+			cmmu->patc_hash_next[i] = 0;
+			return;
+		}
+
+		p = &cmmu->patc_hash_next[*p - 1];
+	}
+}
+
+static void m8820x_patc_hash_insert(struct m8820x_cmmu *cmmu, int i)
+{
+	int h = M8820X_PATC_HASH(cmmu->patc_v_and_control[i]);
+
+	cmmu->patc_hash_next[i] = cmmu->patc_hash[h];
+	cmmu->patc_hash[h] = i + 1;
+}
+
+
 /*
  *  m88k_translate_v2p():
  *
@@ -147,23 +206,13 @@ int m88k_translate_v2p(struct cpu *cpu, uint64_t vaddr64,
 	 *  BATC lookup:
 	 *
 	 *  The BATC is a 10-entry array of virtual to physical mappings,
-	 *  where the top 13 bits of the virtual address must match.
+	 *  where the top 13 bits of the virtual address must match. The
+	 *  range table (see m8820x_batc_update()) gives the matching entry
+	 *  directly, for the current supervisor/user mode.
 	 */
-	for (i=0; i<N_M88200_BATC_REGS; i++) {
-		uint32_t batc = cmmu->batc[i];
-
-		/*  The batc entry must be valid:  */
-		if (!(batc & BATC_V))
-			continue;
-
-		/*  ... and have a matching supervisor/user bit:  */
-		if ((supervisor && !(batc & BATC_SO)) ||
-		    (!supervisor && (batc & BATC_SO)))
-			continue;
-
-		/*  ... and matching virtual address:  */
-		if ((vaddr & 0xfff80000) != (batc & 0xfff80000))
-			continue;
+	i = cmmu->batc_index[supervisor? 1 : 0][vaddr >> 19];
+	if (i != 0) {
+		uint32_t batc = cmmu->batc[i - 1];
 
 		/*  A matching BATC entry was found!  */
 
@@ -186,10 +235,17 @@ int m88k_translate_v2p(struct cpu *cpu, uint64_t vaddr64,
 	 *  4 KB pages. If writeflag is set, and a PATC entry is found without
 	 *  the Modified bit set, a page table search must be performed to
 	 *  set the Modified bit in emulated memory.
+	 *
+	 *  Only the entries in the hash chain for the virtual page need to
+	 *  be checked.
 	 */
-	for (i=0; i<N_M88200_PATC_ENTRIES; i++) {
-		uint32_t vaddr_and_control = cmmu->patc_v_and_control[i];
-		uint32_t paddr_and_sbit = cmmu->patc_p_and_supervisorbit[i];
+	for (i = cmmu->patc_hash[M8820X_PATC_HASH(vaddr)]; i != 0;
+	    i = cmmu->patc_hash_next[i]) {
+		uint32_t vaddr_and_control, paddr_and_sbit;
+
+		i --;
+		vaddr_and_control = cmmu->patc_v_and_control[i];
+		paddr_and_sbit = cmmu->patc_p_and_supervisorbit[i];
 
 		/*  Skip this entry if the valid bit isn't set:  */
 		if (!(vaddr_and_control & PG_V))
@@ -238,10 +294,18 @@ int m88k_translate_v2p(struct cpu *cpu, uint64_t vaddr64,
 	 */
 
 	/*
-	 *  Attempt a search through page tables, to refill the PATC:
+	 *  Attempt a search through page tables, to refill the PATC.
+	 *  (The host address of the segment table is cached, since it
+	 *  usually stays the same for many table walks in a row.)
 	 */
-	seg_base = (uint32_t *) memory_paddr_to_hostaddr(
-	    cpu->mem, apr & 0xfffff000, 1);
+	if (cmmu->last_seg_table_host == NULL ||
+	    cmmu->last_seg_table_paddr != (apr & 0xfffff000)) {
+		cmmu->last_seg_table_paddr = apr & 0xfffff000;
+		cmmu->last_seg_table_host = (uint32_t *)
+		    memory_paddr_to_hostaddr(cpu->mem, apr & 0xfffff000, 1);
+	}
+
+	seg_base = cmmu->last_seg_table_host;
 
 	seg_descriptor = seg_base[seg_nr];
 	if (cpu->byte_order == EMUL_LITTLE_ENDIAN)
@@ -326,6 +390,7 @@ int m88k_translate_v2p(struct cpu *cpu, uint64_t vaddr64,
 			    INVALIDATE_VADDR);
 
 		/*  ... and write the new one:  */
+		m8820x_patc_hash_remove(cmmu, i);
 		cmmu->patc_update_index ++;
 		cmmu->patc_update_index %= N_M88200_PATC_ENTRIES;
 		cmmu->patc_v_and_control[i] =
@@ -333,6 +398,7 @@ int m88k_translate_v2p(struct cpu *cpu, uint64_t vaddr64,
 		cmmu->patc_p_and_supervisorbit[i] =
 		    (page_descriptor & 0xfffff000) |
 		    (supervisor? M8820X_PATC_SUPERVISOR_BIT : 0);
+		m8820x_patc_hash_insert(cmmu, i);
 	}
 
 	/*  Check for writes to read-only pages:  */
@@ -99,6 +99,46 @@ int MEMORY_RW(struct cpu *cpu, struct memory *mem, uint64_t vaddr,
 			return MEMORY_ACCESS_FAILED;
 	}
 
+	/*
+	 *  Data accesses to watched pages end up here. On a hit, the access
+	 *  is completed, but the current run of translated code is ended
+	 *  right after the instruction (in the same way as for breakpoints),
+	 *  so that the debugger is entered with the pc pointing to the next
+	 *  instruction.
+	 *
+	 *  The pc is first synchronized (the same way as at the end of
+	 *  DYNTRANS_RUN_INSTR) to the instruction doing the access, so that
+	 *  it can be reported. An instruction in a delay slot can not be
+	 *  stopped after, since the branch has not been taken yet; only the
+	 *  run is cut short.
+	 */
+	if (cpu->machine->watchpoints.n > 0 && cache != CACHE_INSTRUCTION &&
+	    !no_exceptions) {
+		int was_single_stepping = single_step;
+		int low_pc = ((size_t)cpu->cd.DYNTRANS_ARCH.next_ic -
+		    (size_t)cpu->cd.DYNTRANS_ARCH.cur_ic_page) /
+		    sizeof(struct DYNTRANS_IC);
+		int synched = cpu->delay_slot == NOT_DELAYED &&
+		    low_pc >= 1 && low_pc <= DYNTRANS_IC_ENTRIES_PER_PAGE;
+
+		if (synched) {
+			cpu->pc &= ~((DYNTRANS_IC_ENTRIES_PER_PAGE-1) <<
+			    DYNTRANS_INSTR_ALIGNMENT_SHIFT);
+			cpu->pc += ((low_pc - 1) <<
+			    DYNTRANS_INSTR_ALIGNMENT_SHIFT);
+		}
+
+		if (machine_watchpoint_hit(cpu, vaddr, len, writeflag) >= 0 &&
+		    !was_single_stepping) {
+			cpu->n_translated_instrs = N_SAFE_DYNTRANS_LIMIT;
+
+			if (synched) {
+				cpu->pc += (1 << DYNTRANS_INSTR_ALIGNMENT_SHIFT);
+				cpu->cd.DYNTRANS_ARCH.next_ic = &nothing_call;
+			}
+		}
+	}
+
 
 	/*
 	 *  Memory mapped device?
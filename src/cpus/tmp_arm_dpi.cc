@@ -0,0 +1,7643 @@
+
+/*  AUTOMATICALLY GENERATED! Do not edit.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cpu.h"
+#include "misc.h"
+#define DYNTRANS_PC_TO_POINTERS arm_pc_to_pointers
+#include "quick_pc_to_pointers.h"
+#define reg(x) (*((uint32_t *)(x)))
+extern void arm_instr_nop(struct cpu *, struct arm_instr_call *);
+extern void arm_instr_invalid(struct cpu *, struct arm_instr_call *);
+extern void arm_pc_to_pointers(struct cpu *);
+#define A__NAME arm_instr_and
+#define A__NAME__eq arm_instr_and__eq
+#define A__NAME__ne arm_instr_and__ne
+#define A__NAME__cs arm_instr_and__cs
+#define A__NAME__cc arm_instr_and__cc
+#define A__NAME__mi arm_instr_and__mi
+#define A__NAME__pl arm_instr_and__pl
+#define A__NAME__vs arm_instr_and__vs
+#define A__NAME__vc arm_instr_and__vc
+#define A__NAME__hi arm_instr_and__hi
+#define A__NAME__ls arm_instr_and__ls
+#define A__NAME__ge arm_instr_and__ge
+#define A__NAME__lt arm_instr_and__lt
+#define A__NAME__gt arm_instr_and__gt
+#define A__NAME__le arm_instr_and__le
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eor
+#define A__NAME__eq arm_instr_eor__eq
+#define A__NAME__ne arm_instr_eor__ne
+#define A__NAME__cs arm_instr_eor__cs
+#define A__NAME__cc arm_instr_eor__cc
+#define A__NAME__mi arm_instr_eor__mi
+#define A__NAME__pl arm_instr_eor__pl
+#define A__NAME__vs arm_instr_eor__vs
+#define A__NAME__vc arm_instr_eor__vc
+#define A__NAME__hi arm_instr_eor__hi
+#define A__NAME__ls arm_instr_eor__ls
+#define A__NAME__ge arm_instr_eor__ge
+#define A__NAME__lt arm_instr_eor__lt
+#define A__NAME__gt arm_instr_eor__gt
+#define A__NAME__le arm_instr_eor__le
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sub
+#define A__NAME__eq arm_instr_sub__eq
+#define A__NAME__ne arm_instr_sub__ne
+#define A__NAME__cs arm_instr_sub__cs
+#define A__NAME__cc arm_instr_sub__cc
+#define A__NAME__mi arm_instr_sub__mi
+#define A__NAME__pl arm_instr_sub__pl
+#define A__NAME__vs arm_instr_sub__vs
+#define A__NAME__vc arm_instr_sub__vc
+#define A__NAME__hi arm_instr_sub__hi
+#define A__NAME__ls arm_instr_sub__ls
+#define A__NAME__ge arm_instr_sub__ge
+#define A__NAME__lt arm_instr_sub__lt
+#define A__NAME__gt arm_instr_sub__gt
+#define A__NAME__le arm_instr_sub__le
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsb
+#define A__NAME__eq arm_instr_rsb__eq
+#define A__NAME__ne arm_instr_rsb__ne
+#define A__NAME__cs arm_instr_rsb__cs
+#define A__NAME__cc arm_instr_rsb__cc
+#define A__NAME__mi arm_instr_rsb__mi
+#define A__NAME__pl arm_instr_rsb__pl
+#define A__NAME__vs arm_instr_rsb__vs
+#define A__NAME__vc arm_instr_rsb__vc
+#define A__NAME__hi arm_instr_rsb__hi
+#define A__NAME__ls arm_instr_rsb__ls
+#define A__NAME__ge arm_instr_rsb__ge
+#define A__NAME__lt arm_instr_rsb__lt
+#define A__NAME__gt arm_instr_rsb__gt
+#define A__NAME__le arm_instr_rsb__le
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_add
+#define A__NAME__eq arm_instr_add__eq
+#define A__NAME__ne arm_instr_add__ne
+#define A__NAME__cs arm_instr_add__cs
+#define A__NAME__cc arm_instr_add__cc
+#define A__NAME__mi arm_instr_add__mi
+#define A__NAME__pl arm_instr_add__pl
+#define A__NAME__vs arm_instr_add__vs
+#define A__NAME__vc arm_instr_add__vc
+#define A__NAME__hi arm_instr_add__hi
+#define A__NAME__ls arm_instr_add__ls
+#define A__NAME__ge arm_instr_add__ge
+#define A__NAME__lt arm_instr_add__lt
+#define A__NAME__gt arm_instr_add__gt
+#define A__NAME__le arm_instr_add__le
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adc
+#define A__NAME__eq arm_instr_adc__eq
+#define A__NAME__ne arm_instr_adc__ne
+#define A__NAME__cs arm_instr_adc__cs
+#define A__NAME__cc arm_instr_adc__cc
+#define A__NAME__mi arm_instr_adc__mi
+#define A__NAME__pl arm_instr_adc__pl
+#define A__NAME__vs arm_instr_adc__vs
+#define A__NAME__vc arm_instr_adc__vc
+#define A__NAME__hi arm_instr_adc__hi
+#define A__NAME__ls arm_instr_adc__ls
+#define A__NAME__ge arm_instr_adc__ge
+#define A__NAME__lt arm_instr_adc__lt
+#define A__NAME__gt arm_instr_adc__gt
+#define A__NAME__le arm_instr_adc__le
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbc
+#define A__NAME__eq arm_instr_sbc__eq
+#define A__NAME__ne arm_instr_sbc__ne
+#define A__NAME__cs arm_instr_sbc__cs
+#define A__NAME__cc arm_instr_sbc__cc
+#define A__NAME__mi arm_instr_sbc__mi
+#define A__NAME__pl arm_instr_sbc__pl
+#define A__NAME__vs arm_instr_sbc__vs
+#define A__NAME__vc arm_instr_sbc__vc
+#define A__NAME__hi arm_instr_sbc__hi
+#define A__NAME__ls arm_instr_sbc__ls
+#define A__NAME__ge arm_instr_sbc__ge
+#define A__NAME__lt arm_instr_sbc__lt
+#define A__NAME__gt arm_instr_sbc__gt
+#define A__NAME__le arm_instr_sbc__le
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsc
+#define A__NAME__eq arm_instr_rsc__eq
+#define A__NAME__ne arm_instr_rsc__ne
+#define A__NAME__cs arm_instr_rsc__cs
+#define A__NAME__cc arm_instr_rsc__cc
+#define A__NAME__mi arm_instr_rsc__mi
+#define A__NAME__pl arm_instr_rsc__pl
+#define A__NAME__vs arm_instr_rsc__vs
+#define A__NAME__vc arm_instr_rsc__vc
+#define A__NAME__hi arm_instr_rsc__hi
+#define A__NAME__ls arm_instr_rsc__ls
+#define A__NAME__ge arm_instr_rsc__ge
+#define A__NAME__lt arm_instr_rsc__lt
+#define A__NAME__gt arm_instr_rsc__gt
+#define A__NAME__le arm_instr_rsc__le
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orr
+#define A__NAME__eq arm_instr_orr__eq
+#define A__NAME__ne arm_instr_orr__ne
+#define A__NAME__cs arm_instr_orr__cs
+#define A__NAME__cc arm_instr_orr__cc
+#define A__NAME__mi arm_instr_orr__mi
+#define A__NAME__pl arm_instr_orr__pl
+#define A__NAME__vs arm_instr_orr__vs
+#define A__NAME__vc arm_instr_orr__vc
+#define A__NAME__hi arm_instr_orr__hi
+#define A__NAME__ls arm_instr_orr__ls
+#define A__NAME__ge arm_instr_orr__ge
+#define A__NAME__lt arm_instr_orr__lt
+#define A__NAME__gt arm_instr_orr__gt
+#define A__NAME__le arm_instr_orr__le
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mov
+#define A__NAME__eq arm_instr_mov__eq
+#define A__NAME__ne arm_instr_mov__ne
+#define A__NAME__cs arm_instr_mov__cs
+#define A__NAME__cc arm_instr_mov__cc
+#define A__NAME__mi arm_instr_mov__mi
+#define A__NAME__pl arm_instr_mov__pl
+#define A__NAME__vs arm_instr_mov__vs
+#define A__NAME__vc arm_instr_mov__vc
+#define A__NAME__hi arm_instr_mov__hi
+#define A__NAME__ls arm_instr_mov__ls
+#define A__NAME__ge arm_instr_mov__ge
+#define A__NAME__lt arm_instr_mov__lt
+#define A__NAME__gt arm_instr_mov__gt
+#define A__NAME__le arm_instr_mov__le
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bic
+#define A__NAME__eq arm_instr_bic__eq
+#define A__NAME__ne arm_instr_bic__ne
+#define A__NAME__cs arm_instr_bic__cs
+#define A__NAME__cc arm_instr_bic__cc
+#define A__NAME__mi arm_instr_bic__mi
+#define A__NAME__pl arm_instr_bic__pl
+#define A__NAME__vs arm_instr_bic__vs
+#define A__NAME__vc arm_instr_bic__vc
+#define A__NAME__hi arm_instr_bic__hi
+#define A__NAME__ls arm_instr_bic__ls
+#define A__NAME__ge arm_instr_bic__ge
+#define A__NAME__lt arm_instr_bic__lt
+#define A__NAME__gt arm_instr_bic__gt
+#define A__NAME__le arm_instr_bic__le
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvn
+#define A__NAME__eq arm_instr_mvn__eq
+#define A__NAME__ne arm_instr_mvn__ne
+#define A__NAME__cs arm_instr_mvn__cs
+#define A__NAME__cc arm_instr_mvn__cc
+#define A__NAME__mi arm_instr_mvn__mi
+#define A__NAME__pl arm_instr_mvn__pl
+#define A__NAME__vs arm_instr_mvn__vs
+#define A__NAME__vc arm_instr_mvn__vc
+#define A__NAME__hi arm_instr_mvn__hi
+#define A__NAME__ls arm_instr_mvn__ls
+#define A__NAME__ge arm_instr_mvn__ge
+#define A__NAME__lt arm_instr_mvn__lt
+#define A__NAME__gt arm_instr_mvn__gt
+#define A__NAME__le arm_instr_mvn__le
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_ands
+#define A__NAME__eq arm_instr_ands__eq
+#define A__NAME__ne arm_instr_ands__ne
+#define A__NAME__cs arm_instr_ands__cs
+#define A__NAME__cc arm_instr_ands__cc
+#define A__NAME__mi arm_instr_ands__mi
+#define A__NAME__pl arm_instr_ands__pl
+#define A__NAME__vs arm_instr_ands__vs
+#define A__NAME__vc arm_instr_ands__vc
+#define A__NAME__hi arm_instr_ands__hi
+#define A__NAME__ls arm_instr_ands__ls
+#define A__NAME__ge arm_instr_ands__ge
+#define A__NAME__lt arm_instr_ands__lt
+#define A__NAME__gt arm_instr_ands__gt
+#define A__NAME__le arm_instr_ands__le
+#define A__S
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eors
+#define A__NAME__eq arm_instr_eors__eq
+#define A__NAME__ne arm_instr_eors__ne
+#define A__NAME__cs arm_instr_eors__cs
+#define A__NAME__cc arm_instr_eors__cc
+#define A__NAME__mi arm_instr_eors__mi
+#define A__NAME__pl arm_instr_eors__pl
+#define A__NAME__vs arm_instr_eors__vs
+#define A__NAME__vc arm_instr_eors__vc
+#define A__NAME__hi arm_instr_eors__hi
+#define A__NAME__ls arm_instr_eors__ls
+#define A__NAME__ge arm_instr_eors__ge
+#define A__NAME__lt arm_instr_eors__lt
+#define A__NAME__gt arm_instr_eors__gt
+#define A__NAME__le arm_instr_eors__le
+#define A__S
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_subs
+#define A__NAME__eq arm_instr_subs__eq
+#define A__NAME__ne arm_instr_subs__ne
+#define A__NAME__cs arm_instr_subs__cs
+#define A__NAME__cc arm_instr_subs__cc
+#define A__NAME__mi arm_instr_subs__mi
+#define A__NAME__pl arm_instr_subs__pl
+#define A__NAME__vs arm_instr_subs__vs
+#define A__NAME__vc arm_instr_subs__vc
+#define A__NAME__hi arm_instr_subs__hi
+#define A__NAME__ls arm_instr_subs__ls
+#define A__NAME__ge arm_instr_subs__ge
+#define A__NAME__lt arm_instr_subs__lt
+#define A__NAME__gt arm_instr_subs__gt
+#define A__NAME__le arm_instr_subs__le
+#define A__S
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsbs
+#define A__NAME__eq arm_instr_rsbs__eq
+#define A__NAME__ne arm_instr_rsbs__ne
+#define A__NAME__cs arm_instr_rsbs__cs
+#define A__NAME__cc arm_instr_rsbs__cc
+#define A__NAME__mi arm_instr_rsbs__mi
+#define A__NAME__pl arm_instr_rsbs__pl
+#define A__NAME__vs arm_instr_rsbs__vs
+#define A__NAME__vc arm_instr_rsbs__vc
+#define A__NAME__hi arm_instr_rsbs__hi
+#define A__NAME__ls arm_instr_rsbs__ls
+#define A__NAME__ge arm_instr_rsbs__ge
+#define A__NAME__lt arm_instr_rsbs__lt
+#define A__NAME__gt arm_instr_rsbs__gt
+#define A__NAME__le arm_instr_rsbs__le
+#define A__S
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adds
+#define A__NAME__eq arm_instr_adds__eq
+#define A__NAME__ne arm_instr_adds__ne
+#define A__NAME__cs arm_instr_adds__cs
+#define A__NAME__cc arm_instr_adds__cc
+#define A__NAME__mi arm_instr_adds__mi
+#define A__NAME__pl arm_instr_adds__pl
+#define A__NAME__vs arm_instr_adds__vs
+#define A__NAME__vc arm_instr_adds__vc
+#define A__NAME__hi arm_instr_adds__hi
+#define A__NAME__ls arm_instr_adds__ls
+#define A__NAME__ge arm_instr_adds__ge
+#define A__NAME__lt arm_instr_adds__lt
+#define A__NAME__gt arm_instr_adds__gt
+#define A__NAME__le arm_instr_adds__le
+#define A__S
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adcs
+#define A__NAME__eq arm_instr_adcs__eq
+#define A__NAME__ne arm_instr_adcs__ne
+#define A__NAME__cs arm_instr_adcs__cs
+#define A__NAME__cc arm_instr_adcs__cc
+#define A__NAME__mi arm_instr_adcs__mi
+#define A__NAME__pl arm_instr_adcs__pl
+#define A__NAME__vs arm_instr_adcs__vs
+#define A__NAME__vc arm_instr_adcs__vc
+#define A__NAME__hi arm_instr_adcs__hi
+#define A__NAME__ls arm_instr_adcs__ls
+#define A__NAME__ge arm_instr_adcs__ge
+#define A__NAME__lt arm_instr_adcs__lt
+#define A__NAME__gt arm_instr_adcs__gt
+#define A__NAME__le arm_instr_adcs__le
+#define A__S
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbcs
+#define A__NAME__eq arm_instr_sbcs__eq
+#define A__NAME__ne arm_instr_sbcs__ne
+#define A__NAME__cs arm_instr_sbcs__cs
+#define A__NAME__cc arm_instr_sbcs__cc
+#define A__NAME__mi arm_instr_sbcs__mi
+#define A__NAME__pl arm_instr_sbcs__pl
+#define A__NAME__vs arm_instr_sbcs__vs
+#define A__NAME__vc arm_instr_sbcs__vc
+#define A__NAME__hi arm_instr_sbcs__hi
+#define A__NAME__ls arm_instr_sbcs__ls
+#define A__NAME__ge arm_instr_sbcs__ge
+#define A__NAME__lt arm_instr_sbcs__lt
+#define A__NAME__gt arm_instr_sbcs__gt
+#define A__NAME__le arm_instr_sbcs__le
+#define A__S
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rscs
+#define A__NAME__eq arm_instr_rscs__eq
+#define A__NAME__ne arm_instr_rscs__ne
+#define A__NAME__cs arm_instr_rscs__cs
+#define A__NAME__cc arm_instr_rscs__cc
+#define A__NAME__mi arm_instr_rscs__mi
+#define A__NAME__pl arm_instr_rscs__pl
+#define A__NAME__vs arm_instr_rscs__vs
+#define A__NAME__vc arm_instr_rscs__vc
+#define A__NAME__hi arm_instr_rscs__hi
+#define A__NAME__ls arm_instr_rscs__ls
+#define A__NAME__ge arm_instr_rscs__ge
+#define A__NAME__lt arm_instr_rscs__lt
+#define A__NAME__gt arm_instr_rscs__gt
+#define A__NAME__le arm_instr_rscs__le
+#define A__S
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_tsts
+#define A__NAME__eq arm_instr_tsts__eq
+#define A__NAME__ne arm_instr_tsts__ne
+#define A__NAME__cs arm_instr_tsts__cs
+#define A__NAME__cc arm_instr_tsts__cc
+#define A__NAME__mi arm_instr_tsts__mi
+#define A__NAME__pl arm_instr_tsts__pl
+#define A__NAME__vs arm_instr_tsts__vs
+#define A__NAME__vc arm_instr_tsts__vc
+#define A__NAME__hi arm_instr_tsts__hi
+#define A__NAME__ls arm_instr_tsts__ls
+#define A__NAME__ge arm_instr_tsts__ge
+#define A__NAME__lt arm_instr_tsts__lt
+#define A__NAME__gt arm_instr_tsts__gt
+#define A__NAME__le arm_instr_tsts__le
+#define A__S
+#define A__TST
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TST
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_teqs
+#define A__NAME__eq arm_instr_teqs__eq
+#define A__NAME__ne arm_instr_teqs__ne
+#define A__NAME__cs arm_instr_teqs__cs
+#define A__NAME__cc arm_instr_teqs__cc
+#define A__NAME__mi arm_instr_teqs__mi
+#define A__NAME__pl arm_instr_teqs__pl
+#define A__NAME__vs arm_instr_teqs__vs
+#define A__NAME__vc arm_instr_teqs__vc
+#define A__NAME__hi arm_instr_teqs__hi
+#define A__NAME__ls arm_instr_teqs__ls
+#define A__NAME__ge arm_instr_teqs__ge
+#define A__NAME__lt arm_instr_teqs__lt
+#define A__NAME__gt arm_instr_teqs__gt
+#define A__NAME__le arm_instr_teqs__le
+#define A__S
+#define A__TEQ
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TEQ
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmps
+#define A__NAME__eq arm_instr_cmps__eq
+#define A__NAME__ne arm_instr_cmps__ne
+#define A__NAME__cs arm_instr_cmps__cs
+#define A__NAME__cc arm_instr_cmps__cc
+#define A__NAME__mi arm_instr_cmps__mi
+#define A__NAME__pl arm_instr_cmps__pl
+#define A__NAME__vs arm_instr_cmps__vs
+#define A__NAME__vc arm_instr_cmps__vc
+#define A__NAME__hi arm_instr_cmps__hi
+#define A__NAME__ls arm_instr_cmps__ls
+#define A__NAME__ge arm_instr_cmps__ge
+#define A__NAME__lt arm_instr_cmps__lt
+#define A__NAME__gt arm_instr_cmps__gt
+#define A__NAME__le arm_instr_cmps__le
+#define A__S
+#define A__CMP
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMP
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmns
+#define A__NAME__eq arm_instr_cmns__eq
+#define A__NAME__ne arm_instr_cmns__ne
+#define A__NAME__cs arm_instr_cmns__cs
+#define A__NAME__cc arm_instr_cmns__cc
+#define A__NAME__mi arm_instr_cmns__mi
+#define A__NAME__pl arm_instr_cmns__pl
+#define A__NAME__vs arm_instr_cmns__vs
+#define A__NAME__vc arm_instr_cmns__vc
+#define A__NAME__hi arm_instr_cmns__hi
+#define A__NAME__ls arm_instr_cmns__ls
+#define A__NAME__ge arm_instr_cmns__ge
+#define A__NAME__lt arm_instr_cmns__lt
+#define A__NAME__gt arm_instr_cmns__gt
+#define A__NAME__le arm_instr_cmns__le
+#define A__S
+#define A__CMN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMN
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orrs
+#define A__NAME__eq arm_instr_orrs__eq
+#define A__NAME__ne arm_instr_orrs__ne
+#define A__NAME__cs arm_instr_orrs__cs
+#define A__NAME__cc arm_instr_orrs__cc
+#define A__NAME__mi arm_instr_orrs__mi
+#define A__NAME__pl arm_instr_orrs__pl
+#define A__NAME__vs arm_instr_orrs__vs
+#define A__NAME__vc arm_instr_orrs__vc
+#define A__NAME__hi arm_instr_orrs__hi
+#define A__NAME__ls arm_instr_orrs__ls
+#define A__NAME__ge arm_instr_orrs__ge
+#define A__NAME__lt arm_instr_orrs__lt
+#define A__NAME__gt arm_instr_orrs__gt
+#define A__NAME__le arm_instr_orrs__le
+#define A__S
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_movs
+#define A__NAME__eq arm_instr_movs__eq
+#define A__NAME__ne arm_instr_movs__ne
+#define A__NAME__cs arm_instr_movs__cs
+#define A__NAME__cc arm_instr_movs__cc
+#define A__NAME__mi arm_instr_movs__mi
+#define A__NAME__pl arm_instr_movs__pl
+#define A__NAME__vs arm_instr_movs__vs
+#define A__NAME__vc arm_instr_movs__vc
+#define A__NAME__hi arm_instr_movs__hi
+#define A__NAME__ls arm_instr_movs__ls
+#define A__NAME__ge arm_instr_movs__ge
+#define A__NAME__lt arm_instr_movs__lt
+#define A__NAME__gt arm_instr_movs__gt
+#define A__NAME__le arm_instr_movs__le
+#define A__S
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bics
+#define A__NAME__eq arm_instr_bics__eq
+#define A__NAME__ne arm_instr_bics__ne
+#define A__NAME__cs arm_instr_bics__cs
+#define A__NAME__cc arm_instr_bics__cc
+#define A__NAME__mi arm_instr_bics__mi
+#define A__NAME__pl arm_instr_bics__pl
+#define A__NAME__vs arm_instr_bics__vs
+#define A__NAME__vc arm_instr_bics__vc
+#define A__NAME__hi arm_instr_bics__hi
+#define A__NAME__ls arm_instr_bics__ls
+#define A__NAME__ge arm_instr_bics__ge
+#define A__NAME__lt arm_instr_bics__lt
+#define A__NAME__gt arm_instr_bics__gt
+#define A__NAME__le arm_instr_bics__le
+#define A__S
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvns
+#define A__NAME__eq arm_instr_mvns__eq
+#define A__NAME__ne arm_instr_mvns__ne
+#define A__NAME__cs arm_instr_mvns__cs
+#define A__NAME__cc arm_instr_mvns__cc
+#define A__NAME__mi arm_instr_mvns__mi
+#define A__NAME__pl arm_instr_mvns__pl
+#define A__NAME__vs arm_instr_mvns__vs
+#define A__NAME__vc arm_instr_mvns__vc
+#define A__NAME__hi arm_instr_mvns__hi
+#define A__NAME__ls arm_instr_mvns__ls
+#define A__NAME__ge arm_instr_mvns__ge
+#define A__NAME__lt arm_instr_mvns__lt
+#define A__NAME__gt arm_instr_mvns__gt
+#define A__NAME__le arm_instr_mvns__le
+#define A__S
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__S
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_and_pc
+#define A__NAME__eq arm_instr_and_pc__eq
+#define A__NAME__ne arm_instr_and_pc__ne
+#define A__NAME__cs arm_instr_and_pc__cs
+#define A__NAME__cc arm_instr_and_pc__cc
+#define A__NAME__mi arm_instr_and_pc__mi
+#define A__NAME__pl arm_instr_and_pc__pl
+#define A__NAME__vs arm_instr_and_pc__vs
+#define A__NAME__vc arm_instr_and_pc__vc
+#define A__NAME__hi arm_instr_and_pc__hi
+#define A__NAME__ls arm_instr_and_pc__ls
+#define A__NAME__ge arm_instr_and_pc__ge
+#define A__NAME__lt arm_instr_and_pc__lt
+#define A__NAME__gt arm_instr_and_pc__gt
+#define A__NAME__le arm_instr_and_pc__le
+#define A__PC
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eor_pc
+#define A__NAME__eq arm_instr_eor_pc__eq
+#define A__NAME__ne arm_instr_eor_pc__ne
+#define A__NAME__cs arm_instr_eor_pc__cs
+#define A__NAME__cc arm_instr_eor_pc__cc
+#define A__NAME__mi arm_instr_eor_pc__mi
+#define A__NAME__pl arm_instr_eor_pc__pl
+#define A__NAME__vs arm_instr_eor_pc__vs
+#define A__NAME__vc arm_instr_eor_pc__vc
+#define A__NAME__hi arm_instr_eor_pc__hi
+#define A__NAME__ls arm_instr_eor_pc__ls
+#define A__NAME__ge arm_instr_eor_pc__ge
+#define A__NAME__lt arm_instr_eor_pc__lt
+#define A__NAME__gt arm_instr_eor_pc__gt
+#define A__NAME__le arm_instr_eor_pc__le
+#define A__PC
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sub_pc
+#define A__NAME__eq arm_instr_sub_pc__eq
+#define A__NAME__ne arm_instr_sub_pc__ne
+#define A__NAME__cs arm_instr_sub_pc__cs
+#define A__NAME__cc arm_instr_sub_pc__cc
+#define A__NAME__mi arm_instr_sub_pc__mi
+#define A__NAME__pl arm_instr_sub_pc__pl
+#define A__NAME__vs arm_instr_sub_pc__vs
+#define A__NAME__vc arm_instr_sub_pc__vc
+#define A__NAME__hi arm_instr_sub_pc__hi
+#define A__NAME__ls arm_instr_sub_pc__ls
+#define A__NAME__ge arm_instr_sub_pc__ge
+#define A__NAME__lt arm_instr_sub_pc__lt
+#define A__NAME__gt arm_instr_sub_pc__gt
+#define A__NAME__le arm_instr_sub_pc__le
+#define A__PC
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsb_pc
+#define A__NAME__eq arm_instr_rsb_pc__eq
+#define A__NAME__ne arm_instr_rsb_pc__ne
+#define A__NAME__cs arm_instr_rsb_pc__cs
+#define A__NAME__cc arm_instr_rsb_pc__cc
+#define A__NAME__mi arm_instr_rsb_pc__mi
+#define A__NAME__pl arm_instr_rsb_pc__pl
+#define A__NAME__vs arm_instr_rsb_pc__vs
+#define A__NAME__vc arm_instr_rsb_pc__vc
+#define A__NAME__hi arm_instr_rsb_pc__hi
+#define A__NAME__ls arm_instr_rsb_pc__ls
+#define A__NAME__ge arm_instr_rsb_pc__ge
+#define A__NAME__lt arm_instr_rsb_pc__lt
+#define A__NAME__gt arm_instr_rsb_pc__gt
+#define A__NAME__le arm_instr_rsb_pc__le
+#define A__PC
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_add_pc
+#define A__NAME__eq arm_instr_add_pc__eq
+#define A__NAME__ne arm_instr_add_pc__ne
+#define A__NAME__cs arm_instr_add_pc__cs
+#define A__NAME__cc arm_instr_add_pc__cc
+#define A__NAME__mi arm_instr_add_pc__mi
+#define A__NAME__pl arm_instr_add_pc__pl
+#define A__NAME__vs arm_instr_add_pc__vs
+#define A__NAME__vc arm_instr_add_pc__vc
+#define A__NAME__hi arm_instr_add_pc__hi
+#define A__NAME__ls arm_instr_add_pc__ls
+#define A__NAME__ge arm_instr_add_pc__ge
+#define A__NAME__lt arm_instr_add_pc__lt
+#define A__NAME__gt arm_instr_add_pc__gt
+#define A__NAME__le arm_instr_add_pc__le
+#define A__PC
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adc_pc
+#define A__NAME__eq arm_instr_adc_pc__eq
+#define A__NAME__ne arm_instr_adc_pc__ne
+#define A__NAME__cs arm_instr_adc_pc__cs
+#define A__NAME__cc arm_instr_adc_pc__cc
+#define A__NAME__mi arm_instr_adc_pc__mi
+#define A__NAME__pl arm_instr_adc_pc__pl
+#define A__NAME__vs arm_instr_adc_pc__vs
+#define A__NAME__vc arm_instr_adc_pc__vc
+#define A__NAME__hi arm_instr_adc_pc__hi
+#define A__NAME__ls arm_instr_adc_pc__ls
+#define A__NAME__ge arm_instr_adc_pc__ge
+#define A__NAME__lt arm_instr_adc_pc__lt
+#define A__NAME__gt arm_instr_adc_pc__gt
+#define A__NAME__le arm_instr_adc_pc__le
+#define A__PC
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbc_pc
+#define A__NAME__eq arm_instr_sbc_pc__eq
+#define A__NAME__ne arm_instr_sbc_pc__ne
+#define A__NAME__cs arm_instr_sbc_pc__cs
+#define A__NAME__cc arm_instr_sbc_pc__cc
+#define A__NAME__mi arm_instr_sbc_pc__mi
+#define A__NAME__pl arm_instr_sbc_pc__pl
+#define A__NAME__vs arm_instr_sbc_pc__vs
+#define A__NAME__vc arm_instr_sbc_pc__vc
+#define A__NAME__hi arm_instr_sbc_pc__hi
+#define A__NAME__ls arm_instr_sbc_pc__ls
+#define A__NAME__ge arm_instr_sbc_pc__ge
+#define A__NAME__lt arm_instr_sbc_pc__lt
+#define A__NAME__gt arm_instr_sbc_pc__gt
+#define A__NAME__le arm_instr_sbc_pc__le
+#define A__PC
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsc_pc
+#define A__NAME__eq arm_instr_rsc_pc__eq
+#define A__NAME__ne arm_instr_rsc_pc__ne
+#define A__NAME__cs arm_instr_rsc_pc__cs
+#define A__NAME__cc arm_instr_rsc_pc__cc
+#define A__NAME__mi arm_instr_rsc_pc__mi
+#define A__NAME__pl arm_instr_rsc_pc__pl
+#define A__NAME__vs arm_instr_rsc_pc__vs
+#define A__NAME__vc arm_instr_rsc_pc__vc
+#define A__NAME__hi arm_instr_rsc_pc__hi
+#define A__NAME__ls arm_instr_rsc_pc__ls
+#define A__NAME__ge arm_instr_rsc_pc__ge
+#define A__NAME__lt arm_instr_rsc_pc__lt
+#define A__NAME__gt arm_instr_rsc_pc__gt
+#define A__NAME__le arm_instr_rsc_pc__le
+#define A__PC
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orr_pc
+#define A__NAME__eq arm_instr_orr_pc__eq
+#define A__NAME__ne arm_instr_orr_pc__ne
+#define A__NAME__cs arm_instr_orr_pc__cs
+#define A__NAME__cc arm_instr_orr_pc__cc
+#define A__NAME__mi arm_instr_orr_pc__mi
+#define A__NAME__pl arm_instr_orr_pc__pl
+#define A__NAME__vs arm_instr_orr_pc__vs
+#define A__NAME__vc arm_instr_orr_pc__vc
+#define A__NAME__hi arm_instr_orr_pc__hi
+#define A__NAME__ls arm_instr_orr_pc__ls
+#define A__NAME__ge arm_instr_orr_pc__ge
+#define A__NAME__lt arm_instr_orr_pc__lt
+#define A__NAME__gt arm_instr_orr_pc__gt
+#define A__NAME__le arm_instr_orr_pc__le
+#define A__PC
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mov_pc
+#define A__NAME__eq arm_instr_mov_pc__eq
+#define A__NAME__ne arm_instr_mov_pc__ne
+#define A__NAME__cs arm_instr_mov_pc__cs
+#define A__NAME__cc arm_instr_mov_pc__cc
+#define A__NAME__mi arm_instr_mov_pc__mi
+#define A__NAME__pl arm_instr_mov_pc__pl
+#define A__NAME__vs arm_instr_mov_pc__vs
+#define A__NAME__vc arm_instr_mov_pc__vc
+#define A__NAME__hi arm_instr_mov_pc__hi
+#define A__NAME__ls arm_instr_mov_pc__ls
+#define A__NAME__ge arm_instr_mov_pc__ge
+#define A__NAME__lt arm_instr_mov_pc__lt
+#define A__NAME__gt arm_instr_mov_pc__gt
+#define A__NAME__le arm_instr_mov_pc__le
+#define A__PC
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bic_pc
+#define A__NAME__eq arm_instr_bic_pc__eq
+#define A__NAME__ne arm_instr_bic_pc__ne
+#define A__NAME__cs arm_instr_bic_pc__cs
+#define A__NAME__cc arm_instr_bic_pc__cc
+#define A__NAME__mi arm_instr_bic_pc__mi
+#define A__NAME__pl arm_instr_bic_pc__pl
+#define A__NAME__vs arm_instr_bic_pc__vs
+#define A__NAME__vc arm_instr_bic_pc__vc
+#define A__NAME__hi arm_instr_bic_pc__hi
+#define A__NAME__ls arm_instr_bic_pc__ls
+#define A__NAME__ge arm_instr_bic_pc__ge
+#define A__NAME__lt arm_instr_bic_pc__lt
+#define A__NAME__gt arm_instr_bic_pc__gt
+#define A__NAME__le arm_instr_bic_pc__le
+#define A__PC
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvn_pc
+#define A__NAME__eq arm_instr_mvn_pc__eq
+#define A__NAME__ne arm_instr_mvn_pc__ne
+#define A__NAME__cs arm_instr_mvn_pc__cs
+#define A__NAME__cc arm_instr_mvn_pc__cc
+#define A__NAME__mi arm_instr_mvn_pc__mi
+#define A__NAME__pl arm_instr_mvn_pc__pl
+#define A__NAME__vs arm_instr_mvn_pc__vs
+#define A__NAME__vc arm_instr_mvn_pc__vc
+#define A__NAME__hi arm_instr_mvn_pc__hi
+#define A__NAME__ls arm_instr_mvn_pc__ls
+#define A__NAME__ge arm_instr_mvn_pc__ge
+#define A__NAME__lt arm_instr_mvn_pc__lt
+#define A__NAME__gt arm_instr_mvn_pc__gt
+#define A__NAME__le arm_instr_mvn_pc__le
+#define A__PC
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_ands_pc
+#define A__NAME__eq arm_instr_ands_pc__eq
+#define A__NAME__ne arm_instr_ands_pc__ne
+#define A__NAME__cs arm_instr_ands_pc__cs
+#define A__NAME__cc arm_instr_ands_pc__cc
+#define A__NAME__mi arm_instr_ands_pc__mi
+#define A__NAME__pl arm_instr_ands_pc__pl
+#define A__NAME__vs arm_instr_ands_pc__vs
+#define A__NAME__vc arm_instr_ands_pc__vc
+#define A__NAME__hi arm_instr_ands_pc__hi
+#define A__NAME__ls arm_instr_ands_pc__ls
+#define A__NAME__ge arm_instr_ands_pc__ge
+#define A__NAME__lt arm_instr_ands_pc__lt
+#define A__NAME__gt arm_instr_ands_pc__gt
+#define A__NAME__le arm_instr_ands_pc__le
+#define A__S
+#define A__PC
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eors_pc
+#define A__NAME__eq arm_instr_eors_pc__eq
+#define A__NAME__ne arm_instr_eors_pc__ne
+#define A__NAME__cs arm_instr_eors_pc__cs
+#define A__NAME__cc arm_instr_eors_pc__cc
+#define A__NAME__mi arm_instr_eors_pc__mi
+#define A__NAME__pl arm_instr_eors_pc__pl
+#define A__NAME__vs arm_instr_eors_pc__vs
+#define A__NAME__vc arm_instr_eors_pc__vc
+#define A__NAME__hi arm_instr_eors_pc__hi
+#define A__NAME__ls arm_instr_eors_pc__ls
+#define A__NAME__ge arm_instr_eors_pc__ge
+#define A__NAME__lt arm_instr_eors_pc__lt
+#define A__NAME__gt arm_instr_eors_pc__gt
+#define A__NAME__le arm_instr_eors_pc__le
+#define A__S
+#define A__PC
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_subs_pc
+#define A__NAME__eq arm_instr_subs_pc__eq
+#define A__NAME__ne arm_instr_subs_pc__ne
+#define A__NAME__cs arm_instr_subs_pc__cs
+#define A__NAME__cc arm_instr_subs_pc__cc
+#define A__NAME__mi arm_instr_subs_pc__mi
+#define A__NAME__pl arm_instr_subs_pc__pl
+#define A__NAME__vs arm_instr_subs_pc__vs
+#define A__NAME__vc arm_instr_subs_pc__vc
+#define A__NAME__hi arm_instr_subs_pc__hi
+#define A__NAME__ls arm_instr_subs_pc__ls
+#define A__NAME__ge arm_instr_subs_pc__ge
+#define A__NAME__lt arm_instr_subs_pc__lt
+#define A__NAME__gt arm_instr_subs_pc__gt
+#define A__NAME__le arm_instr_subs_pc__le
+#define A__S
+#define A__PC
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsbs_pc
+#define A__NAME__eq arm_instr_rsbs_pc__eq
+#define A__NAME__ne arm_instr_rsbs_pc__ne
+#define A__NAME__cs arm_instr_rsbs_pc__cs
+#define A__NAME__cc arm_instr_rsbs_pc__cc
+#define A__NAME__mi arm_instr_rsbs_pc__mi
+#define A__NAME__pl arm_instr_rsbs_pc__pl
+#define A__NAME__vs arm_instr_rsbs_pc__vs
+#define A__NAME__vc arm_instr_rsbs_pc__vc
+#define A__NAME__hi arm_instr_rsbs_pc__hi
+#define A__NAME__ls arm_instr_rsbs_pc__ls
+#define A__NAME__ge arm_instr_rsbs_pc__ge
+#define A__NAME__lt arm_instr_rsbs_pc__lt
+#define A__NAME__gt arm_instr_rsbs_pc__gt
+#define A__NAME__le arm_instr_rsbs_pc__le
+#define A__S
+#define A__PC
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adds_pc
+#define A__NAME__eq arm_instr_adds_pc__eq
+#define A__NAME__ne arm_instr_adds_pc__ne
+#define A__NAME__cs arm_instr_adds_pc__cs
+#define A__NAME__cc arm_instr_adds_pc__cc
+#define A__NAME__mi arm_instr_adds_pc__mi
+#define A__NAME__pl arm_instr_adds_pc__pl
+#define A__NAME__vs arm_instr_adds_pc__vs
+#define A__NAME__vc arm_instr_adds_pc__vc
+#define A__NAME__hi arm_instr_adds_pc__hi
+#define A__NAME__ls arm_instr_adds_pc__ls
+#define A__NAME__ge arm_instr_adds_pc__ge
+#define A__NAME__lt arm_instr_adds_pc__lt
+#define A__NAME__gt arm_instr_adds_pc__gt
+#define A__NAME__le arm_instr_adds_pc__le
+#define A__S
+#define A__PC
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adcs_pc
+#define A__NAME__eq arm_instr_adcs_pc__eq
+#define A__NAME__ne arm_instr_adcs_pc__ne
+#define A__NAME__cs arm_instr_adcs_pc__cs
+#define A__NAME__cc arm_instr_adcs_pc__cc
+#define A__NAME__mi arm_instr_adcs_pc__mi
+#define A__NAME__pl arm_instr_adcs_pc__pl
+#define A__NAME__vs arm_instr_adcs_pc__vs
+#define A__NAME__vc arm_instr_adcs_pc__vc
+#define A__NAME__hi arm_instr_adcs_pc__hi
+#define A__NAME__ls arm_instr_adcs_pc__ls
+#define A__NAME__ge arm_instr_adcs_pc__ge
+#define A__NAME__lt arm_instr_adcs_pc__lt
+#define A__NAME__gt arm_instr_adcs_pc__gt
+#define A__NAME__le arm_instr_adcs_pc__le
+#define A__S
+#define A__PC
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbcs_pc
+#define A__NAME__eq arm_instr_sbcs_pc__eq
+#define A__NAME__ne arm_instr_sbcs_pc__ne
+#define A__NAME__cs arm_instr_sbcs_pc__cs
+#define A__NAME__cc arm_instr_sbcs_pc__cc
+#define A__NAME__mi arm_instr_sbcs_pc__mi
+#define A__NAME__pl arm_instr_sbcs_pc__pl
+#define A__NAME__vs arm_instr_sbcs_pc__vs
+#define A__NAME__vc arm_instr_sbcs_pc__vc
+#define A__NAME__hi arm_instr_sbcs_pc__hi
+#define A__NAME__ls arm_instr_sbcs_pc__ls
+#define A__NAME__ge arm_instr_sbcs_pc__ge
+#define A__NAME__lt arm_instr_sbcs_pc__lt
+#define A__NAME__gt arm_instr_sbcs_pc__gt
+#define A__NAME__le arm_instr_sbcs_pc__le
+#define A__S
+#define A__PC
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rscs_pc
+#define A__NAME__eq arm_instr_rscs_pc__eq
+#define A__NAME__ne arm_instr_rscs_pc__ne
+#define A__NAME__cs arm_instr_rscs_pc__cs
+#define A__NAME__cc arm_instr_rscs_pc__cc
+#define A__NAME__mi arm_instr_rscs_pc__mi
+#define A__NAME__pl arm_instr_rscs_pc__pl
+#define A__NAME__vs arm_instr_rscs_pc__vs
+#define A__NAME__vc arm_instr_rscs_pc__vc
+#define A__NAME__hi arm_instr_rscs_pc__hi
+#define A__NAME__ls arm_instr_rscs_pc__ls
+#define A__NAME__ge arm_instr_rscs_pc__ge
+#define A__NAME__lt arm_instr_rscs_pc__lt
+#define A__NAME__gt arm_instr_rscs_pc__gt
+#define A__NAME__le arm_instr_rscs_pc__le
+#define A__S
+#define A__PC
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_tsts_pc
+#define A__NAME__eq arm_instr_tsts_pc__eq
+#define A__NAME__ne arm_instr_tsts_pc__ne
+#define A__NAME__cs arm_instr_tsts_pc__cs
+#define A__NAME__cc arm_instr_tsts_pc__cc
+#define A__NAME__mi arm_instr_tsts_pc__mi
+#define A__NAME__pl arm_instr_tsts_pc__pl
+#define A__NAME__vs arm_instr_tsts_pc__vs
+#define A__NAME__vc arm_instr_tsts_pc__vc
+#define A__NAME__hi arm_instr_tsts_pc__hi
+#define A__NAME__ls arm_instr_tsts_pc__ls
+#define A__NAME__ge arm_instr_tsts_pc__ge
+#define A__NAME__lt arm_instr_tsts_pc__lt
+#define A__NAME__gt arm_instr_tsts_pc__gt
+#define A__NAME__le arm_instr_tsts_pc__le
+#define A__S
+#define A__PC
+#define A__TST
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TST
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_teqs_pc
+#define A__NAME__eq arm_instr_teqs_pc__eq
+#define A__NAME__ne arm_instr_teqs_pc__ne
+#define A__NAME__cs arm_instr_teqs_pc__cs
+#define A__NAME__cc arm_instr_teqs_pc__cc
+#define A__NAME__mi arm_instr_teqs_pc__mi
+#define A__NAME__pl arm_instr_teqs_pc__pl
+#define A__NAME__vs arm_instr_teqs_pc__vs
+#define A__NAME__vc arm_instr_teqs_pc__vc
+#define A__NAME__hi arm_instr_teqs_pc__hi
+#define A__NAME__ls arm_instr_teqs_pc__ls
+#define A__NAME__ge arm_instr_teqs_pc__ge
+#define A__NAME__lt arm_instr_teqs_pc__lt
+#define A__NAME__gt arm_instr_teqs_pc__gt
+#define A__NAME__le arm_instr_teqs_pc__le
+#define A__S
+#define A__PC
+#define A__TEQ
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TEQ
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmps_pc
+#define A__NAME__eq arm_instr_cmps_pc__eq
+#define A__NAME__ne arm_instr_cmps_pc__ne
+#define A__NAME__cs arm_instr_cmps_pc__cs
+#define A__NAME__cc arm_instr_cmps_pc__cc
+#define A__NAME__mi arm_instr_cmps_pc__mi
+#define A__NAME__pl arm_instr_cmps_pc__pl
+#define A__NAME__vs arm_instr_cmps_pc__vs
+#define A__NAME__vc arm_instr_cmps_pc__vc
+#define A__NAME__hi arm_instr_cmps_pc__hi
+#define A__NAME__ls arm_instr_cmps_pc__ls
+#define A__NAME__ge arm_instr_cmps_pc__ge
+#define A__NAME__lt arm_instr_cmps_pc__lt
+#define A__NAME__gt arm_instr_cmps_pc__gt
+#define A__NAME__le arm_instr_cmps_pc__le
+#define A__S
+#define A__PC
+#define A__CMP
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMP
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmns_pc
+#define A__NAME__eq arm_instr_cmns_pc__eq
+#define A__NAME__ne arm_instr_cmns_pc__ne
+#define A__NAME__cs arm_instr_cmns_pc__cs
+#define A__NAME__cc arm_instr_cmns_pc__cc
+#define A__NAME__mi arm_instr_cmns_pc__mi
+#define A__NAME__pl arm_instr_cmns_pc__pl
+#define A__NAME__vs arm_instr_cmns_pc__vs
+#define A__NAME__vc arm_instr_cmns_pc__vc
+#define A__NAME__hi arm_instr_cmns_pc__hi
+#define A__NAME__ls arm_instr_cmns_pc__ls
+#define A__NAME__ge arm_instr_cmns_pc__ge
+#define A__NAME__lt arm_instr_cmns_pc__lt
+#define A__NAME__gt arm_instr_cmns_pc__gt
+#define A__NAME__le arm_instr_cmns_pc__le
+#define A__S
+#define A__PC
+#define A__CMN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMN
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orrs_pc
+#define A__NAME__eq arm_instr_orrs_pc__eq
+#define A__NAME__ne arm_instr_orrs_pc__ne
+#define A__NAME__cs arm_instr_orrs_pc__cs
+#define A__NAME__cc arm_instr_orrs_pc__cc
+#define A__NAME__mi arm_instr_orrs_pc__mi
+#define A__NAME__pl arm_instr_orrs_pc__pl
+#define A__NAME__vs arm_instr_orrs_pc__vs
+#define A__NAME__vc arm_instr_orrs_pc__vc
+#define A__NAME__hi arm_instr_orrs_pc__hi
+#define A__NAME__ls arm_instr_orrs_pc__ls
+#define A__NAME__ge arm_instr_orrs_pc__ge
+#define A__NAME__lt arm_instr_orrs_pc__lt
+#define A__NAME__gt arm_instr_orrs_pc__gt
+#define A__NAME__le arm_instr_orrs_pc__le
+#define A__S
+#define A__PC
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_movs_pc
+#define A__NAME__eq arm_instr_movs_pc__eq
+#define A__NAME__ne arm_instr_movs_pc__ne
+#define A__NAME__cs arm_instr_movs_pc__cs
+#define A__NAME__cc arm_instr_movs_pc__cc
+#define A__NAME__mi arm_instr_movs_pc__mi
+#define A__NAME__pl arm_instr_movs_pc__pl
+#define A__NAME__vs arm_instr_movs_pc__vs
+#define A__NAME__vc arm_instr_movs_pc__vc
+#define A__NAME__hi arm_instr_movs_pc__hi
+#define A__NAME__ls arm_instr_movs_pc__ls
+#define A__NAME__ge arm_instr_movs_pc__ge
+#define A__NAME__lt arm_instr_movs_pc__lt
+#define A__NAME__gt arm_instr_movs_pc__gt
+#define A__NAME__le arm_instr_movs_pc__le
+#define A__S
+#define A__PC
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bics_pc
+#define A__NAME__eq arm_instr_bics_pc__eq
+#define A__NAME__ne arm_instr_bics_pc__ne
+#define A__NAME__cs arm_instr_bics_pc__cs
+#define A__NAME__cc arm_instr_bics_pc__cc
+#define A__NAME__mi arm_instr_bics_pc__mi
+#define A__NAME__pl arm_instr_bics_pc__pl
+#define A__NAME__vs arm_instr_bics_pc__vs
+#define A__NAME__vc arm_instr_bics_pc__vc
+#define A__NAME__hi arm_instr_bics_pc__hi
+#define A__NAME__ls arm_instr_bics_pc__ls
+#define A__NAME__ge arm_instr_bics_pc__ge
+#define A__NAME__lt arm_instr_bics_pc__lt
+#define A__NAME__gt arm_instr_bics_pc__gt
+#define A__NAME__le arm_instr_bics_pc__le
+#define A__S
+#define A__PC
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvns_pc
+#define A__NAME__eq arm_instr_mvns_pc__eq
+#define A__NAME__ne arm_instr_mvns_pc__ne
+#define A__NAME__cs arm_instr_mvns_pc__cs
+#define A__NAME__cc arm_instr_mvns_pc__cc
+#define A__NAME__mi arm_instr_mvns_pc__mi
+#define A__NAME__pl arm_instr_mvns_pc__pl
+#define A__NAME__vs arm_instr_mvns_pc__vs
+#define A__NAME__vc arm_instr_mvns_pc__vc
+#define A__NAME__hi arm_instr_mvns_pc__hi
+#define A__NAME__ls arm_instr_mvns_pc__ls
+#define A__NAME__ge arm_instr_mvns_pc__ge
+#define A__NAME__lt arm_instr_mvns_pc__lt
+#define A__NAME__gt arm_instr_mvns_pc__gt
+#define A__NAME__le arm_instr_mvns_pc__le
+#define A__S
+#define A__PC
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__S
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_and_reg
+#define A__NAME__eq arm_instr_and_reg__eq
+#define A__NAME__ne arm_instr_and_reg__ne
+#define A__NAME__cs arm_instr_and_reg__cs
+#define A__NAME__cc arm_instr_and_reg__cc
+#define A__NAME__mi arm_instr_and_reg__mi
+#define A__NAME__pl arm_instr_and_reg__pl
+#define A__NAME__vs arm_instr_and_reg__vs
+#define A__NAME__vc arm_instr_and_reg__vc
+#define A__NAME__hi arm_instr_and_reg__hi
+#define A__NAME__ls arm_instr_and_reg__ls
+#define A__NAME__ge arm_instr_and_reg__ge
+#define A__NAME__lt arm_instr_and_reg__lt
+#define A__NAME__gt arm_instr_and_reg__gt
+#define A__NAME__le arm_instr_and_reg__le
+#define A__REG
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eor_reg
+#define A__NAME__eq arm_instr_eor_reg__eq
+#define A__NAME__ne arm_instr_eor_reg__ne
+#define A__NAME__cs arm_instr_eor_reg__cs
+#define A__NAME__cc arm_instr_eor_reg__cc
+#define A__NAME__mi arm_instr_eor_reg__mi
+#define A__NAME__pl arm_instr_eor_reg__pl
+#define A__NAME__vs arm_instr_eor_reg__vs
+#define A__NAME__vc arm_instr_eor_reg__vc
+#define A__NAME__hi arm_instr_eor_reg__hi
+#define A__NAME__ls arm_instr_eor_reg__ls
+#define A__NAME__ge arm_instr_eor_reg__ge
+#define A__NAME__lt arm_instr_eor_reg__lt
+#define A__NAME__gt arm_instr_eor_reg__gt
+#define A__NAME__le arm_instr_eor_reg__le
+#define A__REG
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sub_reg
+#define A__NAME__eq arm_instr_sub_reg__eq
+#define A__NAME__ne arm_instr_sub_reg__ne
+#define A__NAME__cs arm_instr_sub_reg__cs
+#define A__NAME__cc arm_instr_sub_reg__cc
+#define A__NAME__mi arm_instr_sub_reg__mi
+#define A__NAME__pl arm_instr_sub_reg__pl
+#define A__NAME__vs arm_instr_sub_reg__vs
+#define A__NAME__vc arm_instr_sub_reg__vc
+#define A__NAME__hi arm_instr_sub_reg__hi
+#define A__NAME__ls arm_instr_sub_reg__ls
+#define A__NAME__ge arm_instr_sub_reg__ge
+#define A__NAME__lt arm_instr_sub_reg__lt
+#define A__NAME__gt arm_instr_sub_reg__gt
+#define A__NAME__le arm_instr_sub_reg__le
+#define A__REG
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsb_reg
+#define A__NAME__eq arm_instr_rsb_reg__eq
+#define A__NAME__ne arm_instr_rsb_reg__ne
+#define A__NAME__cs arm_instr_rsb_reg__cs
+#define A__NAME__cc arm_instr_rsb_reg__cc
+#define A__NAME__mi arm_instr_rsb_reg__mi
+#define A__NAME__pl arm_instr_rsb_reg__pl
+#define A__NAME__vs arm_instr_rsb_reg__vs
+#define A__NAME__vc arm_instr_rsb_reg__vc
+#define A__NAME__hi arm_instr_rsb_reg__hi
+#define A__NAME__ls arm_instr_rsb_reg__ls
+#define A__NAME__ge arm_instr_rsb_reg__ge
+#define A__NAME__lt arm_instr_rsb_reg__lt
+#define A__NAME__gt arm_instr_rsb_reg__gt
+#define A__NAME__le arm_instr_rsb_reg__le
+#define A__REG
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_add_reg
+#define A__NAME__eq arm_instr_add_reg__eq
+#define A__NAME__ne arm_instr_add_reg__ne
+#define A__NAME__cs arm_instr_add_reg__cs
+#define A__NAME__cc arm_instr_add_reg__cc
+#define A__NAME__mi arm_instr_add_reg__mi
+#define A__NAME__pl arm_instr_add_reg__pl
+#define A__NAME__vs arm_instr_add_reg__vs
+#define A__NAME__vc arm_instr_add_reg__vc
+#define A__NAME__hi arm_instr_add_reg__hi
+#define A__NAME__ls arm_instr_add_reg__ls
+#define A__NAME__ge arm_instr_add_reg__ge
+#define A__NAME__lt arm_instr_add_reg__lt
+#define A__NAME__gt arm_instr_add_reg__gt
+#define A__NAME__le arm_instr_add_reg__le
+#define A__REG
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adc_reg
+#define A__NAME__eq arm_instr_adc_reg__eq
+#define A__NAME__ne arm_instr_adc_reg__ne
+#define A__NAME__cs arm_instr_adc_reg__cs
+#define A__NAME__cc arm_instr_adc_reg__cc
+#define A__NAME__mi arm_instr_adc_reg__mi
+#define A__NAME__pl arm_instr_adc_reg__pl
+#define A__NAME__vs arm_instr_adc_reg__vs
+#define A__NAME__vc arm_instr_adc_reg__vc
+#define A__NAME__hi arm_instr_adc_reg__hi
+#define A__NAME__ls arm_instr_adc_reg__ls
+#define A__NAME__ge arm_instr_adc_reg__ge
+#define A__NAME__lt arm_instr_adc_reg__lt
+#define A__NAME__gt arm_instr_adc_reg__gt
+#define A__NAME__le arm_instr_adc_reg__le
+#define A__REG
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbc_reg
+#define A__NAME__eq arm_instr_sbc_reg__eq
+#define A__NAME__ne arm_instr_sbc_reg__ne
+#define A__NAME__cs arm_instr_sbc_reg__cs
+#define A__NAME__cc arm_instr_sbc_reg__cc
+#define A__NAME__mi arm_instr_sbc_reg__mi
+#define A__NAME__pl arm_instr_sbc_reg__pl
+#define A__NAME__vs arm_instr_sbc_reg__vs
+#define A__NAME__vc arm_instr_sbc_reg__vc
+#define A__NAME__hi arm_instr_sbc_reg__hi
+#define A__NAME__ls arm_instr_sbc_reg__ls
+#define A__NAME__ge arm_instr_sbc_reg__ge
+#define A__NAME__lt arm_instr_sbc_reg__lt
+#define A__NAME__gt arm_instr_sbc_reg__gt
+#define A__NAME__le arm_instr_sbc_reg__le
+#define A__REG
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsc_reg
+#define A__NAME__eq arm_instr_rsc_reg__eq
+#define A__NAME__ne arm_instr_rsc_reg__ne
+#define A__NAME__cs arm_instr_rsc_reg__cs
+#define A__NAME__cc arm_instr_rsc_reg__cc
+#define A__NAME__mi arm_instr_rsc_reg__mi
+#define A__NAME__pl arm_instr_rsc_reg__pl
+#define A__NAME__vs arm_instr_rsc_reg__vs
+#define A__NAME__vc arm_instr_rsc_reg__vc
+#define A__NAME__hi arm_instr_rsc_reg__hi
+#define A__NAME__ls arm_instr_rsc_reg__ls
+#define A__NAME__ge arm_instr_rsc_reg__ge
+#define A__NAME__lt arm_instr_rsc_reg__lt
+#define A__NAME__gt arm_instr_rsc_reg__gt
+#define A__NAME__le arm_instr_rsc_reg__le
+#define A__REG
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orr_reg
+#define A__NAME__eq arm_instr_orr_reg__eq
+#define A__NAME__ne arm_instr_orr_reg__ne
+#define A__NAME__cs arm_instr_orr_reg__cs
+#define A__NAME__cc arm_instr_orr_reg__cc
+#define A__NAME__mi arm_instr_orr_reg__mi
+#define A__NAME__pl arm_instr_orr_reg__pl
+#define A__NAME__vs arm_instr_orr_reg__vs
+#define A__NAME__vc arm_instr_orr_reg__vc
+#define A__NAME__hi arm_instr_orr_reg__hi
+#define A__NAME__ls arm_instr_orr_reg__ls
+#define A__NAME__ge arm_instr_orr_reg__ge
+#define A__NAME__lt arm_instr_orr_reg__lt
+#define A__NAME__gt arm_instr_orr_reg__gt
+#define A__NAME__le arm_instr_orr_reg__le
+#define A__REG
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mov_reg
+#define A__NAME__eq arm_instr_mov_reg__eq
+#define A__NAME__ne arm_instr_mov_reg__ne
+#define A__NAME__cs arm_instr_mov_reg__cs
+#define A__NAME__cc arm_instr_mov_reg__cc
+#define A__NAME__mi arm_instr_mov_reg__mi
+#define A__NAME__pl arm_instr_mov_reg__pl
+#define A__NAME__vs arm_instr_mov_reg__vs
+#define A__NAME__vc arm_instr_mov_reg__vc
+#define A__NAME__hi arm_instr_mov_reg__hi
+#define A__NAME__ls arm_instr_mov_reg__ls
+#define A__NAME__ge arm_instr_mov_reg__ge
+#define A__NAME__lt arm_instr_mov_reg__lt
+#define A__NAME__gt arm_instr_mov_reg__gt
+#define A__NAME__le arm_instr_mov_reg__le
+#define A__REG
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bic_reg
+#define A__NAME__eq arm_instr_bic_reg__eq
+#define A__NAME__ne arm_instr_bic_reg__ne
+#define A__NAME__cs arm_instr_bic_reg__cs
+#define A__NAME__cc arm_instr_bic_reg__cc
+#define A__NAME__mi arm_instr_bic_reg__mi
+#define A__NAME__pl arm_instr_bic_reg__pl
+#define A__NAME__vs arm_instr_bic_reg__vs
+#define A__NAME__vc arm_instr_bic_reg__vc
+#define A__NAME__hi arm_instr_bic_reg__hi
+#define A__NAME__ls arm_instr_bic_reg__ls
+#define A__NAME__ge arm_instr_bic_reg__ge
+#define A__NAME__lt arm_instr_bic_reg__lt
+#define A__NAME__gt arm_instr_bic_reg__gt
+#define A__NAME__le arm_instr_bic_reg__le
+#define A__REG
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvn_reg
+#define A__NAME__eq arm_instr_mvn_reg__eq
+#define A__NAME__ne arm_instr_mvn_reg__ne
+#define A__NAME__cs arm_instr_mvn_reg__cs
+#define A__NAME__cc arm_instr_mvn_reg__cc
+#define A__NAME__mi arm_instr_mvn_reg__mi
+#define A__NAME__pl arm_instr_mvn_reg__pl
+#define A__NAME__vs arm_instr_mvn_reg__vs
+#define A__NAME__vc arm_instr_mvn_reg__vc
+#define A__NAME__hi arm_instr_mvn_reg__hi
+#define A__NAME__ls arm_instr_mvn_reg__ls
+#define A__NAME__ge arm_instr_mvn_reg__ge
+#define A__NAME__lt arm_instr_mvn_reg__lt
+#define A__NAME__gt arm_instr_mvn_reg__gt
+#define A__NAME__le arm_instr_mvn_reg__le
+#define A__REG
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_ands_reg
+#define A__NAME__eq arm_instr_ands_reg__eq
+#define A__NAME__ne arm_instr_ands_reg__ne
+#define A__NAME__cs arm_instr_ands_reg__cs
+#define A__NAME__cc arm_instr_ands_reg__cc
+#define A__NAME__mi arm_instr_ands_reg__mi
+#define A__NAME__pl arm_instr_ands_reg__pl
+#define A__NAME__vs arm_instr_ands_reg__vs
+#define A__NAME__vc arm_instr_ands_reg__vc
+#define A__NAME__hi arm_instr_ands_reg__hi
+#define A__NAME__ls arm_instr_ands_reg__ls
+#define A__NAME__ge arm_instr_ands_reg__ge
+#define A__NAME__lt arm_instr_ands_reg__lt
+#define A__NAME__gt arm_instr_ands_reg__gt
+#define A__NAME__le arm_instr_ands_reg__le
+#define A__S
+#define A__REG
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eors_reg
+#define A__NAME__eq arm_instr_eors_reg__eq
+#define A__NAME__ne arm_instr_eors_reg__ne
+#define A__NAME__cs arm_instr_eors_reg__cs
+#define A__NAME__cc arm_instr_eors_reg__cc
+#define A__NAME__mi arm_instr_eors_reg__mi
+#define A__NAME__pl arm_instr_eors_reg__pl
+#define A__NAME__vs arm_instr_eors_reg__vs
+#define A__NAME__vc arm_instr_eors_reg__vc
+#define A__NAME__hi arm_instr_eors_reg__hi
+#define A__NAME__ls arm_instr_eors_reg__ls
+#define A__NAME__ge arm_instr_eors_reg__ge
+#define A__NAME__lt arm_instr_eors_reg__lt
+#define A__NAME__gt arm_instr_eors_reg__gt
+#define A__NAME__le arm_instr_eors_reg__le
+#define A__S
+#define A__REG
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_subs_reg
+#define A__NAME__eq arm_instr_subs_reg__eq
+#define A__NAME__ne arm_instr_subs_reg__ne
+#define A__NAME__cs arm_instr_subs_reg__cs
+#define A__NAME__cc arm_instr_subs_reg__cc
+#define A__NAME__mi arm_instr_subs_reg__mi
+#define A__NAME__pl arm_instr_subs_reg__pl
+#define A__NAME__vs arm_instr_subs_reg__vs
+#define A__NAME__vc arm_instr_subs_reg__vc
+#define A__NAME__hi arm_instr_subs_reg__hi
+#define A__NAME__ls arm_instr_subs_reg__ls
+#define A__NAME__ge arm_instr_subs_reg__ge
+#define A__NAME__lt arm_instr_subs_reg__lt
+#define A__NAME__gt arm_instr_subs_reg__gt
+#define A__NAME__le arm_instr_subs_reg__le
+#define A__S
+#define A__REG
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsbs_reg
+#define A__NAME__eq arm_instr_rsbs_reg__eq
+#define A__NAME__ne arm_instr_rsbs_reg__ne
+#define A__NAME__cs arm_instr_rsbs_reg__cs
+#define A__NAME__cc arm_instr_rsbs_reg__cc
+#define A__NAME__mi arm_instr_rsbs_reg__mi
+#define A__NAME__pl arm_instr_rsbs_reg__pl
+#define A__NAME__vs arm_instr_rsbs_reg__vs
+#define A__NAME__vc arm_instr_rsbs_reg__vc
+#define A__NAME__hi arm_instr_rsbs_reg__hi
+#define A__NAME__ls arm_instr_rsbs_reg__ls
+#define A__NAME__ge arm_instr_rsbs_reg__ge
+#define A__NAME__lt arm_instr_rsbs_reg__lt
+#define A__NAME__gt arm_instr_rsbs_reg__gt
+#define A__NAME__le arm_instr_rsbs_reg__le
+#define A__S
+#define A__REG
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adds_reg
+#define A__NAME__eq arm_instr_adds_reg__eq
+#define A__NAME__ne arm_instr_adds_reg__ne
+#define A__NAME__cs arm_instr_adds_reg__cs
+#define A__NAME__cc arm_instr_adds_reg__cc
+#define A__NAME__mi arm_instr_adds_reg__mi
+#define A__NAME__pl arm_instr_adds_reg__pl
+#define A__NAME__vs arm_instr_adds_reg__vs
+#define A__NAME__vc arm_instr_adds_reg__vc
+#define A__NAME__hi arm_instr_adds_reg__hi
+#define A__NAME__ls arm_instr_adds_reg__ls
+#define A__NAME__ge arm_instr_adds_reg__ge
+#define A__NAME__lt arm_instr_adds_reg__lt
+#define A__NAME__gt arm_instr_adds_reg__gt
+#define A__NAME__le arm_instr_adds_reg__le
+#define A__S
+#define A__REG
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adcs_reg
+#define A__NAME__eq arm_instr_adcs_reg__eq
+#define A__NAME__ne arm_instr_adcs_reg__ne
+#define A__NAME__cs arm_instr_adcs_reg__cs
+#define A__NAME__cc arm_instr_adcs_reg__cc
+#define A__NAME__mi arm_instr_adcs_reg__mi
+#define A__NAME__pl arm_instr_adcs_reg__pl
+#define A__NAME__vs arm_instr_adcs_reg__vs
+#define A__NAME__vc arm_instr_adcs_reg__vc
+#define A__NAME__hi arm_instr_adcs_reg__hi
+#define A__NAME__ls arm_instr_adcs_reg__ls
+#define A__NAME__ge arm_instr_adcs_reg__ge
+#define A__NAME__lt arm_instr_adcs_reg__lt
+#define A__NAME__gt arm_instr_adcs_reg__gt
+#define A__NAME__le arm_instr_adcs_reg__le
+#define A__S
+#define A__REG
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbcs_reg
+#define A__NAME__eq arm_instr_sbcs_reg__eq
+#define A__NAME__ne arm_instr_sbcs_reg__ne
+#define A__NAME__cs arm_instr_sbcs_reg__cs
+#define A__NAME__cc arm_instr_sbcs_reg__cc
+#define A__NAME__mi arm_instr_sbcs_reg__mi
+#define A__NAME__pl arm_instr_sbcs_reg__pl
+#define A__NAME__vs arm_instr_sbcs_reg__vs
+#define A__NAME__vc arm_instr_sbcs_reg__vc
+#define A__NAME__hi arm_instr_sbcs_reg__hi
+#define A__NAME__ls arm_instr_sbcs_reg__ls
+#define A__NAME__ge arm_instr_sbcs_reg__ge
+#define A__NAME__lt arm_instr_sbcs_reg__lt
+#define A__NAME__gt arm_instr_sbcs_reg__gt
+#define A__NAME__le arm_instr_sbcs_reg__le
+#define A__S
+#define A__REG
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rscs_reg
+#define A__NAME__eq arm_instr_rscs_reg__eq
+#define A__NAME__ne arm_instr_rscs_reg__ne
+#define A__NAME__cs arm_instr_rscs_reg__cs
+#define A__NAME__cc arm_instr_rscs_reg__cc
+#define A__NAME__mi arm_instr_rscs_reg__mi
+#define A__NAME__pl arm_instr_rscs_reg__pl
+#define A__NAME__vs arm_instr_rscs_reg__vs
+#define A__NAME__vc arm_instr_rscs_reg__vc
+#define A__NAME__hi arm_instr_rscs_reg__hi
+#define A__NAME__ls arm_instr_rscs_reg__ls
+#define A__NAME__ge arm_instr_rscs_reg__ge
+#define A__NAME__lt arm_instr_rscs_reg__lt
+#define A__NAME__gt arm_instr_rscs_reg__gt
+#define A__NAME__le arm_instr_rscs_reg__le
+#define A__S
+#define A__REG
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_tsts_reg
+#define A__NAME__eq arm_instr_tsts_reg__eq
+#define A__NAME__ne arm_instr_tsts_reg__ne
+#define A__NAME__cs arm_instr_tsts_reg__cs
+#define A__NAME__cc arm_instr_tsts_reg__cc
+#define A__NAME__mi arm_instr_tsts_reg__mi
+#define A__NAME__pl arm_instr_tsts_reg__pl
+#define A__NAME__vs arm_instr_tsts_reg__vs
+#define A__NAME__vc arm_instr_tsts_reg__vc
+#define A__NAME__hi arm_instr_tsts_reg__hi
+#define A__NAME__ls arm_instr_tsts_reg__ls
+#define A__NAME__ge arm_instr_tsts_reg__ge
+#define A__NAME__lt arm_instr_tsts_reg__lt
+#define A__NAME__gt arm_instr_tsts_reg__gt
+#define A__NAME__le arm_instr_tsts_reg__le
+#define A__S
+#define A__REG
+#define A__TST
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TST
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_teqs_reg
+#define A__NAME__eq arm_instr_teqs_reg__eq
+#define A__NAME__ne arm_instr_teqs_reg__ne
+#define A__NAME__cs arm_instr_teqs_reg__cs
+#define A__NAME__cc arm_instr_teqs_reg__cc
+#define A__NAME__mi arm_instr_teqs_reg__mi
+#define A__NAME__pl arm_instr_teqs_reg__pl
+#define A__NAME__vs arm_instr_teqs_reg__vs
+#define A__NAME__vc arm_instr_teqs_reg__vc
+#define A__NAME__hi arm_instr_teqs_reg__hi
+#define A__NAME__ls arm_instr_teqs_reg__ls
+#define A__NAME__ge arm_instr_teqs_reg__ge
+#define A__NAME__lt arm_instr_teqs_reg__lt
+#define A__NAME__gt arm_instr_teqs_reg__gt
+#define A__NAME__le arm_instr_teqs_reg__le
+#define A__S
+#define A__REG
+#define A__TEQ
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TEQ
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmps_reg
+#define A__NAME__eq arm_instr_cmps_reg__eq
+#define A__NAME__ne arm_instr_cmps_reg__ne
+#define A__NAME__cs arm_instr_cmps_reg__cs
+#define A__NAME__cc arm_instr_cmps_reg__cc
+#define A__NAME__mi arm_instr_cmps_reg__mi
+#define A__NAME__pl arm_instr_cmps_reg__pl
+#define A__NAME__vs arm_instr_cmps_reg__vs
+#define A__NAME__vc arm_instr_cmps_reg__vc
+#define A__NAME__hi arm_instr_cmps_reg__hi
+#define A__NAME__ls arm_instr_cmps_reg__ls
+#define A__NAME__ge arm_instr_cmps_reg__ge
+#define A__NAME__lt arm_instr_cmps_reg__lt
+#define A__NAME__gt arm_instr_cmps_reg__gt
+#define A__NAME__le arm_instr_cmps_reg__le
+#define A__S
+#define A__REG
+#define A__CMP
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMP
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmns_reg
+#define A__NAME__eq arm_instr_cmns_reg__eq
+#define A__NAME__ne arm_instr_cmns_reg__ne
+#define A__NAME__cs arm_instr_cmns_reg__cs
+#define A__NAME__cc arm_instr_cmns_reg__cc
+#define A__NAME__mi arm_instr_cmns_reg__mi
+#define A__NAME__pl arm_instr_cmns_reg__pl
+#define A__NAME__vs arm_instr_cmns_reg__vs
+#define A__NAME__vc arm_instr_cmns_reg__vc
+#define A__NAME__hi arm_instr_cmns_reg__hi
+#define A__NAME__ls arm_instr_cmns_reg__ls
+#define A__NAME__ge arm_instr_cmns_reg__ge
+#define A__NAME__lt arm_instr_cmns_reg__lt
+#define A__NAME__gt arm_instr_cmns_reg__gt
+#define A__NAME__le arm_instr_cmns_reg__le
+#define A__S
+#define A__REG
+#define A__CMN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMN
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orrs_reg
+#define A__NAME__eq arm_instr_orrs_reg__eq
+#define A__NAME__ne arm_instr_orrs_reg__ne
+#define A__NAME__cs arm_instr_orrs_reg__cs
+#define A__NAME__cc arm_instr_orrs_reg__cc
+#define A__NAME__mi arm_instr_orrs_reg__mi
+#define A__NAME__pl arm_instr_orrs_reg__pl
+#define A__NAME__vs arm_instr_orrs_reg__vs
+#define A__NAME__vc arm_instr_orrs_reg__vc
+#define A__NAME__hi arm_instr_orrs_reg__hi
+#define A__NAME__ls arm_instr_orrs_reg__ls
+#define A__NAME__ge arm_instr_orrs_reg__ge
+#define A__NAME__lt arm_instr_orrs_reg__lt
+#define A__NAME__gt arm_instr_orrs_reg__gt
+#define A__NAME__le arm_instr_orrs_reg__le
+#define A__S
+#define A__REG
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_movs_reg
+#define A__NAME__eq arm_instr_movs_reg__eq
+#define A__NAME__ne arm_instr_movs_reg__ne
+#define A__NAME__cs arm_instr_movs_reg__cs
+#define A__NAME__cc arm_instr_movs_reg__cc
+#define A__NAME__mi arm_instr_movs_reg__mi
+#define A__NAME__pl arm_instr_movs_reg__pl
+#define A__NAME__vs arm_instr_movs_reg__vs
+#define A__NAME__vc arm_instr_movs_reg__vc
+#define A__NAME__hi arm_instr_movs_reg__hi
+#define A__NAME__ls arm_instr_movs_reg__ls
+#define A__NAME__ge arm_instr_movs_reg__ge
+#define A__NAME__lt arm_instr_movs_reg__lt
+#define A__NAME__gt arm_instr_movs_reg__gt
+#define A__NAME__le arm_instr_movs_reg__le
+#define A__S
+#define A__REG
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bics_reg
+#define A__NAME__eq arm_instr_bics_reg__eq
+#define A__NAME__ne arm_instr_bics_reg__ne
+#define A__NAME__cs arm_instr_bics_reg__cs
+#define A__NAME__cc arm_instr_bics_reg__cc
+#define A__NAME__mi arm_instr_bics_reg__mi
+#define A__NAME__pl arm_instr_bics_reg__pl
+#define A__NAME__vs arm_instr_bics_reg__vs
+#define A__NAME__vc arm_instr_bics_reg__vc
+#define A__NAME__hi arm_instr_bics_reg__hi
+#define A__NAME__ls arm_instr_bics_reg__ls
+#define A__NAME__ge arm_instr_bics_reg__ge
+#define A__NAME__lt arm_instr_bics_reg__lt
+#define A__NAME__gt arm_instr_bics_reg__gt
+#define A__NAME__le arm_instr_bics_reg__le
+#define A__S
+#define A__REG
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvns_reg
+#define A__NAME__eq arm_instr_mvns_reg__eq
+#define A__NAME__ne arm_instr_mvns_reg__ne
+#define A__NAME__cs arm_instr_mvns_reg__cs
+#define A__NAME__cc arm_instr_mvns_reg__cc
+#define A__NAME__mi arm_instr_mvns_reg__mi
+#define A__NAME__pl arm_instr_mvns_reg__pl
+#define A__NAME__vs arm_instr_mvns_reg__vs
+#define A__NAME__vc arm_instr_mvns_reg__vc
+#define A__NAME__hi arm_instr_mvns_reg__hi
+#define A__NAME__ls arm_instr_mvns_reg__ls
+#define A__NAME__ge arm_instr_mvns_reg__ge
+#define A__NAME__lt arm_instr_mvns_reg__lt
+#define A__NAME__gt arm_instr_mvns_reg__gt
+#define A__NAME__le arm_instr_mvns_reg__le
+#define A__S
+#define A__REG
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__S
+#undef A__REG
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_and_pc_reg
+#define A__NAME__eq arm_instr_and_pc_reg__eq
+#define A__NAME__ne arm_instr_and_pc_reg__ne
+#define A__NAME__cs arm_instr_and_pc_reg__cs
+#define A__NAME__cc arm_instr_and_pc_reg__cc
+#define A__NAME__mi arm_instr_and_pc_reg__mi
+#define A__NAME__pl arm_instr_and_pc_reg__pl
+#define A__NAME__vs arm_instr_and_pc_reg__vs
+#define A__NAME__vc arm_instr_and_pc_reg__vc
+#define A__NAME__hi arm_instr_and_pc_reg__hi
+#define A__NAME__ls arm_instr_and_pc_reg__ls
+#define A__NAME__ge arm_instr_and_pc_reg__ge
+#define A__NAME__lt arm_instr_and_pc_reg__lt
+#define A__NAME__gt arm_instr_and_pc_reg__gt
+#define A__NAME__le arm_instr_and_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eor_pc_reg
+#define A__NAME__eq arm_instr_eor_pc_reg__eq
+#define A__NAME__ne arm_instr_eor_pc_reg__ne
+#define A__NAME__cs arm_instr_eor_pc_reg__cs
+#define A__NAME__cc arm_instr_eor_pc_reg__cc
+#define A__NAME__mi arm_instr_eor_pc_reg__mi
+#define A__NAME__pl arm_instr_eor_pc_reg__pl
+#define A__NAME__vs arm_instr_eor_pc_reg__vs
+#define A__NAME__vc arm_instr_eor_pc_reg__vc
+#define A__NAME__hi arm_instr_eor_pc_reg__hi
+#define A__NAME__ls arm_instr_eor_pc_reg__ls
+#define A__NAME__ge arm_instr_eor_pc_reg__ge
+#define A__NAME__lt arm_instr_eor_pc_reg__lt
+#define A__NAME__gt arm_instr_eor_pc_reg__gt
+#define A__NAME__le arm_instr_eor_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sub_pc_reg
+#define A__NAME__eq arm_instr_sub_pc_reg__eq
+#define A__NAME__ne arm_instr_sub_pc_reg__ne
+#define A__NAME__cs arm_instr_sub_pc_reg__cs
+#define A__NAME__cc arm_instr_sub_pc_reg__cc
+#define A__NAME__mi arm_instr_sub_pc_reg__mi
+#define A__NAME__pl arm_instr_sub_pc_reg__pl
+#define A__NAME__vs arm_instr_sub_pc_reg__vs
+#define A__NAME__vc arm_instr_sub_pc_reg__vc
+#define A__NAME__hi arm_instr_sub_pc_reg__hi
+#define A__NAME__ls arm_instr_sub_pc_reg__ls
+#define A__NAME__ge arm_instr_sub_pc_reg__ge
+#define A__NAME__lt arm_instr_sub_pc_reg__lt
+#define A__NAME__gt arm_instr_sub_pc_reg__gt
+#define A__NAME__le arm_instr_sub_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsb_pc_reg
+#define A__NAME__eq arm_instr_rsb_pc_reg__eq
+#define A__NAME__ne arm_instr_rsb_pc_reg__ne
+#define A__NAME__cs arm_instr_rsb_pc_reg__cs
+#define A__NAME__cc arm_instr_rsb_pc_reg__cc
+#define A__NAME__mi arm_instr_rsb_pc_reg__mi
+#define A__NAME__pl arm_instr_rsb_pc_reg__pl
+#define A__NAME__vs arm_instr_rsb_pc_reg__vs
+#define A__NAME__vc arm_instr_rsb_pc_reg__vc
+#define A__NAME__hi arm_instr_rsb_pc_reg__hi
+#define A__NAME__ls arm_instr_rsb_pc_reg__ls
+#define A__NAME__ge arm_instr_rsb_pc_reg__ge
+#define A__NAME__lt arm_instr_rsb_pc_reg__lt
+#define A__NAME__gt arm_instr_rsb_pc_reg__gt
+#define A__NAME__le arm_instr_rsb_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_add_pc_reg
+#define A__NAME__eq arm_instr_add_pc_reg__eq
+#define A__NAME__ne arm_instr_add_pc_reg__ne
+#define A__NAME__cs arm_instr_add_pc_reg__cs
+#define A__NAME__cc arm_instr_add_pc_reg__cc
+#define A__NAME__mi arm_instr_add_pc_reg__mi
+#define A__NAME__pl arm_instr_add_pc_reg__pl
+#define A__NAME__vs arm_instr_add_pc_reg__vs
+#define A__NAME__vc arm_instr_add_pc_reg__vc
+#define A__NAME__hi arm_instr_add_pc_reg__hi
+#define A__NAME__ls arm_instr_add_pc_reg__ls
+#define A__NAME__ge arm_instr_add_pc_reg__ge
+#define A__NAME__lt arm_instr_add_pc_reg__lt
+#define A__NAME__gt arm_instr_add_pc_reg__gt
+#define A__NAME__le arm_instr_add_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adc_pc_reg
+#define A__NAME__eq arm_instr_adc_pc_reg__eq
+#define A__NAME__ne arm_instr_adc_pc_reg__ne
+#define A__NAME__cs arm_instr_adc_pc_reg__cs
+#define A__NAME__cc arm_instr_adc_pc_reg__cc
+#define A__NAME__mi arm_instr_adc_pc_reg__mi
+#define A__NAME__pl arm_instr_adc_pc_reg__pl
+#define A__NAME__vs arm_instr_adc_pc_reg__vs
+#define A__NAME__vc arm_instr_adc_pc_reg__vc
+#define A__NAME__hi arm_instr_adc_pc_reg__hi
+#define A__NAME__ls arm_instr_adc_pc_reg__ls
+#define A__NAME__ge arm_instr_adc_pc_reg__ge
+#define A__NAME__lt arm_instr_adc_pc_reg__lt
+#define A__NAME__gt arm_instr_adc_pc_reg__gt
+#define A__NAME__le arm_instr_adc_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbc_pc_reg
+#define A__NAME__eq arm_instr_sbc_pc_reg__eq
+#define A__NAME__ne arm_instr_sbc_pc_reg__ne
+#define A__NAME__cs arm_instr_sbc_pc_reg__cs
+#define A__NAME__cc arm_instr_sbc_pc_reg__cc
+#define A__NAME__mi arm_instr_sbc_pc_reg__mi
+#define A__NAME__pl arm_instr_sbc_pc_reg__pl
+#define A__NAME__vs arm_instr_sbc_pc_reg__vs
+#define A__NAME__vc arm_instr_sbc_pc_reg__vc
+#define A__NAME__hi arm_instr_sbc_pc_reg__hi
+#define A__NAME__ls arm_instr_sbc_pc_reg__ls
+#define A__NAME__ge arm_instr_sbc_pc_reg__ge
+#define A__NAME__lt arm_instr_sbc_pc_reg__lt
+#define A__NAME__gt arm_instr_sbc_pc_reg__gt
+#define A__NAME__le arm_instr_sbc_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsc_pc_reg
+#define A__NAME__eq arm_instr_rsc_pc_reg__eq
+#define A__NAME__ne arm_instr_rsc_pc_reg__ne
+#define A__NAME__cs arm_instr_rsc_pc_reg__cs
+#define A__NAME__cc arm_instr_rsc_pc_reg__cc
+#define A__NAME__mi arm_instr_rsc_pc_reg__mi
+#define A__NAME__pl arm_instr_rsc_pc_reg__pl
+#define A__NAME__vs arm_instr_rsc_pc_reg__vs
+#define A__NAME__vc arm_instr_rsc_pc_reg__vc
+#define A__NAME__hi arm_instr_rsc_pc_reg__hi
+#define A__NAME__ls arm_instr_rsc_pc_reg__ls
+#define A__NAME__ge arm_instr_rsc_pc_reg__ge
+#define A__NAME__lt arm_instr_rsc_pc_reg__lt
+#define A__NAME__gt arm_instr_rsc_pc_reg__gt
+#define A__NAME__le arm_instr_rsc_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orr_pc_reg
+#define A__NAME__eq arm_instr_orr_pc_reg__eq
+#define A__NAME__ne arm_instr_orr_pc_reg__ne
+#define A__NAME__cs arm_instr_orr_pc_reg__cs
+#define A__NAME__cc arm_instr_orr_pc_reg__cc
+#define A__NAME__mi arm_instr_orr_pc_reg__mi
+#define A__NAME__pl arm_instr_orr_pc_reg__pl
+#define A__NAME__vs arm_instr_orr_pc_reg__vs
+#define A__NAME__vc arm_instr_orr_pc_reg__vc
+#define A__NAME__hi arm_instr_orr_pc_reg__hi
+#define A__NAME__ls arm_instr_orr_pc_reg__ls
+#define A__NAME__ge arm_instr_orr_pc_reg__ge
+#define A__NAME__lt arm_instr_orr_pc_reg__lt
+#define A__NAME__gt arm_instr_orr_pc_reg__gt
+#define A__NAME__le arm_instr_orr_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mov_pc_reg
+#define A__NAME__eq arm_instr_mov_pc_reg__eq
+#define A__NAME__ne arm_instr_mov_pc_reg__ne
+#define A__NAME__cs arm_instr_mov_pc_reg__cs
+#define A__NAME__cc arm_instr_mov_pc_reg__cc
+#define A__NAME__mi arm_instr_mov_pc_reg__mi
+#define A__NAME__pl arm_instr_mov_pc_reg__pl
+#define A__NAME__vs arm_instr_mov_pc_reg__vs
+#define A__NAME__vc arm_instr_mov_pc_reg__vc
+#define A__NAME__hi arm_instr_mov_pc_reg__hi
+#define A__NAME__ls arm_instr_mov_pc_reg__ls
+#define A__NAME__ge arm_instr_mov_pc_reg__ge
+#define A__NAME__lt arm_instr_mov_pc_reg__lt
+#define A__NAME__gt arm_instr_mov_pc_reg__gt
+#define A__NAME__le arm_instr_mov_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bic_pc_reg
+#define A__NAME__eq arm_instr_bic_pc_reg__eq
+#define A__NAME__ne arm_instr_bic_pc_reg__ne
+#define A__NAME__cs arm_instr_bic_pc_reg__cs
+#define A__NAME__cc arm_instr_bic_pc_reg__cc
+#define A__NAME__mi arm_instr_bic_pc_reg__mi
+#define A__NAME__pl arm_instr_bic_pc_reg__pl
+#define A__NAME__vs arm_instr_bic_pc_reg__vs
+#define A__NAME__vc arm_instr_bic_pc_reg__vc
+#define A__NAME__hi arm_instr_bic_pc_reg__hi
+#define A__NAME__ls arm_instr_bic_pc_reg__ls
+#define A__NAME__ge arm_instr_bic_pc_reg__ge
+#define A__NAME__lt arm_instr_bic_pc_reg__lt
+#define A__NAME__gt arm_instr_bic_pc_reg__gt
+#define A__NAME__le arm_instr_bic_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvn_pc_reg
+#define A__NAME__eq arm_instr_mvn_pc_reg__eq
+#define A__NAME__ne arm_instr_mvn_pc_reg__ne
+#define A__NAME__cs arm_instr_mvn_pc_reg__cs
+#define A__NAME__cc arm_instr_mvn_pc_reg__cc
+#define A__NAME__mi arm_instr_mvn_pc_reg__mi
+#define A__NAME__pl arm_instr_mvn_pc_reg__pl
+#define A__NAME__vs arm_instr_mvn_pc_reg__vs
+#define A__NAME__vc arm_instr_mvn_pc_reg__vc
+#define A__NAME__hi arm_instr_mvn_pc_reg__hi
+#define A__NAME__ls arm_instr_mvn_pc_reg__ls
+#define A__NAME__ge arm_instr_mvn_pc_reg__ge
+#define A__NAME__lt arm_instr_mvn_pc_reg__lt
+#define A__NAME__gt arm_instr_mvn_pc_reg__gt
+#define A__NAME__le arm_instr_mvn_pc_reg__le
+#define A__REG
+#define A__PC
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_ands_pc_reg
+#define A__NAME__eq arm_instr_ands_pc_reg__eq
+#define A__NAME__ne arm_instr_ands_pc_reg__ne
+#define A__NAME__cs arm_instr_ands_pc_reg__cs
+#define A__NAME__cc arm_instr_ands_pc_reg__cc
+#define A__NAME__mi arm_instr_ands_pc_reg__mi
+#define A__NAME__pl arm_instr_ands_pc_reg__pl
+#define A__NAME__vs arm_instr_ands_pc_reg__vs
+#define A__NAME__vc arm_instr_ands_pc_reg__vc
+#define A__NAME__hi arm_instr_ands_pc_reg__hi
+#define A__NAME__ls arm_instr_ands_pc_reg__ls
+#define A__NAME__ge arm_instr_ands_pc_reg__ge
+#define A__NAME__lt arm_instr_ands_pc_reg__lt
+#define A__NAME__gt arm_instr_ands_pc_reg__gt
+#define A__NAME__le arm_instr_ands_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eors_pc_reg
+#define A__NAME__eq arm_instr_eors_pc_reg__eq
+#define A__NAME__ne arm_instr_eors_pc_reg__ne
+#define A__NAME__cs arm_instr_eors_pc_reg__cs
+#define A__NAME__cc arm_instr_eors_pc_reg__cc
+#define A__NAME__mi arm_instr_eors_pc_reg__mi
+#define A__NAME__pl arm_instr_eors_pc_reg__pl
+#define A__NAME__vs arm_instr_eors_pc_reg__vs
+#define A__NAME__vc arm_instr_eors_pc_reg__vc
+#define A__NAME__hi arm_instr_eors_pc_reg__hi
+#define A__NAME__ls arm_instr_eors_pc_reg__ls
+#define A__NAME__ge arm_instr_eors_pc_reg__ge
+#define A__NAME__lt arm_instr_eors_pc_reg__lt
+#define A__NAME__gt arm_instr_eors_pc_reg__gt
+#define A__NAME__le arm_instr_eors_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_subs_pc_reg
+#define A__NAME__eq arm_instr_subs_pc_reg__eq
+#define A__NAME__ne arm_instr_subs_pc_reg__ne
+#define A__NAME__cs arm_instr_subs_pc_reg__cs
+#define A__NAME__cc arm_instr_subs_pc_reg__cc
+#define A__NAME__mi arm_instr_subs_pc_reg__mi
+#define A__NAME__pl arm_instr_subs_pc_reg__pl
+#define A__NAME__vs arm_instr_subs_pc_reg__vs
+#define A__NAME__vc arm_instr_subs_pc_reg__vc
+#define A__NAME__hi arm_instr_subs_pc_reg__hi
+#define A__NAME__ls arm_instr_subs_pc_reg__ls
+#define A__NAME__ge arm_instr_subs_pc_reg__ge
+#define A__NAME__lt arm_instr_subs_pc_reg__lt
+#define A__NAME__gt arm_instr_subs_pc_reg__gt
+#define A__NAME__le arm_instr_subs_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsbs_pc_reg
+#define A__NAME__eq arm_instr_rsbs_pc_reg__eq
+#define A__NAME__ne arm_instr_rsbs_pc_reg__ne
+#define A__NAME__cs arm_instr_rsbs_pc_reg__cs
+#define A__NAME__cc arm_instr_rsbs_pc_reg__cc
+#define A__NAME__mi arm_instr_rsbs_pc_reg__mi
+#define A__NAME__pl arm_instr_rsbs_pc_reg__pl
+#define A__NAME__vs arm_instr_rsbs_pc_reg__vs
+#define A__NAME__vc arm_instr_rsbs_pc_reg__vc
+#define A__NAME__hi arm_instr_rsbs_pc_reg__hi
+#define A__NAME__ls arm_instr_rsbs_pc_reg__ls
+#define A__NAME__ge arm_instr_rsbs_pc_reg__ge
+#define A__NAME__lt arm_instr_rsbs_pc_reg__lt
+#define A__NAME__gt arm_instr_rsbs_pc_reg__gt
+#define A__NAME__le arm_instr_rsbs_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adds_pc_reg
+#define A__NAME__eq arm_instr_adds_pc_reg__eq
+#define A__NAME__ne arm_instr_adds_pc_reg__ne
+#define A__NAME__cs arm_instr_adds_pc_reg__cs
+#define A__NAME__cc arm_instr_adds_pc_reg__cc
+#define A__NAME__mi arm_instr_adds_pc_reg__mi
+#define A__NAME__pl arm_instr_adds_pc_reg__pl
+#define A__NAME__vs arm_instr_adds_pc_reg__vs
+#define A__NAME__vc arm_instr_adds_pc_reg__vc
+#define A__NAME__hi arm_instr_adds_pc_reg__hi
+#define A__NAME__ls arm_instr_adds_pc_reg__ls
+#define A__NAME__ge arm_instr_adds_pc_reg__ge
+#define A__NAME__lt arm_instr_adds_pc_reg__lt
+#define A__NAME__gt arm_instr_adds_pc_reg__gt
+#define A__NAME__le arm_instr_adds_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adcs_pc_reg
+#define A__NAME__eq arm_instr_adcs_pc_reg__eq
+#define A__NAME__ne arm_instr_adcs_pc_reg__ne
+#define A__NAME__cs arm_instr_adcs_pc_reg__cs
+#define A__NAME__cc arm_instr_adcs_pc_reg__cc
+#define A__NAME__mi arm_instr_adcs_pc_reg__mi
+#define A__NAME__pl arm_instr_adcs_pc_reg__pl
+#define A__NAME__vs arm_instr_adcs_pc_reg__vs
+#define A__NAME__vc arm_instr_adcs_pc_reg__vc
+#define A__NAME__hi arm_instr_adcs_pc_reg__hi
+#define A__NAME__ls arm_instr_adcs_pc_reg__ls
+#define A__NAME__ge arm_instr_adcs_pc_reg__ge
+#define A__NAME__lt arm_instr_adcs_pc_reg__lt
+#define A__NAME__gt arm_instr_adcs_pc_reg__gt
+#define A__NAME__le arm_instr_adcs_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbcs_pc_reg
+#define A__NAME__eq arm_instr_sbcs_pc_reg__eq
+#define A__NAME__ne arm_instr_sbcs_pc_reg__ne
+#define A__NAME__cs arm_instr_sbcs_pc_reg__cs
+#define A__NAME__cc arm_instr_sbcs_pc_reg__cc
+#define A__NAME__mi arm_instr_sbcs_pc_reg__mi
+#define A__NAME__pl arm_instr_sbcs_pc_reg__pl
+#define A__NAME__vs arm_instr_sbcs_pc_reg__vs
+#define A__NAME__vc arm_instr_sbcs_pc_reg__vc
+#define A__NAME__hi arm_instr_sbcs_pc_reg__hi
+#define A__NAME__ls arm_instr_sbcs_pc_reg__ls
+#define A__NAME__ge arm_instr_sbcs_pc_reg__ge
+#define A__NAME__lt arm_instr_sbcs_pc_reg__lt
+#define A__NAME__gt arm_instr_sbcs_pc_reg__gt
+#define A__NAME__le arm_instr_sbcs_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rscs_pc_reg
+#define A__NAME__eq arm_instr_rscs_pc_reg__eq
+#define A__NAME__ne arm_instr_rscs_pc_reg__ne
+#define A__NAME__cs arm_instr_rscs_pc_reg__cs
+#define A__NAME__cc arm_instr_rscs_pc_reg__cc
+#define A__NAME__mi arm_instr_rscs_pc_reg__mi
+#define A__NAME__pl arm_instr_rscs_pc_reg__pl
+#define A__NAME__vs arm_instr_rscs_pc_reg__vs
+#define A__NAME__vc arm_instr_rscs_pc_reg__vc
+#define A__NAME__hi arm_instr_rscs_pc_reg__hi
+#define A__NAME__ls arm_instr_rscs_pc_reg__ls
+#define A__NAME__ge arm_instr_rscs_pc_reg__ge
+#define A__NAME__lt arm_instr_rscs_pc_reg__lt
+#define A__NAME__gt arm_instr_rscs_pc_reg__gt
+#define A__NAME__le arm_instr_rscs_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_tsts_pc_reg
+#define A__NAME__eq arm_instr_tsts_pc_reg__eq
+#define A__NAME__ne arm_instr_tsts_pc_reg__ne
+#define A__NAME__cs arm_instr_tsts_pc_reg__cs
+#define A__NAME__cc arm_instr_tsts_pc_reg__cc
+#define A__NAME__mi arm_instr_tsts_pc_reg__mi
+#define A__NAME__pl arm_instr_tsts_pc_reg__pl
+#define A__NAME__vs arm_instr_tsts_pc_reg__vs
+#define A__NAME__vc arm_instr_tsts_pc_reg__vc
+#define A__NAME__hi arm_instr_tsts_pc_reg__hi
+#define A__NAME__ls arm_instr_tsts_pc_reg__ls
+#define A__NAME__ge arm_instr_tsts_pc_reg__ge
+#define A__NAME__lt arm_instr_tsts_pc_reg__lt
+#define A__NAME__gt arm_instr_tsts_pc_reg__gt
+#define A__NAME__le arm_instr_tsts_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__TST
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TST
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_teqs_pc_reg
+#define A__NAME__eq arm_instr_teqs_pc_reg__eq
+#define A__NAME__ne arm_instr_teqs_pc_reg__ne
+#define A__NAME__cs arm_instr_teqs_pc_reg__cs
+#define A__NAME__cc arm_instr_teqs_pc_reg__cc
+#define A__NAME__mi arm_instr_teqs_pc_reg__mi
+#define A__NAME__pl arm_instr_teqs_pc_reg__pl
+#define A__NAME__vs arm_instr_teqs_pc_reg__vs
+#define A__NAME__vc arm_instr_teqs_pc_reg__vc
+#define A__NAME__hi arm_instr_teqs_pc_reg__hi
+#define A__NAME__ls arm_instr_teqs_pc_reg__ls
+#define A__NAME__ge arm_instr_teqs_pc_reg__ge
+#define A__NAME__lt arm_instr_teqs_pc_reg__lt
+#define A__NAME__gt arm_instr_teqs_pc_reg__gt
+#define A__NAME__le arm_instr_teqs_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__TEQ
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TEQ
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmps_pc_reg
+#define A__NAME__eq arm_instr_cmps_pc_reg__eq
+#define A__NAME__ne arm_instr_cmps_pc_reg__ne
+#define A__NAME__cs arm_instr_cmps_pc_reg__cs
+#define A__NAME__cc arm_instr_cmps_pc_reg__cc
+#define A__NAME__mi arm_instr_cmps_pc_reg__mi
+#define A__NAME__pl arm_instr_cmps_pc_reg__pl
+#define A__NAME__vs arm_instr_cmps_pc_reg__vs
+#define A__NAME__vc arm_instr_cmps_pc_reg__vc
+#define A__NAME__hi arm_instr_cmps_pc_reg__hi
+#define A__NAME__ls arm_instr_cmps_pc_reg__ls
+#define A__NAME__ge arm_instr_cmps_pc_reg__ge
+#define A__NAME__lt arm_instr_cmps_pc_reg__lt
+#define A__NAME__gt arm_instr_cmps_pc_reg__gt
+#define A__NAME__le arm_instr_cmps_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__CMP
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMP
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmns_pc_reg
+#define A__NAME__eq arm_instr_cmns_pc_reg__eq
+#define A__NAME__ne arm_instr_cmns_pc_reg__ne
+#define A__NAME__cs arm_instr_cmns_pc_reg__cs
+#define A__NAME__cc arm_instr_cmns_pc_reg__cc
+#define A__NAME__mi arm_instr_cmns_pc_reg__mi
+#define A__NAME__pl arm_instr_cmns_pc_reg__pl
+#define A__NAME__vs arm_instr_cmns_pc_reg__vs
+#define A__NAME__vc arm_instr_cmns_pc_reg__vc
+#define A__NAME__hi arm_instr_cmns_pc_reg__hi
+#define A__NAME__ls arm_instr_cmns_pc_reg__ls
+#define A__NAME__ge arm_instr_cmns_pc_reg__ge
+#define A__NAME__lt arm_instr_cmns_pc_reg__lt
+#define A__NAME__gt arm_instr_cmns_pc_reg__gt
+#define A__NAME__le arm_instr_cmns_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__CMN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMN
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orrs_pc_reg
+#define A__NAME__eq arm_instr_orrs_pc_reg__eq
+#define A__NAME__ne arm_instr_orrs_pc_reg__ne
+#define A__NAME__cs arm_instr_orrs_pc_reg__cs
+#define A__NAME__cc arm_instr_orrs_pc_reg__cc
+#define A__NAME__mi arm_instr_orrs_pc_reg__mi
+#define A__NAME__pl arm_instr_orrs_pc_reg__pl
+#define A__NAME__vs arm_instr_orrs_pc_reg__vs
+#define A__NAME__vc arm_instr_orrs_pc_reg__vc
+#define A__NAME__hi arm_instr_orrs_pc_reg__hi
+#define A__NAME__ls arm_instr_orrs_pc_reg__ls
+#define A__NAME__ge arm_instr_orrs_pc_reg__ge
+#define A__NAME__lt arm_instr_orrs_pc_reg__lt
+#define A__NAME__gt arm_instr_orrs_pc_reg__gt
+#define A__NAME__le arm_instr_orrs_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_movs_pc_reg
+#define A__NAME__eq arm_instr_movs_pc_reg__eq
+#define A__NAME__ne arm_instr_movs_pc_reg__ne
+#define A__NAME__cs arm_instr_movs_pc_reg__cs
+#define A__NAME__cc arm_instr_movs_pc_reg__cc
+#define A__NAME__mi arm_instr_movs_pc_reg__mi
+#define A__NAME__pl arm_instr_movs_pc_reg__pl
+#define A__NAME__vs arm_instr_movs_pc_reg__vs
+#define A__NAME__vc arm_instr_movs_pc_reg__vc
+#define A__NAME__hi arm_instr_movs_pc_reg__hi
+#define A__NAME__ls arm_instr_movs_pc_reg__ls
+#define A__NAME__ge arm_instr_movs_pc_reg__ge
+#define A__NAME__lt arm_instr_movs_pc_reg__lt
+#define A__NAME__gt arm_instr_movs_pc_reg__gt
+#define A__NAME__le arm_instr_movs_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bics_pc_reg
+#define A__NAME__eq arm_instr_bics_pc_reg__eq
+#define A__NAME__ne arm_instr_bics_pc_reg__ne
+#define A__NAME__cs arm_instr_bics_pc_reg__cs
+#define A__NAME__cc arm_instr_bics_pc_reg__cc
+#define A__NAME__mi arm_instr_bics_pc_reg__mi
+#define A__NAME__pl arm_instr_bics_pc_reg__pl
+#define A__NAME__vs arm_instr_bics_pc_reg__vs
+#define A__NAME__vc arm_instr_bics_pc_reg__vc
+#define A__NAME__hi arm_instr_bics_pc_reg__hi
+#define A__NAME__ls arm_instr_bics_pc_reg__ls
+#define A__NAME__ge arm_instr_bics_pc_reg__ge
+#define A__NAME__lt arm_instr_bics_pc_reg__lt
+#define A__NAME__gt arm_instr_bics_pc_reg__gt
+#define A__NAME__le arm_instr_bics_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvns_pc_reg
+#define A__NAME__eq arm_instr_mvns_pc_reg__eq
+#define A__NAME__ne arm_instr_mvns_pc_reg__ne
+#define A__NAME__cs arm_instr_mvns_pc_reg__cs
+#define A__NAME__cc arm_instr_mvns_pc_reg__cc
+#define A__NAME__mi arm_instr_mvns_pc_reg__mi
+#define A__NAME__pl arm_instr_mvns_pc_reg__pl
+#define A__NAME__vs arm_instr_mvns_pc_reg__vs
+#define A__NAME__vc arm_instr_mvns_pc_reg__vc
+#define A__NAME__hi arm_instr_mvns_pc_reg__hi
+#define A__NAME__ls arm_instr_mvns_pc_reg__ls
+#define A__NAME__ge arm_instr_mvns_pc_reg__ge
+#define A__NAME__lt arm_instr_mvns_pc_reg__lt
+#define A__NAME__gt arm_instr_mvns_pc_reg__gt
+#define A__NAME__le arm_instr_mvns_pc_reg__le
+#define A__S
+#define A__REG
+#define A__PC
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__S
+#undef A__REG
+#undef A__PC
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_and_regshort
+#define A__NAME__eq arm_instr_and_regshort__eq
+#define A__NAME__ne arm_instr_and_regshort__ne
+#define A__NAME__cs arm_instr_and_regshort__cs
+#define A__NAME__cc arm_instr_and_regshort__cc
+#define A__NAME__mi arm_instr_and_regshort__mi
+#define A__NAME__pl arm_instr_and_regshort__pl
+#define A__NAME__vs arm_instr_and_regshort__vs
+#define A__NAME__vc arm_instr_and_regshort__vc
+#define A__NAME__hi arm_instr_and_regshort__hi
+#define A__NAME__ls arm_instr_and_regshort__ls
+#define A__NAME__ge arm_instr_and_regshort__ge
+#define A__NAME__lt arm_instr_and_regshort__lt
+#define A__NAME__gt arm_instr_and_regshort__gt
+#define A__NAME__le arm_instr_and_regshort__le
+#define A__REGSHORT
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eor_regshort
+#define A__NAME__eq arm_instr_eor_regshort__eq
+#define A__NAME__ne arm_instr_eor_regshort__ne
+#define A__NAME__cs arm_instr_eor_regshort__cs
+#define A__NAME__cc arm_instr_eor_regshort__cc
+#define A__NAME__mi arm_instr_eor_regshort__mi
+#define A__NAME__pl arm_instr_eor_regshort__pl
+#define A__NAME__vs arm_instr_eor_regshort__vs
+#define A__NAME__vc arm_instr_eor_regshort__vc
+#define A__NAME__hi arm_instr_eor_regshort__hi
+#define A__NAME__ls arm_instr_eor_regshort__ls
+#define A__NAME__ge arm_instr_eor_regshort__ge
+#define A__NAME__lt arm_instr_eor_regshort__lt
+#define A__NAME__gt arm_instr_eor_regshort__gt
+#define A__NAME__le arm_instr_eor_regshort__le
+#define A__REGSHORT
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sub_regshort
+#define A__NAME__eq arm_instr_sub_regshort__eq
+#define A__NAME__ne arm_instr_sub_regshort__ne
+#define A__NAME__cs arm_instr_sub_regshort__cs
+#define A__NAME__cc arm_instr_sub_regshort__cc
+#define A__NAME__mi arm_instr_sub_regshort__mi
+#define A__NAME__pl arm_instr_sub_regshort__pl
+#define A__NAME__vs arm_instr_sub_regshort__vs
+#define A__NAME__vc arm_instr_sub_regshort__vc
+#define A__NAME__hi arm_instr_sub_regshort__hi
+#define A__NAME__ls arm_instr_sub_regshort__ls
+#define A__NAME__ge arm_instr_sub_regshort__ge
+#define A__NAME__lt arm_instr_sub_regshort__lt
+#define A__NAME__gt arm_instr_sub_regshort__gt
+#define A__NAME__le arm_instr_sub_regshort__le
+#define A__REGSHORT
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsb_regshort
+#define A__NAME__eq arm_instr_rsb_regshort__eq
+#define A__NAME__ne arm_instr_rsb_regshort__ne
+#define A__NAME__cs arm_instr_rsb_regshort__cs
+#define A__NAME__cc arm_instr_rsb_regshort__cc
+#define A__NAME__mi arm_instr_rsb_regshort__mi
+#define A__NAME__pl arm_instr_rsb_regshort__pl
+#define A__NAME__vs arm_instr_rsb_regshort__vs
+#define A__NAME__vc arm_instr_rsb_regshort__vc
+#define A__NAME__hi arm_instr_rsb_regshort__hi
+#define A__NAME__ls arm_instr_rsb_regshort__ls
+#define A__NAME__ge arm_instr_rsb_regshort__ge
+#define A__NAME__lt arm_instr_rsb_regshort__lt
+#define A__NAME__gt arm_instr_rsb_regshort__gt
+#define A__NAME__le arm_instr_rsb_regshort__le
+#define A__REGSHORT
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_add_regshort
+#define A__NAME__eq arm_instr_add_regshort__eq
+#define A__NAME__ne arm_instr_add_regshort__ne
+#define A__NAME__cs arm_instr_add_regshort__cs
+#define A__NAME__cc arm_instr_add_regshort__cc
+#define A__NAME__mi arm_instr_add_regshort__mi
+#define A__NAME__pl arm_instr_add_regshort__pl
+#define A__NAME__vs arm_instr_add_regshort__vs
+#define A__NAME__vc arm_instr_add_regshort__vc
+#define A__NAME__hi arm_instr_add_regshort__hi
+#define A__NAME__ls arm_instr_add_regshort__ls
+#define A__NAME__ge arm_instr_add_regshort__ge
+#define A__NAME__lt arm_instr_add_regshort__lt
+#define A__NAME__gt arm_instr_add_regshort__gt
+#define A__NAME__le arm_instr_add_regshort__le
+#define A__REGSHORT
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adc_regshort
+#define A__NAME__eq arm_instr_adc_regshort__eq
+#define A__NAME__ne arm_instr_adc_regshort__ne
+#define A__NAME__cs arm_instr_adc_regshort__cs
+#define A__NAME__cc arm_instr_adc_regshort__cc
+#define A__NAME__mi arm_instr_adc_regshort__mi
+#define A__NAME__pl arm_instr_adc_regshort__pl
+#define A__NAME__vs arm_instr_adc_regshort__vs
+#define A__NAME__vc arm_instr_adc_regshort__vc
+#define A__NAME__hi arm_instr_adc_regshort__hi
+#define A__NAME__ls arm_instr_adc_regshort__ls
+#define A__NAME__ge arm_instr_adc_regshort__ge
+#define A__NAME__lt arm_instr_adc_regshort__lt
+#define A__NAME__gt arm_instr_adc_regshort__gt
+#define A__NAME__le arm_instr_adc_regshort__le
+#define A__REGSHORT
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbc_regshort
+#define A__NAME__eq arm_instr_sbc_regshort__eq
+#define A__NAME__ne arm_instr_sbc_regshort__ne
+#define A__NAME__cs arm_instr_sbc_regshort__cs
+#define A__NAME__cc arm_instr_sbc_regshort__cc
+#define A__NAME__mi arm_instr_sbc_regshort__mi
+#define A__NAME__pl arm_instr_sbc_regshort__pl
+#define A__NAME__vs arm_instr_sbc_regshort__vs
+#define A__NAME__vc arm_instr_sbc_regshort__vc
+#define A__NAME__hi arm_instr_sbc_regshort__hi
+#define A__NAME__ls arm_instr_sbc_regshort__ls
+#define A__NAME__ge arm_instr_sbc_regshort__ge
+#define A__NAME__lt arm_instr_sbc_regshort__lt
+#define A__NAME__gt arm_instr_sbc_regshort__gt
+#define A__NAME__le arm_instr_sbc_regshort__le
+#define A__REGSHORT
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsc_regshort
+#define A__NAME__eq arm_instr_rsc_regshort__eq
+#define A__NAME__ne arm_instr_rsc_regshort__ne
+#define A__NAME__cs arm_instr_rsc_regshort__cs
+#define A__NAME__cc arm_instr_rsc_regshort__cc
+#define A__NAME__mi arm_instr_rsc_regshort__mi
+#define A__NAME__pl arm_instr_rsc_regshort__pl
+#define A__NAME__vs arm_instr_rsc_regshort__vs
+#define A__NAME__vc arm_instr_rsc_regshort__vc
+#define A__NAME__hi arm_instr_rsc_regshort__hi
+#define A__NAME__ls arm_instr_rsc_regshort__ls
+#define A__NAME__ge arm_instr_rsc_regshort__ge
+#define A__NAME__lt arm_instr_rsc_regshort__lt
+#define A__NAME__gt arm_instr_rsc_regshort__gt
+#define A__NAME__le arm_instr_rsc_regshort__le
+#define A__REGSHORT
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orr_regshort
+#define A__NAME__eq arm_instr_orr_regshort__eq
+#define A__NAME__ne arm_instr_orr_regshort__ne
+#define A__NAME__cs arm_instr_orr_regshort__cs
+#define A__NAME__cc arm_instr_orr_regshort__cc
+#define A__NAME__mi arm_instr_orr_regshort__mi
+#define A__NAME__pl arm_instr_orr_regshort__pl
+#define A__NAME__vs arm_instr_orr_regshort__vs
+#define A__NAME__vc arm_instr_orr_regshort__vc
+#define A__NAME__hi arm_instr_orr_regshort__hi
+#define A__NAME__ls arm_instr_orr_regshort__ls
+#define A__NAME__ge arm_instr_orr_regshort__ge
+#define A__NAME__lt arm_instr_orr_regshort__lt
+#define A__NAME__gt arm_instr_orr_regshort__gt
+#define A__NAME__le arm_instr_orr_regshort__le
+#define A__REGSHORT
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mov_regshort
+#define A__NAME__eq arm_instr_mov_regshort__eq
+#define A__NAME__ne arm_instr_mov_regshort__ne
+#define A__NAME__cs arm_instr_mov_regshort__cs
+#define A__NAME__cc arm_instr_mov_regshort__cc
+#define A__NAME__mi arm_instr_mov_regshort__mi
+#define A__NAME__pl arm_instr_mov_regshort__pl
+#define A__NAME__vs arm_instr_mov_regshort__vs
+#define A__NAME__vc arm_instr_mov_regshort__vc
+#define A__NAME__hi arm_instr_mov_regshort__hi
+#define A__NAME__ls arm_instr_mov_regshort__ls
+#define A__NAME__ge arm_instr_mov_regshort__ge
+#define A__NAME__lt arm_instr_mov_regshort__lt
+#define A__NAME__gt arm_instr_mov_regshort__gt
+#define A__NAME__le arm_instr_mov_regshort__le
+#define A__REGSHORT
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bic_regshort
+#define A__NAME__eq arm_instr_bic_regshort__eq
+#define A__NAME__ne arm_instr_bic_regshort__ne
+#define A__NAME__cs arm_instr_bic_regshort__cs
+#define A__NAME__cc arm_instr_bic_regshort__cc
+#define A__NAME__mi arm_instr_bic_regshort__mi
+#define A__NAME__pl arm_instr_bic_regshort__pl
+#define A__NAME__vs arm_instr_bic_regshort__vs
+#define A__NAME__vc arm_instr_bic_regshort__vc
+#define A__NAME__hi arm_instr_bic_regshort__hi
+#define A__NAME__ls arm_instr_bic_regshort__ls
+#define A__NAME__ge arm_instr_bic_regshort__ge
+#define A__NAME__lt arm_instr_bic_regshort__lt
+#define A__NAME__gt arm_instr_bic_regshort__gt
+#define A__NAME__le arm_instr_bic_regshort__le
+#define A__REGSHORT
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvn_regshort
+#define A__NAME__eq arm_instr_mvn_regshort__eq
+#define A__NAME__ne arm_instr_mvn_regshort__ne
+#define A__NAME__cs arm_instr_mvn_regshort__cs
+#define A__NAME__cc arm_instr_mvn_regshort__cc
+#define A__NAME__mi arm_instr_mvn_regshort__mi
+#define A__NAME__pl arm_instr_mvn_regshort__pl
+#define A__NAME__vs arm_instr_mvn_regshort__vs
+#define A__NAME__vc arm_instr_mvn_regshort__vc
+#define A__NAME__hi arm_instr_mvn_regshort__hi
+#define A__NAME__ls arm_instr_mvn_regshort__ls
+#define A__NAME__ge arm_instr_mvn_regshort__ge
+#define A__NAME__lt arm_instr_mvn_regshort__lt
+#define A__NAME__gt arm_instr_mvn_regshort__gt
+#define A__NAME__le arm_instr_mvn_regshort__le
+#define A__REGSHORT
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_ands_regshort
+#define A__NAME__eq arm_instr_ands_regshort__eq
+#define A__NAME__ne arm_instr_ands_regshort__ne
+#define A__NAME__cs arm_instr_ands_regshort__cs
+#define A__NAME__cc arm_instr_ands_regshort__cc
+#define A__NAME__mi arm_instr_ands_regshort__mi
+#define A__NAME__pl arm_instr_ands_regshort__pl
+#define A__NAME__vs arm_instr_ands_regshort__vs
+#define A__NAME__vc arm_instr_ands_regshort__vc
+#define A__NAME__hi arm_instr_ands_regshort__hi
+#define A__NAME__ls arm_instr_ands_regshort__ls
+#define A__NAME__ge arm_instr_ands_regshort__ge
+#define A__NAME__lt arm_instr_ands_regshort__lt
+#define A__NAME__gt arm_instr_ands_regshort__gt
+#define A__NAME__le arm_instr_ands_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__AND
+#include "cpu_arm_instr_dpi.cc"
+#undef A__AND
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_eors_regshort
+#define A__NAME__eq arm_instr_eors_regshort__eq
+#define A__NAME__ne arm_instr_eors_regshort__ne
+#define A__NAME__cs arm_instr_eors_regshort__cs
+#define A__NAME__cc arm_instr_eors_regshort__cc
+#define A__NAME__mi arm_instr_eors_regshort__mi
+#define A__NAME__pl arm_instr_eors_regshort__pl
+#define A__NAME__vs arm_instr_eors_regshort__vs
+#define A__NAME__vc arm_instr_eors_regshort__vc
+#define A__NAME__hi arm_instr_eors_regshort__hi
+#define A__NAME__ls arm_instr_eors_regshort__ls
+#define A__NAME__ge arm_instr_eors_regshort__ge
+#define A__NAME__lt arm_instr_eors_regshort__lt
+#define A__NAME__gt arm_instr_eors_regshort__gt
+#define A__NAME__le arm_instr_eors_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__EOR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__EOR
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_subs_regshort
+#define A__NAME__eq arm_instr_subs_regshort__eq
+#define A__NAME__ne arm_instr_subs_regshort__ne
+#define A__NAME__cs arm_instr_subs_regshort__cs
+#define A__NAME__cc arm_instr_subs_regshort__cc
+#define A__NAME__mi arm_instr_subs_regshort__mi
+#define A__NAME__pl arm_instr_subs_regshort__pl
+#define A__NAME__vs arm_instr_subs_regshort__vs
+#define A__NAME__vc arm_instr_subs_regshort__vc
+#define A__NAME__hi arm_instr_subs_regshort__hi
+#define A__NAME__ls arm_instr_subs_regshort__ls
+#define A__NAME__ge arm_instr_subs_regshort__ge
+#define A__NAME__lt arm_instr_subs_regshort__lt
+#define A__NAME__gt arm_instr_subs_regshort__gt
+#define A__NAME__le arm_instr_subs_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__SUB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SUB
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rsbs_regshort
+#define A__NAME__eq arm_instr_rsbs_regshort__eq
+#define A__NAME__ne arm_instr_rsbs_regshort__ne
+#define A__NAME__cs arm_instr_rsbs_regshort__cs
+#define A__NAME__cc arm_instr_rsbs_regshort__cc
+#define A__NAME__mi arm_instr_rsbs_regshort__mi
+#define A__NAME__pl arm_instr_rsbs_regshort__pl
+#define A__NAME__vs arm_instr_rsbs_regshort__vs
+#define A__NAME__vc arm_instr_rsbs_regshort__vc
+#define A__NAME__hi arm_instr_rsbs_regshort__hi
+#define A__NAME__ls arm_instr_rsbs_regshort__ls
+#define A__NAME__ge arm_instr_rsbs_regshort__ge
+#define A__NAME__lt arm_instr_rsbs_regshort__lt
+#define A__NAME__gt arm_instr_rsbs_regshort__gt
+#define A__NAME__le arm_instr_rsbs_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__RSB
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSB
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adds_regshort
+#define A__NAME__eq arm_instr_adds_regshort__eq
+#define A__NAME__ne arm_instr_adds_regshort__ne
+#define A__NAME__cs arm_instr_adds_regshort__cs
+#define A__NAME__cc arm_instr_adds_regshort__cc
+#define A__NAME__mi arm_instr_adds_regshort__mi
+#define A__NAME__pl arm_instr_adds_regshort__pl
+#define A__NAME__vs arm_instr_adds_regshort__vs
+#define A__NAME__vc arm_instr_adds_regshort__vc
+#define A__NAME__hi arm_instr_adds_regshort__hi
+#define A__NAME__ls arm_instr_adds_regshort__ls
+#define A__NAME__ge arm_instr_adds_regshort__ge
+#define A__NAME__lt arm_instr_adds_regshort__lt
+#define A__NAME__gt arm_instr_adds_regshort__gt
+#define A__NAME__le arm_instr_adds_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__ADD
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADD
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_adcs_regshort
+#define A__NAME__eq arm_instr_adcs_regshort__eq
+#define A__NAME__ne arm_instr_adcs_regshort__ne
+#define A__NAME__cs arm_instr_adcs_regshort__cs
+#define A__NAME__cc arm_instr_adcs_regshort__cc
+#define A__NAME__mi arm_instr_adcs_regshort__mi
+#define A__NAME__pl arm_instr_adcs_regshort__pl
+#define A__NAME__vs arm_instr_adcs_regshort__vs
+#define A__NAME__vc arm_instr_adcs_regshort__vc
+#define A__NAME__hi arm_instr_adcs_regshort__hi
+#define A__NAME__ls arm_instr_adcs_regshort__ls
+#define A__NAME__ge arm_instr_adcs_regshort__ge
+#define A__NAME__lt arm_instr_adcs_regshort__lt
+#define A__NAME__gt arm_instr_adcs_regshort__gt
+#define A__NAME__le arm_instr_adcs_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__ADC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ADC
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_sbcs_regshort
+#define A__NAME__eq arm_instr_sbcs_regshort__eq
+#define A__NAME__ne arm_instr_sbcs_regshort__ne
+#define A__NAME__cs arm_instr_sbcs_regshort__cs
+#define A__NAME__cc arm_instr_sbcs_regshort__cc
+#define A__NAME__mi arm_instr_sbcs_regshort__mi
+#define A__NAME__pl arm_instr_sbcs_regshort__pl
+#define A__NAME__vs arm_instr_sbcs_regshort__vs
+#define A__NAME__vc arm_instr_sbcs_regshort__vc
+#define A__NAME__hi arm_instr_sbcs_regshort__hi
+#define A__NAME__ls arm_instr_sbcs_regshort__ls
+#define A__NAME__ge arm_instr_sbcs_regshort__ge
+#define A__NAME__lt arm_instr_sbcs_regshort__lt
+#define A__NAME__gt arm_instr_sbcs_regshort__gt
+#define A__NAME__le arm_instr_sbcs_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__SBC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__SBC
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_rscs_regshort
+#define A__NAME__eq arm_instr_rscs_regshort__eq
+#define A__NAME__ne arm_instr_rscs_regshort__ne
+#define A__NAME__cs arm_instr_rscs_regshort__cs
+#define A__NAME__cc arm_instr_rscs_regshort__cc
+#define A__NAME__mi arm_instr_rscs_regshort__mi
+#define A__NAME__pl arm_instr_rscs_regshort__pl
+#define A__NAME__vs arm_instr_rscs_regshort__vs
+#define A__NAME__vc arm_instr_rscs_regshort__vc
+#define A__NAME__hi arm_instr_rscs_regshort__hi
+#define A__NAME__ls arm_instr_rscs_regshort__ls
+#define A__NAME__ge arm_instr_rscs_regshort__ge
+#define A__NAME__lt arm_instr_rscs_regshort__lt
+#define A__NAME__gt arm_instr_rscs_regshort__gt
+#define A__NAME__le arm_instr_rscs_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__RSC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__RSC
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_tsts_regshort
+#define A__NAME__eq arm_instr_tsts_regshort__eq
+#define A__NAME__ne arm_instr_tsts_regshort__ne
+#define A__NAME__cs arm_instr_tsts_regshort__cs
+#define A__NAME__cc arm_instr_tsts_regshort__cc
+#define A__NAME__mi arm_instr_tsts_regshort__mi
+#define A__NAME__pl arm_instr_tsts_regshort__pl
+#define A__NAME__vs arm_instr_tsts_regshort__vs
+#define A__NAME__vc arm_instr_tsts_regshort__vc
+#define A__NAME__hi arm_instr_tsts_regshort__hi
+#define A__NAME__ls arm_instr_tsts_regshort__ls
+#define A__NAME__ge arm_instr_tsts_regshort__ge
+#define A__NAME__lt arm_instr_tsts_regshort__lt
+#define A__NAME__gt arm_instr_tsts_regshort__gt
+#define A__NAME__le arm_instr_tsts_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__TST
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TST
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_teqs_regshort
+#define A__NAME__eq arm_instr_teqs_regshort__eq
+#define A__NAME__ne arm_instr_teqs_regshort__ne
+#define A__NAME__cs arm_instr_teqs_regshort__cs
+#define A__NAME__cc arm_instr_teqs_regshort__cc
+#define A__NAME__mi arm_instr_teqs_regshort__mi
+#define A__NAME__pl arm_instr_teqs_regshort__pl
+#define A__NAME__vs arm_instr_teqs_regshort__vs
+#define A__NAME__vc arm_instr_teqs_regshort__vc
+#define A__NAME__hi arm_instr_teqs_regshort__hi
+#define A__NAME__ls arm_instr_teqs_regshort__ls
+#define A__NAME__ge arm_instr_teqs_regshort__ge
+#define A__NAME__lt arm_instr_teqs_regshort__lt
+#define A__NAME__gt arm_instr_teqs_regshort__gt
+#define A__NAME__le arm_instr_teqs_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__TEQ
+#include "cpu_arm_instr_dpi.cc"
+#undef A__TEQ
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmps_regshort
+#define A__NAME__eq arm_instr_cmps_regshort__eq
+#define A__NAME__ne arm_instr_cmps_regshort__ne
+#define A__NAME__cs arm_instr_cmps_regshort__cs
+#define A__NAME__cc arm_instr_cmps_regshort__cc
+#define A__NAME__mi arm_instr_cmps_regshort__mi
+#define A__NAME__pl arm_instr_cmps_regshort__pl
+#define A__NAME__vs arm_instr_cmps_regshort__vs
+#define A__NAME__vc arm_instr_cmps_regshort__vc
+#define A__NAME__hi arm_instr_cmps_regshort__hi
+#define A__NAME__ls arm_instr_cmps_regshort__ls
+#define A__NAME__ge arm_instr_cmps_regshort__ge
+#define A__NAME__lt arm_instr_cmps_regshort__lt
+#define A__NAME__gt arm_instr_cmps_regshort__gt
+#define A__NAME__le arm_instr_cmps_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__CMP
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMP
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_cmns_regshort
+#define A__NAME__eq arm_instr_cmns_regshort__eq
+#define A__NAME__ne arm_instr_cmns_regshort__ne
+#define A__NAME__cs arm_instr_cmns_regshort__cs
+#define A__NAME__cc arm_instr_cmns_regshort__cc
+#define A__NAME__mi arm_instr_cmns_regshort__mi
+#define A__NAME__pl arm_instr_cmns_regshort__pl
+#define A__NAME__vs arm_instr_cmns_regshort__vs
+#define A__NAME__vc arm_instr_cmns_regshort__vc
+#define A__NAME__hi arm_instr_cmns_regshort__hi
+#define A__NAME__ls arm_instr_cmns_regshort__ls
+#define A__NAME__ge arm_instr_cmns_regshort__ge
+#define A__NAME__lt arm_instr_cmns_regshort__lt
+#define A__NAME__gt arm_instr_cmns_regshort__gt
+#define A__NAME__le arm_instr_cmns_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__CMN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__CMN
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_orrs_regshort
+#define A__NAME__eq arm_instr_orrs_regshort__eq
+#define A__NAME__ne arm_instr_orrs_regshort__ne
+#define A__NAME__cs arm_instr_orrs_regshort__cs
+#define A__NAME__cc arm_instr_orrs_regshort__cc
+#define A__NAME__mi arm_instr_orrs_regshort__mi
+#define A__NAME__pl arm_instr_orrs_regshort__pl
+#define A__NAME__vs arm_instr_orrs_regshort__vs
+#define A__NAME__vc arm_instr_orrs_regshort__vc
+#define A__NAME__hi arm_instr_orrs_regshort__hi
+#define A__NAME__ls arm_instr_orrs_regshort__ls
+#define A__NAME__ge arm_instr_orrs_regshort__ge
+#define A__NAME__lt arm_instr_orrs_regshort__lt
+#define A__NAME__gt arm_instr_orrs_regshort__gt
+#define A__NAME__le arm_instr_orrs_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__ORR
+#include "cpu_arm_instr_dpi.cc"
+#undef A__ORR
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_movs_regshort
+#define A__NAME__eq arm_instr_movs_regshort__eq
+#define A__NAME__ne arm_instr_movs_regshort__ne
+#define A__NAME__cs arm_instr_movs_regshort__cs
+#define A__NAME__cc arm_instr_movs_regshort__cc
+#define A__NAME__mi arm_instr_movs_regshort__mi
+#define A__NAME__pl arm_instr_movs_regshort__pl
+#define A__NAME__vs arm_instr_movs_regshort__vs
+#define A__NAME__vc arm_instr_movs_regshort__vc
+#define A__NAME__hi arm_instr_movs_regshort__hi
+#define A__NAME__ls arm_instr_movs_regshort__ls
+#define A__NAME__ge arm_instr_movs_regshort__ge
+#define A__NAME__lt arm_instr_movs_regshort__lt
+#define A__NAME__gt arm_instr_movs_regshort__gt
+#define A__NAME__le arm_instr_movs_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__MOV
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MOV
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_bics_regshort
+#define A__NAME__eq arm_instr_bics_regshort__eq
+#define A__NAME__ne arm_instr_bics_regshort__ne
+#define A__NAME__cs arm_instr_bics_regshort__cs
+#define A__NAME__cc arm_instr_bics_regshort__cc
+#define A__NAME__mi arm_instr_bics_regshort__mi
+#define A__NAME__pl arm_instr_bics_regshort__pl
+#define A__NAME__vs arm_instr_bics_regshort__vs
+#define A__NAME__vc arm_instr_bics_regshort__vc
+#define A__NAME__hi arm_instr_bics_regshort__hi
+#define A__NAME__ls arm_instr_bics_regshort__ls
+#define A__NAME__ge arm_instr_bics_regshort__ge
+#define A__NAME__lt arm_instr_bics_regshort__lt
+#define A__NAME__gt arm_instr_bics_regshort__gt
+#define A__NAME__le arm_instr_bics_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__BIC
+#include "cpu_arm_instr_dpi.cc"
+#undef A__BIC
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+#define A__NAME arm_instr_mvns_regshort
+#define A__NAME__eq arm_instr_mvns_regshort__eq
+#define A__NAME__ne arm_instr_mvns_regshort__ne
+#define A__NAME__cs arm_instr_mvns_regshort__cs
+#define A__NAME__cc arm_instr_mvns_regshort__cc
+#define A__NAME__mi arm_instr_mvns_regshort__mi
+#define A__NAME__pl arm_instr_mvns_regshort__pl
+#define A__NAME__vs arm_instr_mvns_regshort__vs
+#define A__NAME__vc arm_instr_mvns_regshort__vc
+#define A__NAME__hi arm_instr_mvns_regshort__hi
+#define A__NAME__ls arm_instr_mvns_regshort__ls
+#define A__NAME__ge arm_instr_mvns_regshort__ge
+#define A__NAME__lt arm_instr_mvns_regshort__lt
+#define A__NAME__gt arm_instr_mvns_regshort__gt
+#define A__NAME__le arm_instr_mvns_regshort__le
+#define A__S
+#define A__REGSHORT
+#define A__MVN
+#include "cpu_arm_instr_dpi.cc"
+#undef A__MVN
+#undef A__S
+#undef A__REGSHORT
+#undef A__NAME__eq
+#undef A__NAME__ne
+#undef A__NAME__cs
+#undef A__NAME__cc
+#undef A__NAME__mi
+#undef A__NAME__pl
+#undef A__NAME__vs
+#undef A__NAME__vc
+#undef A__NAME__hi
+#undef A__NAME__ls
+#undef A__NAME__ge
+#undef A__NAME__lt
+#undef A__NAME__gt
+#undef A__NAME__le
+#undef A__NAME
+
+	void (*arm_dpi_instr[2 * 2 * 2 * 16 * 16])(struct cpu *,
+		struct arm_instr_call *) = {
+	arm_instr_and__eq,
+	arm_instr_and__ne,
+	arm_instr_and__cs,
+	arm_instr_and__cc,
+	arm_instr_and__mi,
+	arm_instr_and__pl,
+	arm_instr_and__vs,
+	arm_instr_and__vc,
+	arm_instr_and__hi,
+	arm_instr_and__ls,
+	arm_instr_and__ge,
+	arm_instr_and__lt,
+	arm_instr_and__gt,
+	arm_instr_and__le,
+	arm_instr_and,
+	arm_instr_nop,
+	arm_instr_eor__eq,
+	arm_instr_eor__ne,
+	arm_instr_eor__cs,
+	arm_instr_eor__cc,
+	arm_instr_eor__mi,
+	arm_instr_eor__pl,
+	arm_instr_eor__vs,
+	arm_instr_eor__vc,
+	arm_instr_eor__hi,
+	arm_instr_eor__ls,
+	arm_instr_eor__ge,
+	arm_instr_eor__lt,
+	arm_instr_eor__gt,
+	arm_instr_eor__le,
+	arm_instr_eor,
+	arm_instr_nop,
+	arm_instr_sub__eq,
+	arm_instr_sub__ne,
+	arm_instr_sub__cs,
+	arm_instr_sub__cc,
+	arm_instr_sub__mi,
+	arm_instr_sub__pl,
+	arm_instr_sub__vs,
+	arm_instr_sub__vc,
+	arm_instr_sub__hi,
+	arm_instr_sub__ls,
+	arm_instr_sub__ge,
+	arm_instr_sub__lt,
+	arm_instr_sub__gt,
+	arm_instr_sub__le,
+	arm_instr_sub,
+	arm_instr_nop,
+	arm_instr_rsb__eq,
+	arm_instr_rsb__ne,
+	arm_instr_rsb__cs,
+	arm_instr_rsb__cc,
+	arm_instr_rsb__mi,
+	arm_instr_rsb__pl,
+	arm_instr_rsb__vs,
+	arm_instr_rsb__vc,
+	arm_instr_rsb__hi,
+	arm_instr_rsb__ls,
+	arm_instr_rsb__ge,
+	arm_instr_rsb__lt,
+	arm_instr_rsb__gt,
+	arm_instr_rsb__le,
+	arm_instr_rsb,
+	arm_instr_nop,
+	arm_instr_add__eq,
+	arm_instr_add__ne,
+	arm_instr_add__cs,
+	arm_instr_add__cc,
+	arm_instr_add__mi,
+	arm_instr_add__pl,
+	arm_instr_add__vs,
+	arm_instr_add__vc,
+	arm_instr_add__hi,
+	arm_instr_add__ls,
+	arm_instr_add__ge,
+	arm_instr_add__lt,
+	arm_instr_add__gt,
+	arm_instr_add__le,
+	arm_instr_add,
+	arm_instr_nop,
+	arm_instr_adc__eq,
+	arm_instr_adc__ne,
+	arm_instr_adc__cs,
+	arm_instr_adc__cc,
+	arm_instr_adc__mi,
+	arm_instr_adc__pl,
+	arm_instr_adc__vs,
+	arm_instr_adc__vc,
+	arm_instr_adc__hi,
+	arm_instr_adc__ls,
+	arm_instr_adc__ge,
+	arm_instr_adc__lt,
+	arm_instr_adc__gt,
+	arm_instr_adc__le,
+	arm_instr_adc,
+	arm_instr_nop,
+	arm_instr_sbc__eq,
+	arm_instr_sbc__ne,
+	arm_instr_sbc__cs,
+	arm_instr_sbc__cc,
+	arm_instr_sbc__mi,
+	arm_instr_sbc__pl,
+	arm_instr_sbc__vs,
+	arm_instr_sbc__vc,
+	arm_instr_sbc__hi,
+	arm_instr_sbc__ls,
+	arm_instr_sbc__ge,
+	arm_instr_sbc__lt,
+	arm_instr_sbc__gt,
+	arm_instr_sbc__le,
+	arm_instr_sbc,
+	arm_instr_nop,
+	arm_instr_rsc__eq,
+	arm_instr_rsc__ne,
+	arm_instr_rsc__cs,
+	arm_instr_rsc__cc,
+	arm_instr_rsc__mi,
+	arm_instr_rsc__pl,
+	arm_instr_rsc__vs,
+	arm_instr_rsc__vc,
+	arm_instr_rsc__hi,
+	arm_instr_rsc__ls,
+	arm_instr_rsc__ge,
+	arm_instr_rsc__lt,
+	arm_instr_rsc__gt,
+	arm_instr_rsc__le,
+	arm_instr_rsc,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_orr__eq,
+	arm_instr_orr__ne,
+	arm_instr_orr__cs,
+	arm_instr_orr__cc,
+	arm_instr_orr__mi,
+	arm_instr_orr__pl,
+	arm_instr_orr__vs,
+	arm_instr_orr__vc,
+	arm_instr_orr__hi,
+	arm_instr_orr__ls,
+	arm_instr_orr__ge,
+	arm_instr_orr__lt,
+	arm_instr_orr__gt,
+	arm_instr_orr__le,
+	arm_instr_orr,
+	arm_instr_nop,
+	arm_instr_mov__eq,
+	arm_instr_mov__ne,
+	arm_instr_mov__cs,
+	arm_instr_mov__cc,
+	arm_instr_mov__mi,
+	arm_instr_mov__pl,
+	arm_instr_mov__vs,
+	arm_instr_mov__vc,
+	arm_instr_mov__hi,
+	arm_instr_mov__ls,
+	arm_instr_mov__ge,
+	arm_instr_mov__lt,
+	arm_instr_mov__gt,
+	arm_instr_mov__le,
+	arm_instr_mov,
+	arm_instr_nop,
+	arm_instr_bic__eq,
+	arm_instr_bic__ne,
+	arm_instr_bic__cs,
+	arm_instr_bic__cc,
+	arm_instr_bic__mi,
+	arm_instr_bic__pl,
+	arm_instr_bic__vs,
+	arm_instr_bic__vc,
+	arm_instr_bic__hi,
+	arm_instr_bic__ls,
+	arm_instr_bic__ge,
+	arm_instr_bic__lt,
+	arm_instr_bic__gt,
+	arm_instr_bic__le,
+	arm_instr_bic,
+	arm_instr_nop,
+	arm_instr_mvn__eq,
+	arm_instr_mvn__ne,
+	arm_instr_mvn__cs,
+	arm_instr_mvn__cc,
+	arm_instr_mvn__mi,
+	arm_instr_mvn__pl,
+	arm_instr_mvn__vs,
+	arm_instr_mvn__vc,
+	arm_instr_mvn__hi,
+	arm_instr_mvn__ls,
+	arm_instr_mvn__ge,
+	arm_instr_mvn__lt,
+	arm_instr_mvn__gt,
+	arm_instr_mvn__le,
+	arm_instr_mvn,
+	arm_instr_nop,
+	arm_instr_ands__eq,
+	arm_instr_ands__ne,
+	arm_instr_ands__cs,
+	arm_instr_ands__cc,
+	arm_instr_ands__mi,
+	arm_instr_ands__pl,
+	arm_instr_ands__vs,
+	arm_instr_ands__vc,
+	arm_instr_ands__hi,
+	arm_instr_ands__ls,
+	arm_instr_ands__ge,
+	arm_instr_ands__lt,
+	arm_instr_ands__gt,
+	arm_instr_ands__le,
+	arm_instr_ands,
+	arm_instr_nop,
+	arm_instr_eors__eq,
+	arm_instr_eors__ne,
+	arm_instr_eors__cs,
+	arm_instr_eors__cc,
+	arm_instr_eors__mi,
+	arm_instr_eors__pl,
+	arm_instr_eors__vs,
+	arm_instr_eors__vc,
+	arm_instr_eors__hi,
+	arm_instr_eors__ls,
+	arm_instr_eors__ge,
+	arm_instr_eors__lt,
+	arm_instr_eors__gt,
+	arm_instr_eors__le,
+	arm_instr_eors,
+	arm_instr_nop,
+	arm_instr_subs__eq,
+	arm_instr_subs__ne,
+	arm_instr_subs__cs,
+	arm_instr_subs__cc,
+	arm_instr_subs__mi,
+	arm_instr_subs__pl,
+	arm_instr_subs__vs,
+	arm_instr_subs__vc,
+	arm_instr_subs__hi,
+	arm_instr_subs__ls,
+	arm_instr_subs__ge,
+	arm_instr_subs__lt,
+	arm_instr_subs__gt,
+	arm_instr_subs__le,
+	arm_instr_subs,
+	arm_instr_nop,
+	arm_instr_rsbs__eq,
+	arm_instr_rsbs__ne,
+	arm_instr_rsbs__cs,
+	arm_instr_rsbs__cc,
+	arm_instr_rsbs__mi,
+	arm_instr_rsbs__pl,
+	arm_instr_rsbs__vs,
+	arm_instr_rsbs__vc,
+	arm_instr_rsbs__hi,
+	arm_instr_rsbs__ls,
+	arm_instr_rsbs__ge,
+	arm_instr_rsbs__lt,
+	arm_instr_rsbs__gt,
+	arm_instr_rsbs__le,
+	arm_instr_rsbs,
+	arm_instr_nop,
+	arm_instr_adds__eq,
+	arm_instr_adds__ne,
+	arm_instr_adds__cs,
+	arm_instr_adds__cc,
+	arm_instr_adds__mi,
+	arm_instr_adds__pl,
+	arm_instr_adds__vs,
+	arm_instr_adds__vc,
+	arm_instr_adds__hi,
+	arm_instr_adds__ls,
+	arm_instr_adds__ge,
+	arm_instr_adds__lt,
+	arm_instr_adds__gt,
+	arm_instr_adds__le,
+	arm_instr_adds,
+	arm_instr_nop,
+	arm_instr_adcs__eq,
+	arm_instr_adcs__ne,
+	arm_instr_adcs__cs,
+	arm_instr_adcs__cc,
+	arm_instr_adcs__mi,
+	arm_instr_adcs__pl,
+	arm_instr_adcs__vs,
+	arm_instr_adcs__vc,
+	arm_instr_adcs__hi,
+	arm_instr_adcs__ls,
+	arm_instr_adcs__ge,
+	arm_instr_adcs__lt,
+	arm_instr_adcs__gt,
+	arm_instr_adcs__le,
+	arm_instr_adcs,
+	arm_instr_nop,
+	arm_instr_sbcs__eq,
+	arm_instr_sbcs__ne,
+	arm_instr_sbcs__cs,
+	arm_instr_sbcs__cc,
+	arm_instr_sbcs__mi,
+	arm_instr_sbcs__pl,
+	arm_instr_sbcs__vs,
+	arm_instr_sbcs__vc,
+	arm_instr_sbcs__hi,
+	arm_instr_sbcs__ls,
+	arm_instr_sbcs__ge,
+	arm_instr_sbcs__lt,
+	arm_instr_sbcs__gt,
+	arm_instr_sbcs__le,
+	arm_instr_sbcs,
+	arm_instr_nop,
+	arm_instr_rscs__eq,
+	arm_instr_rscs__ne,
+	arm_instr_rscs__cs,
+	arm_instr_rscs__cc,
+	arm_instr_rscs__mi,
+	arm_instr_rscs__pl,
+	arm_instr_rscs__vs,
+	arm_instr_rscs__vc,
+	arm_instr_rscs__hi,
+	arm_instr_rscs__ls,
+	arm_instr_rscs__ge,
+	arm_instr_rscs__lt,
+	arm_instr_rscs__gt,
+	arm_instr_rscs__le,
+	arm_instr_rscs,
+	arm_instr_nop,
+	arm_instr_tsts__eq,
+	arm_instr_tsts__ne,
+	arm_instr_tsts__cs,
+	arm_instr_tsts__cc,
+	arm_instr_tsts__mi,
+	arm_instr_tsts__pl,
+	arm_instr_tsts__vs,
+	arm_instr_tsts__vc,
+	arm_instr_tsts__hi,
+	arm_instr_tsts__ls,
+	arm_instr_tsts__ge,
+	arm_instr_tsts__lt,
+	arm_instr_tsts__gt,
+	arm_instr_tsts__le,
+	arm_instr_tsts,
+	arm_instr_nop,
+	arm_instr_teqs__eq,
+	arm_instr_teqs__ne,
+	arm_instr_teqs__cs,
+	arm_instr_teqs__cc,
+	arm_instr_teqs__mi,
+	arm_instr_teqs__pl,
+	arm_instr_teqs__vs,
+	arm_instr_teqs__vc,
+	arm_instr_teqs__hi,
+	arm_instr_teqs__ls,
+	arm_instr_teqs__ge,
+	arm_instr_teqs__lt,
+	arm_instr_teqs__gt,
+	arm_instr_teqs__le,
+	arm_instr_teqs,
+	arm_instr_nop,
+	arm_instr_cmps__eq,
+	arm_instr_cmps__ne,
+	arm_instr_cmps__cs,
+	arm_instr_cmps__cc,
+	arm_instr_cmps__mi,
+	arm_instr_cmps__pl,
+	arm_instr_cmps__vs,
+	arm_instr_cmps__vc,
+	arm_instr_cmps__hi,
+	arm_instr_cmps__ls,
+	arm_instr_cmps__ge,
+	arm_instr_cmps__lt,
+	arm_instr_cmps__gt,
+	arm_instr_cmps__le,
+	arm_instr_cmps,
+	arm_instr_nop,
+	arm_instr_cmns__eq,
+	arm_instr_cmns__ne,
+	arm_instr_cmns__cs,
+	arm_instr_cmns__cc,
+	arm_instr_cmns__mi,
+	arm_instr_cmns__pl,
+	arm_instr_cmns__vs,
+	arm_instr_cmns__vc,
+	arm_instr_cmns__hi,
+	arm_instr_cmns__ls,
+	arm_instr_cmns__ge,
+	arm_instr_cmns__lt,
+	arm_instr_cmns__gt,
+	arm_instr_cmns__le,
+	arm_instr_cmns,
+	arm_instr_nop,
+	arm_instr_orrs__eq,
+	arm_instr_orrs__ne,
+	arm_instr_orrs__cs,
+	arm_instr_orrs__cc,
+	arm_instr_orrs__mi,
+	arm_instr_orrs__pl,
+	arm_instr_orrs__vs,
+	arm_instr_orrs__vc,
+	arm_instr_orrs__hi,
+	arm_instr_orrs__ls,
+	arm_instr_orrs__ge,
+	arm_instr_orrs__lt,
+	arm_instr_orrs__gt,
+	arm_instr_orrs__le,
+	arm_instr_orrs,
+	arm_instr_nop,
+	arm_instr_movs__eq,
+	arm_instr_movs__ne,
+	arm_instr_movs__cs,
+	arm_instr_movs__cc,
+	arm_instr_movs__mi,
+	arm_instr_movs__pl,
+	arm_instr_movs__vs,
+	arm_instr_movs__vc,
+	arm_instr_movs__hi,
+	arm_instr_movs__ls,
+	arm_instr_movs__ge,
+	arm_instr_movs__lt,
+	arm_instr_movs__gt,
+	arm_instr_movs__le,
+	arm_instr_movs,
+	arm_instr_nop,
+	arm_instr_bics__eq,
+	arm_instr_bics__ne,
+	arm_instr_bics__cs,
+	arm_instr_bics__cc,
+	arm_instr_bics__mi,
+	arm_instr_bics__pl,
+	arm_instr_bics__vs,
+	arm_instr_bics__vc,
+	arm_instr_bics__hi,
+	arm_instr_bics__ls,
+	arm_instr_bics__ge,
+	arm_instr_bics__lt,
+	arm_instr_bics__gt,
+	arm_instr_bics__le,
+	arm_instr_bics,
+	arm_instr_nop,
+	arm_instr_mvns__eq,
+	arm_instr_mvns__ne,
+	arm_instr_mvns__cs,
+	arm_instr_mvns__cc,
+	arm_instr_mvns__mi,
+	arm_instr_mvns__pl,
+	arm_instr_mvns__vs,
+	arm_instr_mvns__vc,
+	arm_instr_mvns__hi,
+	arm_instr_mvns__ls,
+	arm_instr_mvns__ge,
+	arm_instr_mvns__lt,
+	arm_instr_mvns__gt,
+	arm_instr_mvns__le,
+	arm_instr_mvns,
+	arm_instr_nop,
+	arm_instr_and_pc__eq,
+	arm_instr_and_pc__ne,
+	arm_instr_and_pc__cs,
+	arm_instr_and_pc__cc,
+	arm_instr_and_pc__mi,
+	arm_instr_and_pc__pl,
+	arm_instr_and_pc__vs,
+	arm_instr_and_pc__vc,
+	arm_instr_and_pc__hi,
+	arm_instr_and_pc__ls,
+	arm_instr_and_pc__ge,
+	arm_instr_and_pc__lt,
+	arm_instr_and_pc__gt,
+	arm_instr_and_pc__le,
+	arm_instr_and_pc,
+	arm_instr_nop,
+	arm_instr_eor_pc__eq,
+	arm_instr_eor_pc__ne,
+	arm_instr_eor_pc__cs,
+	arm_instr_eor_pc__cc,
+	arm_instr_eor_pc__mi,
+	arm_instr_eor_pc__pl,
+	arm_instr_eor_pc__vs,
+	arm_instr_eor_pc__vc,
+	arm_instr_eor_pc__hi,
+	arm_instr_eor_pc__ls,
+	arm_instr_eor_pc__ge,
+	arm_instr_eor_pc__lt,
+	arm_instr_eor_pc__gt,
+	arm_instr_eor_pc__le,
+	arm_instr_eor_pc,
+	arm_instr_nop,
+	arm_instr_sub_pc__eq,
+	arm_instr_sub_pc__ne,
+	arm_instr_sub_pc__cs,
+	arm_instr_sub_pc__cc,
+	arm_instr_sub_pc__mi,
+	arm_instr_sub_pc__pl,
+	arm_instr_sub_pc__vs,
+	arm_instr_sub_pc__vc,
+	arm_instr_sub_pc__hi,
+	arm_instr_sub_pc__ls,
+	arm_instr_sub_pc__ge,
+	arm_instr_sub_pc__lt,
+	arm_instr_sub_pc__gt,
+	arm_instr_sub_pc__le,
+	arm_instr_sub_pc,
+	arm_instr_nop,
+	arm_instr_rsb_pc__eq,
+	arm_instr_rsb_pc__ne,
+	arm_instr_rsb_pc__cs,
+	arm_instr_rsb_pc__cc,
+	arm_instr_rsb_pc__mi,
+	arm_instr_rsb_pc__pl,
+	arm_instr_rsb_pc__vs,
+	arm_instr_rsb_pc__vc,
+	arm_instr_rsb_pc__hi,
+	arm_instr_rsb_pc__ls,
+	arm_instr_rsb_pc__ge,
+	arm_instr_rsb_pc__lt,
+	arm_instr_rsb_pc__gt,
+	arm_instr_rsb_pc__le,
+	arm_instr_rsb_pc,
+	arm_instr_nop,
+	arm_instr_add_pc__eq,
+	arm_instr_add_pc__ne,
+	arm_instr_add_pc__cs,
+	arm_instr_add_pc__cc,
+	arm_instr_add_pc__mi,
+	arm_instr_add_pc__pl,
+	arm_instr_add_pc__vs,
+	arm_instr_add_pc__vc,
+	arm_instr_add_pc__hi,
+	arm_instr_add_pc__ls,
+	arm_instr_add_pc__ge,
+	arm_instr_add_pc__lt,
+	arm_instr_add_pc__gt,
+	arm_instr_add_pc__le,
+	arm_instr_add_pc,
+	arm_instr_nop,
+	arm_instr_adc_pc__eq,
+	arm_instr_adc_pc__ne,
+	arm_instr_adc_pc__cs,
+	arm_instr_adc_pc__cc,
+	arm_instr_adc_pc__mi,
+	arm_instr_adc_pc__pl,
+	arm_instr_adc_pc__vs,
+	arm_instr_adc_pc__vc,
+	arm_instr_adc_pc__hi,
+	arm_instr_adc_pc__ls,
+	arm_instr_adc_pc__ge,
+	arm_instr_adc_pc__lt,
+	arm_instr_adc_pc__gt,
+	arm_instr_adc_pc__le,
+	arm_instr_adc_pc,
+	arm_instr_nop,
+	arm_instr_sbc_pc__eq,
+	arm_instr_sbc_pc__ne,
+	arm_instr_sbc_pc__cs,
+	arm_instr_sbc_pc__cc,
+	arm_instr_sbc_pc__mi,
+	arm_instr_sbc_pc__pl,
+	arm_instr_sbc_pc__vs,
+	arm_instr_sbc_pc__vc,
+	arm_instr_sbc_pc__hi,
+	arm_instr_sbc_pc__ls,
+	arm_instr_sbc_pc__ge,
+	arm_instr_sbc_pc__lt,
+	arm_instr_sbc_pc__gt,
+	arm_instr_sbc_pc__le,
+	arm_instr_sbc_pc,
+	arm_instr_nop,
+	arm_instr_rsc_pc__eq,
+	arm_instr_rsc_pc__ne,
+	arm_instr_rsc_pc__cs,
+	arm_instr_rsc_pc__cc,
+	arm_instr_rsc_pc__mi,
+	arm_instr_rsc_pc__pl,
+	arm_instr_rsc_pc__vs,
+	arm_instr_rsc_pc__vc,
+	arm_instr_rsc_pc__hi,
+	arm_instr_rsc_pc__ls,
+	arm_instr_rsc_pc__ge,
+	arm_instr_rsc_pc__lt,
+	arm_instr_rsc_pc__gt,
+	arm_instr_rsc_pc__le,
+	arm_instr_rsc_pc,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_orr_pc__eq,
+	arm_instr_orr_pc__ne,
+	arm_instr_orr_pc__cs,
+	arm_instr_orr_pc__cc,
+	arm_instr_orr_pc__mi,
+	arm_instr_orr_pc__pl,
+	arm_instr_orr_pc__vs,
+	arm_instr_orr_pc__vc,
+	arm_instr_orr_pc__hi,
+	arm_instr_orr_pc__ls,
+	arm_instr_orr_pc__ge,
+	arm_instr_orr_pc__lt,
+	arm_instr_orr_pc__gt,
+	arm_instr_orr_pc__le,
+	arm_instr_orr_pc,
+	arm_instr_nop,
+	arm_instr_mov_pc__eq,
+	arm_instr_mov_pc__ne,
+	arm_instr_mov_pc__cs,
+	arm_instr_mov_pc__cc,
+	arm_instr_mov_pc__mi,
+	arm_instr_mov_pc__pl,
+	arm_instr_mov_pc__vs,
+	arm_instr_mov_pc__vc,
+	arm_instr_mov_pc__hi,
+	arm_instr_mov_pc__ls,
+	arm_instr_mov_pc__ge,
+	arm_instr_mov_pc__lt,
+	arm_instr_mov_pc__gt,
+	arm_instr_mov_pc__le,
+	arm_instr_mov_pc,
+	arm_instr_nop,
+	arm_instr_bic_pc__eq,
+	arm_instr_bic_pc__ne,
+	arm_instr_bic_pc__cs,
+	arm_instr_bic_pc__cc,
+	arm_instr_bic_pc__mi,
+	arm_instr_bic_pc__pl,
+	arm_instr_bic_pc__vs,
+	arm_instr_bic_pc__vc,
+	arm_instr_bic_pc__hi,
+	arm_instr_bic_pc__ls,
+	arm_instr_bic_pc__ge,
+	arm_instr_bic_pc__lt,
+	arm_instr_bic_pc__gt,
+	arm_instr_bic_pc__le,
+	arm_instr_bic_pc,
+	arm_instr_nop,
+	arm_instr_mvn_pc__eq,
+	arm_instr_mvn_pc__ne,
+	arm_instr_mvn_pc__cs,
+	arm_instr_mvn_pc__cc,
+	arm_instr_mvn_pc__mi,
+	arm_instr_mvn_pc__pl,
+	arm_instr_mvn_pc__vs,
+	arm_instr_mvn_pc__vc,
+	arm_instr_mvn_pc__hi,
+	arm_instr_mvn_pc__ls,
+	arm_instr_mvn_pc__ge,
+	arm_instr_mvn_pc__lt,
+	arm_instr_mvn_pc__gt,
+	arm_instr_mvn_pc__le,
+	arm_instr_mvn_pc,
+	arm_instr_nop,
+	arm_instr_ands_pc__eq,
+	arm_instr_ands_pc__ne,
+	arm_instr_ands_pc__cs,
+	arm_instr_ands_pc__cc,
+	arm_instr_ands_pc__mi,
+	arm_instr_ands_pc__pl,
+	arm_instr_ands_pc__vs,
+	arm_instr_ands_pc__vc,
+	arm_instr_ands_pc__hi,
+	arm_instr_ands_pc__ls,
+	arm_instr_ands_pc__ge,
+	arm_instr_ands_pc__lt,
+	arm_instr_ands_pc__gt,
+	arm_instr_ands_pc__le,
+	arm_instr_ands_pc,
+	arm_instr_nop,
+	arm_instr_eors_pc__eq,
+	arm_instr_eors_pc__ne,
+	arm_instr_eors_pc__cs,
+	arm_instr_eors_pc__cc,
+	arm_instr_eors_pc__mi,
+	arm_instr_eors_pc__pl,
+	arm_instr_eors_pc__vs,
+	arm_instr_eors_pc__vc,
+	arm_instr_eors_pc__hi,
+	arm_instr_eors_pc__ls,
+	arm_instr_eors_pc__ge,
+	arm_instr_eors_pc__lt,
+	arm_instr_eors_pc__gt,
+	arm_instr_eors_pc__le,
+	arm_instr_eors_pc,
+	arm_instr_nop,
+	arm_instr_subs_pc__eq,
+	arm_instr_subs_pc__ne,
+	arm_instr_subs_pc__cs,
+	arm_instr_subs_pc__cc,
+	arm_instr_subs_pc__mi,
+	arm_instr_subs_pc__pl,
+	arm_instr_subs_pc__vs,
+	arm_instr_subs_pc__vc,
+	arm_instr_subs_pc__hi,
+	arm_instr_subs_pc__ls,
+	arm_instr_subs_pc__ge,
+	arm_instr_subs_pc__lt,
+	arm_instr_subs_pc__gt,
+	arm_instr_subs_pc__le,
+	arm_instr_subs_pc,
+	arm_instr_nop,
+	arm_instr_rsbs_pc__eq,
+	arm_instr_rsbs_pc__ne,
+	arm_instr_rsbs_pc__cs,
+	arm_instr_rsbs_pc__cc,
+	arm_instr_rsbs_pc__mi,
+	arm_instr_rsbs_pc__pl,
+	arm_instr_rsbs_pc__vs,
+	arm_instr_rsbs_pc__vc,
+	arm_instr_rsbs_pc__hi,
+	arm_instr_rsbs_pc__ls,
+	arm_instr_rsbs_pc__ge,
+	arm_instr_rsbs_pc__lt,
+	arm_instr_rsbs_pc__gt,
+	arm_instr_rsbs_pc__le,
+	arm_instr_rsbs_pc,
+	arm_instr_nop,
+	arm_instr_adds_pc__eq,
+	arm_instr_adds_pc__ne,
+	arm_instr_adds_pc__cs,
+	arm_instr_adds_pc__cc,
+	arm_instr_adds_pc__mi,
+	arm_instr_adds_pc__pl,
+	arm_instr_adds_pc__vs,
+	arm_instr_adds_pc__vc,
+	arm_instr_adds_pc__hi,
+	arm_instr_adds_pc__ls,
+	arm_instr_adds_pc__ge,
+	arm_instr_adds_pc__lt,
+	arm_instr_adds_pc__gt,
+	arm_instr_adds_pc__le,
+	arm_instr_adds_pc,
+	arm_instr_nop,
+	arm_instr_adcs_pc__eq,
+	arm_instr_adcs_pc__ne,
+	arm_instr_adcs_pc__cs,
+	arm_instr_adcs_pc__cc,
+	arm_instr_adcs_pc__mi,
+	arm_instr_adcs_pc__pl,
+	arm_instr_adcs_pc__vs,
+	arm_instr_adcs_pc__vc,
+	arm_instr_adcs_pc__hi,
+	arm_instr_adcs_pc__ls,
+	arm_instr_adcs_pc__ge,
+	arm_instr_adcs_pc__lt,
+	arm_instr_adcs_pc__gt,
+	arm_instr_adcs_pc__le,
+	arm_instr_adcs_pc,
+	arm_instr_nop,
+	arm_instr_sbcs_pc__eq,
+	arm_instr_sbcs_pc__ne,
+	arm_instr_sbcs_pc__cs,
+	arm_instr_sbcs_pc__cc,
+	arm_instr_sbcs_pc__mi,
+	arm_instr_sbcs_pc__pl,
+	arm_instr_sbcs_pc__vs,
+	arm_instr_sbcs_pc__vc,
+	arm_instr_sbcs_pc__hi,
+	arm_instr_sbcs_pc__ls,
+	arm_instr_sbcs_pc__ge,
+	arm_instr_sbcs_pc__lt,
+	arm_instr_sbcs_pc__gt,
+	arm_instr_sbcs_pc__le,
+	arm_instr_sbcs_pc,
+	arm_instr_nop,
+	arm_instr_rscs_pc__eq,
+	arm_instr_rscs_pc__ne,
+	arm_instr_rscs_pc__cs,
+	arm_instr_rscs_pc__cc,
+	arm_instr_rscs_pc__mi,
+	arm_instr_rscs_pc__pl,
+	arm_instr_rscs_pc__vs,
+	arm_instr_rscs_pc__vc,
+	arm_instr_rscs_pc__hi,
+	arm_instr_rscs_pc__ls,
+	arm_instr_rscs_pc__ge,
+	arm_instr_rscs_pc__lt,
+	arm_instr_rscs_pc__gt,
+	arm_instr_rscs_pc__le,
+	arm_instr_rscs_pc,
+	arm_instr_nop,
+	arm_instr_tsts_pc__eq,
+	arm_instr_tsts_pc__ne,
+	arm_instr_tsts_pc__cs,
+	arm_instr_tsts_pc__cc,
+	arm_instr_tsts_pc__mi,
+	arm_instr_tsts_pc__pl,
+	arm_instr_tsts_pc__vs,
+	arm_instr_tsts_pc__vc,
+	arm_instr_tsts_pc__hi,
+	arm_instr_tsts_pc__ls,
+	arm_instr_tsts_pc__ge,
+	arm_instr_tsts_pc__lt,
+	arm_instr_tsts_pc__gt,
+	arm_instr_tsts_pc__le,
+	arm_instr_tsts_pc,
+	arm_instr_nop,
+	arm_instr_teqs_pc__eq,
+	arm_instr_teqs_pc__ne,
+	arm_instr_teqs_pc__cs,
+	arm_instr_teqs_pc__cc,
+	arm_instr_teqs_pc__mi,
+	arm_instr_teqs_pc__pl,
+	arm_instr_teqs_pc__vs,
+	arm_instr_teqs_pc__vc,
+	arm_instr_teqs_pc__hi,
+	arm_instr_teqs_pc__ls,
+	arm_instr_teqs_pc__ge,
+	arm_instr_teqs_pc__lt,
+	arm_instr_teqs_pc__gt,
+	arm_instr_teqs_pc__le,
+	arm_instr_teqs_pc,
+	arm_instr_nop,
+	arm_instr_cmps_pc__eq,
+	arm_instr_cmps_pc__ne,
+	arm_instr_cmps_pc__cs,
+	arm_instr_cmps_pc__cc,
+	arm_instr_cmps_pc__mi,
+	arm_instr_cmps_pc__pl,
+	arm_instr_cmps_pc__vs,
+	arm_instr_cmps_pc__vc,
+	arm_instr_cmps_pc__hi,
+	arm_instr_cmps_pc__ls,
+	arm_instr_cmps_pc__ge,
+	arm_instr_cmps_pc__lt,
+	arm_instr_cmps_pc__gt,
+	arm_instr_cmps_pc__le,
+	arm_instr_cmps_pc,
+	arm_instr_nop,
+	arm_instr_cmns_pc__eq,
+	arm_instr_cmns_pc__ne,
+	arm_instr_cmns_pc__cs,
+	arm_instr_cmns_pc__cc,
+	arm_instr_cmns_pc__mi,
+	arm_instr_cmns_pc__pl,
+	arm_instr_cmns_pc__vs,
+	arm_instr_cmns_pc__vc,
+	arm_instr_cmns_pc__hi,
+	arm_instr_cmns_pc__ls,
+	arm_instr_cmns_pc__ge,
+	arm_instr_cmns_pc__lt,
+	arm_instr_cmns_pc__gt,
+	arm_instr_cmns_pc__le,
+	arm_instr_cmns_pc,
+	arm_instr_nop,
+	arm_instr_orrs_pc__eq,
+	arm_instr_orrs_pc__ne,
+	arm_instr_orrs_pc__cs,
+	arm_instr_orrs_pc__cc,
+	arm_instr_orrs_pc__mi,
+	arm_instr_orrs_pc__pl,
+	arm_instr_orrs_pc__vs,
+	arm_instr_orrs_pc__vc,
+	arm_instr_orrs_pc__hi,
+	arm_instr_orrs_pc__ls,
+	arm_instr_orrs_pc__ge,
+	arm_instr_orrs_pc__lt,
+	arm_instr_orrs_pc__gt,
+	arm_instr_orrs_pc__le,
+	arm_instr_orrs_pc,
+	arm_instr_nop,
+	arm_instr_movs_pc__eq,
+	arm_instr_movs_pc__ne,
+	arm_instr_movs_pc__cs,
+	arm_instr_movs_pc__cc,
+	arm_instr_movs_pc__mi,
+	arm_instr_movs_pc__pl,
+	arm_instr_movs_pc__vs,
+	arm_instr_movs_pc__vc,
+	arm_instr_movs_pc__hi,
+	arm_instr_movs_pc__ls,
+	arm_instr_movs_pc__ge,
+	arm_instr_movs_pc__lt,
+	arm_instr_movs_pc__gt,
+	arm_instr_movs_pc__le,
+	arm_instr_movs_pc,
+	arm_instr_nop,
+	arm_instr_bics_pc__eq,
+	arm_instr_bics_pc__ne,
+	arm_instr_bics_pc__cs,
+	arm_instr_bics_pc__cc,
+	arm_instr_bics_pc__mi,
+	arm_instr_bics_pc__pl,
+	arm_instr_bics_pc__vs,
+	arm_instr_bics_pc__vc,
+	arm_instr_bics_pc__hi,
+	arm_instr_bics_pc__ls,
+	arm_instr_bics_pc__ge,
+	arm_instr_bics_pc__lt,
+	arm_instr_bics_pc__gt,
+	arm_instr_bics_pc__le,
+	arm_instr_bics_pc,
+	arm_instr_nop,
+	arm_instr_mvns_pc__eq,
+	arm_instr_mvns_pc__ne,
+	arm_instr_mvns_pc__cs,
+	arm_instr_mvns_pc__cc,
+	arm_instr_mvns_pc__mi,
+	arm_instr_mvns_pc__pl,
+	arm_instr_mvns_pc__vs,
+	arm_instr_mvns_pc__vc,
+	arm_instr_mvns_pc__hi,
+	arm_instr_mvns_pc__ls,
+	arm_instr_mvns_pc__ge,
+	arm_instr_mvns_pc__lt,
+	arm_instr_mvns_pc__gt,
+	arm_instr_mvns_pc__le,
+	arm_instr_mvns_pc,
+	arm_instr_nop,
+	arm_instr_and_reg__eq,
+	arm_instr_and_reg__ne,
+	arm_instr_and_reg__cs,
+	arm_instr_and_reg__cc,
+	arm_instr_and_reg__mi,
+	arm_instr_and_reg__pl,
+	arm_instr_and_reg__vs,
+	arm_instr_and_reg__vc,
+	arm_instr_and_reg__hi,
+	arm_instr_and_reg__ls,
+	arm_instr_and_reg__ge,
+	arm_instr_and_reg__lt,
+	arm_instr_and_reg__gt,
+	arm_instr_and_reg__le,
+	arm_instr_and_reg,
+	arm_instr_nop,
+	arm_instr_eor_reg__eq,
+	arm_instr_eor_reg__ne,
+	arm_instr_eor_reg__cs,
+	arm_instr_eor_reg__cc,
+	arm_instr_eor_reg__mi,
+	arm_instr_eor_reg__pl,
+	arm_instr_eor_reg__vs,
+	arm_instr_eor_reg__vc,
+	arm_instr_eor_reg__hi,
+	arm_instr_eor_reg__ls,
+	arm_instr_eor_reg__ge,
+	arm_instr_eor_reg__lt,
+	arm_instr_eor_reg__gt,
+	arm_instr_eor_reg__le,
+	arm_instr_eor_reg,
+	arm_instr_nop,
+	arm_instr_sub_reg__eq,
+	arm_instr_sub_reg__ne,
+	arm_instr_sub_reg__cs,
+	arm_instr_sub_reg__cc,
+	arm_instr_sub_reg__mi,
+	arm_instr_sub_reg__pl,
+	arm_instr_sub_reg__vs,
+	arm_instr_sub_reg__vc,
+	arm_instr_sub_reg__hi,
+	arm_instr_sub_reg__ls,
+	arm_instr_sub_reg__ge,
+	arm_instr_sub_reg__lt,
+	arm_instr_sub_reg__gt,
+	arm_instr_sub_reg__le,
+	arm_instr_sub_reg,
+	arm_instr_nop,
+	arm_instr_rsb_reg__eq,
+	arm_instr_rsb_reg__ne,
+	arm_instr_rsb_reg__cs,
+	arm_instr_rsb_reg__cc,
+	arm_instr_rsb_reg__mi,
+	arm_instr_rsb_reg__pl,
+	arm_instr_rsb_reg__vs,
+	arm_instr_rsb_reg__vc,
+	arm_instr_rsb_reg__hi,
+	arm_instr_rsb_reg__ls,
+	arm_instr_rsb_reg__ge,
+	arm_instr_rsb_reg__lt,
+	arm_instr_rsb_reg__gt,
+	arm_instr_rsb_reg__le,
+	arm_instr_rsb_reg,
+	arm_instr_nop,
+	arm_instr_add_reg__eq,
+	arm_instr_add_reg__ne,
+	arm_instr_add_reg__cs,
+	arm_instr_add_reg__cc,
+	arm_instr_add_reg__mi,
+	arm_instr_add_reg__pl,
+	arm_instr_add_reg__vs,
+	arm_instr_add_reg__vc,
+	arm_instr_add_reg__hi,
+	arm_instr_add_reg__ls,
+	arm_instr_add_reg__ge,
+	arm_instr_add_reg__lt,
+	arm_instr_add_reg__gt,
+	arm_instr_add_reg__le,
+	arm_instr_add_reg,
+	arm_instr_nop,
+	arm_instr_adc_reg__eq,
+	arm_instr_adc_reg__ne,
+	arm_instr_adc_reg__cs,
+	arm_instr_adc_reg__cc,
+	arm_instr_adc_reg__mi,
+	arm_instr_adc_reg__pl,
+	arm_instr_adc_reg__vs,
+	arm_instr_adc_reg__vc,
+	arm_instr_adc_reg__hi,
+	arm_instr_adc_reg__ls,
+	arm_instr_adc_reg__ge,
+	arm_instr_adc_reg__lt,
+	arm_instr_adc_reg__gt,
+	arm_instr_adc_reg__le,
+	arm_instr_adc_reg,
+	arm_instr_nop,
+	arm_instr_sbc_reg__eq,
+	arm_instr_sbc_reg__ne,
+	arm_instr_sbc_reg__cs,
+	arm_instr_sbc_reg__cc,
+	arm_instr_sbc_reg__mi,
+	arm_instr_sbc_reg__pl,
+	arm_instr_sbc_reg__vs,
+	arm_instr_sbc_reg__vc,
+	arm_instr_sbc_reg__hi,
+	arm_instr_sbc_reg__ls,
+	arm_instr_sbc_reg__ge,
+	arm_instr_sbc_reg__lt,
+	arm_instr_sbc_reg__gt,
+	arm_instr_sbc_reg__le,
+	arm_instr_sbc_reg,
+	arm_instr_nop,
+	arm_instr_rsc_reg__eq,
+	arm_instr_rsc_reg__ne,
+	arm_instr_rsc_reg__cs,
+	arm_instr_rsc_reg__cc,
+	arm_instr_rsc_reg__mi,
+	arm_instr_rsc_reg__pl,
+	arm_instr_rsc_reg__vs,
+	arm_instr_rsc_reg__vc,
+	arm_instr_rsc_reg__hi,
+	arm_instr_rsc_reg__ls,
+	arm_instr_rsc_reg__ge,
+	arm_instr_rsc_reg__lt,
+	arm_instr_rsc_reg__gt,
+	arm_instr_rsc_reg__le,
+	arm_instr_rsc_reg,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_orr_reg__eq,
+	arm_instr_orr_reg__ne,
+	arm_instr_orr_reg__cs,
+	arm_instr_orr_reg__cc,
+	arm_instr_orr_reg__mi,
+	arm_instr_orr_reg__pl,
+	arm_instr_orr_reg__vs,
+	arm_instr_orr_reg__vc,
+	arm_instr_orr_reg__hi,
+	arm_instr_orr_reg__ls,
+	arm_instr_orr_reg__ge,
+	arm_instr_orr_reg__lt,
+	arm_instr_orr_reg__gt,
+	arm_instr_orr_reg__le,
+	arm_instr_orr_reg,
+	arm_instr_nop,
+	arm_instr_mov_reg__eq,
+	arm_instr_mov_reg__ne,
+	arm_instr_mov_reg__cs,
+	arm_instr_mov_reg__cc,
+	arm_instr_mov_reg__mi,
+	arm_instr_mov_reg__pl,
+	arm_instr_mov_reg__vs,
+	arm_instr_mov_reg__vc,
+	arm_instr_mov_reg__hi,
+	arm_instr_mov_reg__ls,
+	arm_instr_mov_reg__ge,
+	arm_instr_mov_reg__lt,
+	arm_instr_mov_reg__gt,
+	arm_instr_mov_reg__le,
+	arm_instr_mov_reg,
+	arm_instr_nop,
+	arm_instr_bic_reg__eq,
+	arm_instr_bic_reg__ne,
+	arm_instr_bic_reg__cs,
+	arm_instr_bic_reg__cc,
+	arm_instr_bic_reg__mi,
+	arm_instr_bic_reg__pl,
+	arm_instr_bic_reg__vs,
+	arm_instr_bic_reg__vc,
+	arm_instr_bic_reg__hi,
+	arm_instr_bic_reg__ls,
+	arm_instr_bic_reg__ge,
+	arm_instr_bic_reg__lt,
+	arm_instr_bic_reg__gt,
+	arm_instr_bic_reg__le,
+	arm_instr_bic_reg,
+	arm_instr_nop,
+	arm_instr_mvn_reg__eq,
+	arm_instr_mvn_reg__ne,
+	arm_instr_mvn_reg__cs,
+	arm_instr_mvn_reg__cc,
+	arm_instr_mvn_reg__mi,
+	arm_instr_mvn_reg__pl,
+	arm_instr_mvn_reg__vs,
+	arm_instr_mvn_reg__vc,
+	arm_instr_mvn_reg__hi,
+	arm_instr_mvn_reg__ls,
+	arm_instr_mvn_reg__ge,
+	arm_instr_mvn_reg__lt,
+	arm_instr_mvn_reg__gt,
+	arm_instr_mvn_reg__le,
+	arm_instr_mvn_reg,
+	arm_instr_nop,
+	arm_instr_ands_reg__eq,
+	arm_instr_ands_reg__ne,
+	arm_instr_ands_reg__cs,
+	arm_instr_ands_reg__cc,
+	arm_instr_ands_reg__mi,
+	arm_instr_ands_reg__pl,
+	arm_instr_ands_reg__vs,
+	arm_instr_ands_reg__vc,
+	arm_instr_ands_reg__hi,
+	arm_instr_ands_reg__ls,
+	arm_instr_ands_reg__ge,
+	arm_instr_ands_reg__lt,
+	arm_instr_ands_reg__gt,
+	arm_instr_ands_reg__le,
+	arm_instr_ands_reg,
+	arm_instr_nop,
+	arm_instr_eors_reg__eq,
+	arm_instr_eors_reg__ne,
+	arm_instr_eors_reg__cs,
+	arm_instr_eors_reg__cc,
+	arm_instr_eors_reg__mi,
+	arm_instr_eors_reg__pl,
+	arm_instr_eors_reg__vs,
+	arm_instr_eors_reg__vc,
+	arm_instr_eors_reg__hi,
+	arm_instr_eors_reg__ls,
+	arm_instr_eors_reg__ge,
+	arm_instr_eors_reg__lt,
+	arm_instr_eors_reg__gt,
+	arm_instr_eors_reg__le,
+	arm_instr_eors_reg,
+	arm_instr_nop,
+	arm_instr_subs_reg__eq,
+	arm_instr_subs_reg__ne,
+	arm_instr_subs_reg__cs,
+	arm_instr_subs_reg__cc,
+	arm_instr_subs_reg__mi,
+	arm_instr_subs_reg__pl,
+	arm_instr_subs_reg__vs,
+	arm_instr_subs_reg__vc,
+	arm_instr_subs_reg__hi,
+	arm_instr_subs_reg__ls,
+	arm_instr_subs_reg__ge,
+	arm_instr_subs_reg__lt,
+	arm_instr_subs_reg__gt,
+	arm_instr_subs_reg__le,
+	arm_instr_subs_reg,
+	arm_instr_nop,
+	arm_instr_rsbs_reg__eq,
+	arm_instr_rsbs_reg__ne,
+	arm_instr_rsbs_reg__cs,
+	arm_instr_rsbs_reg__cc,
+	arm_instr_rsbs_reg__mi,
+	arm_instr_rsbs_reg__pl,
+	arm_instr_rsbs_reg__vs,
+	arm_instr_rsbs_reg__vc,
+	arm_instr_rsbs_reg__hi,
+	arm_instr_rsbs_reg__ls,
+	arm_instr_rsbs_reg__ge,
+	arm_instr_rsbs_reg__lt,
+	arm_instr_rsbs_reg__gt,
+	arm_instr_rsbs_reg__le,
+	arm_instr_rsbs_reg,
+	arm_instr_nop,
+	arm_instr_adds_reg__eq,
+	arm_instr_adds_reg__ne,
+	arm_instr_adds_reg__cs,
+	arm_instr_adds_reg__cc,
+	arm_instr_adds_reg__mi,
+	arm_instr_adds_reg__pl,
+	arm_instr_adds_reg__vs,
+	arm_instr_adds_reg__vc,
+	arm_instr_adds_reg__hi,
+	arm_instr_adds_reg__ls,
+	arm_instr_adds_reg__ge,
+	arm_instr_adds_reg__lt,
+	arm_instr_adds_reg__gt,
+	arm_instr_adds_reg__le,
+	arm_instr_adds_reg,
+	arm_instr_nop,
+	arm_instr_adcs_reg__eq,
+	arm_instr_adcs_reg__ne,
+	arm_instr_adcs_reg__cs,
+	arm_instr_adcs_reg__cc,
+	arm_instr_adcs_reg__mi,
+	arm_instr_adcs_reg__pl,
+	arm_instr_adcs_reg__vs,
+	arm_instr_adcs_reg__vc,
+	arm_instr_adcs_reg__hi,
+	arm_instr_adcs_reg__ls,
+	arm_instr_adcs_reg__ge,
+	arm_instr_adcs_reg__lt,
+	arm_instr_adcs_reg__gt,
+	arm_instr_adcs_reg__le,
+	arm_instr_adcs_reg,
+	arm_instr_nop,
+	arm_instr_sbcs_reg__eq,
+	arm_instr_sbcs_reg__ne,
+	arm_instr_sbcs_reg__cs,
+	arm_instr_sbcs_reg__cc,
+	arm_instr_sbcs_reg__mi,
+	arm_instr_sbcs_reg__pl,
+	arm_instr_sbcs_reg__vs,
+	arm_instr_sbcs_reg__vc,
+	arm_instr_sbcs_reg__hi,
+	arm_instr_sbcs_reg__ls,
+	arm_instr_sbcs_reg__ge,
+	arm_instr_sbcs_reg__lt,
+	arm_instr_sbcs_reg__gt,
+	arm_instr_sbcs_reg__le,
+	arm_instr_sbcs_reg,
+	arm_instr_nop,
+	arm_instr_rscs_reg__eq,
+	arm_instr_rscs_reg__ne,
+	arm_instr_rscs_reg__cs,
+	arm_instr_rscs_reg__cc,
+	arm_instr_rscs_reg__mi,
+	arm_instr_rscs_reg__pl,
+	arm_instr_rscs_reg__vs,
+	arm_instr_rscs_reg__vc,
+	arm_instr_rscs_reg__hi,
+	arm_instr_rscs_reg__ls,
+	arm_instr_rscs_reg__ge,
+	arm_instr_rscs_reg__lt,
+	arm_instr_rscs_reg__gt,
+	arm_instr_rscs_reg__le,
+	arm_instr_rscs_reg,
+	arm_instr_nop,
+	arm_instr_tsts_reg__eq,
+	arm_instr_tsts_reg__ne,
+	arm_instr_tsts_reg__cs,
+	arm_instr_tsts_reg__cc,
+	arm_instr_tsts_reg__mi,
+	arm_instr_tsts_reg__pl,
+	arm_instr_tsts_reg__vs,
+	arm_instr_tsts_reg__vc,
+	arm_instr_tsts_reg__hi,
+	arm_instr_tsts_reg__ls,
+	arm_instr_tsts_reg__ge,
+	arm_instr_tsts_reg__lt,
+	arm_instr_tsts_reg__gt,
+	arm_instr_tsts_reg__le,
+	arm_instr_tsts_reg,
+	arm_instr_nop,
+	arm_instr_teqs_reg__eq,
+	arm_instr_teqs_reg__ne,
+	arm_instr_teqs_reg__cs,
+	arm_instr_teqs_reg__cc,
+	arm_instr_teqs_reg__mi,
+	arm_instr_teqs_reg__pl,
+	arm_instr_teqs_reg__vs,
+	arm_instr_teqs_reg__vc,
+	arm_instr_teqs_reg__hi,
+	arm_instr_teqs_reg__ls,
+	arm_instr_teqs_reg__ge,
+	arm_instr_teqs_reg__lt,
+	arm_instr_teqs_reg__gt,
+	arm_instr_teqs_reg__le,
+	arm_instr_teqs_reg,
+	arm_instr_nop,
+	arm_instr_cmps_reg__eq,
+	arm_instr_cmps_reg__ne,
+	arm_instr_cmps_reg__cs,
+	arm_instr_cmps_reg__cc,
+	arm_instr_cmps_reg__mi,
+	arm_instr_cmps_reg__pl,
+	arm_instr_cmps_reg__vs,
+	arm_instr_cmps_reg__vc,
+	arm_instr_cmps_reg__hi,
+	arm_instr_cmps_reg__ls,
+	arm_instr_cmps_reg__ge,
+	arm_instr_cmps_reg__lt,
+	arm_instr_cmps_reg__gt,
+	arm_instr_cmps_reg__le,
+	arm_instr_cmps_reg,
+	arm_instr_nop,
+	arm_instr_cmns_reg__eq,
+	arm_instr_cmns_reg__ne,
+	arm_instr_cmns_reg__cs,
+	arm_instr_cmns_reg__cc,
+	arm_instr_cmns_reg__mi,
+	arm_instr_cmns_reg__pl,
+	arm_instr_cmns_reg__vs,
+	arm_instr_cmns_reg__vc,
+	arm_instr_cmns_reg__hi,
+	arm_instr_cmns_reg__ls,
+	arm_instr_cmns_reg__ge,
+	arm_instr_cmns_reg__lt,
+	arm_instr_cmns_reg__gt,
+	arm_instr_cmns_reg__le,
+	arm_instr_cmns_reg,
+	arm_instr_nop,
+	arm_instr_orrs_reg__eq,
+	arm_instr_orrs_reg__ne,
+	arm_instr_orrs_reg__cs,
+	arm_instr_orrs_reg__cc,
+	arm_instr_orrs_reg__mi,
+	arm_instr_orrs_reg__pl,
+	arm_instr_orrs_reg__vs,
+	arm_instr_orrs_reg__vc,
+	arm_instr_orrs_reg__hi,
+	arm_instr_orrs_reg__ls,
+	arm_instr_orrs_reg__ge,
+	arm_instr_orrs_reg__lt,
+	arm_instr_orrs_reg__gt,
+	arm_instr_orrs_reg__le,
+	arm_instr_orrs_reg,
+	arm_instr_nop,
+	arm_instr_movs_reg__eq,
+	arm_instr_movs_reg__ne,
+	arm_instr_movs_reg__cs,
+	arm_instr_movs_reg__cc,
+	arm_instr_movs_reg__mi,
+	arm_instr_movs_reg__pl,
+	arm_instr_movs_reg__vs,
+	arm_instr_movs_reg__vc,
+	arm_instr_movs_reg__hi,
+	arm_instr_movs_reg__ls,
+	arm_instr_movs_reg__ge,
+	arm_instr_movs_reg__lt,
+	arm_instr_movs_reg__gt,
+	arm_instr_movs_reg__le,
+	arm_instr_movs_reg,
+	arm_instr_nop,
+	arm_instr_bics_reg__eq,
+	arm_instr_bics_reg__ne,
+	arm_instr_bics_reg__cs,
+	arm_instr_bics_reg__cc,
+	arm_instr_bics_reg__mi,
+	arm_instr_bics_reg__pl,
+	arm_instr_bics_reg__vs,
+	arm_instr_bics_reg__vc,
+	arm_instr_bics_reg__hi,
+	arm_instr_bics_reg__ls,
+	arm_instr_bics_reg__ge,
+	arm_instr_bics_reg__lt,
+	arm_instr_bics_reg__gt,
+	arm_instr_bics_reg__le,
+	arm_instr_bics_reg,
+	arm_instr_nop,
+	arm_instr_mvns_reg__eq,
+	arm_instr_mvns_reg__ne,
+	arm_instr_mvns_reg__cs,
+	arm_instr_mvns_reg__cc,
+	arm_instr_mvns_reg__mi,
+	arm_instr_mvns_reg__pl,
+	arm_instr_mvns_reg__vs,
+	arm_instr_mvns_reg__vc,
+	arm_instr_mvns_reg__hi,
+	arm_instr_mvns_reg__ls,
+	arm_instr_mvns_reg__ge,
+	arm_instr_mvns_reg__lt,
+	arm_instr_mvns_reg__gt,
+	arm_instr_mvns_reg__le,
+	arm_instr_mvns_reg,
+	arm_instr_nop,
+	arm_instr_and_pc_reg__eq,
+	arm_instr_and_pc_reg__ne,
+	arm_instr_and_pc_reg__cs,
+	arm_instr_and_pc_reg__cc,
+	arm_instr_and_pc_reg__mi,
+	arm_instr_and_pc_reg__pl,
+	arm_instr_and_pc_reg__vs,
+	arm_instr_and_pc_reg__vc,
+	arm_instr_and_pc_reg__hi,
+	arm_instr_and_pc_reg__ls,
+	arm_instr_and_pc_reg__ge,
+	arm_instr_and_pc_reg__lt,
+	arm_instr_and_pc_reg__gt,
+	arm_instr_and_pc_reg__le,
+	arm_instr_and_pc_reg,
+	arm_instr_nop,
+	arm_instr_eor_pc_reg__eq,
+	arm_instr_eor_pc_reg__ne,
+	arm_instr_eor_pc_reg__cs,
+	arm_instr_eor_pc_reg__cc,
+	arm_instr_eor_pc_reg__mi,
+	arm_instr_eor_pc_reg__pl,
+	arm_instr_eor_pc_reg__vs,
+	arm_instr_eor_pc_reg__vc,
+	arm_instr_eor_pc_reg__hi,
+	arm_instr_eor_pc_reg__ls,
+	arm_instr_eor_pc_reg__ge,
+	arm_instr_eor_pc_reg__lt,
+	arm_instr_eor_pc_reg__gt,
+	arm_instr_eor_pc_reg__le,
+	arm_instr_eor_pc_reg,
+	arm_instr_nop,
+	arm_instr_sub_pc_reg__eq,
+	arm_instr_sub_pc_reg__ne,
+	arm_instr_sub_pc_reg__cs,
+	arm_instr_sub_pc_reg__cc,
+	arm_instr_sub_pc_reg__mi,
+	arm_instr_sub_pc_reg__pl,
+	arm_instr_sub_pc_reg__vs,
+	arm_instr_sub_pc_reg__vc,
+	arm_instr_sub_pc_reg__hi,
+	arm_instr_sub_pc_reg__ls,
+	arm_instr_sub_pc_reg__ge,
+	arm_instr_sub_pc_reg__lt,
+	arm_instr_sub_pc_reg__gt,
+	arm_instr_sub_pc_reg__le,
+	arm_instr_sub_pc_reg,
+	arm_instr_nop,
+	arm_instr_rsb_pc_reg__eq,
+	arm_instr_rsb_pc_reg__ne,
+	arm_instr_rsb_pc_reg__cs,
+	arm_instr_rsb_pc_reg__cc,
+	arm_instr_rsb_pc_reg__mi,
+	arm_instr_rsb_pc_reg__pl,
+	arm_instr_rsb_pc_reg__vs,
+	arm_instr_rsb_pc_reg__vc,
+	arm_instr_rsb_pc_reg__hi,
+	arm_instr_rsb_pc_reg__ls,
+	arm_instr_rsb_pc_reg__ge,
+	arm_instr_rsb_pc_reg__lt,
+	arm_instr_rsb_pc_reg__gt,
+	arm_instr_rsb_pc_reg__le,
+	arm_instr_rsb_pc_reg,
+	arm_instr_nop,
+	arm_instr_add_pc_reg__eq,
+	arm_instr_add_pc_reg__ne,
+	arm_instr_add_pc_reg__cs,
+	arm_instr_add_pc_reg__cc,
+	arm_instr_add_pc_reg__mi,
+	arm_instr_add_pc_reg__pl,
+	arm_instr_add_pc_reg__vs,
+	arm_instr_add_pc_reg__vc,
+	arm_instr_add_pc_reg__hi,
+	arm_instr_add_pc_reg__ls,
+	arm_instr_add_pc_reg__ge,
+	arm_instr_add_pc_reg__lt,
+	arm_instr_add_pc_reg__gt,
+	arm_instr_add_pc_reg__le,
+	arm_instr_add_pc_reg,
+	arm_instr_nop,
+	arm_instr_adc_pc_reg__eq,
+	arm_instr_adc_pc_reg__ne,
+	arm_instr_adc_pc_reg__cs,
+	arm_instr_adc_pc_reg__cc,
+	arm_instr_adc_pc_reg__mi,
+	arm_instr_adc_pc_reg__pl,
+	arm_instr_adc_pc_reg__vs,
+	arm_instr_adc_pc_reg__vc,
+	arm_instr_adc_pc_reg__hi,
+	arm_instr_adc_pc_reg__ls,
+	arm_instr_adc_pc_reg__ge,
+	arm_instr_adc_pc_reg__lt,
+	arm_instr_adc_pc_reg__gt,
+	arm_instr_adc_pc_reg__le,
+	arm_instr_adc_pc_reg,
+	arm_instr_nop,
+	arm_instr_sbc_pc_reg__eq,
+	arm_instr_sbc_pc_reg__ne,
+	arm_instr_sbc_pc_reg__cs,
+	arm_instr_sbc_pc_reg__cc,
+	arm_instr_sbc_pc_reg__mi,
+	arm_instr_sbc_pc_reg__pl,
+	arm_instr_sbc_pc_reg__vs,
+	arm_instr_sbc_pc_reg__vc,
+	arm_instr_sbc_pc_reg__hi,
+	arm_instr_sbc_pc_reg__ls,
+	arm_instr_sbc_pc_reg__ge,
+	arm_instr_sbc_pc_reg__lt,
+	arm_instr_sbc_pc_reg__gt,
+	arm_instr_sbc_pc_reg__le,
+	arm_instr_sbc_pc_reg,
+	arm_instr_nop,
+	arm_instr_rsc_pc_reg__eq,
+	arm_instr_rsc_pc_reg__ne,
+	arm_instr_rsc_pc_reg__cs,
+	arm_instr_rsc_pc_reg__cc,
+	arm_instr_rsc_pc_reg__mi,
+	arm_instr_rsc_pc_reg__pl,
+	arm_instr_rsc_pc_reg__vs,
+	arm_instr_rsc_pc_reg__vc,
+	arm_instr_rsc_pc_reg__hi,
+	arm_instr_rsc_pc_reg__ls,
+	arm_instr_rsc_pc_reg__ge,
+	arm_instr_rsc_pc_reg__lt,
+	arm_instr_rsc_pc_reg__gt,
+	arm_instr_rsc_pc_reg__le,
+	arm_instr_rsc_pc_reg,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_orr_pc_reg__eq,
+	arm_instr_orr_pc_reg__ne,
+	arm_instr_orr_pc_reg__cs,
+	arm_instr_orr_pc_reg__cc,
+	arm_instr_orr_pc_reg__mi,
+	arm_instr_orr_pc_reg__pl,
+	arm_instr_orr_pc_reg__vs,
+	arm_instr_orr_pc_reg__vc,
+	arm_instr_orr_pc_reg__hi,
+	arm_instr_orr_pc_reg__ls,
+	arm_instr_orr_pc_reg__ge,
+	arm_instr_orr_pc_reg__lt,
+	arm_instr_orr_pc_reg__gt,
+	arm_instr_orr_pc_reg__le,
+	arm_instr_orr_pc_reg,
+	arm_instr_nop,
+	arm_instr_mov_pc_reg__eq,
+	arm_instr_mov_pc_reg__ne,
+	arm_instr_mov_pc_reg__cs,
+	arm_instr_mov_pc_reg__cc,
+	arm_instr_mov_pc_reg__mi,
+	arm_instr_mov_pc_reg__pl,
+	arm_instr_mov_pc_reg__vs,
+	arm_instr_mov_pc_reg__vc,
+	arm_instr_mov_pc_reg__hi,
+	arm_instr_mov_pc_reg__ls,
+	arm_instr_mov_pc_reg__ge,
+	arm_instr_mov_pc_reg__lt,
+	arm_instr_mov_pc_reg__gt,
+	arm_instr_mov_pc_reg__le,
+	arm_instr_mov_pc_reg,
+	arm_instr_nop,
+	arm_instr_bic_pc_reg__eq,
+	arm_instr_bic_pc_reg__ne,
+	arm_instr_bic_pc_reg__cs,
+	arm_instr_bic_pc_reg__cc,
+	arm_instr_bic_pc_reg__mi,
+	arm_instr_bic_pc_reg__pl,
+	arm_instr_bic_pc_reg__vs,
+	arm_instr_bic_pc_reg__vc,
+	arm_instr_bic_pc_reg__hi,
+	arm_instr_bic_pc_reg__ls,
+	arm_instr_bic_pc_reg__ge,
+	arm_instr_bic_pc_reg__lt,
+	arm_instr_bic_pc_reg__gt,
+	arm_instr_bic_pc_reg__le,
+	arm_instr_bic_pc_reg,
+	arm_instr_nop,
+	arm_instr_mvn_pc_reg__eq,
+	arm_instr_mvn_pc_reg__ne,
+	arm_instr_mvn_pc_reg__cs,
+	arm_instr_mvn_pc_reg__cc,
+	arm_instr_mvn_pc_reg__mi,
+	arm_instr_mvn_pc_reg__pl,
+	arm_instr_mvn_pc_reg__vs,
+	arm_instr_mvn_pc_reg__vc,
+	arm_instr_mvn_pc_reg__hi,
+	arm_instr_mvn_pc_reg__ls,
+	arm_instr_mvn_pc_reg__ge,
+	arm_instr_mvn_pc_reg__lt,
+	arm_instr_mvn_pc_reg__gt,
+	arm_instr_mvn_pc_reg__le,
+	arm_instr_mvn_pc_reg,
+	arm_instr_nop,
+	arm_instr_ands_pc_reg__eq,
+	arm_instr_ands_pc_reg__ne,
+	arm_instr_ands_pc_reg__cs,
+	arm_instr_ands_pc_reg__cc,
+	arm_instr_ands_pc_reg__mi,
+	arm_instr_ands_pc_reg__pl,
+	arm_instr_ands_pc_reg__vs,
+	arm_instr_ands_pc_reg__vc,
+	arm_instr_ands_pc_reg__hi,
+	arm_instr_ands_pc_reg__ls,
+	arm_instr_ands_pc_reg__ge,
+	arm_instr_ands_pc_reg__lt,
+	arm_instr_ands_pc_reg__gt,
+	arm_instr_ands_pc_reg__le,
+	arm_instr_ands_pc_reg,
+	arm_instr_nop,
+	arm_instr_eors_pc_reg__eq,
+	arm_instr_eors_pc_reg__ne,
+	arm_instr_eors_pc_reg__cs,
+	arm_instr_eors_pc_reg__cc,
+	arm_instr_eors_pc_reg__mi,
+	arm_instr_eors_pc_reg__pl,
+	arm_instr_eors_pc_reg__vs,
+	arm_instr_eors_pc_reg__vc,
+	arm_instr_eors_pc_reg__hi,
+	arm_instr_eors_pc_reg__ls,
+	arm_instr_eors_pc_reg__ge,
+	arm_instr_eors_pc_reg__lt,
+	arm_instr_eors_pc_reg__gt,
+	arm_instr_eors_pc_reg__le,
+	arm_instr_eors_pc_reg,
+	arm_instr_nop,
+	arm_instr_subs_pc_reg__eq,
+	arm_instr_subs_pc_reg__ne,
+	arm_instr_subs_pc_reg__cs,
+	arm_instr_subs_pc_reg__cc,
+	arm_instr_subs_pc_reg__mi,
+	arm_instr_subs_pc_reg__pl,
+	arm_instr_subs_pc_reg__vs,
+	arm_instr_subs_pc_reg__vc,
+	arm_instr_subs_pc_reg__hi,
+	arm_instr_subs_pc_reg__ls,
+	arm_instr_subs_pc_reg__ge,
+	arm_instr_subs_pc_reg__lt,
+	arm_instr_subs_pc_reg__gt,
+	arm_instr_subs_pc_reg__le,
+	arm_instr_subs_pc_reg,
+	arm_instr_nop,
+	arm_instr_rsbs_pc_reg__eq,
+	arm_instr_rsbs_pc_reg__ne,
+	arm_instr_rsbs_pc_reg__cs,
+	arm_instr_rsbs_pc_reg__cc,
+	arm_instr_rsbs_pc_reg__mi,
+	arm_instr_rsbs_pc_reg__pl,
+	arm_instr_rsbs_pc_reg__vs,
+	arm_instr_rsbs_pc_reg__vc,
+	arm_instr_rsbs_pc_reg__hi,
+	arm_instr_rsbs_pc_reg__ls,
+	arm_instr_rsbs_pc_reg__ge,
+	arm_instr_rsbs_pc_reg__lt,
+	arm_instr_rsbs_pc_reg__gt,
+	arm_instr_rsbs_pc_reg__le,
+	arm_instr_rsbs_pc_reg,
+	arm_instr_nop,
+	arm_instr_adds_pc_reg__eq,
+	arm_instr_adds_pc_reg__ne,
+	arm_instr_adds_pc_reg__cs,
+	arm_instr_adds_pc_reg__cc,
+	arm_instr_adds_pc_reg__mi,
+	arm_instr_adds_pc_reg__pl,
+	arm_instr_adds_pc_reg__vs,
+	arm_instr_adds_pc_reg__vc,
+	arm_instr_adds_pc_reg__hi,
+	arm_instr_adds_pc_reg__ls,
+	arm_instr_adds_pc_reg__ge,
+	arm_instr_adds_pc_reg__lt,
+	arm_instr_adds_pc_reg__gt,
+	arm_instr_adds_pc_reg__le,
+	arm_instr_adds_pc_reg,
+	arm_instr_nop,
+	arm_instr_adcs_pc_reg__eq,
+	arm_instr_adcs_pc_reg__ne,
+	arm_instr_adcs_pc_reg__cs,
+	arm_instr_adcs_pc_reg__cc,
+	arm_instr_adcs_pc_reg__mi,
+	arm_instr_adcs_pc_reg__pl,
+	arm_instr_adcs_pc_reg__vs,
+	arm_instr_adcs_pc_reg__vc,
+	arm_instr_adcs_pc_reg__hi,
+	arm_instr_adcs_pc_reg__ls,
+	arm_instr_adcs_pc_reg__ge,
+	arm_instr_adcs_pc_reg__lt,
+	arm_instr_adcs_pc_reg__gt,
+	arm_instr_adcs_pc_reg__le,
+	arm_instr_adcs_pc_reg,
+	arm_instr_nop,
+	arm_instr_sbcs_pc_reg__eq,
+	arm_instr_sbcs_pc_reg__ne,
+	arm_instr_sbcs_pc_reg__cs,
+	arm_instr_sbcs_pc_reg__cc,
+	arm_instr_sbcs_pc_reg__mi,
+	arm_instr_sbcs_pc_reg__pl,
+	arm_instr_sbcs_pc_reg__vs,
+	arm_instr_sbcs_pc_reg__vc,
+	arm_instr_sbcs_pc_reg__hi,
+	arm_instr_sbcs_pc_reg__ls,
+	arm_instr_sbcs_pc_reg__ge,
+	arm_instr_sbcs_pc_reg__lt,
+	arm_instr_sbcs_pc_reg__gt,
+	arm_instr_sbcs_pc_reg__le,
+	arm_instr_sbcs_pc_reg,
+	arm_instr_nop,
+	arm_instr_rscs_pc_reg__eq,
+	arm_instr_rscs_pc_reg__ne,
+	arm_instr_rscs_pc_reg__cs,
+	arm_instr_rscs_pc_reg__cc,
+	arm_instr_rscs_pc_reg__mi,
+	arm_instr_rscs_pc_reg__pl,
+	arm_instr_rscs_pc_reg__vs,
+	arm_instr_rscs_pc_reg__vc,
+	arm_instr_rscs_pc_reg__hi,
+	arm_instr_rscs_pc_reg__ls,
+	arm_instr_rscs_pc_reg__ge,
+	arm_instr_rscs_pc_reg__lt,
+	arm_instr_rscs_pc_reg__gt,
+	arm_instr_rscs_pc_reg__le,
+	arm_instr_rscs_pc_reg,
+	arm_instr_nop,
+	arm_instr_tsts_pc_reg__eq,
+	arm_instr_tsts_pc_reg__ne,
+	arm_instr_tsts_pc_reg__cs,
+	arm_instr_tsts_pc_reg__cc,
+	arm_instr_tsts_pc_reg__mi,
+	arm_instr_tsts_pc_reg__pl,
+	arm_instr_tsts_pc_reg__vs,
+	arm_instr_tsts_pc_reg__vc,
+	arm_instr_tsts_pc_reg__hi,
+	arm_instr_tsts_pc_reg__ls,
+	arm_instr_tsts_pc_reg__ge,
+	arm_instr_tsts_pc_reg__lt,
+	arm_instr_tsts_pc_reg__gt,
+	arm_instr_tsts_pc_reg__le,
+	arm_instr_tsts_pc_reg,
+	arm_instr_nop,
+	arm_instr_teqs_pc_reg__eq,
+	arm_instr_teqs_pc_reg__ne,
+	arm_instr_teqs_pc_reg__cs,
+	arm_instr_teqs_pc_reg__cc,
+	arm_instr_teqs_pc_reg__mi,
+	arm_instr_teqs_pc_reg__pl,
+	arm_instr_teqs_pc_reg__vs,
+	arm_instr_teqs_pc_reg__vc,
+	arm_instr_teqs_pc_reg__hi,
+	arm_instr_teqs_pc_reg__ls,
+	arm_instr_teqs_pc_reg__ge,
+	arm_instr_teqs_pc_reg__lt,
+	arm_instr_teqs_pc_reg__gt,
+	arm_instr_teqs_pc_reg__le,
+	arm_instr_teqs_pc_reg,
+	arm_instr_nop,
+	arm_instr_cmps_pc_reg__eq,
+	arm_instr_cmps_pc_reg__ne,
+	arm_instr_cmps_pc_reg__cs,
+	arm_instr_cmps_pc_reg__cc,
+	arm_instr_cmps_pc_reg__mi,
+	arm_instr_cmps_pc_reg__pl,
+	arm_instr_cmps_pc_reg__vs,
+	arm_instr_cmps_pc_reg__vc,
+	arm_instr_cmps_pc_reg__hi,
+	arm_instr_cmps_pc_reg__ls,
+	arm_instr_cmps_pc_reg__ge,
+	arm_instr_cmps_pc_reg__lt,
+	arm_instr_cmps_pc_reg__gt,
+	arm_instr_cmps_pc_reg__le,
+	arm_instr_cmps_pc_reg,
+	arm_instr_nop,
+	arm_instr_cmns_pc_reg__eq,
+	arm_instr_cmns_pc_reg__ne,
+	arm_instr_cmns_pc_reg__cs,
+	arm_instr_cmns_pc_reg__cc,
+	arm_instr_cmns_pc_reg__mi,
+	arm_instr_cmns_pc_reg__pl,
+	arm_instr_cmns_pc_reg__vs,
+	arm_instr_cmns_pc_reg__vc,
+	arm_instr_cmns_pc_reg__hi,
+	arm_instr_cmns_pc_reg__ls,
+	arm_instr_cmns_pc_reg__ge,
+	arm_instr_cmns_pc_reg__lt,
+	arm_instr_cmns_pc_reg__gt,
+	arm_instr_cmns_pc_reg__le,
+	arm_instr_cmns_pc_reg,
+	arm_instr_nop,
+	arm_instr_orrs_pc_reg__eq,
+	arm_instr_orrs_pc_reg__ne,
+	arm_instr_orrs_pc_reg__cs,
+	arm_instr_orrs_pc_reg__cc,
+	arm_instr_orrs_pc_reg__mi,
+	arm_instr_orrs_pc_reg__pl,
+	arm_instr_orrs_pc_reg__vs,
+	arm_instr_orrs_pc_reg__vc,
+	arm_instr_orrs_pc_reg__hi,
+	arm_instr_orrs_pc_reg__ls,
+	arm_instr_orrs_pc_reg__ge,
+	arm_instr_orrs_pc_reg__lt,
+	arm_instr_orrs_pc_reg__gt,
+	arm_instr_orrs_pc_reg__le,
+	arm_instr_orrs_pc_reg,
+	arm_instr_nop,
+	arm_instr_movs_pc_reg__eq,
+	arm_instr_movs_pc_reg__ne,
+	arm_instr_movs_pc_reg__cs,
+	arm_instr_movs_pc_reg__cc,
+	arm_instr_movs_pc_reg__mi,
+	arm_instr_movs_pc_reg__pl,
+	arm_instr_movs_pc_reg__vs,
+	arm_instr_movs_pc_reg__vc,
+	arm_instr_movs_pc_reg__hi,
+	arm_instr_movs_pc_reg__ls,
+	arm_instr_movs_pc_reg__ge,
+	arm_instr_movs_pc_reg__lt,
+	arm_instr_movs_pc_reg__gt,
+	arm_instr_movs_pc_reg__le,
+	arm_instr_movs_pc_reg,
+	arm_instr_nop,
+	arm_instr_bics_pc_reg__eq,
+	arm_instr_bics_pc_reg__ne,
+	arm_instr_bics_pc_reg__cs,
+	arm_instr_bics_pc_reg__cc,
+	arm_instr_bics_pc_reg__mi,
+	arm_instr_bics_pc_reg__pl,
+	arm_instr_bics_pc_reg__vs,
+	arm_instr_bics_pc_reg__vc,
+	arm_instr_bics_pc_reg__hi,
+	arm_instr_bics_pc_reg__ls,
+	arm_instr_bics_pc_reg__ge,
+	arm_instr_bics_pc_reg__lt,
+	arm_instr_bics_pc_reg__gt,
+	arm_instr_bics_pc_reg__le,
+	arm_instr_bics_pc_reg,
+	arm_instr_nop,
+	arm_instr_mvns_pc_reg__eq,
+	arm_instr_mvns_pc_reg__ne,
+	arm_instr_mvns_pc_reg__cs,
+	arm_instr_mvns_pc_reg__cc,
+	arm_instr_mvns_pc_reg__mi,
+	arm_instr_mvns_pc_reg__pl,
+	arm_instr_mvns_pc_reg__vs,
+	arm_instr_mvns_pc_reg__vc,
+	arm_instr_mvns_pc_reg__hi,
+	arm_instr_mvns_pc_reg__ls,
+	arm_instr_mvns_pc_reg__ge,
+	arm_instr_mvns_pc_reg__lt,
+	arm_instr_mvns_pc_reg__gt,
+	arm_instr_mvns_pc_reg__le,
+	arm_instr_mvns_pc_reg,
+	arm_instr_nop
+};
+
+
+	void (*arm_dpi_instr_regshort[2 * 16 * 16])(struct cpu *,
+		struct arm_instr_call *) = {
+	arm_instr_and_regshort__eq,
+	arm_instr_and_regshort__ne,
+	arm_instr_and_regshort__cs,
+	arm_instr_and_regshort__cc,
+	arm_instr_and_regshort__mi,
+	arm_instr_and_regshort__pl,
+	arm_instr_and_regshort__vs,
+	arm_instr_and_regshort__vc,
+	arm_instr_and_regshort__hi,
+	arm_instr_and_regshort__ls,
+	arm_instr_and_regshort__ge,
+	arm_instr_and_regshort__lt,
+	arm_instr_and_regshort__gt,
+	arm_instr_and_regshort__le,
+	arm_instr_and_regshort,
+	arm_instr_nop,
+	arm_instr_eor_regshort__eq,
+	arm_instr_eor_regshort__ne,
+	arm_instr_eor_regshort__cs,
+	arm_instr_eor_regshort__cc,
+	arm_instr_eor_regshort__mi,
+	arm_instr_eor_regshort__pl,
+	arm_instr_eor_regshort__vs,
+	arm_instr_eor_regshort__vc,
+	arm_instr_eor_regshort__hi,
+	arm_instr_eor_regshort__ls,
+	arm_instr_eor_regshort__ge,
+	arm_instr_eor_regshort__lt,
+	arm_instr_eor_regshort__gt,
+	arm_instr_eor_regshort__le,
+	arm_instr_eor_regshort,
+	arm_instr_nop,
+	arm_instr_sub_regshort__eq,
+	arm_instr_sub_regshort__ne,
+	arm_instr_sub_regshort__cs,
+	arm_instr_sub_regshort__cc,
+	arm_instr_sub_regshort__mi,
+	arm_instr_sub_regshort__pl,
+	arm_instr_sub_regshort__vs,
+	arm_instr_sub_regshort__vc,
+	arm_instr_sub_regshort__hi,
+	arm_instr_sub_regshort__ls,
+	arm_instr_sub_regshort__ge,
+	arm_instr_sub_regshort__lt,
+	arm_instr_sub_regshort__gt,
+	arm_instr_sub_regshort__le,
+	arm_instr_sub_regshort,
+	arm_instr_nop,
+	arm_instr_rsb_regshort__eq,
+	arm_instr_rsb_regshort__ne,
+	arm_instr_rsb_regshort__cs,
+	arm_instr_rsb_regshort__cc,
+	arm_instr_rsb_regshort__mi,
+	arm_instr_rsb_regshort__pl,
+	arm_instr_rsb_regshort__vs,
+	arm_instr_rsb_regshort__vc,
+	arm_instr_rsb_regshort__hi,
+	arm_instr_rsb_regshort__ls,
+	arm_instr_rsb_regshort__ge,
+	arm_instr_rsb_regshort__lt,
+	arm_instr_rsb_regshort__gt,
+	arm_instr_rsb_regshort__le,
+	arm_instr_rsb_regshort,
+	arm_instr_nop,
+	arm_instr_add_regshort__eq,
+	arm_instr_add_regshort__ne,
+	arm_instr_add_regshort__cs,
+	arm_instr_add_regshort__cc,
+	arm_instr_add_regshort__mi,
+	arm_instr_add_regshort__pl,
+	arm_instr_add_regshort__vs,
+	arm_instr_add_regshort__vc,
+	arm_instr_add_regshort__hi,
+	arm_instr_add_regshort__ls,
+	arm_instr_add_regshort__ge,
+	arm_instr_add_regshort__lt,
+	arm_instr_add_regshort__gt,
+	arm_instr_add_regshort__le,
+	arm_instr_add_regshort,
+	arm_instr_nop,
+	arm_instr_adc_regshort__eq,
+	arm_instr_adc_regshort__ne,
+	arm_instr_adc_regshort__cs,
+	arm_instr_adc_regshort__cc,
+	arm_instr_adc_regshort__mi,
+	arm_instr_adc_regshort__pl,
+	arm_instr_adc_regshort__vs,
+	arm_instr_adc_regshort__vc,
+	arm_instr_adc_regshort__hi,
+	arm_instr_adc_regshort__ls,
+	arm_instr_adc_regshort__ge,
+	arm_instr_adc_regshort__lt,
+	arm_instr_adc_regshort__gt,
+	arm_instr_adc_regshort__le,
+	arm_instr_adc_regshort,
+	arm_instr_nop,
+	arm_instr_sbc_regshort__eq,
+	arm_instr_sbc_regshort__ne,
+	arm_instr_sbc_regshort__cs,
+	arm_instr_sbc_regshort__cc,
+	arm_instr_sbc_regshort__mi,
+	arm_instr_sbc_regshort__pl,
+	arm_instr_sbc_regshort__vs,
+	arm_instr_sbc_regshort__vc,
+	arm_instr_sbc_regshort__hi,
+	arm_instr_sbc_regshort__ls,
+	arm_instr_sbc_regshort__ge,
+	arm_instr_sbc_regshort__lt,
+	arm_instr_sbc_regshort__gt,
+	arm_instr_sbc_regshort__le,
+	arm_instr_sbc_regshort,
+	arm_instr_nop,
+	arm_instr_rsc_regshort__eq,
+	arm_instr_rsc_regshort__ne,
+	arm_instr_rsc_regshort__cs,
+	arm_instr_rsc_regshort__cc,
+	arm_instr_rsc_regshort__mi,
+	arm_instr_rsc_regshort__pl,
+	arm_instr_rsc_regshort__vs,
+	arm_instr_rsc_regshort__vc,
+	arm_instr_rsc_regshort__hi,
+	arm_instr_rsc_regshort__ls,
+	arm_instr_rsc_regshort__ge,
+	arm_instr_rsc_regshort__lt,
+	arm_instr_rsc_regshort__gt,
+	arm_instr_rsc_regshort__le,
+	arm_instr_rsc_regshort,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_invalid,
+	arm_instr_nop,
+	arm_instr_orr_regshort__eq,
+	arm_instr_orr_regshort__ne,
+	arm_instr_orr_regshort__cs,
+	arm_instr_orr_regshort__cc,
+	arm_instr_orr_regshort__mi,
+	arm_instr_orr_regshort__pl,
+	arm_instr_orr_regshort__vs,
+	arm_instr_orr_regshort__vc,
+	arm_instr_orr_regshort__hi,
+	arm_instr_orr_regshort__ls,
+	arm_instr_orr_regshort__ge,
+	arm_instr_orr_regshort__lt,
+	arm_instr_orr_regshort__gt,
+	arm_instr_orr_regshort__le,
+	arm_instr_orr_regshort,
+	arm_instr_nop,
+	arm_instr_mov_regshort__eq,
+	arm_instr_mov_regshort__ne,
+	arm_instr_mov_regshort__cs,
+	arm_instr_mov_regshort__cc,
+	arm_instr_mov_regshort__mi,
+	arm_instr_mov_regshort__pl,
+	arm_instr_mov_regshort__vs,
+	arm_instr_mov_regshort__vc,
+	arm_instr_mov_regshort__hi,
+	arm_instr_mov_regshort__ls,
+	arm_instr_mov_regshort__ge,
+	arm_instr_mov_regshort__lt,
+	arm_instr_mov_regshort__gt,
+	arm_instr_mov_regshort__le,
+	arm_instr_mov_regshort,
+	arm_instr_nop,
+	arm_instr_bic_regshort__eq,
+	arm_instr_bic_regshort__ne,
+	arm_instr_bic_regshort__cs,
+	arm_instr_bic_regshort__cc,
+	arm_instr_bic_regshort__mi,
+	arm_instr_bic_regshort__pl,
+	arm_instr_bic_regshort__vs,
+	arm_instr_bic_regshort__vc,
+	arm_instr_bic_regshort__hi,
+	arm_instr_bic_regshort__ls,
+	arm_instr_bic_regshort__ge,
+	arm_instr_bic_regshort__lt,
+	arm_instr_bic_regshort__gt,
+	arm_instr_bic_regshort__le,
+	arm_instr_bic_regshort,
+	arm_instr_nop,
+	arm_instr_mvn_regshort__eq,
+	arm_instr_mvn_regshort__ne,
+	arm_instr_mvn_regshort__cs,
+	arm_instr_mvn_regshort__cc,
+	arm_instr_mvn_regshort__mi,
+	arm_instr_mvn_regshort__pl,
+	arm_instr_mvn_regshort__vs,
+	arm_instr_mvn_regshort__vc,
+	arm_instr_mvn_regshort__hi,
+	arm_instr_mvn_regshort__ls,
+	arm_instr_mvn_regshort__ge,
+	arm_instr_mvn_regshort__lt,
+	arm_instr_mvn_regshort__gt,
+	arm_instr_mvn_regshort__le,
+	arm_instr_mvn_regshort,
+	arm_instr_nop,
+	arm_instr_ands_regshort__eq,
+	arm_instr_ands_regshort__ne,
+	arm_instr_ands_regshort__cs,
+	arm_instr_ands_regshort__cc,
+	arm_instr_ands_regshort__mi,
+	arm_instr_ands_regshort__pl,
+	arm_instr_ands_regshort__vs,
+	arm_instr_ands_regshort__vc,
+	arm_instr_ands_regshort__hi,
+	arm_instr_ands_regshort__ls,
+	arm_instr_ands_regshort__ge,
+	arm_instr_ands_regshort__lt,
+	arm_instr_ands_regshort__gt,
+	arm_instr_ands_regshort__le,
+	arm_instr_ands_regshort,
+	arm_instr_nop,
+	arm_instr_eors_regshort__eq,
+	arm_instr_eors_regshort__ne,
+	arm_instr_eors_regshort__cs,
+	arm_instr_eors_regshort__cc,
+	arm_instr_eors_regshort__mi,
+	arm_instr_eors_regshort__pl,
+	arm_instr_eors_regshort__vs,
+	arm_instr_eors_regshort__vc,
+	arm_instr_eors_regshort__hi,
+	arm_instr_eors_regshort__ls,
+	arm_instr_eors_regshort__ge,
+	arm_instr_eors_regshort__lt,
+	arm_instr_eors_regshort__gt,
+	arm_instr_eors_regshort__le,
+	arm_instr_eors_regshort,
+	arm_instr_nop,
+	arm_instr_subs_regshort__eq,
+	arm_instr_subs_regshort__ne,
+	arm_instr_subs_regshort__cs,
+	arm_instr_subs_regshort__cc,
+	arm_instr_subs_regshort__mi,
+	arm_instr_subs_regshort__pl,
+	arm_instr_subs_regshort__vs,
+	arm_instr_subs_regshort__vc,
+	arm_instr_subs_regshort__hi,
+	arm_instr_subs_regshort__ls,
+	arm_instr_subs_regshort__ge,
+	arm_instr_subs_regshort__lt,
+	arm_instr_subs_regshort__gt,
+	arm_instr_subs_regshort__le,
+	arm_instr_subs_regshort,
+	arm_instr_nop,
+	arm_instr_rsbs_regshort__eq,
+	arm_instr_rsbs_regshort__ne,
+	arm_instr_rsbs_regshort__cs,
+	arm_instr_rsbs_regshort__cc,
+	arm_instr_rsbs_regshort__mi,
+	arm_instr_rsbs_regshort__pl,
+	arm_instr_rsbs_regshort__vs,
+	arm_instr_rsbs_regshort__vc,
+	arm_instr_rsbs_regshort__hi,
+	arm_instr_rsbs_regshort__ls,
+	arm_instr_rsbs_regshort__ge,
+	arm_instr_rsbs_regshort__lt,
+	arm_instr_rsbs_regshort__gt,
+	arm_instr_rsbs_regshort__le,
+	arm_instr_rsbs_regshort,
+	arm_instr_nop,
+	arm_instr_adds_regshort__eq,
+	arm_instr_adds_regshort__ne,
+	arm_instr_adds_regshort__cs,
+	arm_instr_adds_regshort__cc,
+	arm_instr_adds_regshort__mi,
+	arm_instr_adds_regshort__pl,
+	arm_instr_adds_regshort__vs,
+	arm_instr_adds_regshort__vc,
+	arm_instr_adds_regshort__hi,
+	arm_instr_adds_regshort__ls,
+	arm_instr_adds_regshort__ge,
+	arm_instr_adds_regshort__lt,
+	arm_instr_adds_regshort__gt,
+	arm_instr_adds_regshort__le,
+	arm_instr_adds_regshort,
+	arm_instr_nop,
+	arm_instr_adcs_regshort__eq,
+	arm_instr_adcs_regshort__ne,
+	arm_instr_adcs_regshort__cs,
+	arm_instr_adcs_regshort__cc,
+	arm_instr_adcs_regshort__mi,
+	arm_instr_adcs_regshort__pl,
+	arm_instr_adcs_regshort__vs,
+	arm_instr_adcs_regshort__vc,
+	arm_instr_adcs_regshort__hi,
+	arm_instr_adcs_regshort__ls,
+	arm_instr_adcs_regshort__ge,
+	arm_instr_adcs_regshort__lt,
+	arm_instr_adcs_regshort__gt,
+	arm_instr_adcs_regshort__le,
+	arm_instr_adcs_regshort,
+	arm_instr_nop,
+	arm_instr_sbcs_regshort__eq,
+	arm_instr_sbcs_regshort__ne,
+	arm_instr_sbcs_regshort__cs,
+	arm_instr_sbcs_regshort__cc,
+	arm_instr_sbcs_regshort__mi,
+	arm_instr_sbcs_regshort__pl,
+	arm_instr_sbcs_regshort__vs,
+	arm_instr_sbcs_regshort__vc,
+	arm_instr_sbcs_regshort__hi,
+	arm_instr_sbcs_regshort__ls,
+	arm_instr_sbcs_regshort__ge,
+	arm_instr_sbcs_regshort__lt,
+	arm_instr_sbcs_regshort__gt,
+	arm_instr_sbcs_regshort__le,
+	arm_instr_sbcs_regshort,
+	arm_instr_nop,
+	arm_instr_rscs_regshort__eq,
+	arm_instr_rscs_regshort__ne,
+	arm_instr_rscs_regshort__cs,
+	arm_instr_rscs_regshort__cc,
+	arm_instr_rscs_regshort__mi,
+	arm_instr_rscs_regshort__pl,
+	arm_instr_rscs_regshort__vs,
+	arm_instr_rscs_regshort__vc,
+	arm_instr_rscs_regshort__hi,
+	arm_instr_rscs_regshort__ls,
+	arm_instr_rscs_regshort__ge,
+	arm_instr_rscs_regshort__lt,
+	arm_instr_rscs_regshort__gt,
+	arm_instr_rscs_regshort__le,
+	arm_instr_rscs_regshort,
+	arm_instr_nop,
+	arm_instr_tsts_regshort__eq,
+	arm_instr_tsts_regshort__ne,
+	arm_instr_tsts_regshort__cs,
+	arm_instr_tsts_regshort__cc,
+	arm_instr_tsts_regshort__mi,
+	arm_instr_tsts_regshort__pl,
+	arm_instr_tsts_regshort__vs,
+	arm_instr_tsts_regshort__vc,
+	arm_instr_tsts_regshort__hi,
+	arm_instr_tsts_regshort__ls,
+	arm_instr_tsts_regshort__ge,
+	arm_instr_tsts_regshort__lt,
+	arm_instr_tsts_regshort__gt,
+	arm_instr_tsts_regshort__le,
+	arm_instr_tsts_regshort,
+	arm_instr_nop,
+	arm_instr_teqs_regshort__eq,
+	arm_instr_teqs_regshort__ne,
+	arm_instr_teqs_regshort__cs,
+	arm_instr_teqs_regshort__cc,
+	arm_instr_teqs_regshort__mi,
+	arm_instr_teqs_regshort__pl,
+	arm_instr_teqs_regshort__vs,
+	arm_instr_teqs_regshort__vc,
+	arm_instr_teqs_regshort__hi,
+	arm_instr_teqs_regshort__ls,
+	arm_instr_teqs_regshort__ge,
+	arm_instr_teqs_regshort__lt,
+	arm_instr_teqs_regshort__gt,
+	arm_instr_teqs_regshort__le,
+	arm_instr_teqs_regshort,
+	arm_instr_nop,
+	arm_instr_cmps_regshort__eq,
+	arm_instr_cmps_regshort__ne,
+	arm_instr_cmps_regshort__cs,
+	arm_instr_cmps_regshort__cc,
+	arm_instr_cmps_regshort__mi,
+	arm_instr_cmps_regshort__pl,
+	arm_instr_cmps_regshort__vs,
+	arm_instr_cmps_regshort__vc,
+	arm_instr_cmps_regshort__hi,
+	arm_instr_cmps_regshort__ls,
+	arm_instr_cmps_regshort__ge,
+	arm_instr_cmps_regshort__lt,
+	arm_instr_cmps_regshort__gt,
+	arm_instr_cmps_regshort__le,
+	arm_instr_cmps_regshort,
+	arm_instr_nop,
+	arm_instr_cmns_regshort__eq,
+	arm_instr_cmns_regshort__ne,
+	arm_instr_cmns_regshort__cs,
+	arm_instr_cmns_regshort__cc,
+	arm_instr_cmns_regshort__mi,
+	arm_instr_cmns_regshort__pl,
+	arm_instr_cmns_regshort__vs,
+	arm_instr_cmns_regshort__vc,
+	arm_instr_cmns_regshort__hi,
+	arm_instr_cmns_regshort__ls,
+	arm_instr_cmns_regshort__ge,
+	arm_instr_cmns_regshort__lt,
+	arm_instr_cmns_regshort__gt,
+	arm_instr_cmns_regshort__le,
+	arm_instr_cmns_regshort,
+	arm_instr_nop,
+	arm_instr_orrs_regshort__eq,
+	arm_instr_orrs_regshort__ne,
+	arm_instr_orrs_regshort__cs,
+	arm_instr_orrs_regshort__cc,
+	arm_instr_orrs_regshort__mi,
+	arm_instr_orrs_regshort__pl,
+	arm_instr_orrs_regshort__vs,
+	arm_instr_orrs_regshort__vc,
+	arm_instr_orrs_regshort__hi,
+	arm_instr_orrs_regshort__ls,
+	arm_instr_orrs_regshort__ge,
+	arm_instr_orrs_regshort__lt,
+	arm_instr_orrs_regshort__gt,
+	arm_instr_orrs_regshort__le,
+	arm_instr_orrs_regshort,
+	arm_instr_nop,
+	arm_instr_movs_regshort__eq,
+	arm_instr_movs_regshort__ne,
+	arm_instr_movs_regshort__cs,
+	arm_instr_movs_regshort__cc,
+	arm_instr_movs_regshort__mi,
+	arm_instr_movs_regshort__pl,
+	arm_instr_movs_regshort__vs,
+	arm_instr_movs_regshort__vc,
+	arm_instr_movs_regshort__hi,
+	arm_instr_movs_regshort__ls,
+	arm_instr_movs_regshort__ge,
+	arm_instr_movs_regshort__lt,
+	arm_instr_movs_regshort__gt,
+	arm_instr_movs_regshort__le,
+	arm_instr_movs_regshort,
+	arm_instr_nop,
+	arm_instr_bics_regshort__eq,
+	arm_instr_bics_regshort__ne,
+	arm_instr_bics_regshort__cs,
+	arm_instr_bics_regshort__cc,
+	arm_instr_bics_regshort__mi,
+	arm_instr_bics_regshort__pl,
+	arm_instr_bics_regshort__vs,
+	arm_instr_bics_regshort__vc,
+	arm_instr_bics_regshort__hi,
+	arm_instr_bics_regshort__ls,
+	arm_instr_bics_regshort__ge,
+	arm_instr_bics_regshort__lt,
+	arm_instr_bics_regshort__gt,
+	arm_instr_bics_regshort__le,
+	arm_instr_bics_regshort,
+	arm_instr_nop,
+	arm_instr_mvns_regshort__eq,
+	arm_instr_mvns_regshort__ne,
+	arm_instr_mvns_regshort__cs,
+	arm_instr_mvns_regshort__cc,
+	arm_instr_mvns_regshort__mi,
+	arm_instr_mvns_regshort__pl,
+	arm_instr_mvns_regshort__vs,
+	arm_instr_mvns_regshort__vc,
+	arm_instr_mvns_regshort__hi,
+	arm_instr_mvns_regshort__ls,
+	arm_instr_mvns_regshort__ge,
+	arm_instr_mvns_regshort__lt,
+	arm_instr_mvns_regshort__gt,
+	arm_instr_mvns_regshort__le,
+	arm_instr_mvns_regshort,
+	arm_instr_nop
+};
+
@@ -0,0 +1,2029 @@
+
+/*  AUTOMATICALLY GENERATED! Do not edit.  */
+
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_1_le
+#define LS_GENERIC_N m88k_generic_ld_u_1
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_le
+#define LS_GENERIC_N m88k_generic_ld_u_2
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_le
+#define LS_GENERIC_N m88k_generic_ld_u_4
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_le
+#define LS_GENERIC_N m88k_generic_ld_u_8
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_1_le
+#define LS_GENERIC_N m88k_generic_st_1
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_2_le
+#define LS_GENERIC_N m88k_generic_st_2
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_le
+#define LS_GENERIC_N m88k_generic_st_4
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_le
+#define LS_GENERIC_N m88k_generic_st_8
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_1_le
+#define LS_GENERIC_N m88k_generic_ld_1
+#define LS_1
+#define LS_SIZE 1
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_le
+#define LS_GENERIC_N m88k_generic_ld_2
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_le
+#define LS_GENERIC_N m88k_generic_ld_4
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_le
+#define LS_GENERIC_N m88k_generic_ld_8
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_be
+#define LS_GENERIC_N m88k_generic_ld_u_2
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_be
+#define LS_GENERIC_N m88k_generic_ld_u_4
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_be
+#define LS_GENERIC_N m88k_generic_ld_u_8
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_2_be
+#define LS_GENERIC_N m88k_generic_st_2
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_be
+#define LS_GENERIC_N m88k_generic_st_4
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_be
+#define LS_GENERIC_N m88k_generic_st_8
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_be
+#define LS_GENERIC_N m88k_generic_ld_2
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_BE
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_be
+#define LS_GENERIC_N m88k_generic_ld_4
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_BE
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_be
+#define LS_GENERIC_N m88k_generic_ld_8
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_BE
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_1_le_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_1_regofs
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_le_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_2_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_le_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_4_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_le_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_8_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_1_le_regofs
+#define LS_GENERIC_N m88k_generic_st_1_regofs
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_2_le_regofs
+#define LS_GENERIC_N m88k_generic_st_2_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_le_regofs
+#define LS_GENERIC_N m88k_generic_st_4_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_le_regofs
+#define LS_GENERIC_N m88k_generic_st_8_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_1_le_regofs
+#define LS_GENERIC_N m88k_generic_ld_1_regofs
+#define LS_1
+#define LS_SIZE 1
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_le_regofs
+#define LS_GENERIC_N m88k_generic_ld_2_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_le_regofs
+#define LS_GENERIC_N m88k_generic_ld_4_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_le_regofs
+#define LS_GENERIC_N m88k_generic_ld_8_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_be_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_2_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_be_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_4_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_be_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_8_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_2_be_regofs
+#define LS_GENERIC_N m88k_generic_st_2_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_be_regofs
+#define LS_GENERIC_N m88k_generic_st_4_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_be_regofs
+#define LS_GENERIC_N m88k_generic_st_8_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_be_regofs
+#define LS_GENERIC_N m88k_generic_ld_2_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_BE
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_be_regofs
+#define LS_GENERIC_N m88k_generic_ld_4_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_BE
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_be_regofs
+#define LS_GENERIC_N m88k_generic_ld_8_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_BE
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_le_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_2_scaled_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_le_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_4_scaled_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_le_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_8_scaled_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_2_le_scaled_regofs
+#define LS_GENERIC_N m88k_generic_st_2_scaled_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_le_scaled_regofs
+#define LS_GENERIC_N m88k_generic_st_4_scaled_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_le_scaled_regofs
+#define LS_GENERIC_N m88k_generic_st_8_scaled_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_le_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_2_scaled_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_le_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_4_scaled_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_le_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_8_scaled_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_be_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_2_scaled_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_be_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_4_scaled_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_be_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_8_scaled_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_2_be_scaled_regofs
+#define LS_GENERIC_N m88k_generic_st_2_scaled_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_be_scaled_regofs
+#define LS_GENERIC_N m88k_generic_st_4_scaled_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_be_scaled_regofs
+#define LS_GENERIC_N m88k_generic_st_8_scaled_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_be_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_2_scaled_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_BE
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_be_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_4_scaled_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_BE
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_be_scaled_regofs
+#define LS_GENERIC_N m88k_generic_ld_8_scaled_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_BE
+#define LS_SCALED
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_1_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_1_usr_regofs
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_2_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_4_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_8_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_1_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_1_usr_regofs
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_2_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_2_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_4_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_8_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_1_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_1_usr_regofs
+#define LS_1
+#define LS_SIZE 1
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_2_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_4_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_le_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_8_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_be_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_2_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_be_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_4_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_be_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_8_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_2_be_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_2_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_be_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_4_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_be_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_8_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_be_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_2_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_BE
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_be_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_4_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_BE
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_be_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_8_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_BE
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_le_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_2_scaled_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_le_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_4_scaled_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_le_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_8_scaled_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_2_le_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_2_scaled_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_le_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_4_scaled_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_le_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_8_scaled_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_le_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_2_scaled_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_le_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_4_scaled_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_le_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_8_scaled_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_2_be_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_2_scaled_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_4_be_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_4_scaled_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_u_8_be_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_u_8_scaled_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_STORE
+#define LS_N m88k_instr_st_2_be_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_2_scaled_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_4_be_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_4_scaled_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_STORE
+#define LS_N m88k_instr_st_8_be_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_st_8_scaled_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#define LS_LOAD
+#define LS_N m88k_instr_ld_2_be_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_2_scaled_usr_regofs
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_BE
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_4_be_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_4_scaled_usr_regofs
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_BE
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#define LS_LOAD
+#define LS_N m88k_instr_ld_8_be_scaled_usr_regofs
+#define LS_GENERIC_N m88k_generic_ld_8_scaled_usr_regofs
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_BE
+#define LS_SCALED
+#define LS_USR
+#define LS_REGOFS
+#include "cpu_m88k_instr_loadstore.cc"
+#undef LS_REGOFS
+#undef LS_USR
+#undef LS_SCALED
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+
+
+void (*m88k_loadstore[256])(struct cpu *, struct m88k_instr_call *) = {
+	m88k_instr_ld_u_1_le,
+	m88k_instr_ld_u_2_le,
+	m88k_instr_ld_u_4_le,
+	m88k_instr_ld_u_8_le,
+	m88k_instr_st_1_le,
+	m88k_instr_st_2_le,
+	m88k_instr_st_4_le,
+	m88k_instr_st_8_le,
+	m88k_instr_ld_1_le,
+	m88k_instr_ld_2_le,
+	m88k_instr_ld_4_le,
+	m88k_instr_ld_8_le,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	m88k_instr_ld_u_1_le,
+	m88k_instr_ld_u_2_be,
+	m88k_instr_ld_u_4_be,
+	m88k_instr_ld_u_8_be,
+	m88k_instr_st_1_le,
+	m88k_instr_st_2_be,
+	m88k_instr_st_4_be,
+	m88k_instr_st_8_be,
+	m88k_instr_ld_1_le,
+	m88k_instr_ld_2_be,
+	m88k_instr_ld_4_be,
+	m88k_instr_ld_8_be,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	m88k_instr_ld_u_1_le_regofs,
+	m88k_instr_ld_u_2_le_regofs,
+	m88k_instr_ld_u_4_le_regofs,
+	m88k_instr_ld_u_8_le_regofs,
+	m88k_instr_st_1_le_regofs,
+	m88k_instr_st_2_le_regofs,
+	m88k_instr_st_4_le_regofs,
+	m88k_instr_st_8_le_regofs,
+	m88k_instr_ld_1_le_regofs,
+	m88k_instr_ld_2_le_regofs,
+	m88k_instr_ld_4_le_regofs,
+	m88k_instr_ld_8_le_regofs,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	m88k_instr_ld_u_1_le_regofs,
+	m88k_instr_ld_u_2_be_regofs,
+	m88k_instr_ld_u_4_be_regofs,
+	m88k_instr_ld_u_8_be_regofs,
+	m88k_instr_st_1_le_regofs,
+	m88k_instr_st_2_be_regofs,
+	m88k_instr_st_4_be_regofs,
+	m88k_instr_st_8_be_regofs,
+	m88k_instr_ld_1_le_regofs,
+	m88k_instr_ld_2_be_regofs,
+	m88k_instr_ld_4_be_regofs,
+	m88k_instr_ld_8_be_regofs,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	m88k_instr_ld_u_2_le_scaled_regofs,
+	m88k_instr_ld_u_4_le_scaled_regofs,
+	m88k_instr_ld_u_8_le_scaled_regofs,
+	NULL,
+	m88k_instr_st_2_le_scaled_regofs,
+	m88k_instr_st_4_le_scaled_regofs,
+	m88k_instr_st_8_le_scaled_regofs,
+	NULL,
+	m88k_instr_ld_2_le_scaled_regofs,
+	m88k_instr_ld_4_le_scaled_regofs,
+	m88k_instr_ld_8_le_scaled_regofs,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	m88k_instr_ld_u_2_be_scaled_regofs,
+	m88k_instr_ld_u_4_be_scaled_regofs,
+	m88k_instr_ld_u_8_be_scaled_regofs,
+	NULL,
+	m88k_instr_st_2_be_scaled_regofs,
+	m88k_instr_st_4_be_scaled_regofs,
+	m88k_instr_st_8_be_scaled_regofs,
+	NULL,
+	m88k_instr_ld_2_be_scaled_regofs,
+	m88k_instr_ld_4_be_scaled_regofs,
+	m88k_instr_ld_8_be_scaled_regofs,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	m88k_instr_ld_u_1_le_usr_regofs,
+	m88k_instr_ld_u_2_le_usr_regofs,
+	m88k_instr_ld_u_4_le_usr_regofs,
+	m88k_instr_ld_u_8_le_usr_regofs,
+	m88k_instr_st_1_le_usr_regofs,
+	m88k_instr_st_2_le_usr_regofs,
+	m88k_instr_st_4_le_usr_regofs,
+	m88k_instr_st_8_le_usr_regofs,
+	m88k_instr_ld_1_le_usr_regofs,
+	m88k_instr_ld_2_le_usr_regofs,
+	m88k_instr_ld_4_le_usr_regofs,
+	m88k_instr_ld_8_le_usr_regofs,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	m88k_instr_ld_u_1_le_usr_regofs,
+	m88k_instr_ld_u_2_be_usr_regofs,
+	m88k_instr_ld_u_4_be_usr_regofs,
+	m88k_instr_ld_u_8_be_usr_regofs,
+	m88k_instr_st_1_le_usr_regofs,
+	m88k_instr_st_2_be_usr_regofs,
+	m88k_instr_st_4_be_usr_regofs,
+	m88k_instr_st_8_be_usr_regofs,
+	m88k_instr_ld_1_le_usr_regofs,
+	m88k_instr_ld_2_be_usr_regofs,
+	m88k_instr_ld_4_be_usr_regofs,
+	m88k_instr_ld_8_be_usr_regofs,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	m88k_instr_ld_u_2_le_scaled_usr_regofs,
+	m88k_instr_ld_u_4_le_scaled_usr_regofs,
+	m88k_instr_ld_u_8_le_scaled_usr_regofs,
+	NULL,
+	m88k_instr_st_2_le_scaled_usr_regofs,
+	m88k_instr_st_4_le_scaled_usr_regofs,
+	m88k_instr_st_8_le_scaled_usr_regofs,
+	NULL,
+	m88k_instr_ld_2_le_scaled_usr_regofs,
+	m88k_instr_ld_4_le_scaled_usr_regofs,
+	m88k_instr_ld_8_le_scaled_usr_regofs,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	m88k_instr_ld_u_2_be_scaled_usr_regofs,
+	m88k_instr_ld_u_4_be_scaled_usr_regofs,
+	m88k_instr_ld_u_8_be_scaled_usr_regofs,
+	NULL,
+	m88k_instr_st_2_be_scaled_usr_regofs,
+	m88k_instr_st_4_be_scaled_usr_regofs,
+	m88k_instr_st_8_be_scaled_usr_regofs,
+	NULL,
+	m88k_instr_ld_2_be_scaled_usr_regofs,
+	m88k_instr_ld_4_be_scaled_usr_regofs,
+	m88k_instr_ld_8_be_scaled_usr_regofs,
+	NULL,
+	NULL,
+	NULL,
+	NULL };
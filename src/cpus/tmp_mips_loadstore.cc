@@ -0,0 +1,825 @@
+
+/*  AUTOMATICALLY GENERATED! Do not edit.  */
+
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_lu1_le
+#define LS_GENERIC_N mips_generic_lu1
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_l1_le
+#define LS_GENERIC_N mips_generic_l1
+#define LS_1
+#define LS_SIZE 1
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_lu2_le
+#define LS_GENERIC_N mips_generic_lu2
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_l2_le
+#define LS_GENERIC_N mips_generic_l2
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_lu4_le
+#define LS_GENERIC_N mips_generic_lu4
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_l4_le
+#define LS_GENERIC_N mips_generic_l4
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_lu8_le
+#define LS_GENERIC_N mips_generic_lu8
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_l8_le
+#define LS_GENERIC_N mips_generic_l8
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_STORE
+#define LS_N mips_instr_s1_le
+#define LS_GENERIC_N mips_generic_s1
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifndef MODE32
+#define LS_STORE
+#define LS_N mips_instr_s2_le
+#define LS_GENERIC_N mips_generic_s2
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifndef MODE32
+#define LS_STORE
+#define LS_N mips_instr_s4_le
+#define LS_GENERIC_N mips_generic_s4
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifndef MODE32
+#define LS_STORE
+#define LS_N mips_instr_s8_le
+#define LS_GENERIC_N mips_generic_s8
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_lu2_be
+#define LS_GENERIC_N mips_generic_lu2
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_l2_be
+#define LS_GENERIC_N mips_generic_l2
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_lu4_be
+#define LS_GENERIC_N mips_generic_lu4
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_l4_be
+#define LS_GENERIC_N mips_generic_l4
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_lu8_be
+#define LS_GENERIC_N mips_generic_lu8
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_LOAD
+#define LS_N mips_instr_l8_be
+#define LS_GENERIC_N mips_generic_l8
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifndef MODE32
+#define LS_STORE
+#define LS_N mips_instr_s2_be
+#define LS_GENERIC_N mips_generic_s2
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifndef MODE32
+#define LS_STORE
+#define LS_N mips_instr_s4_be
+#define LS_GENERIC_N mips_generic_s4
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifndef MODE32
+#define LS_STORE
+#define LS_N mips_instr_s8_be
+#define LS_GENERIC_N mips_generic_s8
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_lu1_le
+#define LS_GENERIC_N mips32_generic_lu1
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_l1_le
+#define LS_GENERIC_N mips32_generic_l1
+#define LS_1
+#define LS_SIZE 1
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_lu2_le
+#define LS_GENERIC_N mips32_generic_lu2
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_l2_le
+#define LS_GENERIC_N mips32_generic_l2
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_lu4_le
+#define LS_GENERIC_N mips32_generic_lu4
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_l4_le
+#define LS_GENERIC_N mips32_generic_l4
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_lu8_le
+#define LS_GENERIC_N mips32_generic_lu8
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_l8_le
+#define LS_GENERIC_N mips32_generic_l8
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_STORE
+#define LS_N mips32_instr_s1_le
+#define LS_GENERIC_N mips32_generic_s1
+#define LS_1
+#define LS_SIZE 1
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_1
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifdef MODE32
+#define LS_STORE
+#define LS_N mips32_instr_s2_le
+#define LS_GENERIC_N mips32_generic_s2
+#define LS_2
+#define LS_SIZE 2
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifdef MODE32
+#define LS_STORE
+#define LS_N mips32_instr_s4_le
+#define LS_GENERIC_N mips32_generic_s4
+#define LS_4
+#define LS_SIZE 4
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifdef MODE32
+#define LS_STORE
+#define LS_N mips32_instr_s8_le
+#define LS_GENERIC_N mips32_generic_s8
+#define LS_8
+#define LS_SIZE 8
+#define LS_LE
+#define LS_INCLUDE_GENERIC
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_INCLUDE_GENERIC
+#undef LS_LE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_lu2_be
+#define LS_GENERIC_N mips32_generic_lu2
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_l2_be
+#define LS_GENERIC_N mips32_generic_l2
+#define LS_2
+#define LS_SIZE 2
+#define LS_SIGNED
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_lu4_be
+#define LS_GENERIC_N mips32_generic_lu4
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_l4_be
+#define LS_GENERIC_N mips32_generic_l4
+#define LS_4
+#define LS_SIZE 4
+#define LS_SIGNED
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_lu8_be
+#define LS_GENERIC_N mips32_generic_lu8
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_LOAD
+#define LS_N mips32_instr_l8_be
+#define LS_GENERIC_N mips32_generic_l8
+#define LS_8
+#define LS_SIZE 8
+#define LS_SIGNED
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIGNED
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_LOAD
+#endif
+#ifdef MODE32
+#define LS_STORE
+#define LS_N mips32_instr_s2_be
+#define LS_GENERIC_N mips32_generic_s2
+#define LS_2
+#define LS_SIZE 2
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_2
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifdef MODE32
+#define LS_STORE
+#define LS_N mips32_instr_s4_be
+#define LS_GENERIC_N mips32_generic_s4
+#define LS_4
+#define LS_SIZE 4
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_4
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifdef MODE32
+#define LS_STORE
+#define LS_N mips32_instr_s8_be
+#define LS_GENERIC_N mips32_generic_s8
+#define LS_8
+#define LS_SIZE 8
+#define LS_BE
+#include "cpu_mips_instr_loadstore.cc"
+#undef LS_BE
+#undef LS_SIZE
+#undef LS_8
+#undef LS_GENERIC_N
+#undef LS_N
+#undef LS_STORE
+#endif
+#ifndef MODE32
+
+
+void (*mips_loadstore[32])(struct cpu *, struct mips_instr_call *) = {
+	mips_instr_lu1_le,
+	mips_instr_l1_le,
+	mips_instr_lu2_le,
+	mips_instr_l2_le,
+	mips_instr_lu4_le,
+	mips_instr_l4_le,
+	mips_instr_lu8_le,
+	mips_instr_l8_le,
+	mips_instr_s1_le,
+	mips_instr_invalid,
+	mips_instr_s2_le,
+	mips_instr_invalid,
+	mips_instr_s4_le,
+	mips_instr_invalid,
+	mips_instr_s8_le,
+	mips_instr_invalid,
+	mips_instr_lu1_le,
+	mips_instr_l1_le,
+	mips_instr_lu2_be,
+	mips_instr_l2_be,
+	mips_instr_lu4_be,
+	mips_instr_l4_be,
+	mips_instr_lu8_be,
+	mips_instr_l8_be,
+	mips_instr_s1_le,
+	mips_instr_invalid,
+	mips_instr_s2_be,
+	mips_instr_invalid,
+	mips_instr_s4_be,
+	mips_instr_invalid,
+	mips_instr_s8_be,
+	mips_instr_invalid };
+#endif
+#ifdef MODE32
+
+
+void (*mips32_loadstore[32])(struct cpu *, struct mips_instr_call *) = {
+	mips32_instr_lu1_le,
+	mips32_instr_l1_le,
+	mips32_instr_lu2_le,
+	mips32_instr_l2_le,
+	mips32_instr_lu4_le,
+	mips32_instr_l4_le,
+	mips32_instr_lu8_le,
+	mips32_instr_l8_le,
+	mips32_instr_s1_le,
+	mips32_instr_invalid,
+	mips32_instr_s2_le,
+	mips32_instr_invalid,
+	mips32_instr_s4_le,
+	mips32_instr_invalid,
+	mips32_instr_s8_le,
+	mips32_instr_invalid,
+	mips32_instr_lu1_le,
+	mips32_instr_l1_le,
+	mips32_instr_lu2_be,
+	mips32_instr_l2_be,
+	mips32_instr_lu4_be,
+	mips32_instr_l4_be,
+	mips32_instr_lu8_be,
+	mips32_instr_l8_be,
+	mips32_instr_s1_le,
+	mips32_instr_invalid,
+	mips32_instr_s2_be,
+	mips32_instr_invalid,
+	mips32_instr_s4_be,
+	mips32_instr_invalid,
+	mips32_instr_s8_be,
+	mips32_instr_invalid };
+#endif
+#ifndef MODE32
+
+
+void (*mips_loadstore_generic[16])(struct cpu *, struct mips_instr_call *) = {
+	mips_generic_lu1,
+	mips_generic_l1,
+	mips_generic_lu2,
+	mips_generic_l2,
+	mips_generic_lu4,
+	mips_generic_l4,
+	mips_generic_lu8,
+	mips_generic_l8,
+	mips_generic_s1,
+	mips_instr_invalid,
+	mips_generic_s2,
+	mips_instr_invalid,
+	mips_generic_s4,
+	mips_instr_invalid,
+	mips_generic_s8,
+	mips_instr_invalid };
+#endif
+#ifdef MODE32
+
+
+void (*mips32_loadstore_generic[16])(struct cpu *, struct mips_instr_call *) = {
+	mips32_generic_lu1,
+	mips32_generic_l1,
+	mips32_generic_lu2,
+	mips32_generic_l2,
+	mips32_generic_lu4,
+	mips32_generic_l4,
+	mips32_generic_lu8,
+	mips32_generic_l8,
+	mips32_generic_s1,
+	mips32_instr_invalid,
+	mips32_generic_s2,
+	mips32_instr_invalid,
+	mips32_generic_s4,
+	mips32_instr_invalid,
+	mips32_generic_s8,
+	mips32_instr_invalid };
+#endif
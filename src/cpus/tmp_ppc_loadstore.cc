@@ -0,0 +1,2063 @@
+
+/*  AUTOMATICALLY GENERATED! Do not edit.  */
+
+#ifndef MODE32
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_GENERIC_N ppc_generic_stb
+#define LS_N ppc_instr_stb
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_GENERIC_N ppc_generic_sth
+#define LS_N ppc_instr_sth
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_GENERIC_N ppc_generic_stw
+#define LS_N ppc_instr_stw
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_GENERIC_N ppc_generic_std
+#define LS_N ppc_instr_std
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lba
+#define LS_N ppc_instr_lba
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lha
+#define LS_N ppc_instr_lha
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lwa
+#define LS_N ppc_instr_lwa
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lbz
+#define LS_N ppc_instr_lbz
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lhz
+#define LS_N ppc_instr_lhz
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lwz
+#define LS_N ppc_instr_lwz
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_ldz
+#define LS_N ppc_instr_ld
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_stb
+#define LS_N ppc_instr_stb_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_sth
+#define LS_N ppc_instr_sth_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_stw
+#define LS_N ppc_instr_stw_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_std
+#define LS_N ppc_instr_std_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_lba
+#define LS_N ppc_instr_lba_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_lha
+#define LS_N ppc_instr_lha_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_lwa
+#define LS_N ppc_instr_lwa_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_lbz
+#define LS_N ppc_instr_lbz_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_lhz
+#define LS_N ppc_instr_lhz_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_lwz
+#define LS_N ppc_instr_lwz_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc_generic_ldz
+#define LS_N ppc_instr_ld_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_stbu
+#define LS_N ppc_instr_stbu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_sthu
+#define LS_N ppc_instr_sthu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_stwu
+#define LS_N ppc_instr_stwu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_stdu
+#define LS_N ppc_instr_stdu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lbau
+#define LS_N ppc_instr_lbau
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lhau
+#define LS_N ppc_instr_lhau
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lwau
+#define LS_N ppc_instr_lwau
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lbzu
+#define LS_N ppc_instr_lbzu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lhzu
+#define LS_N ppc_instr_lhzu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lwzu
+#define LS_N ppc_instr_lwzu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_ldzu
+#define LS_N ppc_instr_ldu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_stbu
+#define LS_N ppc_instr_stbu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_sthu
+#define LS_N ppc_instr_sthu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_stwu
+#define LS_N ppc_instr_stwu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_stdu
+#define LS_N ppc_instr_stdu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lbau
+#define LS_N ppc_instr_lbau_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lhau
+#define LS_N ppc_instr_lhau_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lwau
+#define LS_N ppc_instr_lwau_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lbzu
+#define LS_N ppc_instr_lbzu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lhzu
+#define LS_N ppc_instr_lhzu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lwzu
+#define LS_N ppc_instr_lwzu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_ldzu
+#define LS_N ppc_instr_ldu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_INDEXED
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_GENERIC_N ppc_generic_stbx
+#define LS_N ppc_instr_stbx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_GENERIC_N ppc_generic_sthx
+#define LS_N ppc_instr_sthx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_GENERIC_N ppc_generic_stwx
+#define LS_N ppc_instr_stwx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_GENERIC_N ppc_generic_stdx
+#define LS_N ppc_instr_stdx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lbax
+#define LS_N ppc_instr_lbax
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lhax
+#define LS_N ppc_instr_lhax
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lwax
+#define LS_N ppc_instr_lwax
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lbzx
+#define LS_N ppc_instr_lbzx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lhzx
+#define LS_N ppc_instr_lhzx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_lwzx
+#define LS_N ppc_instr_lwzx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc_generic_ldzx
+#define LS_N ppc_instr_ldx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_stbux
+#define LS_N ppc_instr_stbux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_sthux
+#define LS_N ppc_instr_sthux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_stwux
+#define LS_N ppc_instr_stwux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_stdux
+#define LS_N ppc_instr_stdux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lbaux
+#define LS_N ppc_instr_lbaux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lhaux
+#define LS_N ppc_instr_lhaux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lwaux
+#define LS_N ppc_instr_lwaux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lbzux
+#define LS_N ppc_instr_lbzux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lhzux
+#define LS_N ppc_instr_lhzux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_lwzux
+#define LS_N ppc_instr_lwzux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc_generic_ldzux
+#define LS_N ppc_instr_ldux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_INDEXED
+
+
+void (*ppc_loadstore[64])(struct cpu *, struct ppc_instr_call *) = {
+	ppc_instr_stb,
+	ppc_instr_sth,
+	ppc_instr_stw,
+	ppc_instr_std,
+	ppc_instr_stb,
+	ppc_instr_sth,
+	ppc_instr_stw,
+	ppc_instr_std,
+	ppc_instr_lba,
+	ppc_instr_lha,
+	ppc_instr_lwa,
+	ppc_instr_invalid,
+	ppc_instr_lbz,
+	ppc_instr_lhz,
+	ppc_instr_lwz,
+	ppc_instr_ld,
+	ppc_instr_stb_0,
+	ppc_instr_sth_0,
+	ppc_instr_stw_0,
+	ppc_instr_std_0,
+	ppc_instr_stb_0,
+	ppc_instr_sth_0,
+	ppc_instr_stw_0,
+	ppc_instr_std_0,
+	ppc_instr_lba_0,
+	ppc_instr_lha_0,
+	ppc_instr_lwa_0,
+	ppc_instr_invalid,
+	ppc_instr_lbz_0,
+	ppc_instr_lhz_0,
+	ppc_instr_lwz_0,
+	ppc_instr_ld_0,
+	ppc_instr_stbu,
+	ppc_instr_sthu,
+	ppc_instr_stwu,
+	ppc_instr_stdu,
+	ppc_instr_stbu,
+	ppc_instr_sthu,
+	ppc_instr_stwu,
+	ppc_instr_stdu,
+	ppc_instr_lbau,
+	ppc_instr_lhau,
+	ppc_instr_lwau,
+	ppc_instr_invalid,
+	ppc_instr_lbzu,
+	ppc_instr_lhzu,
+	ppc_instr_lwzu,
+	ppc_instr_ldu,
+	ppc_instr_stbu_0,
+	ppc_instr_sthu_0,
+	ppc_instr_stwu_0,
+	ppc_instr_stdu_0,
+	ppc_instr_stbu_0,
+	ppc_instr_sthu_0,
+	ppc_instr_stwu_0,
+	ppc_instr_stdu_0,
+	ppc_instr_lbau_0,
+	ppc_instr_lhau_0,
+	ppc_instr_lwau_0,
+	ppc_instr_invalid,
+	ppc_instr_lbzu_0,
+	ppc_instr_lhzu_0,
+	ppc_instr_lwzu_0,
+	ppc_instr_ldu_0
+};
+
+
+
+void (*ppc_loadstore_indexed[32])(struct cpu *, struct ppc_instr_call *) = {
+	ppc_instr_stbx,
+	ppc_instr_sthx,
+	ppc_instr_stwx,
+	ppc_instr_stdx,
+	ppc_instr_stbx,
+	ppc_instr_sthx,
+	ppc_instr_stwx,
+	ppc_instr_stdx,
+	ppc_instr_lbax,
+	ppc_instr_lhax,
+	ppc_instr_lwax,
+	ppc_instr_invalid,
+	ppc_instr_lbzx,
+	ppc_instr_lhzx,
+	ppc_instr_lwzx,
+	ppc_instr_ldx,
+	ppc_instr_stbux,
+	ppc_instr_sthux,
+	ppc_instr_stwux,
+	ppc_instr_stdux,
+	ppc_instr_stbux,
+	ppc_instr_sthux,
+	ppc_instr_stwux,
+	ppc_instr_stdux,
+	ppc_instr_lbaux,
+	ppc_instr_lhaux,
+	ppc_instr_lwaux,
+	ppc_instr_invalid,
+	ppc_instr_lbzux,
+	ppc_instr_lhzux,
+	ppc_instr_lwzux,
+	ppc_instr_ldux
+};
+
+#define LS_BYTEREVERSE
+#define LS_INDEXED
+#define LS_SIZE 2
+#define LS_H
+#define LS_GENERIC_N ppc_generic_lhbrx
+#define LS_N ppc_instr_lhbrx
+#define LS_LOAD
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_LOAD
+#undef LS_N
+#undef LS_GENERIC_N
+#define LS_GENERIC_N ppc_generic_sthbrx
+#define LS_N ppc_instr_sthbrx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#define LS_SIZE 4
+#define LS_W
+#define LS_GENERIC_N ppc_generic_lwbrx
+#define LS_N ppc_instr_lwbrx
+#define LS_LOAD
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_LOAD
+#undef LS_N
+#undef LS_GENERIC_N
+#define LS_GENERIC_N ppc_generic_stwbrx
+#define LS_N ppc_instr_stwbrx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_INDEXED
+#undef LS_BYTEREVERSE
+#endif
+#ifdef MODE32
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_GENERIC_N ppc32_generic_stb
+#define LS_N ppc32_instr_stb
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_GENERIC_N ppc32_generic_sth
+#define LS_N ppc32_instr_sth
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_GENERIC_N ppc32_generic_stw
+#define LS_N ppc32_instr_stw
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_GENERIC_N ppc32_generic_std
+#define LS_N ppc32_instr_std
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lba
+#define LS_N ppc32_instr_lba
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lha
+#define LS_N ppc32_instr_lha
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lwa
+#define LS_N ppc32_instr_lwa
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lbz
+#define LS_N ppc32_instr_lbz
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lhz
+#define LS_N ppc32_instr_lhz
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lwz
+#define LS_N ppc32_instr_lwz
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_ldz
+#define LS_N ppc32_instr_ld
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_stb
+#define LS_N ppc32_instr_stb_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_sth
+#define LS_N ppc32_instr_sth_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_stw
+#define LS_N ppc32_instr_stw_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_std
+#define LS_N ppc32_instr_std_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_lba
+#define LS_N ppc32_instr_lba_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_lha
+#define LS_N ppc32_instr_lha_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_lwa
+#define LS_N ppc32_instr_lwa_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_lbz
+#define LS_N ppc32_instr_lbz_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_lhz
+#define LS_N ppc32_instr_lhz_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_lwz
+#define LS_N ppc32_instr_lwz_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_GENERIC_N ppc32_generic_ldz
+#define LS_N ppc32_instr_ld_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_stbu
+#define LS_N ppc32_instr_stbu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_sthu
+#define LS_N ppc32_instr_sthu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_stwu
+#define LS_N ppc32_instr_stwu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_stdu
+#define LS_N ppc32_instr_stdu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lbau
+#define LS_N ppc32_instr_lbau
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lhau
+#define LS_N ppc32_instr_lhau
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lwau
+#define LS_N ppc32_instr_lwau
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lbzu
+#define LS_N ppc32_instr_lbzu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lhzu
+#define LS_N ppc32_instr_lhzu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lwzu
+#define LS_N ppc32_instr_lwzu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_ldzu
+#define LS_N ppc32_instr_ldu
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_stbu
+#define LS_N ppc32_instr_stbu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_sthu
+#define LS_N ppc32_instr_sthu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_stwu
+#define LS_N ppc32_instr_stwu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_stdu
+#define LS_N ppc32_instr_stdu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lbau
+#define LS_N ppc32_instr_lbau_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lhau
+#define LS_N ppc32_instr_lhau_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lwau
+#define LS_N ppc32_instr_lwau_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_IGNOREOFS
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lbzu
+#define LS_N ppc32_instr_lbzu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lhzu
+#define LS_N ppc32_instr_lhzu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lwzu
+#define LS_N ppc32_instr_lwzu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_IGNOREOFS
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_ldzu
+#define LS_N ppc32_instr_ldu_0
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_IGNOREOFS
+#define LS_INDEXED
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_GENERIC_N ppc32_generic_stbx
+#define LS_N ppc32_instr_stbx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_GENERIC_N ppc32_generic_sthx
+#define LS_N ppc32_instr_sthx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_GENERIC_N ppc32_generic_stwx
+#define LS_N ppc32_instr_stwx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_GENERIC_N ppc32_generic_stdx
+#define LS_N ppc32_instr_stdx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lbax
+#define LS_N ppc32_instr_lbax
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lhax
+#define LS_N ppc32_instr_lhax
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lwax
+#define LS_N ppc32_instr_lwax
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lbzx
+#define LS_N ppc32_instr_lbzx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lhzx
+#define LS_N ppc32_instr_lhzx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_lwzx
+#define LS_N ppc32_instr_lwzx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_GENERIC_N ppc32_generic_ldzx
+#define LS_N ppc32_instr_ldx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_stbux
+#define LS_N ppc32_instr_stbux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_sthux
+#define LS_N ppc32_instr_sthux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_stwux
+#define LS_N ppc32_instr_stwux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_stdux
+#define LS_N ppc32_instr_stdux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_B
+#define LS_SIZE 1
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lbaux
+#define LS_N ppc32_instr_lbaux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_H
+#define LS_SIZE 2
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lhaux
+#define LS_N ppc32_instr_lhaux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_W
+#define LS_SIZE 4
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lwaux
+#define LS_N ppc32_instr_lwaux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#define LS_B
+#define LS_SIZE 1
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lbzux
+#define LS_N ppc32_instr_lbzux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_B
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_H
+#define LS_SIZE 2
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lhzux
+#define LS_N ppc32_instr_lhzux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_W
+#define LS_SIZE 4
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_lwzux
+#define LS_N ppc32_instr_lwzux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#define LS_D
+#define LS_SIZE 8
+#define LS_ZERO
+#define LS_LOAD
+#define LS_UPDATE
+#define LS_GENERIC_N ppc32_generic_ldzux
+#define LS_N ppc32_instr_ldux
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_D
+#undef LS_SIZE
+#undef LS_LOAD
+#undef LS_UPDATE
+#undef LS_ZERO
+#undef LS_INDEXED
+
+
+void (*ppc32_loadstore[64])(struct cpu *, struct ppc_instr_call *) = {
+	ppc32_instr_stb,
+	ppc32_instr_sth,
+	ppc32_instr_stw,
+	ppc32_instr_std,
+	ppc32_instr_stb,
+	ppc32_instr_sth,
+	ppc32_instr_stw,
+	ppc32_instr_std,
+	ppc32_instr_lba,
+	ppc32_instr_lha,
+	ppc32_instr_lwa,
+	ppc32_instr_invalid,
+	ppc32_instr_lbz,
+	ppc32_instr_lhz,
+	ppc32_instr_lwz,
+	ppc32_instr_ld,
+	ppc32_instr_stb_0,
+	ppc32_instr_sth_0,
+	ppc32_instr_stw_0,
+	ppc32_instr_std_0,
+	ppc32_instr_stb_0,
+	ppc32_instr_sth_0,
+	ppc32_instr_stw_0,
+	ppc32_instr_std_0,
+	ppc32_instr_lba_0,
+	ppc32_instr_lha_0,
+	ppc32_instr_lwa_0,
+	ppc32_instr_invalid,
+	ppc32_instr_lbz_0,
+	ppc32_instr_lhz_0,
+	ppc32_instr_lwz_0,
+	ppc32_instr_ld_0,
+	ppc32_instr_stbu,
+	ppc32_instr_sthu,
+	ppc32_instr_stwu,
+	ppc32_instr_stdu,
+	ppc32_instr_stbu,
+	ppc32_instr_sthu,
+	ppc32_instr_stwu,
+	ppc32_instr_stdu,
+	ppc32_instr_lbau,
+	ppc32_instr_lhau,
+	ppc32_instr_lwau,
+	ppc32_instr_invalid,
+	ppc32_instr_lbzu,
+	ppc32_instr_lhzu,
+	ppc32_instr_lwzu,
+	ppc32_instr_ldu,
+	ppc32_instr_stbu_0,
+	ppc32_instr_sthu_0,
+	ppc32_instr_stwu_0,
+	ppc32_instr_stdu_0,
+	ppc32_instr_stbu_0,
+	ppc32_instr_sthu_0,
+	ppc32_instr_stwu_0,
+	ppc32_instr_stdu_0,
+	ppc32_instr_lbau_0,
+	ppc32_instr_lhau_0,
+	ppc32_instr_lwau_0,
+	ppc32_instr_invalid,
+	ppc32_instr_lbzu_0,
+	ppc32_instr_lhzu_0,
+	ppc32_instr_lwzu_0,
+	ppc32_instr_ldu_0
+};
+
+
+
+void (*ppc32_loadstore_indexed[32])(struct cpu *, struct ppc_instr_call *) = {
+	ppc32_instr_stbx,
+	ppc32_instr_sthx,
+	ppc32_instr_stwx,
+	ppc32_instr_stdx,
+	ppc32_instr_stbx,
+	ppc32_instr_sthx,
+	ppc32_instr_stwx,
+	ppc32_instr_stdx,
+	ppc32_instr_lbax,
+	ppc32_instr_lhax,
+	ppc32_instr_lwax,
+	ppc32_instr_invalid,
+	ppc32_instr_lbzx,
+	ppc32_instr_lhzx,
+	ppc32_instr_lwzx,
+	ppc32_instr_ldx,
+	ppc32_instr_stbux,
+	ppc32_instr_sthux,
+	ppc32_instr_stwux,
+	ppc32_instr_stdux,
+	ppc32_instr_stbux,
+	ppc32_instr_sthux,
+	ppc32_instr_stwux,
+	ppc32_instr_stdux,
+	ppc32_instr_lbaux,
+	ppc32_instr_lhaux,
+	ppc32_instr_lwaux,
+	ppc32_instr_invalid,
+	ppc32_instr_lbzux,
+	ppc32_instr_lhzux,
+	ppc32_instr_lwzux,
+	ppc32_instr_ldux
+};
+
+#define LS_BYTEREVERSE
+#define LS_INDEXED
+#define LS_SIZE 2
+#define LS_H
+#define LS_GENERIC_N ppc32_generic_lhbrx
+#define LS_N ppc32_instr_lhbrx
+#define LS_LOAD
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_LOAD
+#undef LS_N
+#undef LS_GENERIC_N
+#define LS_GENERIC_N ppc32_generic_sthbrx
+#define LS_N ppc32_instr_sthbrx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_H
+#undef LS_SIZE
+#define LS_SIZE 4
+#define LS_W
+#define LS_GENERIC_N ppc32_generic_lwbrx
+#define LS_N ppc32_instr_lwbrx
+#define LS_LOAD
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_LOAD
+#undef LS_N
+#undef LS_GENERIC_N
+#define LS_GENERIC_N ppc32_generic_stwbrx
+#define LS_N ppc32_instr_stwbrx
+#include "cpu_ppc_instr_loadstore.cc"
+#undef LS_N
+#undef LS_GENERIC_N
+#undef LS_W
+#undef LS_SIZE
+#undef LS_INDEXED
+#undef LS_BYTEREVERSE
+#endif
@@ -114,6 +114,10 @@ char debugger_readchar(void)
 		/*  Check for X11 events:  */
 		x11_check_event(debugger_emul);
 
+		/*  Check for console input, and flush output to slaves:  */
+		console_flush();
+		console_poll();
+
 		/*  Give up some CPU time:  */
 		usleep(10000);
 	}
@@ -174,6 +178,26 @@ static void show_breakpoint(struct machine *m, int i)
 }
 
 
+/*
+ *  show_watchpoint():
+ */
+static void show_watchpoint(struct machine *m, int i)
+{
+	printf("%3i: 0x", i);
+	if (m->cpus[0]->is_32bit)
+		printf("%08"PRIx32, (uint32_t) m->watchpoints.addr[i]);
+	else
+		printf("%016"PRIx64, (uint64_t) m->watchpoints.addr[i]);
+	printf(", %"PRIi64" byte%s, %s%s", (int64_t) m->watchpoints.len[i],
+	    m->watchpoints.len[i] == 1? "" : "s",
+	    m->watchpoints.flags[i] & WATCHPOINT_READ? "r" : "",
+	    m->watchpoints.flags[i] & WATCHPOINT_WRITE? "w" : "");
+	if (m->watchpoints.string[i] != NULL)
+		printf(" (%s)", m->watchpoints.string[i]);
+	printf("\n");
+}
+
+
 /****************************************************************************/
 
 
@@ -543,27 +567,20 @@ static char *debugger_readline(void)
 			}
 		} else if (ch == 27) {
 			/*  Escape codes: (cursor keys etc)  */
-			while ((ch = console_readchar(MAIN_CONSOLE)) < 0)
-				usleep(10000);
+			ch = debugger_readchar();
 			if (ch == '[' || ch == 'O') {
-				while ((ch = console_readchar(MAIN_CONSOLE))
-				    < 0)
-					usleep(10000);
+				ch = debugger_readchar();
 				switch (ch) {
 				case '2':	/*  2~ = ins  */
 				case '5':	/*  5~ = pgup  */
 				case '6':	/*  6~ = pgdn  */
 					/*  TODO: Ugly hack, but might work.  */
-					while ((ch = console_readchar(
-					    MAIN_CONSOLE)) < 0)
-						usleep(10000);
+					ch = debugger_readchar();
 					/*  Do nothing for these keys.  */
 					break;
 				case '3':	/*  3~ = delete  */
 					/*  TODO: Ugly hack, but might work.  */
-					while ((ch = console_readchar(
-					    MAIN_CONSOLE)) < 0)
-						usleep(10000);
+					ch = debugger_readchar();
 					console_makeavail(MAIN_CONSOLE, '\b');
 					break;
 				case 'A':	/*  Up.  */
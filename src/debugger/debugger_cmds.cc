@@ -74,7 +74,7 @@ static void debugger_cmd_breakpoint(struct machine *m, char *cmd_line)
 			printf("No breakpoints set.\n");
 			return;
 		}
-		if (x < 0 || x > m->breakpoints.n) {
+		if (x < 0 || x >= m->breakpoints.n) {
 			printf("Invalid breakpoint nr %i. Use 'breakpoint "
 			    "show' to see the current breakpoints.\n", x);
 			return;
@@ -87,6 +87,7 @@ static void debugger_cmd_breakpoint(struct machine *m, char *cmd_line)
 			m->breakpoints.string[i] = m->breakpoints.string[i+1];
 		}
 		m->breakpoints.n --;
+		machine_breakpoints_rehash(m);
 
 		/*  Clear translations:  */
 		for (i=0; i<m->ncpus; i++)
@@ -107,6 +108,11 @@ static void debugger_cmd_breakpoint(struct machine *m, char *cmd_line)
 			return;
 		}
 
+		if (m->arch == ARCH_MIPS) {
+			if ((tmp >> 32) == 0 && ((tmp >> 31) & 1))
+				tmp |= 0xffffffff00000000ULL;
+		}
+
 		CHECK_ALLOCATION(m->breakpoints.string = (char **) realloc(
 		    m->breakpoints.string, sizeof(char *) *
 		    (m->breakpoints.n + 1)));
@@ -123,6 +129,7 @@ static void debugger_cmd_breakpoint(struct machine *m, char *cmd_line)
 		m->breakpoints.addr[i] = tmp;
 
 		m->breakpoints.n ++;
+		machine_breakpoints_rehash(m);
 		show_breakpoint(m, i);
 
 		/*  Clear translations:  */
@@ -1177,6 +1184,100 @@ static void debugger_cmd_version(struct machine *m, char *cmd_line)
 }
 
 
+/*
+ *  debugger_cmd_watchpoint():
+ *
+ *  Watchpoints are per virtual address range. Pages with watchpoints are
+ *  kept out of the cpus' fast translation arrays, so only accesses to those
+ *  pages are slowed down.
+ */
+static void debugger_cmd_watchpoint(struct machine *m, char *cmd_line)
+{
+	int i;
+
+	while (cmd_line[0] != '\0' && cmd_line[0] == ' ')
+		cmd_line ++;
+
+	if (cmd_line[0] == '\0') {
+		printf("syntax: watchpoint subcmd [args...]\n");
+		printf("Available subcmds (and args) are:\n");
+		printf("  add addr [len [r|w|rw]]   add a watchpoint for len"
+		    " bytes (default 4, rw)\n");
+		printf("  delete x                  delete watchpoint nr x\n");
+		printf("  show                      show current watchpoints\n");
+		return;
+	}
+
+	if (strcmp(cmd_line, "show") == 0) {
+		if (m->watchpoints.n == 0)
+			printf("No watchpoints set.\n");
+		for (i=0; i<m->watchpoints.n; i++)
+			show_watchpoint(m, i);
+		return;
+	}
+
+	if (strncmp(cmd_line, "delete ", 7) == 0) {
+		int x = atoi(cmd_line + 7);
+
+		if (m->watchpoints.n == 0) {
+			printf("No watchpoints set.\n");
+			return;
+		}
+		if (x < 0 || x >= m->watchpoints.n) {
+			printf("Invalid watchpoint nr %i. Use 'watchpoint "
+			    "show' to see the current watchpoints.\n", x);
+			return;
+		}
+
+		machine_remove_watchpoint(m, x);
+		return;
+	}
+
+	if (strncmp(cmd_line, "add ", 4) == 0) {
+		char addr_str[MAX_CMD_BUFLEN], mode_str[MAX_CMD_BUFLEN];
+		uint64_t addr, len = 4;
+		int flags = WATCHPOINT_READ | WATCHPOINT_WRITE, n;
+
+		mode_str[0] = '\0';
+		n = sscanf(cmd_line + 4, "%s %"SCNi64" %s", addr_str,
+		    (int64_t *) &len, mode_str);
+		if (n < 1 || (int64_t) len <= 0) {
+			printf("syntax: watchpoint add addr [len [r|w|rw]]\n");
+			return;
+		}
+
+		if (mode_str[0] != '\0') {
+			flags = 0;
+			if (strchr(mode_str, 'r') != NULL)
+				flags |= WATCHPOINT_READ;
+			if (strchr(mode_str, 'w') != NULL)
+				flags |= WATCHPOINT_WRITE;
+			if (flags == 0) {
+				printf("Unknown watchpoint mode '%s'.\n",
+				    mode_str);
+				return;
+			}
+		}
+
+		if (!debugger_parse_expression(m, addr_str, 0, &addr)) {
+			printf("Couldn't parse '%s'\n", addr_str);
+			return;
+		}
+
+		if (m->arch == ARCH_MIPS) {
+			if ((addr >> 32) == 0 && ((addr >> 31) & 1))
+				addr |= 0xffffffff00000000ULL;
+		}
+
+		machine_add_watchpoint(m, addr, len, flags, addr_str);
+		show_watchpoint(m, m->watchpoints.n - 1);
+		return;
+	}
+
+	printf("Unknown watchpoint subcommand.\n");
+}
+
+
 /****************************************************************************/
 
 
@@ -1267,6 +1368,9 @@ static struct cmd cmds[] = {
 	{ "version", "", 0, debugger_cmd_version,
 		"print version information" },
 
+	{ "watchpoint", "...", 0, debugger_cmd_watchpoint,
+		"manipulate memory watchpoints" },
+
 	/*  Note: NULL handler.  */
 	{ "x = expr", "", 0, NULL, "generic assignment" },
 
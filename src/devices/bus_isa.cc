@@ -48,6 +48,14 @@
 
 /*
  *  isa_interrupt_common():
+ *
+ *  NOTE: The 8259 pair is not a struct interrupt_mask cascade, and cannot
+ *  be collapsed like one. Whenever the output level changes, the highest
+ *  priority pending irq has to be stored in *ptr_to_last_int (the CPU's
+ *  interrupt acknowledge reads it), and clearing irq 0 acks a pending timer
+ *  interrupt. Also, irr and ier (where a set bit means _masked_) are owned
+ *  by dev_8259 and modified directly on EOI and OCW writes, without going
+ *  through this function.
  */
 void isa_interrupt_common(struct bus_isa_data *d, int old_isa_assert)
 {
@@ -73,6 +73,10 @@ extern int verbose;
  *  bus_pci_decompose_1():
  *
  *  Helper function for decomposing Mechanism 1 tags.
+ *
+ *  Note: Some controllers (e.g. the Footbridge) map the configuration space
+ *  directly, so the low bits of the tag may be a byte offset into a 32-bit
+ *  register. bus_pci_data_access() handles such sub-word accesses.
  */
 void bus_pci_decompose_1(uint32_t t, int *bus, int *dev, int *func, int *reg)
 {
@@ -80,11 +84,112 @@ void bus_pci_decompose_1(uint32_t t, int *bus, int *dev, int *func, int *reg)
 	*dev  = (t >> 11) & 0x1f;
 	*func = (t >>  8) &  0x7;
 	*reg  =  t        & 0xff;
+}
+
+
+/*
+ *  bus_pci_lookup():
+ *
+ *  Returns the device at a specific bus/device/function, or NULL if there
+ *  is no such device.
+ */
+static struct pci_device *bus_pci_lookup(struct pci_data *pci_data,
+	int bus, int device, int function)
+{
+	if (bus < 0 || bus >= PCI_N_BUSES || device < 0 || device > 0x1f ||
+	    function < 0 || function > 7 || pci_data->device_table[bus] == NULL)
+		return NULL;
+
+	return pci_data->device_table[bus][PCI_DEVFN(device, function)];
+}
+
+
+/*
+ *  bus_pci_invalidate_range():
+ *
+ *  Invalidate all CPUs' translations for a range of physical addresses.
+ */
+static void bus_pci_invalidate_range(struct machine *machine,
+	uint64_t paddr, uint64_t len)
+{
+	uint64_t a, pagesize = machine->arch_pagesize;
+	int i;
+
+	for (i=0; i<machine->ncpus; i++) {
+		struct cpu *c = machine->cpus[i];
+		if (c->invalidate_translation_caches == NULL)
+			continue;
+
+		/*  Large windows: simply invalidate everything.  */
+		if (len > 64 * pagesize) {
+			c->invalidate_translation_caches(c, 0, INVALIDATE_ALL);
+			continue;
+		}
+
+		for (a = paddr & ~(pagesize-1); a < paddr + len; a += pagesize)
+			c->invalidate_translation_caches(c, a, INVALIDATE_PADDR);
+	}
+}
+
+
+/*
+ *  bus_pci_mapreg_write():
+ *
+ *  Handles a guest OS write to a base address register which was set up
+ *  using allocate_device_space(). The new address is stored in the register,
+ *  and the emulated device(s) in the old window are moved to the new window.
+ *
+ *  Returns 1 if the write was handled, 0 otherwise.
+ */
+static int bus_pci_mapreg_write(struct cpu *cpu, struct pci_device *pd,
+	int reg, uint32_t value)
+{
+	int n = PCI_MAPREG_NUM(reg);
+	uint64_t size = pd->mapreg_size[n], offset, oldaddr, newaddr;
+	uint32_t old, mask, new_value;
+	unsigned char *p = pd->cfg_mem + reg;
+	int res;
+
+	if (size == 0 || pd->mem == NULL)
+		return 0;
+
+	old = p[0] + (p[1] << 8) + (p[2] << 16) + ((uint32_t)p[3] << 24);
+
+	if (PCI_MAPREG_TYPE(old) == PCI_MAPREG_TYPE_IO) {
+		mask = PCI_MAPREG_IO_ADDR_MASK;
+		offset = pd->pcibus->pci_actual_io_offset;
+	} else {
+		mask = PCI_MAPREG_MEM_ADDR_MASK;
+		offset = pd->pcibus->pci_actual_mem_offset;
+	}
+
+	new_value = (value & mask & ~(uint32_t)(size - 1)) | (old & ~mask);
+	if (new_value == old)
+		return 1;
+
+	oldaddr = (old & mask) + offset;
+	newaddr = (new_value & mask) + offset;
+
+	res = memory_device_remap(pd->mem, oldaddr, size, newaddr);
+	if (res < 0) {
+		fatal("[ bus_pci: %s: cannot move mapreg 0x%02x from 0x%llx"
+		    " to 0x%llx (collision) ]\n", pd->name, reg,
+		    (long long)oldaddr, (long long)newaddr);
+		return 1;
+	}
+
+	PCI_SET_DATA(reg, new_value);
+
+	debug("[ bus_pci: %s: mapreg 0x%02x moved from 0x%llx to 0x%llx"
+	    " (%i device%s) ]\n", pd->name, reg, (long long)oldaddr,
+	    (long long)newaddr, res, res == 1? "" : "s");
+
+	if (res > 0) {
+		bus_pci_invalidate_range(cpu->machine, oldaddr, size);
+		bus_pci_invalidate_range(cpu->machine, newaddr, size);
+	}
 
-	/*  Warn about unaligned register access:  */
-	if (t & 3)
-		fatal("[ bus_pci_decompose_1: WARNING: reg = 0x%02x ]\n",
-		    t & 0xff);
+	return 1;
 }
 
 
@@ -92,29 +197,20 @@ void bus_pci_decompose_1(uint32_t t, int *bus, int *dev, int *func, int *reg)
  *  bus_pci_data_access():
  *
  *  Reads from or writes to the PCI configuration registers of a device.
+ *  The device was looked up already by bus_pci_setaddr().
  */
 void bus_pci_data_access(struct cpu *cpu, struct pci_data *pci_data,
 	uint64_t *data, int len, int writeflag)
 {
-	struct pci_device *dev;
+	struct pci_device *dev = pci_data->cur_pd;
 	unsigned char *cfg_base;
 	uint64_t x, idata = *data;
-	int i;
-
-	/*  Scan through the list of pci_device entries.  */
-	dev = pci_data->first_device;
-	while (dev != NULL) {
-		if (dev->bus      == pci_data->cur_bus &&
-		    dev->function == pci_data->cur_func &&
-		    dev->device   == pci_data->cur_device)
-			break;
-		dev = dev->next;
-	}
+	int i, reg = pci_data->cur_reg;
 
 	/*  No device? Then return emptiness.  */
 	if (dev == NULL) {
 		if (writeflag == MEM_READ) {
-			if (pci_data->cur_reg == 0)
+			if (reg == 0)
 				*data = (uint64_t) -1;
 			else
 				*data = 0;
@@ -127,18 +223,23 @@ void bus_pci_data_access(struct cpu *cpu, struct pci_data *pci_data,
 
 	/*  Return normal config data, or length data?  */
 	if (pci_data->last_was_write_ffffffff &&
-	    pci_data->cur_reg >= PCI_MAPREG_START &&
-	    pci_data->cur_reg <= PCI_MAPREG_END - 4)
+	    reg >= PCI_MAPREG_START && reg <= PCI_MAPREG_END - 4)
 		cfg_base = dev->cfg_mem_size;
 	else
 		cfg_base = dev->cfg_mem;
 
-	/*  Read data as little-endian:  */
-	x = 0;
-	for (i=len-1; i>=0; i--) {
-		int ofs = pci_data->cur_reg + i;
-		x <<= 8;
-		x |= cfg_base[ofs & (PCI_CFG_MEM_SIZE - 1)];
+	/*  Read data as little-endian, a whole word at a time if possible:  */
+	if (len == sizeof(uint32_t) && (reg & 3) == 0 &&
+	    reg < PCI_CFG_MEM_SIZE) {
+		uint32_t w;
+		memcpy(&w, cfg_base + reg, sizeof(w));
+		x = LE32_TO_HOST(w);
+	} else {
+		x = 0;
+		for (i=len-1; i>=0; i--) {
+			x <<= 8;
+			x |= cfg_base[(reg + i) & (PCI_CFG_MEM_SIZE - 1)];
+		}
 	}
 
 	/*  Register write:  */
@@ -146,31 +247,37 @@ void bus_pci_data_access(struct cpu *cpu, struct pci_data *pci_data,
 		debug("[ bus_pci: write to PCI DATA: data = 0x%08llx ]\n",
 		    (long long)idata);
 		if (idata == 0xffffffffULL &&
-		    pci_data->cur_reg >= PCI_MAPREG_START &&
-		    pci_data->cur_reg <= PCI_MAPREG_END - 4) {
+		    reg >= PCI_MAPREG_START && reg <= PCI_MAPREG_END - 4) {
 			pci_data->last_was_write_ffffffff = 1;
 			return;
 		}
 
-		if (dev->cfg_reg_write == NULL ||
-		    dev->cfg_reg_write(dev, pci_data->cur_reg, *data) == 0) {
-			/*  Print a warning for unhandled writes:  */
-			debug("[ bus_pci: write to PCI DATA: data = 0x%08llx"
-			    " (current value = 0x%08llx); NOT YET"
-			    " SUPPORTED. bus %i, device %i, function %i (%s)"
-			    " register 0x%02x ]\n", (long long)idata,
-			    (long long)x, pci_data->cur_bus,
-			    pci_data->cur_device, pci_data->cur_func,
-			    dev->name, pci_data->cur_reg);
-
-			/*  Special warning, to detect if NetBSD's special
-			    detection of PCI devices fails:  */
-			if (pci_data->cur_reg == PCI_COMMAND_STATUS_REG
-			    && !((*data) & PCI_COMMAND_IO_ENABLE)) {
-				fatal("\n[ NetBSD PCI detection stuff not"
-				    " yet implemented for device '%s' ]\n",
-				    dev->name);
-			}
+		if (dev->cfg_reg_write != NULL &&
+		    dev->cfg_reg_write(dev, reg, *data) != 0)
+			return;
+
+		/*  Base address register rewritten by the guest OS?  */
+		if (len == sizeof(uint32_t) && (reg & 3) == 0 &&
+		    reg >= PCI_MAPREG_START && reg <= PCI_MAPREG_END - 4 &&
+		    bus_pci_mapreg_write(cpu, dev, reg, idata))
+			return;
+
+		/*  Print a warning for unhandled writes:  */
+		debug("[ bus_pci: write to PCI DATA: data = 0x%08llx"
+		    " (current value = 0x%08llx); NOT YET"
+		    " SUPPORTED. bus %i, device %i, function %i (%s)"
+		    " register 0x%02x ]\n", (long long)idata,
+		    (long long)x, pci_data->cur_bus,
+		    pci_data->cur_device, pci_data->cur_func,
+		    dev->name, reg);
+
+		/*  Special warning, to detect if NetBSD's special
+		    detection of PCI devices fails:  */
+		if (reg == PCI_COMMAND_STATUS_REG
+		    && !((*data) & PCI_COMMAND_IO_ENABLE)) {
+			fatal("\n[ NetBSD PCI detection stuff not"
+			    " yet implemented for device '%s' ]\n",
+			    dev->name);
 		}
 		return;
 	}
@@ -183,14 +290,16 @@ void bus_pci_data_access(struct cpu *cpu, struct pci_data *pci_data,
 	debug("[ bus_pci: read from PCI DATA, bus %i, device "
 	    "%i, function %i (%s) register 0x%02x: (len=%i) 0x%08lx ]\n",
 	    pci_data->cur_bus, pci_data->cur_device, pci_data->cur_func,
-	    dev->name, pci_data->cur_reg, len, (long)*data);
+	    dev->name, reg, len, (long)*data);
 }
 
 
 /*
  *  bus_pci_setaddr():
  *
- *  Sets the address in preparation for a PCI register transfer.
+ *  Sets the address in preparation for a PCI register transfer. The device
+ *  lookup is done here, so that repeated data accesses to the same register
+ *  (e.g. sub-word accesses) don't need to decode the address again.
  */
 void bus_pci_setaddr(struct cpu *cpu, struct pci_data *pci_data,
 	int bus, int device, int function, int reg)
@@ -204,6 +313,58 @@ void bus_pci_setaddr(struct cpu *cpu, struct pci_data *pci_data,
 	pci_data->cur_device = device;
 	pci_data->cur_func = function;
 	pci_data->cur_reg = reg;
+	pci_data->cur_pd = bus_pci_lookup(pci_data, bus, device, function);
+}
+
+
+/*
+ *  dev_pci_ecam_access():
+ *
+ *  PCI Express style "Enhanced Configuration Access Mechanism": the entire
+ *  configuration space is memory mapped, 4 KB per function, with the bus,
+ *  device, function, and register encoded directly in the address. Only the
+ *  first PCI_CFG_MEM_SIZE bytes of each function are implemented; the
+ *  extended configuration space reads as zeroes.
+ */
+DEVICE_ACCESS(pci_ecam)
+{
+	struct pci_data *pci_data = (struct pci_data *) extra;
+	int bus, dev, func, reg;
+	int old_bus, old_dev, old_func, old_reg;
+	struct pci_device *old_pd;
+	uint64_t idata = 0, odata = 0;
+
+	if (writeflag == MEM_WRITE)
+		idata = memory_readmax64(cpu, data, len|MEM_PCI_LITTLE_ENDIAN);
+
+	bus  = (relative_addr >> 20) & 0xff;
+	dev  = (relative_addr >> 15) & 0x1f;
+	func = (relative_addr >> 12) & 0x7;
+	reg  =  relative_addr        & 0xfff;
+
+	if (reg + len > PCI_CFG_MEM_SIZE) {
+		if (writeflag == MEM_READ)
+			memset(data, 0, len);
+		return 1;
+	}
+
+	/*  Don't disturb a Mechanism 1 style access in progress:  */
+	old_bus = pci_data->cur_bus; old_dev = pci_data->cur_device;
+	old_func = pci_data->cur_func; old_reg = pci_data->cur_reg;
+	old_pd = pci_data->cur_pd;
+
+	bus_pci_setaddr(cpu, pci_data, bus, dev, func, reg);
+	bus_pci_data_access(cpu, pci_data, writeflag == MEM_READ?
+	    &odata : &idata, len, writeflag);
+
+	pci_data->cur_bus = old_bus; pci_data->cur_device = old_dev;
+	pci_data->cur_func = old_func; pci_data->cur_reg = old_reg;
+	pci_data->cur_pd = old_pd;
+
+	if (writeflag == MEM_READ)
+		memory_writemax64(cpu, data, len|MEM_PCI_LITTLE_ENDIAN, odata);
+
+	return 1;
 }
 
 
@@ -228,30 +389,39 @@ void bus_pci_add(struct machine *machine, struct pci_data *pci_data,
 	/*  Find the PCI device:  */
 	init = pci_lookup_initf(name);
 
+	if (bus < 0 || bus >= PCI_N_BUSES || device < 0 || device > 0x1f ||
+	    function < 0 || function > 7) {
+		fatal("bus_pci_add(): invalid bus %i, device %i, function"
+		    " %i\n", bus, device, function);
+		exit(1);
+	}
+
 	/*  Make sure this bus/device/function number isn't already in use:  */
-	pd = pci_data->first_device;
-	while (pd != NULL) {
-		if (pd->bus == bus && pd->device == device &&
-		    pd->function == function) {
-			fatal("bus_pci_add(): (bus %i, device %i, function"
-			    " %i) already in use\n", bus, device, function);
-			exit(1);
-		}
-		pd = pd->next;
+	if (bus_pci_lookup(pci_data, bus, device, function) != NULL) {
+		fatal("bus_pci_add(): (bus %i, device %i, function"
+		    " %i) already in use\n", bus, device, function);
+		exit(1);
 	}
 
+	if (pci_data->device_table[bus] == NULL)
+		CHECK_ALLOCATION(pci_data->device_table[bus] = (struct
+		    pci_device **) calloc(PCI_N_DEVFNS, sizeof(struct
+		    pci_device *)));
+
 	CHECK_ALLOCATION(pd = (struct pci_device *) malloc(sizeof(struct pci_device)));
 	memset(pd, 0, sizeof(struct pci_device));
 
 	/*  Add the new device first in the PCI bus' chain:  */
 	pd->next = pci_data->first_device;
 	pci_data->first_device = pd;
+	pci_data->device_table[bus][PCI_DEVFN(device, function)] = pd;
 
 	CHECK_ALLOCATION(pd->name = strdup(name));
 	pd->pcibus   = pci_data;
 	pd->bus      = bus;
 	pd->device   = device;
 	pd->function = function;
+	pd->mem      = mem;
 
 	/*
 	 *  Initialize with some default values:
@@ -299,6 +469,8 @@ static void allocate_device_space(struct pci_device *pd,
 		    port | PCI_MAPREG_TYPE_IO);
 		PCI_SET_DATA_SIZE(PCI_MAPREG_START + pd->cur_mapreg_offset,
 		    ((portsize - 1) & ~0xf) | 0xd);
+		if (pd->cur_mapreg_offset / 4 < PCI_N_MAPREGS)
+			pd->mapreg_size[pd->cur_mapreg_offset / 4] = portsize;
 		pd->cur_mapreg_offset += sizeof(uint32_t);
 	}
 
@@ -310,6 +482,8 @@ static void allocate_device_space(struct pci_device *pd,
 		PCI_SET_DATA(PCI_MAPREG_START + pd->cur_mapreg_offset, mem);
 		PCI_SET_DATA_SIZE(PCI_MAPREG_START + pd->cur_mapreg_offset,
 		    ((memsize - 1) & ~0xf) | 0x0);
+		if (pd->cur_mapreg_offset / 4 < PCI_N_MAPREGS)
+			pd->mapreg_size[pd->cur_mapreg_offset / 4] = memsize;
 		pd->cur_mapreg_offset += sizeof(uint32_t);
 	}
 
@@ -386,6 +560,29 @@ struct pci_data *bus_pci_init(struct machine *machine, const char *irq_path,
 
 
 
+/*
+ *  bus_pci_ecam_init():
+ *
+ *  Makes the configuration space of a PCI bus available as PCI Express style
+ *  memory mapped configuration space (1 MB per bus) at baseaddr, in addition
+ *  to whatever controller specific access method is used.
+ */
+void bus_pci_ecam_init(struct machine *machine, struct memory *mem,
+	struct pci_data *pci_data, uint64_t baseaddr, int n_buses)
+{
+	if (n_buses < 1 || n_buses > PCI_N_BUSES) {
+		fatal("bus_pci_ecam_init(): invalid number of buses (%i)\n",
+		    n_buses);
+		exit(1);
+	}
+
+	memory_device_register(mem, "pci_ecam", baseaddr,
+	    (uint64_t) n_buses << 20, dev_pci_ecam_access, pci_data,
+	    DM_DEFAULT, NULL);
+}
+
+
+
 /******************************************************************************
  *                                                                            *
  *  The following is glue code for PCI controllers and devices. The glue      *
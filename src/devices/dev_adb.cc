@@ -50,6 +50,7 @@
 #include "machine.h"
 #include "memory.h"
 #include "misc.h"
+#include "timer.h"
 
 #include "thirdparty/adb_viareg.h"
 
@@ -228,7 +229,7 @@ static void adb_process_cmd(struct cpu *cpu, struct adb_data *d)
 		    d->output_buf[1] == 0x03) {
 			/*  Read RTC date/time:  */
 			struct timeval tv;
-			gettimeofday(&tv, NULL);
+			timer_gettimeofday(&tv);
 			d->input_buf[0] = tv.tv_sec >> 24;
 			d->input_buf[1] = tv.tv_sec >> 16;
 			d->input_buf[2] = tv.tv_sec >>  8;
@@ -93,7 +93,6 @@ DEVICE_ACCESS(cons)
 				if (cpu->machine->register_dump ||
 				    cpu->machine->instruction_trace)
 					debug("'\n");
-				fflush(stdout);
 			}
 		}
         } else {
@@ -45,6 +45,7 @@
 #include "machine.h"
 #include "memory.h"
 #include "misc.h"
+#include "timer.h"
 
 
 /*  #define debug fatal  */
@@ -71,7 +72,7 @@ DEVICE_ACCESS(dreamcast_rtc)
 			debug("[ dreamcast_rtc: Writes are ignored, only "
 			    "reads are supported. ]\n");
 
-		gettimeofday(&tv, NULL);
+		timer_gettimeofday(&tv);
 
 		/*  Offset by 20 years:  */
 		odata = tv.tv_sec + 631152000;
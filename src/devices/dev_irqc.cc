@@ -45,39 +45,14 @@
 #define	N_IRQC_INTERRUPTS	32
 
 struct irqc_data {
-	struct interrupt irq;		/*  Connected to the CPU  */
-
-	int		asserted;	/*  Current CPU irq assertion  */
-
-	uint32_t	status;		/*  Interrupt Status register  */
-	uint32_t	enabled;	/*  Interrupt Enable register  */
+	/*
+	 *  Interrupt Status and Enable registers, and the CPU irq
+	 *  assertion. (See interrupt.h.)
+	 */
+	struct interrupt_mask	mask;
 };
 
 
-void irqc_interrupt_assert(struct interrupt *interrupt)
-{
-	struct irqc_data *d = (struct irqc_data *) interrupt->extra;
-	d->status |= interrupt->line;
-
-	if ((d->status & d->enabled) && !d->asserted) {
-		INTERRUPT_ASSERT(d->irq);
-		d->asserted = 1;
-	}
-}
-
-
-void irqc_interrupt_deassert(struct interrupt *interrupt)
-{
-	struct irqc_data *d = (struct irqc_data *) interrupt->extra;
-	d->status &= ~interrupt->line;
-
-	if (!(d->status & d->enabled) && d->asserted) {
-		INTERRUPT_DEASSERT(d->irq);
-		d->asserted = 0;
-	}
-}
-
-
 DEVICE_ACCESS(irqc)
 {
 	struct irqc_data *d = (struct irqc_data *) extra;
@@ -91,7 +66,7 @@ DEVICE_ACCESS(irqc)
 	case DEV_IRQC_IRQ:
 		/*  Status register:  */
 		if (writeflag == MEM_READ) {
-			odata = d->status;
+			odata = d->mask.status;
 		} else {
 			fatal("[ irqc: WARNING! write to DEV_IRQC_IRQ ]\n");
 		}
@@ -102,17 +77,8 @@ DEVICE_ACCESS(irqc)
 		if (writeflag == MEM_READ) {
 			fatal("[ irqc: WARNING! read from DEV_IRQC_MASK ]\n");
 		} else {
-			int old_assert = d->status & d->enabled;
-			int new_assert;
-
-			d->enabled &= ~(1 << idata);
-
-			new_assert = d->status & d->enabled;
-
-			if (!old_assert && new_assert)
-				INTERRUPT_ASSERT(d->irq);
-			else if (old_assert && !new_assert)
-				INTERRUPT_DEASSERT(d->irq);
+			d->mask.enabled &= ~(1 << idata);
+			interrupt_mask_update(&d->mask);
 		}
 		break;
 
@@ -121,17 +87,8 @@ DEVICE_ACCESS(irqc)
 		if (writeflag == MEM_READ) {
 			fatal("[ irqc: WARNING! read from DEV_IRQC_UNMASK ]\n");
 		} else {
-			int old_assert = d->status & d->enabled;
-			int new_assert;
-
-			d->enabled |= (1 << idata);
-
-			new_assert = d->status & d->enabled;
-
-			if (!old_assert && new_assert)
-				INTERRUPT_ASSERT(d->irq);
-			else if (old_assert && !new_assert)
-				INTERRUPT_DEASSERT(d->irq);
+			d->mask.enabled |= (1 << idata);
+			interrupt_mask_update(&d->mask);
 		}
 		break;
 
@@ -162,28 +119,16 @@ DEVINIT(irqc)
 	memset(d, 0, sizeof(struct irqc_data));
 
 	/*  Connect to the CPU's interrupt pin:  */
-	INTERRUPT_CONNECT(devinit->interrupt_path, d->irq);
+	interrupt_mask_init(&d->mask, devinit->interrupt_path);
 
-	/*  Register the interrupts:  */
+	/*  Register the interrupts. (Note: line contains the _mask_, not the
+	    line number. All interrupts are enabled by default.)  */
 	for (i=0; i<N_IRQC_INTERRUPTS; i++) {
-		struct interrupt templ;
-
 		snprintf(n, sizeof(n), "%s.irqc.%i",
 		    devinit->interrupt_path, i);
-
-		memset(&templ, 0, sizeof(templ));
-		templ.line = 1 << i;		/*  Note: line contains the
-						    _mask_, not line number.  */
-		templ.name = n;
-		templ.extra = d;
-		templ.interrupt_assert = irqc_interrupt_assert;
-		templ.interrupt_deassert = irqc_interrupt_deassert;
-		interrupt_handler_register(&templ);
+		interrupt_mask_register_line(&d->mask, n, 1 << i);
 	}
 
-	/*  Default to all interrupts enabled:  */
-	d->enabled = 0xffffffff;
-
 	memory_device_register(devinit->machine->memory, devinit->name,
 	    devinit->addr, DEV_IRQC_LENGTH, dev_irqc_access, d,
 	    DM_DEFAULT, NULL);
@@ -48,6 +48,31 @@ struct m8820x_data {
 };
 
 
+/*
+ *  m8820x_flush_patc_entry():
+ *
+ *  Invalidate PATC entry i, if it is valid and its supervisor bit matches.
+ *  (The entry stays linked in its hash chain; it is unlinked when the entry
+ *  is reused.)
+ */
+static void m8820x_flush_patc_entry(struct m8820x_cmmu *cmmu, size_t i,
+	uint32_t super)
+{
+	uint32_t v = cmmu->patc_v_and_control[i];
+	uint32_t p = cmmu->patc_p_and_supervisorbit[i];
+
+	/*  Already invalid? Then skip this entry.  */
+	if (!(v & PG_V))
+		return;
+
+	/*  Super/user mismatch? Then skip the entry.  */
+	if ((p & M8820X_PATC_SUPERVISOR_BIT) != super)
+		return;
+
+	cmmu->patc_v_and_control[i] = v & ~PG_V;
+}
+
+
 /*
  *  m8820x_command():
  *
@@ -55,7 +80,8 @@ struct m8820x_data {
  */
 static void m8820x_command(struct cpu *cpu, struct m8820x_data *d)
 {
-	uint32_t *regs = cpu->cd.m88k.cmmu[d->cmmu_nr]->reg;
+	struct m8820x_cmmu *cmmu = cpu->cd.m88k.cmmu[d->cmmu_nr];
+	uint32_t *regs = cmmu->reg;
 	int cmd = regs[CMMU_SCR];
 	uint32_t sar = regs[CMMU_SAR];
 	size_t i;
@@ -92,28 +118,18 @@ static void m8820x_command(struct cpu *cpu, struct m8820x_data *d)
 		/*  TODO: Don't invalidate EVERYTHING like this!  */
 		cpu->invalidate_translation_caches(cpu, 0, INVALIDATE_ALL);
 
-		for (i=0; i<N_M88200_PATC_ENTRIES; i++) {
-			uint32_t v = cpu->cd.m88k.cmmu[d->cmmu_nr]
-			    ->patc_v_and_control[i];
-			uint32_t p = cpu->cd.m88k.cmmu[d->cmmu_nr]
-			    ->patc_p_and_supervisorbit[i];
-
-			/*  Already invalid? Then skip this entry.  */
-			if (!(v & PG_V))
-				continue;
-
-			/*  Super/user mismatch? Then skip the entry.  */
-			if ((p & M8820X_PATC_SUPERVISOR_BIT) != super)
-				continue;
-
-			/*  If not all pages are to be invalidated, there
-			    must be a virtual address match:  */
-			if (!all && (sar & 0xfffff000) != (v & 0xfffff000))
-				continue;
-
-			/*  Finally, invalidate the entry:  */
-			cpu->cd.m88k.cmmu[d->cmmu_nr]->patc_v_and_control[i]
-			    = v & ~PG_V;
+		if (all) {
+			for (i=0; i<N_M88200_PATC_ENTRIES; i++)
+				m8820x_flush_patc_entry(cmmu, i, super);
+		} else {
+			/*  Only entries in the hash chain for the page
+			    can possibly match:  */
+			for (i = cmmu->patc_hash[M8820X_PATC_HASH(sar)];
+			    i != 0; i = cmmu->patc_hash_next[i - 1])
+				if ((sar & 0xfffff000) == (cmmu->
+				    patc_v_and_control[i - 1] & 0xfffff000))
+					m8820x_flush_patc_entry(cmmu,
+					    i - 1, super);
 		}
 
 		break;
@@ -195,6 +211,9 @@ DEVICE_ACCESS(m8820x)
 			old = batc[i];
 			batc[i] = idata;
 			if (old != idata) {
+				m8820x_batc_update(
+				    cpu->cd.m88k.cmmu[d->cmmu_nr]);
+
 				/*  TODO: Don't invalidate everything?  */
 				cpu->invalidate_translation_caches(
 				    cpu, 0, INVALIDATE_ALL);
@@ -187,7 +187,7 @@ static void mc146818_update_time(struct mc_data *d)
 	struct tm *tmp;
 	time_t timet;
 
-	timet = time(NULL);
+	timet = timer_time();
 	tmp = gmtime(&timet);
 
 	d->reg[4 * MC_SEC]   = tmp->tm_sec;
@@ -359,7 +359,7 @@ DEVICE_ACCESS(mc146818)
 	 *  in REGA to be updated once a second.
 	 */
 	if (relative_addr == MC_REGA*4 || relative_addr == MC_REGC*4) {
-		timet = time(NULL);
+		timet = timer_time();
 		tmp = gmtime(&timet);
 		d->reg[MC_REGC * 4] &= ~MC_REGC_UF;
 		if (tmp->tm_sec != d->previous_second) {
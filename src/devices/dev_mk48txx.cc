@@ -42,6 +42,7 @@
 #include "machine.h"
 #include "memory.h"
 #include "misc.h"
+#include "timer.h"
 
 #include "thirdparty/mk48txxreg.h"
 
@@ -60,7 +61,7 @@ void mk48txx_update_regs(struct mk48txx_data *d)
 	struct tm *tmp;
 	time_t timet;
 
-	timet = time(NULL);
+	timet = timer_time();
 	tmp = gmtime(&timet);
 
 	d->reg[MK48T08_CLKOFF + MK48TXX_ISEC] = BCD(tmp->tm_sec);
@@ -149,6 +149,7 @@ DEVINIT(mvme187)
 	cmmu->reg[CMMU_IDR] = (M88200_ID << 21) | (9 << 16);
 	cmmu->batc[8] = BATC8;
 	cmmu->batc[9] = BATC9;
+	m8820x_batc_update(cmmu);
 	snprintf(tmpstr, sizeof(tmpstr),
 	    "m8820x addr=0x%x addr2=1", MVME187_SBC_CMMU_D);
 	device_add(devinit->machine, tmpstr);
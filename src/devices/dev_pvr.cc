@@ -35,23 +35,18 @@
  *
  *	x)  Change resolution during runtime (PAL/NTSC/???)
  *
- *	x)  Lots of work on the 3D "Tile Accelerator" engine.
- *		Recognize commands and turn into OpenGL or similar
- *		commands on the host?
- *		Color clipping.
- *		Wire-frame when running on a host without XGL?
- *
- *  Multiple lists of various kinds (6?).
- *  Lists growing downwards!
- *  Pixel clip for rendering.
- *  Real Rendering, using OpenGL if possible.
- *  Tile bins... with 6 pointers for each tile (?)
- *  PVR DMA.
+ *	x)  More work on the 3D "Tile Accelerator" engine:
+ *		Modifier volumes, fog, texture filtering, and mipmap
+ *		selection in the software renderer (see pvr_render()).
+ *		The TA does not write real object lists and parameter
+ *		buffers to VRAM; triangles are kept on the host instead.
+ *		User tile clip.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #include "cpu.h"
 #include "device.h"
@@ -65,6 +60,11 @@
 #include "thirdparty/dreamcast_pvr.h"
 #include "thirdparty/dreamcast_sysasicvar.h"
 
+#ifdef WITH_PTHREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 
 #define	TA_DEBUG
 #define debug fatal
@@ -88,6 +88,132 @@
 #define	PVR_VBLANK_HZ		60.0
 #define	PVR_MARGIN		16
 
+/*  Tile Accelerator lists:  */
+#define	PVR_LIST_OPAQUE		0
+#define	PVR_LIST_OPAQUE_MOD	1
+#define	PVR_LIST_TRANS		2
+#define	PVR_LIST_TRANS_MOD	3
+#define	PVR_LIST_PUNCHTHROUGH	4
+#define	PVR_N_LISTS		5
+
+/*  The renderer works on 32 x 32 pixel tiles, just like the real PVR:  */
+#define	PVR_TILE_SIZE		32
+#define	PVR_MAX_RENDER_THREADS	8
+
+/*  TA Parameter Control Word:  */
+#define	TA_PCW_PARA_TYPE(pcw)	((pcw) >> 29)
+#define	  TA_PARA_END_OF_LIST	  0
+#define	  TA_PARA_USER_TILE_CLIP  1
+#define	  TA_PARA_OBJECT_LIST_SET 2
+#define	  TA_PARA_POLYGON	  4
+#define	  TA_PARA_SPRITE	  5
+#define	  TA_PARA_VERTEX	  7
+#define	TA_PCW_END_OF_STRIP	0x10000000
+#define	TA_PCW_LIST_TYPE(pcw)	(((pcw) >> 24) & 7)
+#define	TA_PCW_VOLUME		0x00000040
+#define	TA_PCW_COL_TYPE(pcw)	(((pcw) >> 4) & 3)
+#define	  TA_COL_PACKED		  0
+#define	  TA_COL_FLOAT		  1
+#define	  TA_COL_INTENSITY1	  2
+#define	  TA_COL_INTENSITY2	  3
+#define	TA_PCW_TEXTURE		0x00000008
+#define	TA_PCW_OFFSET		0x00000004
+#define	TA_PCW_UV16		0x00000001
+
+/*  ISP/TSP Instruction Word:  */
+#define	ISP_DEPTH_MODE(isp)	((isp) >> 29)
+#define	ISP_CULL_MODE(isp)	(((isp) >> 27) & 3)
+#define	ISP_ZWRITE_DISABLE	0x04000000
+#define	ISP_TEXTURE		0x02000000
+#define	ISP_OFFSET		0x01000000
+#define	ISP_GOURAUD		0x00800000
+#define	ISP_UV16		0x00400000
+
+/*  TSP Instruction Word:  */
+#define	TSP_SRC_ALPHA(tsp)	((tsp) >> 29)
+#define	TSP_DST_ALPHA(tsp)	(((tsp) >> 26) & 7)
+#define	TSP_USE_ALPHA		0x00100000
+#define	TSP_IGNORE_TEX_ALPHA	0x00080000
+#define	TSP_FLIP_U		0x00040000
+#define	TSP_FLIP_V		0x00020000
+#define	TSP_CLAMP_U		0x00010000
+#define	TSP_CLAMP_V		0x00008000
+#define	TSP_SHADING(tsp)	(((tsp) >> 6) & 3)
+#define	  TSP_SHADING_DECAL	  0
+#define	  TSP_SHADING_MODULATE	  1
+#define	  TSP_SHADING_DECAL_ALPHA 2
+#define	  TSP_SHADING_MODULATE_ALPHA 3
+#define	TSP_U_SIZE_SHIFT(tsp)	((((tsp) >> 3) & 7) + 3)
+#define	TSP_V_SIZE_SHIFT(tsp)	(((tsp) & 7) + 3)
+
+/*  Texture Control Word:  */
+#define	TCW_MIPMAP		0x80000000
+#define	TCW_VQ			0x40000000
+#define	TCW_PIXEL_FORMAT(tcw)	(((tcw) >> 27) & 7)
+#define	  TCW_ARGB1555		  0
+#define	  TCW_RGB565		  1
+#define	  TCW_ARGB4444		  2
+#define	  TCW_YUV422		  3
+#define	  TCW_BUMP		  4
+#define	  TCW_PAL4		  5
+#define	  TCW_PAL8		  6
+#define	TCW_NON_TWIDDLED	0x04000000
+#define	TCW_STRIDE		0x02000000
+#define	TCW_PAL4_SELECT(tcw)	(((tcw) >> 21) & 0x3f)
+#define	TCW_PAL8_SELECT(tcw)	(((tcw) >> 25) & 0x3)
+#define	TCW_ADDR(tcw)		(((tcw) & 0x1fffff) << 3)
+
+struct pvr_vertex {
+	float			x, y, z;	/*  z is 1/w  */
+	float			u, v;
+	float			base[4];	/*  A, R, G, B  (0.0 .. 1.0)  */
+	float			offset[4];
+};
+
+/*  Interpolated attributes:  */
+#define	PVR_ATTR_Z		0
+#define	PVR_ATTR_UZ		1	/*  u * z  */
+#define	PVR_ATTR_VZ		2	/*  v * z  */
+#define	PVR_ATTR_BASE		3	/*  4 values  */
+#define	PVR_ATTR_OFFSET		7	/*  4 values  */
+#define	PVR_N_ATTR		11
+
+/*
+ *  A triangle, ready to be rasterized: Pixels where all three edge functions
+ *  edge[e][0] * x + edge[e][1] * y + edge[e][2] are >= 0 are inside, and each
+ *  attribute k is attr0[k] + dadx[k] * x + dady[k] * y.
+ */
+struct pvr_triangle {
+	float			edge[3][3];
+	float			attr0[PVR_N_ATTR];
+	float			dadx[PVR_N_ATTR];
+	float			dady[PVR_N_ATTR];
+	float			x1, y1, x2, y2;	/*  bounding box  */
+	uint32_t		isp, tsp, tcw;
+	int			list;
+	int			seq;		/*  for stable sorting  */
+	float			sort_z;
+};
+
+struct pvr_list {
+	struct pvr_triangle	*tri;
+	int			n_tris;
+	int			max_tris;
+};
+
+/*  Parameters of the frame being rendered, shared by all tiles:  */
+struct pvr_render_job {
+	uint32_t		fb_base;
+	uint32_t		cfg;
+	int			mode;
+	int			bytes_per_pixel;
+	int			stride;
+	int			tiles_x, tiles_y;
+	int			clip_x1, clip_x2, clip_y1, clip_y2;
+	uint32_t		bg_color;
+	float			bg_z;
+};
+
 struct pvr_data {
 	struct vfb_data		*fb;
 	int			fb_update_x1;
@@ -130,6 +256,41 @@ struct pvr_data {
 	/*  Tile Accelerator Command:  */
 	uint32_t		ta[64 / sizeof(uint32_t)];
 
+	/*  Tile Accelerator state:  */
+	int			ta_list;	/*  -1 = no list open  */
+	uint32_t		ta_pcw, ta_isp, ta_tsp, ta_tcw;
+	float			ta_face_color[4];
+	float			ta_face_offset[4];
+	int			ta_half_pending;
+	uint32_t		ta_first_half[32 / sizeof(uint32_t)];
+	int			ta_strip_len;
+	struct pvr_vertex	ta_strip[2];
+	struct pvr_list		list[PVR_N_LISTS];
+
+	/*  Renderer: triangles binned per tile  */
+	int			*bin_start;
+	int			n_bins;
+	struct pvr_triangle	**bin;
+	int			max_bin;
+
+	/*  Renderer: the current frame, and which tiles changed the fb  */
+	struct pvr_render_job	job;
+	uint8_t			*tile_dirty;
+	int			n_tile_dirty;
+
+#ifdef WITH_PTHREADS
+	/*  Renderer: tile worker threads (started at the first render)  */
+	int			n_workers;	/*  -1 = not yet started  */
+	pthread_t		*workers;
+	pthread_mutex_t		render_lock;
+	pthread_cond_t		render_start;
+	pthread_cond_t		render_done;
+	int			render_generation;
+	int			render_next_tile;
+	int			render_n_tiles;
+	int			render_busy;
+#endif
+
 	uint8_t			*vram;
 
 	/*  DMA registers:  */
@@ -145,21 +306,51 @@ struct pvr_data_alt {
 #define	DEFAULT_WRITE	REG(relative_addr) = idata;
 
 
-/*  Forward declaration.  */
+/*  Forward declarations.  */
 DEVICE_ACCESS(pvr_ta);
+void pvr_extend_update_region(struct pvr_data *d, uint64_t low,
+	uint64_t high);
+
+
+/*
+ *  pvr_vram_alt_write():
+ *
+ *  Writes to the 64-bit (interleaved) view of VRAM are converted into
+ *  writes to the real (32-bit) VRAM.
+ */
+static void pvr_vram_alt_write(struct pvr_data *d, uint64_t relative_addr,
+	unsigned char *data, size_t len)
+{
+	size_t i;
+
+	for (i=0; i<len; i++) {
+		int addr = relative_addr + i;
+		addr = ((addr & 4) << 20) | (addr & 3)
+		    | ((addr & 0x7ffff8) >> 1);
+		d->vram[addr % VRAM_SIZE] = data[i];
+	}
+}
 
 
+/*
+ *  pvr_dma_transfer():
+ *
+ *  PVR DMA uses channel 2 of the SH4 DMAC, in single address mode. The
+ *  destination is either the Tile Accelerator, or texture memory (through
+ *  the 64-bit path, since only LMMODE0 = LMMODE1 = 0 is implemented).
+ *
+ *  Whenever the source is in RAM, data is fed to the destination directly
+ *  from host memory, instead of going through memory_rw() once per word.
+ */
 void pvr_dma_transfer(struct cpu *cpu, struct pvr_data *d)
 {
-	const int channel = 3;
+	const int channel = 2;
 	uint32_t sar = cpu->cd.sh.dmac_sar[channel] & 0x1fffffff;
-	uint32_t dar = cpu->cd.sh.dmac_dar[channel] & 0x1fffffff;
-	uint32_t count = cpu->cd.sh.dmac_tcr[channel] & 0x1fffffff;
+	uint32_t dar = d->dma_reg[PVR_ADDR / sizeof(uint32_t)];
 	uint32_t chcr = cpu->cd.sh.dmac_chcr[channel];
-	int transmit_size = 1;
-	int src_delta = 0, dst_delta = 0;
-	int cause_interrupt = chcr & CHCR_IE;
-        
+	uint32_t count;
+	int transmit_size, src_delta, dst_delta;
+
 	/*  DMAC not enabled?  */
 	if (!(chcr & CHCR_TD)) {
 		fatal("pvr_dma_transfer: SH4 dma not enabled?\n");
@@ -167,92 +358,69 @@ void pvr_dma_transfer(struct cpu *cpu, struct pvr_data *d)
 	}
 
 	/*  Transfer End already set? Then don't transfer again.  */
-	if (chcr & CHCR_TE)
+	if (!sh4_dmac_setup(cpu, channel, &count, &transmit_size,
+	    &src_delta, &dst_delta))
 		return;
 
-	/*  Special case: 0 means 16777216:  */
-	if (count == 0)
-		count = 16777216;
-
-	switch (chcr & CHCR_TS) {
-	case CHCR_TS_8BYTE: transmit_size = 8; break;
-	case CHCR_TS_1BYTE: transmit_size = 1; break;
-	case CHCR_TS_2BYTE: transmit_size = 2; break;
-	case CHCR_TS_4BYTE: transmit_size = 4; break;
-	case CHCR_TS_32BYTE: transmit_size = 32; break;
-	default: fatal("Unimplemented transmit size?! CHCR[%i] = 0x%08x\n",
-	    channel, chcr);
-	exit(1);
-	}
-
-	switch (chcr & CHCR_DM) {
-	case CHCR_DM_FIXED:       dst_delta = 0; break;
-	case CHCR_DM_INCREMENTED: dst_delta = 1; break;
-	case CHCR_DM_DECREMENTED: dst_delta = -1; break;
-	default: fatal("Unimplemented destination delta?! CHCR[%i] = 0x%08x\n",
-	    channel, chcr);
-	exit(1);
+	if ((chcr & CHCR_RS) != 0x200) {
+		fatal("Unimplemented SH4 RS DMAC: 0x%08x (PVR)\n",
+		    (int) (chcr & CHCR_RS));
+		exit(1);
 	}
 
-	switch (chcr & CHCR_SM) {
-	case CHCR_SM_FIXED:       src_delta = 0; break;
-	case CHCR_SM_INCREMENTED: src_delta = 1; break;
-	case CHCR_SM_DECREMENTED: src_delta = -1; break;
-	default: fatal("Unimplemented source delta?! CHCR[%i] = 0x%08x\n",
-	    channel, chcr);
-	exit(1);
+	if (dar != 0x10000000 && (dar < 0x11000000 || dar >= 0x12000000) &&
+	    (dar < 0x13000000 || dar >= 0x14000000)) {
+		fatal("[ pvr_dma: TODO: DMA to dar=%08x ]\n", (int) dar);
+		sh4_dmac_transfer_end(cpu, channel, sar, dar);
+		return;
 	}
 
-	src_delta *= transmit_size;
-	dst_delta *= transmit_size;
-
-	switch (chcr & CHCR_RS) {
-	case 0x200:
-		dar = d->dma_reg[PVR_ADDR / sizeof(uint32_t)];
-
-		if (dar != 0x10000000) {
-			fatal("[TODO: DMA to non-TA? dar=%08x\n", (int)dar);
-			cpu->cd.sh.dmac_chcr[channel] |= CHCR_TE;
-			break;
-		}
-
-		while (count > 0) {
-			unsigned char buf[32];
-			int ofs;
-			size_t chunksize = transmit_size;
+	while (count > 0) {
+		unsigned char buf[32];
+		unsigned char *src = NULL;
+		size_t ofs, len = (size_t) count * transmit_size;
+		size_t chunksize = transmit_size;
 
-			if (chunksize > sizeof(uint32_t))
-				chunksize = sizeof(uint32_t);
+		if (chunksize > sizeof(uint32_t))
+			chunksize = sizeof(uint32_t);
 
-			for (ofs = 0; ofs < transmit_size; ofs += chunksize) {
-				cpu->memory_rw(cpu, cpu->mem, sar + ofs, buf,
-				    chunksize, MEM_READ, NO_EXCEPTIONS | PHYSICAL);
+		if (src_delta == transmit_size)
+			src = memory_paddr_to_hostrange(cpu->mem, sar,
+			    MEM_READ, &len);
 
-				dev_pvr_ta_access(cpu, cpu->mem, ofs, buf, chunksize,
-				    MEM_WRITE, d);
+		len -= len % transmit_size;
 
-				/*  cpu->memory_rw(cpu, cpu->mem, dar + ofs, buf,
-				    chunksize, MEM_WRITE, NO_EXCEPTIONS | PHYSICAL);  */
-			}
+		if (src == NULL || len == 0) {
+			/*  Not in RAM: read one unit at a time.  */
+			for (ofs = 0; ofs < (size_t) transmit_size;
+			    ofs += chunksize)
+				cpu->memory_rw(cpu, cpu->mem, sar + ofs,
+				    buf + ofs, chunksize, MEM_READ,
+				    NO_EXCEPTIONS | PHYSICAL);
 
-			count --;
-			sar += src_delta;
+			src = buf;
+			len = transmit_size;
 		}
 
-		/*  Transfer End:  */
-		cpu->cd.sh.dmac_chcr[channel] |= CHCR_TE;
+		if (dar == 0x10000000) {
+			/*  Tile Accelerator:  */
+			for (ofs = 0; ofs < len; ofs += chunksize)
+				dev_pvr_ta_access(cpu, cpu->mem,
+				    ofs % transmit_size, src + ofs,
+				    chunksize, MEM_WRITE, d);
+		} else {
+			/*  Texture memory, 64-bit path:  */
+			pvr_vram_alt_write(d, dar & 0xffffff, src, len);
+			dar += len;
+		}
 
-		break;
-	default:
-		fatal("Unimplemented SH4 RS DMAC: 0x%08x (PVR)\n",
-		    (int) (chcr & CHCR_RS));
-		exit(1);
+		count -= len / transmit_size;
+		sar += src_delta * (len / transmit_size);
 	}
 
-	if (cause_interrupt) {
-		fatal("TODO: pvr sh4 dmac interrupt!\n");
-		exit(1);
-	}
+	sh4_dmac_transfer_end(cpu, channel, sar, dar);
+
+	SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_PVR_DMA);
 }
 
 
@@ -464,97 +632,1279 @@ void pvr_geometry_updated(struct pvr_data *d)
 }
 
 
-/*  Ugly quick-hack:  */
-static void line(struct pvr_data *d, int x1, int y1, int x2, int y2)
+/*
+ *  pvr_ta_float():
+ *
+ *  Interpret a 32-bit word written to the TA as an IEEE single.
+ */
+static float pvr_ta_float(uint32_t x)
+{
+	struct ieee_float_value f;
+	ieee_interpret_float_value(x, &f, IEEE_FMT_S);
+	return f.f;
+}
+
+
+/*  Convert a packed ARGB8888 color to floats:  */
+static void pvr_unpack_color(uint32_t c, float *color)
+{
+	color[0] = (c >> 24) / 255.0;
+	color[1] = ((c >> 16) & 255) / 255.0;
+	color[2] = ((c >> 8) & 255) / 255.0;
+	color[3] = (c & 255) / 255.0;
+}
+
+
+/*  Face color multiplied by an intensity value:  */
+static void pvr_intensity_color(float *face, float intensity, float *color)
+{
+	color[0] = face[0];
+	color[1] = face[1] * intensity;
+	color[2] = face[2] * intensity;
+	color[3] = face[3] * intensity;
+}
+
+
+/*
+ *  pvr_ta_list_type():
+ *
+ *  Returns the list which a parameter belongs to. The list type is only
+ *  taken from the first global parameter after an End of List.
+ */
+static int pvr_ta_list_type(struct pvr_data *d, uint32_t pcw)
+{
+	if (d->ta_list >= 0)
+		return d->ta_list;
+
+	return TA_PCW_LIST_TYPE(pcw);
+}
+
+
+/*
+ *  pvr_ta_vertex_type():
+ *
+ *  Returns the vertex parameter type (0..14) for polygons started by a
+ *  global parameter with Parameter Control Word pcw.
+ */
+static int pvr_ta_vertex_type(uint32_t pcw)
+{
+	int col_type = TA_PCW_COL_TYPE(pcw);
+	int uv16 = pcw & TA_PCW_UV16;
+
+	if (pcw & TA_PCW_VOLUME) {
+		if (!(pcw & TA_PCW_TEXTURE))
+			return col_type == TA_COL_PACKED? 9 : 10;
+		if (col_type == TA_COL_PACKED || col_type == TA_COL_FLOAT)
+			return uv16? 12 : 11;
+		return uv16? 14 : 13;
+	}
+
+	if (!(pcw & TA_PCW_TEXTURE)) {
+		switch (col_type) {
+		case TA_COL_PACKED:	return 0;
+		case TA_COL_FLOAT:	return 1;
+		default:		return 2;
+		}
+	}
+
+	switch (col_type) {
+	case TA_COL_PACKED:	return uv16? 4 : 3;
+	case TA_COL_FLOAT:	return uv16? 6 : 5;
+	default:		return uv16? 8 : 7;
+	}
+}
+
+
+/*
+ *  pvr_ta_param_is_64_bytes():
+ *
+ *  Most TA parameters are 32 bytes long, but some global parameters and
+ *  some vertex parameters are 64 bytes. The second half may be written
+ *  either to the second half of the TA area, or (via store queues or DMA)
+ *  to the start of the TA area again.
+ */
+static int pvr_ta_param_is_64_bytes(struct pvr_data *d, uint32_t pcw)
+{
+	int list = pvr_ta_list_type(d, pcw);
+	int modifier = list == PVR_LIST_OPAQUE_MOD || list == PVR_LIST_TRANS_MOD;
+
+	switch (TA_PCW_PARA_TYPE(pcw)) {
+
+	case TA_PARA_POLYGON:
+		if (modifier)
+			return 0;
+		return TA_PCW_COL_TYPE(pcw) == TA_COL_INTENSITY1 &&
+		    (pcw & (TA_PCW_VOLUME | TA_PCW_OFFSET));
+
+	case TA_PARA_VERTEX:
+		if (modifier ||
+		    TA_PCW_PARA_TYPE(d->ta_pcw) == TA_PARA_SPRITE)
+			return 1;
+		switch (pvr_ta_vertex_type(d->ta_pcw)) {
+		case 5: case 6: case 11: case 12: case 13: case 14:
+			return 1;
+		}
+		return 0;
+	}
+
+	return 0;
+}
+
+
+/*
+ *  pvr_ta_global():
+ *
+ *  Handle a Polygon or Sprite global parameter. This sets the ISP/TSP
+ *  instruction words and texture control word for the vertices that follow.
+ */
+static void pvr_ta_global(struct pvr_data *d, uint32_t *param)
+{
+	uint32_t pcw = param[0];
+
+	if (d->ta_list < 0)
+		d->ta_list = TA_PCW_LIST_TYPE(pcw);
+
+	d->ta_pcw = pcw;
+	d->ta_isp = param[1];
+	d->ta_tsp = param[2];
+	d->ta_tcw = param[3];
+	d->ta_strip_len = 0;
+
+	if (TA_PCW_PARA_TYPE(pcw) == TA_PARA_SPRITE) {
+		/*  Sprites: packed base and offset colors.  */
+		pvr_unpack_color(param[4], d->ta_face_color);
+		pvr_unpack_color(param[5], d->ta_face_offset);
+		return;
+	}
+
+	if (TA_PCW_COL_TYPE(pcw) != TA_COL_INTENSITY1)
+		return;
+
+	if (pcw & (TA_PCW_VOLUME | TA_PCW_OFFSET)) {
+		/*  64 bytes: face color and face offset color.  */
+		int i;
+		for (i=0; i<4; i++) {
+			d->ta_face_color[i] = pvr_ta_float(param[8 + i]);
+			d->ta_face_offset[i] = pvr_ta_float(param[12 + i]);
+		}
+	} else {
+		int i;
+		for (i=0; i<4; i++)
+			d->ta_face_color[i] = pvr_ta_float(param[4 + i]);
+	}
+}
+
+
+/*
+ *  pvr_add_triangle():
+ *
+ *  Add a triangle to the current list, unless it is culled. The edge
+ *  functions and attribute gradients are calculated once here, so that
+ *  each tile the triangle covers can use them directly.
+ */
+static void pvr_add_triangle(struct pvr_data *d, struct pvr_vertex *v0,
+	struct pvr_vertex *v1, struct pvr_vertex *v2)
+{
+	struct pvr_list *list = &d->list[d->ta_list];
+	struct pvr_vertex *p[3], *flat = v2;
+	struct pvr_triangle *t;
+	float val[3][PVR_N_ATTR];
+	float area = (v1->x - v0->x) * (v2->y - v0->y) -
+	    (v2->x - v0->x) * (v1->y - v0->y);
+	int e, i, k;
+
+	switch (ISP_CULL_MODE(d->ta_isp)) {
+	case 2:	if (area < 0)		/*  Cull if negative  */
+			return;
+		break;
+	case 3:	if (area > 0)		/*  Cull if positive  */
+			return;
+		break;
+	}
+
+	/*  Zero area triangles are never visible.  */
+	if (!(area > 0 || area < 0))
+		return;
+
+	if (list->n_tris >= list->max_tris) {
+		list->max_tris = list->max_tris == 0? 1024 :
+		    list->max_tris * 2;
+		CHECK_ALLOCATION(list->tri = (struct pvr_triangle *)
+		    realloc(list->tri, list->max_tris *
+		    sizeof(struct pvr_triangle)));
+	}
+
+	t = &list->tri[list->n_tris];
+	t->isp = d->ta_isp;
+	t->tsp = d->ta_tsp;
+	t->tcw = d->ta_tcw;
+	t->list = d->ta_list;
+	t->seq = list->n_tris;
+	t->sort_z = (v0->z + v1->z + v2->z) / 3;
+
+	/*  Reorder the vertices so that the area is positive:  */
+	p[0] = v0;
+	if (area > 0) {
+		p[1] = v1; p[2] = v2;
+	} else {
+		p[1] = v2; p[2] = v1;
+		area = -area;
+	}
+
+	t->x1 = t->x2 = p[0]->x;
+	t->y1 = t->y2 = p[0]->y;
+
+	for (i=0; i<3; i++) {
+		struct pvr_vertex *a = p[i], *b = p[(i + 1) % 3];
+		struct pvr_vertex *c = t->isp & ISP_GOURAUD? a : flat;
+
+		t->edge[i][0] = -(b->y - a->y);
+		t->edge[i][1] = b->x - a->x;
+		t->edge[i][2] = -(t->edge[i][1] * a->y) - t->edge[i][0] * a->x;
+
+		if (a->x < t->x1)  t->x1 = a->x;
+		if (a->x > t->x2)  t->x2 = a->x;
+		if (a->y < t->y1)  t->y1 = a->y;
+		if (a->y > t->y2)  t->y2 = a->y;
+
+		val[i][PVR_ATTR_Z] = a->z;
+		val[i][PVR_ATTR_UZ] = a->u * a->z;
+		val[i][PVR_ATTR_VZ] = a->v * a->z;
+		for (e=0; e<4; e++) {
+			val[i][PVR_ATTR_BASE + e] = c->base[e];
+			val[i][PVR_ATTR_OFFSET + e] = c->offset[e];
+		}
+	}
+
+	for (k=0; k<PVR_N_ATTR; k++) {
+		float d1 = val[1][k] - val[0][k], d2 = val[2][k] - val[0][k];
+
+		t->dadx[k] = (d1 * (p[2]->y - p[0]->y) -
+		    d2 * (p[1]->y - p[0]->y)) / area;
+		t->dady[k] = (d2 * (p[1]->x - p[0]->x) -
+		    d1 * (p[2]->x - p[0]->x)) / area;
+		t->attr0[k] = val[0][k] - t->dadx[k] * p[0]->x -
+		    t->dady[k] * p[0]->y;
+	}
+
+	list->n_tris ++;
+}
+
+
+/*
+ *  pvr_ta_sprite():
+ *
+ *  A sprite is a quad with corners A, B, C, and D, where D is calculated
+ *  from the other three. It is drawn as two triangles.
+ */
+static void pvr_ta_sprite(struct pvr_data *d, uint32_t *param)
+{
+	struct pvr_vertex v[4];
+	int i;
+
+	memset(v, 0, sizeof(v));
+
+	for (i=0; i<3; i++) {
+		v[i].x = pvr_ta_float(param[1 + i*3]);
+		v[i].y = pvr_ta_float(param[2 + i*3]);
+		v[i].z = pvr_ta_float(param[3 + i*3]);
+		v[i].u = pvr_ta_float(param[13 + i] & 0xffff0000);
+		v[i].v = pvr_ta_float(param[13 + i] << 16);
+	}
+
+	v[3].x = pvr_ta_float(param[10]);
+	v[3].y = pvr_ta_float(param[11]);
+	v[3].z = v[0].z + v[2].z - v[1].z;
+	v[3].u = v[0].u + v[2].u - v[1].u;
+	v[3].v = v[0].v + v[2].v - v[1].v;
+
+	for (i=0; i<4; i++) {
+		memcpy(v[i].base, d->ta_face_color, sizeof(v[i].base));
+		memcpy(v[i].offset, d->ta_face_offset, sizeof(v[i].offset));
+	}
+
+	pvr_add_triangle(d, &v[0], &v[1], &v[2]);
+	pvr_add_triangle(d, &v[0], &v[2], &v[3]);
+}
+
+
+/*
+ *  pvr_ta_vertex():
+ *
+ *  Handle a vertex parameter. Vertices form triangle strips; the strip is
+ *  ended by a vertex with the End of Strip bit set.
+ */
+static void pvr_ta_vertex(struct pvr_data *d, uint32_t *param)
 {
-	int fb_base = REG(PVRREG_FB_RENDER_ADDR1);
+	struct pvr_vertex v;
+	int list = d->ta_list;
 	int i;
-	for (i=0; i<256; i++) {
-		int px = (i * x2 + (256-i) * x1) >> 8;
-		int py = (i * y2 + (256-i) * y1) >> 8;
-		if (px > 0 && py > 0 && px < d->xsize && py < d->ysize) {
-			int ofs = fb_base + (px + py * d->xsize) *
-                            d->bytes_per_pixel;
-			d->vram[(ofs+0) % VRAM_SIZE] = 255;
-			d->vram[(ofs+1) % VRAM_SIZE] = 255;
+
+	if (list == PVR_LIST_OPAQUE_MOD || list == PVR_LIST_TRANS_MOD) {
+		/*  TODO: Modifier volumes.  */
+		return;
+	}
+
+	if (list < 0) {
+		fatal("[ pvr_ta: vertex parameter outside of a list ]\n");
+		return;
+	}
+
+	if (TA_PCW_PARA_TYPE(d->ta_pcw) == TA_PARA_SPRITE) {
+		pvr_ta_sprite(d, param);
+		return;
+	}
+
+	memset(&v, 0, sizeof(v));
+	v.x = pvr_ta_float(param[1]);
+	v.y = pvr_ta_float(param[2]);
+	v.z = pvr_ta_float(param[3]);
+
+	switch (pvr_ta_vertex_type(d->ta_pcw)) {
+	case 0:	pvr_unpack_color(param[6], v.base);
+		break;
+	case 1:	for (i=0; i<4; i++)
+			v.base[i] = pvr_ta_float(param[4 + i]);
+		break;
+	case 2:	pvr_intensity_color(d->ta_face_color,
+		    pvr_ta_float(param[6]), v.base);
+		break;
+	case 3:
+	case 11:v.u = pvr_ta_float(param[4]);
+		v.v = pvr_ta_float(param[5]);
+		pvr_unpack_color(param[6], v.base);
+		pvr_unpack_color(param[7], v.offset);
+		break;
+	case 4:
+	case 12:v.u = pvr_ta_float(param[4] & 0xffff0000);
+		v.v = pvr_ta_float(param[4] << 16);
+		pvr_unpack_color(param[6], v.base);
+		pvr_unpack_color(param[7], v.offset);
+		break;
+	case 5:
+	case 6:	if (pvr_ta_vertex_type(d->ta_pcw) == 5) {
+			v.u = pvr_ta_float(param[4]);
+			v.v = pvr_ta_float(param[5]);
+		} else {
+			v.u = pvr_ta_float(param[4] & 0xffff0000);
+			v.v = pvr_ta_float(param[4] << 16);
 		}
+		for (i=0; i<4; i++) {
+			v.base[i] = pvr_ta_float(param[8 + i]);
+			v.offset[i] = pvr_ta_float(param[12 + i]);
+		}
+		break;
+	case 7:
+	case 13:v.u = pvr_ta_float(param[4]);
+		v.v = pvr_ta_float(param[5]);
+		pvr_intensity_color(d->ta_face_color,
+		    pvr_ta_float(param[6]), v.base);
+		pvr_intensity_color(d->ta_face_offset,
+		    pvr_ta_float(param[7]), v.offset);
+		break;
+	case 8:
+	case 14:v.u = pvr_ta_float(param[4] & 0xffff0000);
+		v.v = pvr_ta_float(param[4] << 16);
+		pvr_intensity_color(d->ta_face_color,
+		    pvr_ta_float(param[6]), v.base);
+		pvr_intensity_color(d->ta_face_offset,
+		    pvr_ta_float(param[7]), v.offset);
+		break;
+	case 9:	pvr_unpack_color(param[4], v.base);
+		break;
+	case 10:pvr_intensity_color(d->ta_face_color,
+		    pvr_ta_float(param[4]), v.base);
+		break;
+	}
+
+	/*  Every vertex after the first two completes a triangle. Every
+	    other triangle is flipped, to keep the winding consistent.  */
+	if (d->ta_strip_len < 2) {
+		d->ta_strip[d->ta_strip_len] = v;
+	} else {
+		if (d->ta_strip_len & 1)
+			pvr_add_triangle(d, &d->ta_strip[1],
+			    &d->ta_strip[0], &v);
+		else
+			pvr_add_triangle(d, &d->ta_strip[0],
+			    &d->ta_strip[1], &v);
+
+		d->ta_strip[0] = d->ta_strip[1];
+		d->ta_strip[1] = v;
 	}
+
+	d->ta_strip_len ++;
+
+	if (param[0] & TA_PCW_END_OF_STRIP)
+		d->ta_strip_len = 0;
 }
 
 
 /*
- *  pvr_render():
+ *  pvr_vram32():
  *
- *  Render from the Object Buffer to the framebuffer.
+ *  Read a 32-bit little-endian word from VRAM (32-bit view).
+ */
+static uint32_t pvr_vram32(struct pvr_data *d, uint32_t addr)
+{
+	return d->vram[addr % VRAM_SIZE] +
+	    (d->vram[(addr + 1) % VRAM_SIZE] << 8) +
+	    (d->vram[(addr + 2) % VRAM_SIZE] << 16) +
+	    (d->vram[(addr + 3) % VRAM_SIZE] << 24);
+}
+
+
+/*
+ *  pvr_tex8(), pvr_tex16():
  *
- *  TODO: This function is totally bogus so far, the format of the Object
- *        Buffer is just a quick made-up hack to see if it works at all.
+ *  Read from texture memory. Textures are stored in the 64-bit
+ *  (interleaved) view of VRAM.
  */
-void pvr_render(struct cpu *cpu, struct pvr_data *d)
+static inline uint32_t pvr_tex8(struct pvr_data *d, uint32_t addr)
+{
+	addr = ((addr & 4) << 20) | (addr & 3) | ((addr & 0x7ffff8) >> 1);
+	return d->vram[addr % VRAM_SIZE];
+}
+
+static inline uint32_t pvr_tex16(struct pvr_data *d, uint32_t addr)
 {
-	int ob_ofs = REG(PVRREG_OB_ADDR);
-	int fb_base = REG(PVRREG_FB_RENDER_ADDR1);
-	int wf_point_nr, texture = 0;
-	int wf_x[4], wf_y[4];
+	return pvr_tex8(d, addr) + (pvr_tex8(d, addr + 1) << 8);
+}
 
-	debug("[ pvr_render: rendering to FB offset 0x%x ]\n", fb_base);
 
-	/*  Clear all pixels first:  */
-	/*  TODO  */
-	memset(d->vram + fb_base, 0, d->xsize * d->ysize * d->bytes_per_pixel);
+/*
+ *  pvr_twiddle():
+ *
+ *  Textures are normally stored in "twiddled" order, where the bits of the
+ *  x and y coordinates are interleaved (y in the lowest bit). Non-square
+ *  textures consist of several square blocks of the smaller size.
+ */
+static uint32_t pvr_twiddle(uint32_t x, uint32_t y, int ushift, int vshift)
+{
+	int shift = ushift < vshift? ushift : vshift;
+	uint32_t mask = (1 << shift) - 1, ofs = 0;
+	int i;
 
-	wf_point_nr = 0;
+	for (i=0; i<shift; i++)
+		ofs |= (((y >> i) & 1) << (2*i)) | (((x >> i) & 1) << (2*i+1));
 
-	for (;;) {
-		uint8_t cmd = d->vram[ob_ofs % VRAM_SIZE];
+	return ofs + (((x | y) & ~mask) << shift);
+}
 
-		if (ob_ofs >= VRAM_SIZE)
-			fatal("[ pvr_render: WARNING: ob_ofs > VRAM_SIZE! ]\n");
 
-		if (cmd == 0)
+/*
+ *  pvr_mipmap_offset():
+ *
+ *  Offset (in texels) of the largest mipmap level of a texture of size
+ *  1 << shift. The levels are stored smallest first, after 3 texels
+ *  of padding.
+ */
+static uint32_t pvr_mipmap_offset(int shift)
+{
+	return 3 + ((1 << (2 * shift)) - 1) / 3;
+}
+
+
+/*  Convert a 16-bit texel (or palette entry) to ARGB8888:  */
+static uint32_t pvr_color16(int format, uint32_t c)
+{
+	uint32_t a, r, g, b;
+
+	switch (format) {
+	case TCW_RGB565:
+		a = 255;
+		r = (c >> 11) & 31; r = (r << 3) | (r >> 2);
+		g = (c >> 5) & 63;  g = (g << 2) | (g >> 4);
+		b = c & 31;         b = (b << 3) | (b >> 2);
+		break;
+	case TCW_ARGB4444:
+		a = ((c >> 12) & 15) * 17;
+		r = ((c >> 8) & 15) * 17;
+		g = ((c >> 4) & 15) * 17;
+		b = (c & 15) * 17;
+		break;
+	default:/*  ARGB1555  */
+		a = c & 0x8000? 255 : 0;
+		r = (c >> 10) & 31; r = (r << 3) | (r >> 2);
+		g = (c >> 5) & 31;  g = (g << 3) | (g >> 2);
+		b = c & 31;         b = (b << 3) | (b >> 2);
+	}
+
+	return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+
+/*  Look up a palette entry:  */
+static uint32_t pvr_palette(struct pvr_data *d, int index)
+{
+	uint32_t c = REG(PVRREG_PALETTE + index * sizeof(uint32_t));
+
+	switch (REG(PVRREG_PALETTE_CFG) & PVR_PALETTE_CFG_MODE_MASK) {
+	case PVR_PALETTE_CFG_MODE_RGB565:	return pvr_color16(TCW_RGB565, c);
+	case PVR_PALETTE_CFG_MODE_ARGB4444:	return pvr_color16(TCW_ARGB4444, c);
+	case PVR_PALETTE_CFG_MODE_ARGB8888:	return c;
+	default:				return pvr_color16(TCW_ARGB1555, c);
+	}
+}
+
+
+/*  Convert YUV to ARGB8888:  */
+static uint32_t pvr_yuv(int y, int u, int v)
+{
+	int r = y + (11 * (v - 128)) / 8;
+	int g = y - (11 * (u - 128) + 22 * (v - 128)) / 32;
+	int b = y + (55 * (u - 128)) / 32;
+
+	r = r < 0? 0 : r > 255? 255 : r;
+	g = g < 0? 0 : g > 255? 255 : g;
+	b = b < 0? 0 : b > 255? 255 : b;
+
+	return 0xff000000 | (r << 16) | (g << 8) | b;
+}
+
+
+/*  Wrap, flip, or clamp a texture coordinate:  */
+static int pvr_tex_coord(float f, int shift, int clamp, int flip)
+{
+	int size = 1 << shift, i;
+
+	if (!(f > -1e8 && f < 1e8))
+		f = 0;
+
+	i = (int) floorf(f * size);
+
+	if (clamp)
+		return i < 0? 0 : i >= size? size - 1 : i;
+	if (flip && (i & size))
+		return (size - 1) - (i & (size - 1));
+
+	return i & (size - 1);
+}
+
+
+/*
+ *  pvr_texel():
+ *
+ *  Point sample a texture at (u,v), and return the texel as ARGB8888.
+ */
+static uint32_t pvr_texel(struct pvr_data *d, uint32_t tsp, uint32_t tcw,
+	float u, float v)
+{
+	int ushift = TSP_U_SIZE_SHIFT(tsp), vshift = TSP_V_SIZE_SHIFT(tsp);
+	int x = pvr_tex_coord(u, ushift, tsp & TSP_CLAMP_U, tsp & TSP_FLIP_U);
+	int y = pvr_tex_coord(v, vshift, tsp & TSP_CLAMP_V, tsp & TSP_FLIP_V);
+	int format = TCW_PIXEL_FORMAT(tcw);
+	uint32_t addr = TCW_ADDR(tcw), idx, c;
+
+	if (tcw & TCW_VQ) {
+		/*  256 codebook entries of 2x2 texels, followed by one
+		    index byte per 2x2 block:  */
+		idx = pvr_twiddle(x >> 1, y >> 1, ushift - 1, vshift - 1);
+		if (tcw & TCW_MIPMAP)
+			idx += pvr_mipmap_offset(ushift - 1) - 2;
+		c = pvr_tex8(d, addr + 2048 + idx);
+		c = pvr_tex16(d, addr + c * 8 + ((x & 1) * 2 + (y & 1)) * 2);
+		return pvr_color16(format, c);
+	}
+
+	if (format == TCW_PAL4 || format == TCW_PAL8) {
+		idx = pvr_twiddle(x, y, ushift, vshift);
+		if (tcw & TCW_MIPMAP)
+			idx += pvr_mipmap_offset(ushift);
+
+		if (format == TCW_PAL8)
+			return pvr_palette(d, (TCW_PAL8_SELECT(tcw) << 8) +
+			    pvr_tex8(d, addr + idx));
+
+		c = pvr_tex8(d, addr + idx / 2);
+		c = idx & 1? c >> 4 : c & 15;
+		return pvr_palette(d, (TCW_PAL4_SELECT(tcw) << 4) + c);
+	}
+
+	if (tcw & TCW_NON_TWIDDLED) {
+		int stride = 1 << ushift;
+		if (tcw & TCW_STRIDE)
+			stride = (REG(PVRREG_TSP_CFG) & TSP_CFG_MODULO_MASK)
+			    * 32;
+		idx = y * stride + x;
+	} else {
+		idx = pvr_twiddle(x, y, ushift, vshift);
+		if (tcw & TCW_MIPMAP)
+			idx += pvr_mipmap_offset(ushift);
+	}
+
+	if (format == TCW_YUV422) {
+		/*  Texel pairs: U Y0 V Y1  */
+		uint32_t uy = pvr_tex16(d, addr + (idx & ~1) * 2);
+		uint32_t vy = pvr_tex16(d, addr + (idx | 1) * 2);
+		return pvr_yuv((idx & 1? vy : uy) >> 8, uy & 255, vy & 255);
+	}
+
+	return pvr_color16(format, pvr_tex16(d, addr + idx * 2));
+}
+
+
+/*
+ *  pvr_shade():
+ *
+ *  Calculate the color (A, R, G, B) of a pixel, from the interpolated
+ *  attributes a[].
+ */
+static void pvr_shade(struct pvr_data *d, struct pvr_triangle *t, float *a,
+	float *out)
+{
+	float *base = &a[PVR_ATTR_BASE], *offset = &a[PVR_ATTR_OFFSET];
+	int i;
+
+	if (!(t->isp & ISP_TEXTURE)) {
+		for (i=0; i<4; i++)
+			out[i] = base[i];
+	} else {
+		float z = a[PVR_ATTR_Z], tex[4];
+		float u = z != 0? a[PVR_ATTR_UZ] / z : a[PVR_ATTR_UZ];
+		float v = z != 0? a[PVR_ATTR_VZ] / z : a[PVR_ATTR_VZ];
+		uint32_t texel = pvr_texel(d, t->tsp, t->tcw, u, v);
+
+		pvr_unpack_color(texel, tex);
+		if (t->tsp & TSP_IGNORE_TEX_ALPHA)
+			tex[0] = 1.0;
+
+		switch (TSP_SHADING(t->tsp)) {
+		case TSP_SHADING_DECAL:
+			for (i=0; i<4; i++)
+				out[i] = tex[i];
 			break;
-		else if (cmd == 1) {
-			int16_t px = d->vram[(ob_ofs+2)%VRAM_SIZE] +
-			    d->vram[(ob_ofs+3)%VRAM_SIZE]*256;
-			int16_t py = d->vram[(ob_ofs+4)%VRAM_SIZE] +
-			    d->vram[(ob_ofs+5)%VRAM_SIZE]*256;
-
-			wf_x[wf_point_nr] = px;
-			wf_y[wf_point_nr] = py;
-
-			wf_point_nr ++;
-			if (wf_point_nr == 4) {
-#if 1
-				line(d, wf_x[0], wf_y[0], wf_x[1], wf_y[1]);
-				line(d, wf_x[0], wf_y[0], wf_x[2], wf_y[2]);
-				line(d, wf_x[1], wf_y[1], wf_x[3], wf_y[3]);
-				line(d, wf_x[2], wf_y[2], wf_x[3], wf_y[3]);
-				wf_point_nr = 0;
-				wf_x[0] = wf_x[2]; wf_y[0] = wf_y[2];
-				wf_x[1] = wf_x[3]; wf_y[1] = wf_y[3];
-#else
-				draw_texture(d, wf_x[0], wf_y[0],
-				    wf_x[1], wf_y[1],
-				    wf_x[2], wf_y[2],
-				    wf_x[3], wf_y[3], texture);
-#endif
+		case TSP_SHADING_MODULATE:
+			out[0] = tex[0];
+			for (i=1; i<4; i++)
+				out[i] = tex[i] * base[i];
+			break;
+		case TSP_SHADING_DECAL_ALPHA:
+			out[0] = base[0];
+			for (i=1; i<4; i++)
+				out[i] = tex[i] * tex[0] +
+				    base[i] * (1.0 - tex[0]);
+			break;
+		case TSP_SHADING_MODULATE_ALPHA:
+			for (i=0; i<4; i++)
+				out[i] = tex[i] * base[i];
+			break;
+		}
+
+		if (t->isp & ISP_OFFSET)
+			for (i=1; i<4; i++)
+				out[i] += offset[i];
+	}
+
+	if (!(t->tsp & TSP_USE_ALPHA))
+		out[0] = 1.0;
+
+	for (i=0; i<4; i++)
+		out[i] = out[i] < 0? 0 : out[i] > 1? 1 : out[i];
+}
+
+
+/*  Blend factor, according to a TSP src/dst alpha instruction:  */
+static void pvr_blend_factor(int instr, float *src, float *dst, float *other,
+	float *f)
+{
+	float x;
+	int i;
+
+	switch (instr) {
+	case 0:	x = 0.0; break;
+	case 1:	x = 1.0; break;
+	case 2:
+	case 3:	for (i=0; i<4; i++)
+			f[i] = instr == 2? other[i] : 1.0 - other[i];
+		return;
+	case 4:	x = src[0]; break;
+	case 5:	x = 1.0 - src[0]; break;
+	case 6:	x = dst[0]; break;
+	default:x = 1.0 - dst[0];
+	}
+
+	for (i=0; i<4; i++)
+		f[i] = x;
+}
+
+
+static int pvr_depth_test(int mode, float z, float old)
+{
+	switch (mode) {
+	case 0:	return 0;
+	case 1:	return z < old;
+	case 2:	return z == old;
+	case 3:	return z <= old;
+	case 4:	return z > old;
+	case 5:	return z != old;
+	case 6:	return z >= old;
+	default:return 1;
+	}
+}
+
+
+static uint32_t pvr_pack_color(float *c)
+{
+	return ((uint32_t)(c[0] * 255 + 0.5) << 24) |
+	    ((uint32_t)(c[1] * 255 + 0.5) << 16) |
+	    ((uint32_t)(c[2] * 255 + 0.5) << 8) |
+	    (uint32_t)(c[3] * 255 + 0.5);
+}
+
+
+/*
+ *  pvr_render_triangle():
+ *
+ *  Rasterize one triangle into the tile at (tile_x, tile_y). Each row of
+ *  the tile which the triangle covers is handled as one span. Left edges
+ *  are inclusive and right edges exclusive, so that pixels on edges shared
+ *  by two triangles are only drawn once.
+ */
+static void pvr_render_triangle(struct pvr_data *d, struct pvr_triangle *t,
+	int tile_x, int tile_y, uint32_t *color, float *depth)
+{
+	int depth_mode = ISP_DEPTH_MODE(t->isp);
+	int zwrite = !(t->isp & ISP_ZWRITE_DISABLE);
+	int alpha_ref = REG(PVRREG_PT_ALPHA_REF) & 0xff;
+	int row, e, i, k;
+
+	for (row=0; row<PVR_TILE_SIZE; row++) {
+		float cy = tile_y + row + 0.5, cx, a[PVR_N_ATTR];
+		int xl = 0, xr = PVR_TILE_SIZE - 1, idx;
+
+		for (e=0; e<3; e++) {
+			float ea = t->edge[e][0];
+			float r = t->edge[e][1] * cy + t->edge[e][2], f;
+
+			if (ea == 0) {
+				if (r < 0 || (r == 0 && t->edge[e][1] < 0))
+					xl = PVR_TILE_SIZE;
+				continue;
 			}
 
-		} else if (cmd == 2) {
-			wf_point_nr = 0;
-			texture = d->vram[(ob_ofs+4)%VRAM_SIZE] +
-			    (d->vram[(ob_ofs+5)%VRAM_SIZE]
-			    << 8) + (d->vram[(ob_ofs+6)%VRAM_SIZE] << 16) +
-			    (d->vram[(ob_ofs+7)%VRAM_SIZE] << 24);
-			texture <<= 3;
-			texture &= 0x7fffff;
-			printf("TEXTURE = %x\n", texture);
-		} else {
-			fatal("pvr_render: internal error, unknown cmd\n");
+			f = -r / ea - tile_x - 0.5;
+			if (f < -1)
+				f = -1;
+			if (f > PVR_TILE_SIZE + 1)
+				f = PVR_TILE_SIZE + 1;
+
+			if (ea > 0) {
+				i = (int) ceilf(f);
+				if (i > xl)
+					xl = i;
+			} else {
+				i = (int) ceilf(f) - 1;
+				if (i < xr)
+					xr = i;
+			}
 		}
 
-		ob_ofs += sizeof(uint64_t);
+		if (xl > xr)
+			continue;
+
+		cx = tile_x + xl + 0.5;
+		for (k=0; k<PVR_N_ATTR; k++)
+			a[k] = t->attr0[k] + t->dadx[k] * cx + t->dady[k] * cy;
+
+		idx = row * PVR_TILE_SIZE + xl;
+
+		for (i=xl; i<=xr; i++, idx++) {
+			float out[4];
+
+			if (pvr_depth_test(depth_mode, a[PVR_ATTR_Z],
+			    depth[idx])) {
+				pvr_shade(d, t, a, out);
+
+				if (t->list == PVR_LIST_TRANS) {
+					float dst[4], sf[4], df[4];
+					pvr_unpack_color(color[idx], dst);
+					pvr_blend_factor(TSP_SRC_ALPHA(t->tsp),
+					    out, dst, dst, sf);
+					pvr_blend_factor(TSP_DST_ALPHA(t->tsp),
+					    out, dst, out, df);
+					for (k=0; k<4; k++) {
+						out[k] = out[k] * sf[k] +
+						    dst[k] * df[k];
+						if (out[k] > 1.0)
+							out[k] = 1.0;
+					}
+				}
+
+				if (t->list != PVR_LIST_PUNCHTHROUGH ||
+				    (int)(out[0] * 255 + 0.5) >= alpha_ref) {
+					color[idx] = pvr_pack_color(out);
+					if (zwrite)
+						depth[idx] = a[PVR_ATTR_Z];
+				}
+			}
+
+			for (k=0; k<PVR_N_ATTR; k++)
+				a[k] += t->dadx[k];
+		}
+	}
+}
+
+
+/*
+ *  pvr_bin_triangles():
+ *
+ *  Sort the triangles of the opaque, punch-through, and translucent lists
+ *  (in that order) into per-tile bins. Bin b consists of the entries
+ *  d->bin[b == 0? 0 : d->bin_start[b-1]] .. d->bin[d->bin_start[b] - 1].
+ */
+static void pvr_bin_triangles(struct pvr_data *d, int tiles_x, int tiles_y)
+{
+	const int lists[3] = { PVR_LIST_OPAQUE, PVR_LIST_PUNCHTHROUGH,
+	    PVR_LIST_TRANS };
+	int n_bins = tiles_x * tiles_y, pass, l, i, b, tx, ty;
+
+	if (n_bins + 1 > d->n_bins) {
+		d->n_bins = n_bins + 1;
+		CHECK_ALLOCATION(d->bin_start = (int *) realloc(d->bin_start,
+		    d->n_bins * sizeof(int)));
+	}
+
+	memset(d->bin_start, 0, (n_bins + 1) * sizeof(int));
+
+	for (pass=0; pass<2; pass++) {
+		for (l=0; l<3; l++) {
+			struct pvr_list *list = &d->list[lists[l]];
+
+			for (i=0; i<list->n_tris; i++) {
+				struct pvr_triangle *t = &list->tri[i];
+				int tx1, ty1, tx2, ty2;
+
+				if (!(t->x1 <= t->x2 && t->y1 <= t->y2) ||
+				    t->x2 < 0 || t->y2 < 0 ||
+				    t->x1 >= tiles_x * PVR_TILE_SIZE ||
+				    t->y1 >= tiles_y * PVR_TILE_SIZE)
+					continue;
+
+				tx1 = t->x1 < 0? 0 : (int)t->x1 / PVR_TILE_SIZE;
+				ty1 = t->y1 < 0? 0 : (int)t->y1 / PVR_TILE_SIZE;
+				tx2 = t->x2 >= tiles_x * PVR_TILE_SIZE?
+				    tiles_x - 1 : (int)t->x2 / PVR_TILE_SIZE;
+				ty2 = t->y2 >= tiles_y * PVR_TILE_SIZE?
+				    tiles_y - 1 : (int)t->y2 / PVR_TILE_SIZE;
+
+				for (ty=ty1; ty<=ty2; ty++)
+					for (tx=tx1; tx<=tx2; tx++) {
+						b = ty * tiles_x + tx;
+						if (pass == 0)
+							d->bin_start[b + 1] ++;
+						else
+							d->bin[d->bin_start[b]
+							    ++] = t;
+					}
+			}
+		}
+
+		if (pass == 0) {
+			for (b=1; b<=n_bins; b++)
+				d->bin_start[b] += d->bin_start[b - 1];
+
+			if (d->bin_start[n_bins] > d->max_bin) {
+				d->max_bin = d->bin_start[n_bins];
+				CHECK_ALLOCATION(d->bin = (struct pvr_triangle **)
+				    realloc(d->bin, d->max_bin *
+				    sizeof(struct pvr_triangle *)));
+			}
+		}
 	}
+}
+
+
+/*  Translucent polygons are drawn back to front:  */
+static int pvr_triangle_cmp(const void *a, const void *b)
+{
+	const struct pvr_triangle *ta = (const struct pvr_triangle *) a;
+	const struct pvr_triangle *tb = (const struct pvr_triangle *) b;
+
+	if (ta->sort_z < tb->sort_z)
+		return -1;
+	if (ta->sort_z > tb->sort_z)
+		return 1;
+
+	return ta->seq - tb->seq;
+}
+
+
+/*
+ *  pvr_render_bytes_per_pixel():
+ *
+ *  Framebuffer pixel size for a FB_RENDER_CFG render mode.
+ */
+static int pvr_render_bytes_per_pixel(int mode)
+{
+	switch (mode) {
+	case 4:	return 3;
+	case 5:
+	case 6:	return 4;
+	default:return 2;
+	}
+}
+
+
+/*  Convert a pixel to the framebuffer render mode:  */
+static void pvr_write_pixel(uint8_t *p, int mode, uint32_t cfg, uint32_t c)
+{
+	uint32_t a = c >> 24, r = (c >> 16) & 255, g = (c >> 8) & 255,
+	    b = c & 255, x;
+
+	switch (mode) {
+	case 0:	x = ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3) |
+		    (((cfg >> 15) & 1) << 15);
+		break;
+	case 1:	x = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+		break;
+	case 3:	x = ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3) |
+		    (a >= ((cfg >> 16) & 255)? 0x8000 : 0);
+		break;
+	case 4:	p[0] = b; p[1] = g; p[2] = r;
+		return;
+	case 5:	c = (c & 0xffffff) | (((cfg >> 8) & 255) << 24);
+		/*  Fall-through.  */
+	case 6:	p[0] = c; p[1] = c >> 8; p[2] = c >> 16; p[3] = c >> 24;
+		return;
+	default:x = ((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) |
+		    (b >> 4);
+	}
+
+	p[0] = x;
+	p[1] = x >> 8;
+}
+
+
+/*
+ *  pvr_render_tile():
+ *
+ *  Render tile b of the current frame (d->job), with a tile-local color and
+ *  depth buffer, like on the real hardware. The tile is first filled with
+ *  the background plane, then the binned triangles are drawn (opaque,
+ *  punch-through, and translucent, in that order), and finally the tile is
+ *  written to the framebuffer. d->tile_dirty[b] is set if that changed the
+ *  framebuffer.
+ *
+ *  Tiles are independent of each other, so different tiles may be rendered
+ *  by different threads at the same time.
+ */
+static void pvr_render_tile(struct pvr_data *d, int b)
+{
+	struct pvr_render_job *job = &d->job;
+	uint32_t color[PVR_TILE_SIZE * PVR_TILE_SIZE];
+	float depth[PVR_TILE_SIZE * PVR_TILE_SIZE];
+	int tx = b % job->tiles_x, ty = b / job->tiles_x, row, i;
+	int tile_x = tx * PVR_TILE_SIZE, tile_y = ty * PVR_TILE_SIZE;
+	int x1 = job->clip_x1 - tile_x, x2 = job->clip_x2 - tile_x;
+	int bpp = job->bytes_per_pixel;
+
+	d->tile_dirty[b] = 0;
+
+	if (x1 < 0)
+		x1 = 0;
+	if (x2 >= PVR_TILE_SIZE)
+		x2 = PVR_TILE_SIZE - 1;
+	if (x1 > x2 || tile_y > job->clip_y2 ||
+	    tile_y + PVR_TILE_SIZE <= job->clip_y1)
+		return;
+
+	for (i=0; i<PVR_TILE_SIZE * PVR_TILE_SIZE; i++) {
+		color[i] = job->bg_color;
+		depth[i] = job->bg_z;
+	}
+
+	for (i=b == 0? 0 : d->bin_start[b-1]; i<d->bin_start[b]; i++)
+		pvr_render_triangle(d, d->bin[i], tile_x, tile_y,
+		    color, depth);
+
+	/*  Write the tile to the framebuffer:  */
+	for (row=0; row<PVR_TILE_SIZE; row++) {
+		uint8_t buf[PVR_TILE_SIZE * 4];
+		int y = tile_y + row, len, x;
+		uint32_t ofs;
+
+		if (y < job->clip_y1 || y > job->clip_y2)
+			continue;
+
+		ofs = job->fb_base + y * job->stride + (tile_x + x1) * bpp;
+		len = (x2 - x1 + 1) * bpp;
+		if (ofs + len > VRAM_SIZE)
+			continue;
+
+		for (x=x1; x<=x2; x++)
+			pvr_write_pixel(buf + (x-x1) * bpp, job->mode,
+			    job->cfg, color[row * PVR_TILE_SIZE + x]);
+
+		if (memcmp(d->vram + ofs, buf, len) == 0)
+			continue;
+
+		memcpy(d->vram + ofs, buf, len);
+		d->tile_dirty[b] = 1;
+	}
+}
+
+
+#ifdef WITH_PTHREADS
+/*
+ *  pvr_render_next_tile():
+ *
+ *  Returns the next tile of the current frame which is not yet taken by
+ *  some thread, or -1 if there are no more tiles.
+ */
+static int pvr_render_next_tile(struct pvr_data *d)
+{
+	int b = -1;
+
+	pthread_mutex_lock(&d->render_lock);
+	if (d->render_next_tile < d->render_n_tiles)
+		b = d->render_next_tile ++;
+	pthread_mutex_unlock(&d->render_lock);
+
+	return b;
+}
+
+
+/*
+ *  pvr_render_worker():
+ *
+ *  Tile worker thread. Waits for a new frame, renders tiles until there
+ *  are no more tiles left, and then tells pvr_render() that it is done.
+ */
+static void *pvr_render_worker(void *arg)
+{
+	struct pvr_data *d = (struct pvr_data *) arg;
+	int generation = 0, b;
+
+	for (;;) {
+		pthread_mutex_lock(&d->render_lock);
+		while (d->render_generation == generation)
+			pthread_cond_wait(&d->render_start, &d->render_lock);
+		generation = d->render_generation;
+		pthread_mutex_unlock(&d->render_lock);
+
+		while ((b = pvr_render_next_tile(d)) >= 0)
+			pvr_render_tile(d, b);
+
+		pthread_mutex_lock(&d->render_lock);
+		if (--d->render_busy == 0)
+			pthread_cond_signal(&d->render_done);
+		pthread_mutex_unlock(&d->render_lock);
+	}
+
+	return NULL;
+}
+
+
+/*
+ *  pvr_render_start_workers():
+ *
+ *  Start one tile worker thread per additional host CPU. If no threads
+ *  can be started, tiles are rendered by the emulator thread only.
+ */
+static void pvr_render_start_workers(struct pvr_data *d)
+{
+	long n = sysconf(_SC_NPROCESSORS_ONLN) - 1;
+	int i;
+
+	if (n > PVR_MAX_RENDER_THREADS - 1)
+		n = PVR_MAX_RENDER_THREADS - 1;
+
+	d->n_workers = 0;
+	if (n <= 0)
+		return;
+
+	pthread_mutex_init(&d->render_lock, NULL);
+	pthread_cond_init(&d->render_start, NULL);
+	pthread_cond_init(&d->render_done, NULL);
+
+	CHECK_ALLOCATION(d->workers = (pthread_t *)
+	    malloc(n * sizeof(pthread_t)));
+
+	for (i=0; i<n; i++) {
+		if (pthread_create(&d->workers[i], NULL, pvr_render_worker,
+		    d) != 0) {
+			fatal("[ pvr: could not start tile worker thread ]\n");
+			break;
+		}
+		d->n_workers ++;
+	}
+}
+#endif	/*  WITH_PTHREADS  */
+
+
+/*
+ *  pvr_extend_update_tile():
+ *
+ *  Extend the host update region with the part of tile b which is inside
+ *  the clip area.
+ */
+static void pvr_extend_update_tile(struct pvr_data *d, int b)
+{
+	struct pvr_render_job *job = &d->job;
+	int x1 = (b % job->tiles_x) * PVR_TILE_SIZE;
+	int y1 = (b / job->tiles_x) * PVR_TILE_SIZE;
+	int x2 = x1 + PVR_TILE_SIZE - 1, y2 = y1 + PVR_TILE_SIZE - 1;
+
+	if (x1 < job->clip_x1)  x1 = job->clip_x1;
+	if (y1 < job->clip_y1)  y1 = job->clip_y1;
+	if (x2 > job->clip_x2)  x2 = job->clip_x2;
+	if (y2 > job->clip_y2)  y2 = job->clip_y2;
+
+	/*  Rendering to the displayed framebuffer? Then only the tile
+	    itself needs to be redrawn.  */
+	if (job->fb_base == REG(PVRREG_DIWADDRL) &&
+	    job->bytes_per_pixel == d->bytes_per_pixel &&
+	    job->stride == d->xsize * d->bytes_per_pixel) {
+		if (x2 >= d->xsize)
+			x2 = d->xsize - 1;
+		if (y2 >= d->ysize)
+			y2 = d->ysize - 1;
+		if (x1 > x2 || y1 > y2)
+			return;
+
+		if (d->fb_update_x1 < 0 || x1 < d->fb_update_x1)
+			d->fb_update_x1 = x1;
+		if (d->fb_update_x2 < 0 || x2 > d->fb_update_x2)
+			d->fb_update_x2 = x2;
+		if (d->fb_update_y1 < 0 || y1 < d->fb_update_y1)
+			d->fb_update_y1 = y1;
+		if (d->fb_update_y2 < 0 || y2 > d->fb_update_y2)
+			d->fb_update_y2 = y2;
+		return;
+	}
+
+	pvr_extend_update_region(d, job->fb_base + y1 * job->stride +
+	    x1 * job->bytes_per_pixel, job->fb_base + y2 * job->stride +
+	    (x2 + 1) * job->bytes_per_pixel - 1);
+}
+
+
+/*
+ *  pvr_render():
+ *
+ *  Render the triangles collected by the Tile Accelerator to the
+ *  framebuffer at FB_RENDER_ADDR1.
+ *
+ *  Rendering is done one 32 x 32 pixel tile at a time (see
+ *  pvr_render_tile()). The translucent list is sorted back to front per
+ *  polygon before the triangles are binned. When the host has more than
+ *  one CPU, tiles are handed out to a pool of worker threads, with the
+ *  emulator thread rendering tiles too until all are done.
+ *
+ *  Only tiles which actually changed the framebuffer are included in the
+ *  region which is redrawn on the host.
+ *
+ *  TODO: Modifier volumes, fog, bilinear filtering, mipmap selection,
+ *  user tile clip, interlaced rendering (FB_RENDER_ADDR2).
+ */
+void pvr_render(struct cpu *cpu, struct pvr_data *d)
+{
+	struct pvr_render_job *job = &d->job;
+	uint32_t cfg = REG(PVRREG_FB_RENDER_CFG);
+	uint32_t bg_addr, bg_isp;
+	int tiles_x = d->tilebuf_xsize, tiles_y = d->tilebuf_ysize;
+	int n_tiles, b, i;
+
+	job->fb_base = REG(PVRREG_FB_RENDER_ADDR1);
+	job->cfg = cfg;
+	job->mode = cfg & FB_RENDER_CFG_RENDER_MODE_MASK;
+	job->bytes_per_pixel = pvr_render_bytes_per_pixel(job->mode);
+	job->stride = (REG(PVRREG_FB_RENDER_MODULO) &
+	    FB_RENDER_MODULO_MASK) * 8;
+
+	debug("[ pvr_render: rendering to FB offset 0x%x ]\n", job->fb_base);
+
+	job->clip_x1 = REG(PVRREG_FB_CLIP_X) & FB_CLIP_XY_MIN_MASK;
+	job->clip_x2 = (REG(PVRREG_FB_CLIP_X) & FB_CLIP_XY_MAX_MASK)
+	    >> FB_CLIP_XY_MAX_SHIFT;
+	job->clip_y1 = REG(PVRREG_FB_CLIP_Y) & FB_CLIP_XY_MIN_MASK;
+	job->clip_y2 = (REG(PVRREG_FB_CLIP_Y) & FB_CLIP_XY_MAX_MASK)
+	    >> FB_CLIP_XY_MAX_SHIFT;
+	if (job->clip_x2 == 0)
+		job->clip_x2 = d->xsize - 1;
+	if (job->clip_y2 == 0)
+		job->clip_y2 = d->ysize - 1;
+
+	/*  No tile buffer size set? Then cover the clip area.  */
+	if (tiles_x <= 0 || tiles_y <= 0) {
+		tiles_x = (job->clip_x2 + PVR_TILE_SIZE) / PVR_TILE_SIZE;
+		tiles_y = (job->clip_y2 + PVR_TILE_SIZE) / PVR_TILE_SIZE;
+	}
+	if (tiles_x > 2048 / PVR_TILE_SIZE)
+		tiles_x = 2048 / PVR_TILE_SIZE;
+	if (tiles_y > 2048 / PVR_TILE_SIZE)
+		tiles_y = 2048 / PVR_TILE_SIZE;
+	job->tiles_x = tiles_x;
+	job->tiles_y = tiles_y;
+	n_tiles = tiles_x * tiles_y;
+
+	if (job->stride == 0)
+		job->stride = (job->clip_x2 + 1) * job->bytes_per_pixel;
+
+	/*
+	 *  The background plane is a polygon in the parameter buffer. Only
+	 *  the color of its first vertex is used; after the ISP/TSP and
+	 *  Texture Control words come x, y, z, (u, v,) and base color.
+	 */
+	bg_addr = (REG(PVRREG_OB_ADDR) & PVR_OB_ADDR_MASK) +
+	    ((REG(PVRREG_BGPLANE_CFG) >> 3) & 0x1fffff) * sizeof(uint32_t);
+	bg_isp = pvr_vram32(d, bg_addr);
+	i = 6;
+	if (bg_isp & ISP_TEXTURE)
+		i += bg_isp & ISP_UV16? 1 : 2;
+	job->bg_color = pvr_vram32(d, bg_addr + i * sizeof(uint32_t));
+	job->bg_z = pvr_ta_float(REG(PVRREG_BGPLANE_Z));
+
+	if (d->list[PVR_LIST_TRANS].n_tris > 1)
+		qsort(d->list[PVR_LIST_TRANS].tri,
+		    d->list[PVR_LIST_TRANS].n_tris,
+		    sizeof(struct pvr_triangle), pvr_triangle_cmp);
+
+	pvr_bin_triangles(d, tiles_x, tiles_y);
+
+	if (n_tiles > d->n_tile_dirty) {
+		d->n_tile_dirty = n_tiles;
+		CHECK_ALLOCATION(d->tile_dirty = (uint8_t *) realloc(
+		    d->tile_dirty, n_tiles));
+	}
+
+#ifdef WITH_PTHREADS
+	if (d->n_workers < 0)
+		pvr_render_start_workers(d);
+
+	/*
+	 *  Tiles may only be rendered in parallel if their framebuffer rows
+	 *  don't overlap, i.e. if the stride is at least as large as the
+	 *  rendered width.
+	 */
+	if (d->n_workers > 0 && n_tiles > 1 && job->stride >=
+	    (job->clip_x2 + 1) * job->bytes_per_pixel) {
+		pthread_mutex_lock(&d->render_lock);
+		d->render_next_tile = 0;
+		d->render_n_tiles = n_tiles;
+		d->render_busy = d->n_workers;
+		d->render_generation ++;
+		pthread_cond_broadcast(&d->render_start);
+		pthread_mutex_unlock(&d->render_lock);
+
+		while ((b = pvr_render_next_tile(d)) >= 0)
+			pvr_render_tile(d, b);
+
+		pthread_mutex_lock(&d->render_lock);
+		while (d->render_busy > 0)
+			pthread_cond_wait(&d->render_done, &d->render_lock);
+		pthread_mutex_unlock(&d->render_lock);
+	} else
+#endif
+	{
+		for (b=0; b<n_tiles; b++)
+			pvr_render_tile(d, b);
+	}
+
+	for (b=0; b<n_tiles; b++)
+		if (d->tile_dirty[b])
+			pvr_extend_update_tile(d, b);
 
 	SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_RENDERDONE);
 }
@@ -590,22 +1940,32 @@ static void pvr_reset(struct pvr_data *d)
  */
 void pvr_ta_init(struct cpu *cpu, struct pvr_data *d)
 {
+	int i;
+
 	REG(PVRREG_TA_OPB_POS) = REG(PVRREG_TA_OPB_START);
 	REG(PVRREG_TA_OB_POS) = REG(PVRREG_TA_OB_START);
+
+	/*  Start over with empty lists:  */
+	for (i=0; i<PVR_N_LISTS; i++)
+		d->list[i].n_tris = 0;
+
+	d->ta_list = -1;
+	d->ta_strip_len = 0;
+	d->ta_half_pending = 0;
 }
 
 
 /*
  *  pvr_ta_command():
  *
- *  Read a command (e.g. parts of a polygon primitive) from d->ta[], and output
- *  "compiled commands" into the Object list and Object Pointer list.
+ *  Read a command (a global parameter, a vertex parameter, or a control
+ *  parameter) from d->ta[], and add the resulting triangles to the list
+ *  which is currently open.
  */
 static void pvr_ta_command(struct cpu *cpu, struct pvr_data *d, int list_ofs)
 {
-	int ob_ofs;
-	int16_t x, y;
 	uint32_t *ta = &d->ta[list_ofs];
+	uint32_t param[64 / sizeof(uint32_t)];
 
 #ifdef TA_DEBUG
 	/*  Dump the Tile Accelerator command for debugging:  */
@@ -618,69 +1978,67 @@ static void pvr_ta_command(struct cpu *cpu, struct pvr_data *d, int list_ofs)
 	}
 #endif
 
-	/*
-	 *  TODO: REWRITE!!!
-	 *
-	 *  This is just a quick hack to see if I can get out at least
-	 *  the pixel coordinates.
-	 */
+	/*  Second half of a 64-byte parameter?  */
+	if (d->ta_half_pending) {
+		memcpy(param, d->ta_first_half, sizeof(d->ta_first_half));
+		memcpy(param + 8, ta, sizeof(d->ta_first_half));
+		d->ta_half_pending = 0;
 
-	{
-		struct ieee_float_value fx, fy;
-		ieee_interpret_float_value(ta[1], &fx, IEEE_FMT_S);
-		ieee_interpret_float_value(ta[2], &fy, IEEE_FMT_S);
-		x = (int16_t) fx.f; y = (int16_t) fy.f;
+		if (TA_PCW_PARA_TYPE(param[0]) == TA_PARA_VERTEX)
+			pvr_ta_vertex(d, param);
+		else
+			pvr_ta_global(d, param);
+		return;
 	}
 
-	ob_ofs = REG(PVRREG_TA_OB_POS);
-
-	if (ob_ofs >= VRAM_SIZE - 8)
-		fatal("[ WARNING: ob_ofs >= VRAM_SIZE - 8 ]\n");
-
-	switch (ta[0] >> 28) {
-	case 0x8:
-		d->vram[ob_ofs + 0] = 2;
-		d->vram[ob_ofs + 4] = ta[3];
-		d->vram[ob_ofs + 5] = ta[3] >> 8;
-		d->vram[ob_ofs + 6] = ta[3] >> 16;
-		d->vram[ob_ofs + 7] = ta[3] >> 24;
-		REG(PVRREG_TA_OB_POS) = ob_ofs + sizeof(uint64_t);
-		break;
-	case 0xe:
-	case 0xf:
-		/*  Point.  */
-		d->vram[ob_ofs + 0] = 1;
-		d->vram[ob_ofs + 2] = x & 255;
-		d->vram[ob_ofs + 3] = x >> 8;
-		d->vram[ob_ofs + 4] = y & 255;
-		d->vram[ob_ofs + 5] = y >> 8;
-		REG(PVRREG_TA_OB_POS) = ob_ofs + sizeof(uint64_t);
-		break;
-	case 0x0:
-		if (ta[1] == 0) {
-			/*  End of list.  */
-			uint32_t opb_cfg = REG(PVRREG_TA_OPB_CFG);
-			d->vram[ob_ofs + 0] = 0;
-			REG(PVRREG_TA_OB_POS) = ob_ofs + sizeof(uint64_t);
-			if (opb_cfg & TA_OPB_CFG_OPAQUEPOLY_MASK)
-				SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_OPAQUEDONE);
-			if (opb_cfg & TA_OPB_CFG_OPAQUEMOD_MASK)
-				SYSASIC_TRIGGER_EVENT(
-				    SYSASIC_EVENT_OPAQUEMODDONE);
-			if (opb_cfg & TA_OPB_CFG_TRANSPOLY_MASK)
-				SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_TRANSDONE);
-			if (opb_cfg & TA_OPB_CFG_TRANSMOD_MASK)
-				SYSASIC_TRIGGER_EVENT(
-				    SYSASIC_EVENT_TRANSMODDONE);
-			if (opb_cfg & TA_OPB_CFG_PUNCHTHROUGH_MASK)
-				SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_PVR_PTDONE);
-		}
-		break;
-	case 2:	/*  Ignore for now.  */
-	case 3:	/*  Ignore for now.  */
+	memcpy(param, ta, sizeof(d->ta_first_half));
+
+	switch (TA_PCW_PARA_TYPE(ta[0])) {
+
+	case TA_PARA_END_OF_LIST:
+		switch (d->ta_list) {
+		case PVR_LIST_OPAQUE:
+			SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_OPAQUEDONE);
+			break;
+		case PVR_LIST_OPAQUE_MOD:
+			SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_OPAQUEMODDONE);
+			break;
+		case PVR_LIST_TRANS:
+			SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_TRANSDONE);
+			break;
+		case PVR_LIST_TRANS_MOD:
+			SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_TRANSMODDONE);
+			break;
+		case PVR_LIST_PUNCHTHROUGH:
+			SYSASIC_TRIGGER_EVENT(SYSASIC_EVENT_PVR_PTDONE);
+			break;
+		}
+		d->ta_list = -1;
+		d->ta_strip_len = 0;
+		break;
+
+	case TA_PARA_USER_TILE_CLIP:
+	case TA_PARA_OBJECT_LIST_SET:
 		/*  TODO  */
 		break;
-	default:fatal("Unimplemented top TA nibble %i\n", ta[0] >> 28);
+
+	case TA_PARA_POLYGON:
+	case TA_PARA_SPRITE:
+	case TA_PARA_VERTEX:
+		if (pvr_ta_param_is_64_bytes(d, ta[0])) {
+			memcpy(d->ta_first_half, ta, sizeof(d->ta_first_half));
+			d->ta_half_pending = 1;
+			break;
+		}
+
+		if (TA_PCW_PARA_TYPE(ta[0]) == TA_PARA_VERTEX)
+			pvr_ta_vertex(d, param);
+		else
+			pvr_ta_global(d, param);
+		break;
+
+	default:fatal("Unimplemented TA parameter type %i\n",
+		    TA_PCW_PARA_TYPE(ta[0]));
 		exit(1);
 	}
 }
@@ -745,6 +2103,14 @@ DEVICE_ACCESS(pvr)
 		goto return_ok;
 	}
 
+	/*  Palette access:  */
+	if (relative_addr >= PVRREG_PALETTE &&
+	    relative_addr < PVRREG_PALETTE + PVR_PALETTE_SIZE) {
+		if (writeflag == MEM_WRITE)
+			DEFAULT_WRITE;
+		goto return_ok;
+	}
+
 	switch (relative_addr) {
 
 	case PVRREG_ID:
@@ -1254,6 +2620,22 @@ DEVICE_ACCESS(pvr)
 		}
 		break;
 
+	case PVRREG_PT_ALPHA_REF:
+		if (writeflag == MEM_WRITE) {
+			debug("[ pvr: PT_ALPHA_REF set to 0x%02"PRIx32" ]\n",
+			    (uint32_t) idata);
+			DEFAULT_WRITE;
+		}
+		break;
+
+	case PVRREG_PALETTE_CFG:
+		if (writeflag == MEM_WRITE) {
+			debug("[ pvr: PALETTE_CFG set to 0x%08"PRIx32" ]\n",
+			    (uint32_t) idata);
+			DEFAULT_WRITE;
+		}
+		break;
+
 	case PVRREG_TA_OPB_START:
 		if (writeflag == MEM_WRITE) {
 			if (idata & ~TA_OPB_START_MASK) {
@@ -1606,12 +2988,7 @@ DEVICE_ACCESS(pvr_vram_alt)
 	 *  Convert writes to alternative VRAM, into normal writes:
 	 */
 
-	for (i=0; i<len; i++) {
-		int addr = relative_addr + i;
-		addr = ((addr & 4) << 20) | (addr & 3)
-		    | ((addr & 0x7ffff8) >> 1);
-		d->vram[addr % VRAM_SIZE] = data[i];
-	}
+	pvr_vram_alt_write(d, relative_addr, data, len);
 
 	return 1;
 }
@@ -1691,6 +3068,12 @@ DEVINIT(pvr)
 
 	d->vblank_timer = timer_add(PVR_VBLANK_HZ, pvr_vblank_timer_tick, d);
 
+	d->ta_list = -1;
+
+#ifdef WITH_PTHREADS
+	d->n_workers = -1;
+#endif
+
 	pvr_reset(d);
 	pvr_reset_ta(d);
 
@@ -45,6 +45,7 @@
 #include "machine.h"
 #include "memory.h"
 #include "misc.h"
+#include "timer.h"
 
 #include "thirdparty/rs5c313reg.h"
 
@@ -66,7 +67,7 @@ static void rs5c313_update_time(struct rs5c313_data *d)
 	struct tm *tmp;
 	time_t timet;
 
-	timet = time(NULL);
+	timet = timer_time();
 	tmp = gmtime(&timet);
 
 	d->reg[RS5C313_SEC1]   = tmp->tm_sec % 10;
@@ -67,52 +67,39 @@ struct macepci_data {
 #define	DEV_CRIME_LENGTH		0x1000
 struct crime_data {
 	unsigned char		reg[DEV_CRIME_LENGTH];
-	struct interrupt	irq;
+
+	/*  CRIME_INTSTAT and CRIME_INTMASK live here, not in reg[]:  */
+	struct interrupt_mask	mask;
+
 	int			use_fb;
 };
 
 
 /*
- *  crime_interrupt_assert():
- *  crime_interrupt_deassert():
+ *  crime_sync_intregs():
+ *
+ *  Copies the interrupt status and mask words to or from the (big-endian)
+ *  register bytes, around guest accesses to the registers.
  */
-void crime_interrupt_assert(struct interrupt *interrupt)
-{
-	struct crime_data *d = (struct crime_data *) interrupt->extra;
-	uint32_t line = interrupt->line, asserted;
-
-	d->reg[CRIME_INTSTAT + 4] |= ((line >> 24) & 255);
-	d->reg[CRIME_INTSTAT + 5] |= ((line >> 16) & 255);
-	d->reg[CRIME_INTSTAT + 6] |= ((line >> 8) & 255);
-	d->reg[CRIME_INTSTAT + 7] |= (line & 255);
-
-	asserted =
-	    (d->reg[CRIME_INTSTAT + 4] & d->reg[CRIME_INTMASK + 4]) |
-	    (d->reg[CRIME_INTSTAT + 5] & d->reg[CRIME_INTMASK + 5]) |
-	    (d->reg[CRIME_INTSTAT + 6] & d->reg[CRIME_INTMASK + 6]) |
-	    (d->reg[CRIME_INTSTAT + 7] & d->reg[CRIME_INTMASK + 7]);
-
-	if (asserted)
-		INTERRUPT_ASSERT(d->irq);
-}
-void crime_interrupt_deassert(struct interrupt *interrupt)
+static void crime_sync_intregs(struct crime_data *d, int to_reg)
 {
-	struct crime_data *d = (struct crime_data *) interrupt->extra;
-	uint32_t line = interrupt->line, asserted;
-
-	d->reg[CRIME_INTSTAT + 4] &= ~((line >> 24) & 255);
-	d->reg[CRIME_INTSTAT + 5] &= ~((line >> 16) & 255);
-	d->reg[CRIME_INTSTAT + 6] &= ~((line >> 8) & 255);
-	d->reg[CRIME_INTSTAT + 7] &= ~(line & 255);
-
-	asserted =
-	    (d->reg[CRIME_INTSTAT + 4] & d->reg[CRIME_INTMASK + 4]) |
-	    (d->reg[CRIME_INTSTAT + 5] & d->reg[CRIME_INTMASK + 5]) |
-	    (d->reg[CRIME_INTSTAT + 6] & d->reg[CRIME_INTMASK + 6]) |
-	    (d->reg[CRIME_INTSTAT + 7] & d->reg[CRIME_INTMASK + 7]);
-
-	if (!asserted)
-		INTERRUPT_DEASSERT(d->irq);
+	if (to_reg) {
+		d->reg[CRIME_INTSTAT + 4] = d->mask.status >> 24;
+		d->reg[CRIME_INTSTAT + 5] = d->mask.status >> 16;
+		d->reg[CRIME_INTSTAT + 6] = d->mask.status >> 8;
+		d->reg[CRIME_INTSTAT + 7] = d->mask.status;
+		d->reg[CRIME_INTMASK + 4] = d->mask.enabled >> 24;
+		d->reg[CRIME_INTMASK + 5] = d->mask.enabled >> 16;
+		d->reg[CRIME_INTMASK + 6] = d->mask.enabled >> 8;
+		d->reg[CRIME_INTMASK + 7] = d->mask.enabled;
+	} else {
+		d->mask.status = (d->reg[CRIME_INTSTAT + 4] << 24) +
+		    (d->reg[CRIME_INTSTAT + 5] << 16) +
+		    (d->reg[CRIME_INTSTAT + 6] << 8) + d->reg[CRIME_INTSTAT + 7];
+		d->mask.enabled = (d->reg[CRIME_INTMASK + 4] << 24) +
+		    (d->reg[CRIME_INTMASK + 5] << 16) +
+		    (d->reg[CRIME_INTMASK + 6] << 8) + d->reg[CRIME_INTMASK + 7];
+	}
 }
 
 
@@ -193,11 +180,20 @@ DEVICE_ACCESS(crime)
 		return 1;
 	}
 
+	crime_sync_intregs(d, 1);
+
 	if (writeflag == MEM_WRITE)
 		memcpy(&d->reg[relative_addr], data, len);
 	else
 		memcpy(data, &d->reg[relative_addr], len);
 
+	/*  Recalculate interrupt assertions on status or mask writes:  */
+	if (writeflag == MEM_WRITE && relative_addr < CRIME_INTMASK + 8 &&
+	    relative_addr + len > CRIME_INTSTAT) {
+		crime_sync_intregs(d, 0);
+		interrupt_mask_update(&d->mask);
+	}
+
 	switch (relative_addr) {
 	case CRIME_CONTROL:	/*  0x008  */
 		/*  TODO: 64-bit write to CRIME_CONTROL, but some things
@@ -231,13 +227,7 @@ DEVICE_ACCESS(crime)
 	case CRIME_INTSTAT + 4:
 	case CRIME_INTMASK:	/*  0x018,  Current interrupt mask  */
 	case CRIME_INTMASK + 4:
-		if ((d->reg[CRIME_INTSTAT + 4] & d->reg[CRIME_INTMASK + 4]) |
-		    (d->reg[CRIME_INTSTAT + 5] & d->reg[CRIME_INTMASK + 5]) |
-		    (d->reg[CRIME_INTSTAT + 6] & d->reg[CRIME_INTMASK + 6]) |
-		    (d->reg[CRIME_INTSTAT + 7] & d->reg[CRIME_INTMASK + 7]) )
-			INTERRUPT_ASSERT(d->irq);
-		else
-			INTERRUPT_DEASSERT(d->irq);
+		/*  (Handled above.)  */
 		break;
 	case 0x34:
 		/*  don't dump debug info for these  */
@@ -277,21 +267,16 @@ void dev_crime_init(struct machine *machine, struct memory *mem,
 
 	d->use_fb = use_fb;
 
-	INTERRUPT_CONNECT(irq_path, d->irq);
+	/*  All interrupts are masked until the guest OS enables them:  */
+	interrupt_mask_init(&d->mask, irq_path);
+	d->mask.enabled = 0;
 
 	/*  Register 32 crime interrupts (hexadecimal names):  */
 	for (i=0; i<32; i++) {
-		struct interrupt templ;
 		char name[400];
 		snprintf(name, sizeof(name), "%s.crime.0x%x", irq_path, 1 << i);
-		memset(&templ, 0, sizeof(templ));
-                templ.line = 1 << i;
-		templ.name = name;
-		templ.extra = d;
-		templ.interrupt_assert = crime_interrupt_assert;
-		templ.interrupt_deassert = crime_interrupt_deassert;
-		interrupt_handler_register(&templ);
-        }
+		interrupt_mask_register_line(&d->mask, name, 1 << i);
+	}
 
 	memory_device_register(mem, "crime", baseaddr, DEV_CRIME_LENGTH,
 	    dev_crime_access, d, DM_DEFAULT, NULL);
@@ -311,54 +296,51 @@ void dev_crime_init(struct machine *machine, struct memory *mem,
 #define DEV_MACE_LENGTH		0x100
 struct mace_data {
 	unsigned char		reg[DEV_MACE_LENGTH];
-	struct interrupt	irq_periph;
-	struct interrupt	irq_misc;
+
+	/*
+	 *  MACE_ISA_INT_STATUS and MACE_ISA_INT_MASK live here, not in reg[].
+	 *  The high 16 bits of the status word go to the PERIPH (serial)
+	 *  crime interrupt, and the low 16 bits to the MISC crime interrupt.
+	 *  Both are mask controllers cascaded onto the crime mask controller.
+	 */
+	struct interrupt_mask	periph;
+	struct interrupt_mask	misc;
 };
 
+#define	MACE_PERIPH_BITS	0xffff0000
+#define	MACE_MISC_BITS		0x0000ffff
+
 
 /*
- *  mace_interrupt_assert():
- *  mace_interrupt_deassert():
+ *  mace_sync_intregs():
+ *
+ *  Copies the interrupt status and mask words to or from the (big-endian)
+ *  register bytes, around guest accesses to the registers. The status word
+ *  is read-only.
  */
-void mace_interrupt_assert(struct interrupt *interrupt)
-{
-	struct mace_data *d = (struct mace_data *) interrupt->extra;
-	uint32_t line = 1 << interrupt->line;
-
-	d->reg[MACE_ISA_INT_STATUS + 4] |= ((line >> 24) & 255);
-	d->reg[MACE_ISA_INT_STATUS + 5] |= ((line >> 16) & 255);
-	d->reg[MACE_ISA_INT_STATUS + 6] |= ((line >> 8) & 255);
-	d->reg[MACE_ISA_INT_STATUS + 7] |= (line & 255);
-
-	/*  High bits = PERIPH  */
-	if ((d->reg[MACE_ISA_INT_STATUS+4] & d->reg[MACE_ISA_INT_MASK+4]) |
-	    (d->reg[MACE_ISA_INT_STATUS+5] & d->reg[MACE_ISA_INT_MASK+5]))
-		INTERRUPT_ASSERT(d->irq_periph);
-
-	/*  Low bits = MISC  */
-	if ((d->reg[MACE_ISA_INT_STATUS+6] & d->reg[MACE_ISA_INT_MASK+6]) |
-	    (d->reg[MACE_ISA_INT_STATUS+7] & d->reg[MACE_ISA_INT_MASK+7]))
-		INTERRUPT_ASSERT(d->irq_misc);
-}
-void mace_interrupt_deassert(struct interrupt *interrupt)
+static void mace_sync_intregs(struct mace_data *d, int to_reg)
 {
-	struct mace_data *d = (struct mace_data *) interrupt->extra;
-	uint32_t line = 1 << interrupt->line;
-
-	d->reg[MACE_ISA_INT_STATUS + 4] |= ((line >> 24) & 255);
-	d->reg[MACE_ISA_INT_STATUS + 5] |= ((line >> 16) & 255);
-	d->reg[MACE_ISA_INT_STATUS + 6] |= ((line >> 8) & 255);
-	d->reg[MACE_ISA_INT_STATUS + 7] |= (line & 255);
-
-	/*  High bits = PERIPH  */
-	if (!((d->reg[MACE_ISA_INT_STATUS+4] & d->reg[MACE_ISA_INT_MASK+4]) |
-	    (d->reg[MACE_ISA_INT_STATUS+5] & d->reg[MACE_ISA_INT_MASK+5])))
-		INTERRUPT_DEASSERT(d->irq_periph);
-
-	/*  Low bits = MISC  */
-	if (!((d->reg[MACE_ISA_INT_STATUS+6] & d->reg[MACE_ISA_INT_MASK+6]) |
-	    (d->reg[MACE_ISA_INT_STATUS+7] & d->reg[MACE_ISA_INT_MASK+7])))
-		INTERRUPT_DEASSERT(d->irq_misc);
+	if (to_reg) {
+		uint32_t status = d->periph.status | d->misc.status;
+		uint32_t enabled = d->periph.enabled | d->misc.enabled;
+
+		d->reg[MACE_ISA_INT_STATUS + 4] = status >> 24;
+		d->reg[MACE_ISA_INT_STATUS + 5] = status >> 16;
+		d->reg[MACE_ISA_INT_STATUS + 6] = status >> 8;
+		d->reg[MACE_ISA_INT_STATUS + 7] = status;
+		d->reg[MACE_ISA_INT_MASK + 4] = enabled >> 24;
+		d->reg[MACE_ISA_INT_MASK + 5] = enabled >> 16;
+		d->reg[MACE_ISA_INT_MASK + 6] = enabled >> 8;
+		d->reg[MACE_ISA_INT_MASK + 7] = enabled;
+	} else {
+		uint32_t enabled = (d->reg[MACE_ISA_INT_MASK + 4] << 24) +
+		    (d->reg[MACE_ISA_INT_MASK + 5] << 16) +
+		    (d->reg[MACE_ISA_INT_MASK + 6] << 8) +
+		    d->reg[MACE_ISA_INT_MASK + 7];
+
+		d->periph.enabled = enabled & MACE_PERIPH_BITS;
+		d->misc.enabled = enabled & MACE_MISC_BITS;
+	}
 }
 
 
@@ -367,6 +349,8 @@ DEVICE_ACCESS(mace)
 	size_t i;
 	struct mace_data *d = (struct mace_data *) extra;
 
+	mace_sync_intregs(d, 1);
+
 	if (writeflag == MEM_WRITE)
 		memcpy(&d->reg[relative_addr], data, len);
 	else
@@ -383,21 +367,16 @@ DEVICE_ACCESS(mace)
 			for (i=0; i<len; i++)
 				fatal(" %02x", data[i]);
 			fatal(" (len=%i) ]\n", len);
+			mace_sync_intregs(d, 1);
 		}
 		break;
 	case MACE_ISA_INT_MASK:		/*  Current interrupt mask  */
 	case MACE_ISA_INT_MASK + 4:
-		if ((d->reg[MACE_ISA_INT_STATUS+4]&d->reg[MACE_ISA_INT_MASK+4])|
-		    (d->reg[MACE_ISA_INT_STATUS+5]&d->reg[MACE_ISA_INT_MASK+5]))
-			INTERRUPT_ASSERT(d->irq_periph);
-		else
-			INTERRUPT_DEASSERT(d->irq_periph);
-
-		if ((d->reg[MACE_ISA_INT_STATUS+6]&d->reg[MACE_ISA_INT_MASK+6])|
-		    (d->reg[MACE_ISA_INT_STATUS+7]&d->reg[MACE_ISA_INT_MASK+7]))
-			INTERRUPT_ASSERT(d->irq_misc);
-		else
-			INTERRUPT_DEASSERT(d->irq_misc);
+		if (writeflag == MEM_WRITE) {
+			mace_sync_intregs(d, 0);
+			interrupt_mask_update(&d->periph);
+			interrupt_mask_update(&d->misc);
+		}
 		break;
 
 	default:
@@ -427,42 +406,36 @@ DEVINIT(mace)
 	CHECK_ALLOCATION(d = (struct mace_data *) malloc(sizeof(struct mace_data)));
 	memset(d, 0, sizeof(struct mace_data));
 
+	/*  The parents are crime lines, so these cascades are collapsed:  */
 	snprintf(tmpstr, sizeof(tmpstr), "%s.0x%x",
 	    devinit->interrupt_path, MACE_PERIPH_SERIAL);
-	INTERRUPT_CONNECT(tmpstr, d->irq_periph);
+	interrupt_mask_init(&d->periph, tmpstr);
+	d->periph.enabled = 0;
 
 	snprintf(tmpstr, sizeof(tmpstr), "%s.0x%x",
-	    devinit->interrupt_path, MACE_PERIPH_SERIAL);
-	INTERRUPT_CONNECT(tmpstr, d->irq_misc);
+	    devinit->interrupt_path, MACE_PERIPH_MISC);
+	interrupt_mask_init(&d->misc, tmpstr);
+	d->misc.enabled = 0;
 
 	/*
-	 *  For Mace interrupts MACE_PERIPH_SERIAL and MACE_PERIPH_MISC,
-	 *  register 32 mace interrupts each.
+	 *  Register 32 mace interrupts under each of MACE_PERIPH_SERIAL and
+	 *  MACE_PERIPH_MISC. Mace interrupt i is bit i of the status word,
+	 *  regardless of which of the two names is used.
 	 */
-	/*  Register 32 crime interrupts (hexadecimal names):  */
 	for (i=0; i<32; i++) {
-		struct interrupt templ;
+		uint32_t bit = (uint32_t) 1 << i;
+		struct interrupt_mask *m = bit & MACE_PERIPH_BITS?
+		    &d->periph : &d->misc;
 		char name[400];
+
 		snprintf(name, sizeof(name), "%s.0x%x.mace.%i",
 		    devinit->interrupt_path, MACE_PERIPH_SERIAL, i);
-		memset(&templ, 0, sizeof(templ));
-                templ.line = i;
-		templ.name = name;
-		templ.extra = d;
-		templ.interrupt_assert = mace_interrupt_assert;
-		templ.interrupt_deassert = mace_interrupt_deassert;
-		interrupt_handler_register(&templ);
+		interrupt_mask_register_line(m, name, bit);
 
 		snprintf(name, sizeof(name), "%s.0x%x.mace.%i",
 		    devinit->interrupt_path, MACE_PERIPH_MISC, i);
-		memset(&templ, 0, sizeof(templ));
-                templ.line = i;
-		templ.name = name;
-		templ.extra = d;
-		templ.interrupt_assert = mace_interrupt_assert;
-		templ.interrupt_deassert = mace_interrupt_deassert;
-		interrupt_handler_register(&templ);
-        }
+		interrupt_mask_register_line(m, name, bit);
+	}
 
 	memory_device_register(devinit->machine->memory, devinit->name,
 	    devinit->addr, DEV_MACE_LENGTH, dev_mace_access, d,
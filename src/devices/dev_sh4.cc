@@ -301,34 +301,31 @@ DEVICE_TICK(sh4)
 
 
 /*
- *  sh4_dmac_transfer():
+ *  sh4_dmac_setup():
  *
- *  Called whenever a DMA transfer is to be executed.
- *  Clears the lowest bit of the corresponding channel's CHCR when done.
+ *  Decodes the transfer count, transmit size, and address modes of a DMA
+ *  channel. Returns 1 if a transfer should be performed, 0 if the channel
+ *  is not enabled or if the transfer has already ended.
  */
-void sh4_dmac_transfer(struct cpu *cpu, struct sh4_data *d, int channel)
+int sh4_dmac_setup(struct cpu *cpu, int channel, uint32_t *countp,
+	int *transmit_sizep, int *src_deltap, int *dst_deltap)
 {
-	/*  According to the SH7760 manual, bits 31..29 are ignored in  */
-	/*  both the SAR and DAR.  */
-	uint32_t sar = cpu->cd.sh.dmac_sar[channel] & 0x1fffffff;
-	uint32_t dar = cpu->cd.sh.dmac_dar[channel] & 0x1fffffff;
-	uint32_t count = cpu->cd.sh.dmac_tcr[channel] & 0x1fffffff;
 	uint32_t chcr = cpu->cd.sh.dmac_chcr[channel];
-	int transmit_size = 1;
-	int src_delta = 0, dst_delta = 0;
-	int cause_interrupt = chcr & CHCR_IE;
+	int transmit_size = 1, src_delta = 0, dst_delta = 0;
 
 	/*  DMAC not enabled? Then just return.  */
 	if (!(chcr & CHCR_TD))
-		return;
+		return 0;
 
 	/*  Transfer End already set? Then don't transfer again.  */
 	if (chcr & CHCR_TE)
-		return;
+		return 0;
+
+	*countp = cpu->cd.sh.dmac_tcr[channel] & 0x1fffffff;
 
 	/*  Special case: 0 means 16777216:  */
-	if (count == 0)
-		count = 16777216;
+	if (*countp == 0)
+		*countp = 16777216;
 
 	switch (chcr & CHCR_TS) {
 	case CHCR_TS_8BYTE: transmit_size = 8; break;
@@ -359,8 +356,135 @@ void sh4_dmac_transfer(struct cpu *cpu, struct sh4_data *d, int channel)
 	exit(1);
 	}
 
-	src_delta *= transmit_size;
-	dst_delta *= transmit_size;
+	*transmit_sizep = transmit_size;
+	*src_deltap = src_delta * transmit_size;
+	*dst_deltap = dst_delta * transmit_size;
+
+	return 1;
+}
+
+
+/*
+ *  sh4_dmac_copy():
+ *
+ *  Copies count units of transmit_size bytes from physical address *sarp to
+ *  physical address *darp, and advances *sarp and *darp.
+ *
+ *  When both addresses are incremented and both sides are backed by host
+ *  memory (RAM, or RAM-like devices), as much as possible is copied at once
+ *  using memmove(). Other device space is accessed one unit at a time,
+ *  using 32-bit (or smaller) accesses.
+ */
+void sh4_dmac_copy(struct cpu *cpu, uint32_t *sarp, uint32_t *darp,
+	uint32_t count, int transmit_size, int src_delta, int dst_delta)
+{
+	uint32_t sar = *sarp, dar = *darp;
+	size_t chunksize = transmit_size;
+	int ofs;
+
+	if (chunksize > sizeof(uint32_t))
+		chunksize = sizeof(uint32_t);
+
+	while (count > 0) {
+		if (src_delta == transmit_size && dst_delta == transmit_size) {
+			size_t len = (size_t) count * transmit_size;
+			unsigned char *src, *dst = NULL;
+
+			src = memory_paddr_to_hostrange(cpu->mem, sar,
+			    MEM_READ, &len);
+			len -= len % transmit_size;
+			if (src != NULL && len > 0)
+				dst = memory_paddr_to_hostrange(cpu->mem, dar,
+				    MEM_WRITE, &len);
+			len -= len % transmit_size;
+
+			if (dst != NULL && len > 0) {
+				uint32_t page;
+
+				memmove(dst, src, len);
+
+				/*  Invalidate code translations:  */
+				for (page = dar & ~0xfff; page < dar + len;
+				    page += 0x1000)
+					cpu->invalidate_code_translation(cpu,
+					    page, INVALIDATE_PADDR);
+
+				sar += len;
+				dar += len;
+				count -= len / transmit_size;
+				continue;
+			}
+		}
+
+		for (ofs = 0; ofs < transmit_size; ofs += chunksize) {
+			unsigned char buf[sizeof(uint32_t)];
+
+			cpu->memory_rw(cpu, cpu->mem, sar + ofs, buf,
+			    chunksize, MEM_READ, NO_EXCEPTIONS | PHYSICAL);
+			cpu->memory_rw(cpu, cpu->mem, dar + ofs, buf,
+			    chunksize, MEM_WRITE, NO_EXCEPTIONS | PHYSICAL);
+		}
+
+		sar += src_delta;
+		dar += dst_delta;
+		count --;
+	}
+
+	*sarp = sar;
+	*darp = dar;
+}
+
+
+/*
+ *  sh4_dmac_transfer_end():
+ *
+ *  Writes back the final source and destination addresses of a transfer,
+ *  sets the Transfer End bit, and causes a DMTE interrupt if the channel
+ *  has interrupts enabled.
+ */
+void sh4_dmac_transfer_end(struct cpu *cpu, int channel, uint32_t sar,
+	uint32_t dar)
+{
+	cpu->cd.sh.dmac_sar[channel] = (cpu->cd.sh.dmac_sar[channel]
+	    & 0xe0000000) | (sar & 0x1fffffff);
+	cpu->cd.sh.dmac_dar[channel] = (cpu->cd.sh.dmac_dar[channel]
+	    & 0xe0000000) | (dar & 0x1fffffff);
+	cpu->cd.sh.dmac_tcr[channel] = 0;
+	cpu->cd.sh.dmac_chcr[channel] |= CHCR_TE;
+
+	if (cpu->cd.sh.dmac_chcr[channel] & CHCR_IE) {
+		if (channel < N_SH4_DMA_INTERRUPTS)
+			INTERRUPT_ASSERT(cpu->cd.sh.dmac_irq[channel]);
+		else
+			fatal("[ sh4 dmac: TODO: interrupt for channel"
+			    " %i ]\n", channel);
+	}
+}
+
+
+/*
+ *  sh4_dmac_transfer():
+ *
+ *  Called whenever a DMA transfer is to be executed.
+ *
+ *  There is no emulation of transfer timing; the whole transfer is
+ *  performed at once, and the Transfer End bit is set (and an interrupt
+ *  is caused, if enabled) before returning. Transfers on behalf of on-chip
+ *  peripherals (SCI, SCIF, TMU) are performed as if auto-requested.
+ */
+void sh4_dmac_transfer(struct cpu *cpu, struct sh4_data *d, int channel)
+{
+	/*  According to the SH7760 manual, bits 31..29 are ignored in  */
+	/*  both the SAR and DAR.  */
+	uint32_t sar = cpu->cd.sh.dmac_sar[channel] & 0x1fffffff;
+	uint32_t dar = cpu->cd.sh.dmac_dar[channel] & 0x1fffffff;
+	uint32_t chcr = cpu->cd.sh.dmac_chcr[channel];
+	uint32_t count;
+	int transmit_size, src_delta, dst_delta;
+
+	if (!sh4_dmac_setup(cpu, channel, &count, &transmit_size,
+	    &src_delta, &dst_delta))
+		return;
 
 #ifdef SH4_DEGUG
 	fatal("|SH4 DMA transfer, channel %i\n", channel);
@@ -368,18 +492,35 @@ void sh4_dmac_transfer(struct cpu *cpu, struct sh4_data *d, int channel)
 	fatal("|Destination addr: 0x%08x (delta %i)\n", (int) dar, dst_delta);
 	fatal("|Count:            0x%08x\n", (int) count);
 	fatal("|Transmit size:    0x%08x\n", (int) transmit_size);
-	fatal("|Interrupt:        %s\n", cause_interrupt? "yes" : "no");
+	fatal("|Interrupt:        %s\n", chcr & CHCR_IE? "yes" : "no");
 #endif
 
 	switch (chcr & CHCR_RS) {
 	case 0x200:
+	case 0x300:
 		/*
 		 *  Single Address Mode
-		 *  External Address Space => external device
+		 *  External Address Space <=> external device
 		 */
 
 		/*  Note: No transfer is done here! It is up to the
-		    external device to do the transfer itself!  */
+		    external device to do the transfer itself, and
+		    then call sh4_dmac_transfer_end().  */
+		return;
+
+	case 0x000:	/*  External request, dual address mode  */
+	case 0x400:	/*  Auto request, external => external  */
+	case 0x500:	/*  Auto request, external => on-chip peripheral  */
+	case 0x600:	/*  Auto request, on-chip peripheral => external  */
+	case 0x800:	/*  SCI transmit-data-empty  */
+	case 0x900:	/*  SCI receive-data-full  */
+	case 0xa00:	/*  SCIF transmit-data-empty  */
+	case 0xb00:	/*  SCIF receive-data-full  */
+	case 0xc00:	/*  TMU channel 2 input capture  */
+	case 0xd00:
+	case 0xe00:
+		sh4_dmac_copy(cpu, &sar, &dar, count, transmit_size,
+		    src_delta, dst_delta);
 		break;
 
 	default:fatal("Unimplemented SH4 RS DMAC: 0x%08x\n",
@@ -387,10 +528,7 @@ void sh4_dmac_transfer(struct cpu *cpu, struct sh4_data *d, int channel)
 		exit(1);
 	}
 
-	if (cause_interrupt) {
-		fatal("TODO: sh4 dmac interrupt!\n");
-		exit(1);
-	}
+	sh4_dmac_transfer_end(cpu, channel, sar, dar);
 }
 
 
@@ -1237,7 +1375,7 @@ DEVICE_ACCESS(sh4)
 	case SH4_SAR3:	dma_channel ++;
 	case SH4_SAR2:	dma_channel ++;
 	case SH4_SAR1:	dma_channel ++;
-	case SH4_SAR0:	dma_channel ++;
+	case SH4_SAR0:
 		if (writeflag == MEM_READ)
 			odata = cpu->cd.sh.dmac_sar[dma_channel];
 		else
@@ -1251,7 +1389,7 @@ DEVICE_ACCESS(sh4)
 	case SH4_DAR3:	dma_channel ++;
 	case SH4_DAR2:	dma_channel ++;
 	case SH4_DAR1:	dma_channel ++;
-	case SH4_DAR0:	dma_channel ++;
+	case SH4_DAR0:
 		if (writeflag == MEM_READ)
 			odata = cpu->cd.sh.dmac_dar[dma_channel];
 		else
@@ -1265,7 +1403,7 @@ DEVICE_ACCESS(sh4)
 	case SH4_DMATCR3: dma_channel ++;
 	case SH4_DMATCR2: dma_channel ++;
 	case SH4_DMATCR1: dma_channel ++;
-	case SH4_DMATCR0: dma_channel ++;
+	case SH4_DMATCR0:
 		if (writeflag == MEM_READ)
 			odata = cpu->cd.sh.dmac_tcr[dma_channel] & 0x00ffffff;
 		else {
@@ -1287,7 +1425,7 @@ DEVICE_ACCESS(sh4)
 	case SH4_CHCR3:	dma_channel ++;
 	case SH4_CHCR2:	dma_channel ++;
 	case SH4_CHCR1:	dma_channel ++;
-	case SH4_CHCR0:	dma_channel ++;
+	case SH4_CHCR0:
 		if (writeflag == MEM_READ) {
 			odata = cpu->cd.sh.dmac_chcr[dma_channel];
 		} else {
@@ -1296,6 +1434,12 @@ DEVICE_ACCESS(sh4)
 
 			cpu->cd.sh.dmac_chcr[dma_channel] = idata;
 
+			/*  Clearing Transfer End acknowledges the interrupt:  */
+			if (!(idata & CHCR_TE) &&
+			    dma_channel < N_SH4_DMA_INTERRUPTS)
+				INTERRUPT_DEASSERT(
+				    cpu->cd.sh.dmac_irq[dma_channel]);
+
 			/*  Perform a transfer?  */
 			if (idata & CHCR_TD)
 				sh4_dmac_transfer(cpu, d, dma_channel);
@@ -1303,6 +1447,15 @@ DEVICE_ACCESS(sh4)
 		break;
 
 
+	case SH4_DMAOR:
+		if (writeflag == MEM_READ)
+			odata = cpu->cd.sh.dmac_dmaor;
+		else
+			cpu->cd.sh.dmac_dmaor = idata & (DMAOR_DDT |
+			    DMAOR_PR | DMAOR_AE | DMAOR_NMIF | DMAOR_DME);
+		break;
+
+
 	/*************************************************/
 	/*  BSC: Bus State Controller                    */
 
@@ -583,7 +583,7 @@ DEVICE_ACCESS(vr41xx)
 	case 0xc4:
 		{
 			struct timeval tv;
-			gettimeofday(&tv, NULL);
+			timer_gettimeofday(&tv);
 			/*  Adjust time by 120 years and 29 days.  */
 			tv.tv_sec += (int64_t) (120*365 + 29) * 24*60*60;
 
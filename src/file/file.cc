@@ -42,7 +42,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "cpu.h"
 #include "machine.h"
@@ -50,6 +54,16 @@
 #include "misc.h"
 #include "symbol.h"
 
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef WITH_LZMA
+#include <lzma.h>
+#endif
+#ifdef WITH_ZSTD
+#include <zstd.h>
+#endif
+
 
 extern int quiet_mode;
 extern int verbose;
@@ -86,6 +100,367 @@ static int n_executables_loaded = 0;
 	}
 
 
+/*
+ *  The file being loaded is kept in memory as one image: uncompressed files
+ *  are mmap()ed, and gzip, xz, or zstd compressed files are decompressed
+ *  into a malloc()ed buffer. file_open() returns a stdio stream on top of
+ *  the image, so the loaders can parse headers with fread() and fseek() as
+ *  usual, and file_copy_to_guest() copies segments from the image straight
+ *  into the guest's RAM pages.
+ *
+ *  The image is kept until file_load() returns, so that the file only has
+ *  to be mapped (and decompressed) once, even though the file format is
+ *  sensed before the actual loader opens it again.
+ */
+static char *file_image_name = NULL;
+static unsigned char *file_image_data = NULL;
+static size_t file_image_len = 0;
+static int file_image_mapped = 0;
+
+
+/*
+ *  file_image_free():
+ *
+ *  Release the current file image, if any.
+ */
+static void file_image_free(void)
+{
+	if (file_image_data != NULL) {
+		if (file_image_mapped)
+			munmap(file_image_data, file_image_len);
+		else
+			free(file_image_data);
+	}
+
+	free(file_image_name);
+
+	file_image_name = NULL;
+	file_image_data = NULL;
+	file_image_len = 0;
+	file_image_mapped = 0;
+}
+
+
+/*
+ *  file_image_grow():
+ *
+ *  Helper for the decompressors: make room for at least one more byte in
+ *  the output buffer. Returns the number of bytes now available at *outp.
+ */
+static size_t file_image_grow(unsigned char **bufp, size_t *allocp,
+	size_t used, unsigned char **outp)
+{
+	if (used == *allocp) {
+		*allocp = *allocp == 0? 1048576 : *allocp * 2;
+		CHECK_ALLOCATION(*bufp = (unsigned char *)
+		    realloc(*bufp, *allocp));
+	}
+
+	*outp = *bufp + used;
+	return *allocp - used;
+}
+
+
+/*
+ *  file_image_decompress():
+ *
+ *  If the len bytes at data are gzip, xz, or zstd compressed, then
+ *  decompress them into a new buffer, set *lenp to the decompressed
+ *  length, and return the buffer. Otherwise, return NULL.
+ */
+static unsigned char *file_image_decompress(const char *filename,
+	unsigned char *data, size_t len, size_t *lenp)
+{
+	unsigned char *buf = NULL, *out;
+	size_t alloc = 0, used = 0, avail;
+
+	if (len >= 2 && data[0] == 0x1f && data[1] == 0x8b) {
+#ifdef WITH_ZLIB
+		z_stream zs;
+		int res = Z_OK;
+
+		debug("(gzip compressed)\n");
+		memset(&zs, 0, sizeof(zs));
+
+		/*  15 + 32: gzip or zlib header, detected automatically.  */
+		if (inflateInit2(&zs, 15 + 32) != Z_OK) {
+			fprintf(stderr, "%s: inflateInit2 failed\n", filename);
+			exit(1);
+		}
+
+		zs.next_in = data;
+		zs.avail_in = len;
+
+		while (zs.avail_in > 0 || res != Z_STREAM_END) {
+			/*  Concatenated gzip members:  */
+			if (res == Z_STREAM_END)
+				inflateReset(&zs);
+
+			avail = file_image_grow(&buf, &alloc, used, &out);
+			zs.next_out = out;
+			zs.avail_out = avail;
+			res = inflate(&zs, Z_NO_FLUSH);
+			used += avail - zs.avail_out;
+
+			if (res != Z_OK && res != Z_STREAM_END) {
+				fprintf(stderr, "%s: gzip data is corrupt\n",
+				    filename);
+				exit(1);
+			}
+		}
+
+		inflateEnd(&zs);
+		*lenp = used;
+		return buf;
+#else
+		fprintf(stderr, "\n%s is gzip compressed, but GXemul was "
+		    "built without zlib.\nYou need to gunzip the file before "
+		    "you try to use it.\n", filename);
+		exit(1);
+#endif
+	}
+
+	if (len >= 6 && memcmp(data, "\xfd" "7zXZ\0", 6) == 0) {
+#ifdef WITH_LZMA
+		lzma_stream ls = LZMA_STREAM_INIT;
+		lzma_ret res = LZMA_OK;
+
+		debug("(xz compressed)\n");
+
+		if (lzma_stream_decoder(&ls, UINT64_MAX, LZMA_CONCATENATED)
+		    != LZMA_OK) {
+			fprintf(stderr, "%s: lzma_stream_decoder failed\n",
+			    filename);
+			exit(1);
+		}
+
+		ls.next_in = data;
+		ls.avail_in = len;
+
+		while (res != LZMA_STREAM_END) {
+			avail = file_image_grow(&buf, &alloc, used, &out);
+			ls.next_out = out;
+			ls.avail_out = avail;
+			res = lzma_code(&ls, ls.avail_in == 0?
+			    LZMA_FINISH : LZMA_RUN);
+			used += avail - ls.avail_out;
+
+			if (res != LZMA_OK && res != LZMA_STREAM_END) {
+				fprintf(stderr, "%s: xz data is corrupt\n",
+				    filename);
+				exit(1);
+			}
+		}
+
+		lzma_end(&ls);
+		*lenp = used;
+		return buf;
+#else
+		fprintf(stderr, "\n%s is xz compressed, but GXemul was "
+		    "built without liblzma.\nYou need to unxz the file before "
+		    "you try to use it.\n", filename);
+		exit(1);
+#endif
+	}
+
+	if (len >= 4 && data[0] == 0x28 && data[1] == 0xb5 &&
+	    data[2] == 0x2f && data[3] == 0xfd) {
+#ifdef WITH_ZSTD
+		ZSTD_DStream *zds = ZSTD_createDStream();
+		ZSTD_inBuffer in;
+		size_t res = 1;
+
+		debug("(zstd compressed)\n");
+
+		if (zds == NULL) {
+			fprintf(stderr, "%s: ZSTD_createDStream failed\n",
+			    filename);
+			exit(1);
+		}
+
+		ZSTD_initDStream(zds);
+		in.src = data;
+		in.size = len;
+		in.pos = 0;
+
+		while (in.pos < in.size || res != 0) {
+			ZSTD_outBuffer zout;
+
+			avail = file_image_grow(&buf, &alloc, used, &out);
+			zout.dst = out;
+			zout.size = avail;
+			zout.pos = 0;
+			res = ZSTD_decompressStream(zds, &zout, &in);
+			used += zout.pos;
+
+			if (ZSTD_isError(res) ||
+			    (in.pos == in.size && res != 0 && zout.pos == 0)) {
+				fprintf(stderr, "%s: zstd data is corrupt\n",
+				    filename);
+				exit(1);
+			}
+		}
+
+		ZSTD_freeDStream(zds);
+		*lenp = used;
+		return buf;
+#else
+		fprintf(stderr, "\n%s is zstd compressed, but GXemul was "
+		    "built without libzstd.\nYou need to unzstd the file "
+		    "before you try to use it.\n", filename);
+		exit(1);
+#endif
+	}
+
+	return NULL;
+}
+
+
+/*
+ *  file_image_load():
+ *
+ *  Map a file into memory, and decompress it if necessary. Returns 1 on
+ *  success, 0 if the file could not be opened.
+ */
+static int file_image_load(const char *filename)
+{
+	unsigned char *data, *decompressed;
+	struct stat st;
+	size_t len;
+	int fd;
+
+	fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return 0;
+
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+		close(fd);
+		return 0;
+	}
+
+	len = st.st_size;
+	data = NULL;
+	if (len > 0) {
+		data = (unsigned char *) mmap(NULL, len, PROT_READ,
+		    MAP_PRIVATE, fd, 0);
+		if (data == (unsigned char *) MAP_FAILED) {
+			perror(filename);
+			exit(1);
+		}
+	}
+
+	close(fd);
+
+	CHECK_ALLOCATION(file_image_name = strdup(filename));
+	file_image_data = data;
+	file_image_len = len;
+	file_image_mapped = 1;
+
+	decompressed = file_image_decompress(filename, data, len, &len);
+	if (decompressed != NULL) {
+		munmap(data, file_image_len);
+		file_image_data = decompressed;
+		file_image_len = len;
+		file_image_mapped = 0;
+	}
+
+	return 1;
+}
+
+
+/*
+ *  file_open():
+ *
+ *  Open a file for reading, through the in-memory file image. (The image
+ *  is reused if the same file was opened before.) Returns NULL if the file
+ *  could not be opened.
+ */
+static FILE *file_open(const char *filename)
+{
+	if (file_image_name == NULL || strcmp(file_image_name, filename) != 0) {
+		file_image_free();
+		if (!file_image_load(filename))
+			return NULL;
+	}
+
+	/*  fmemopen() may not accept zero-length buffers:  */
+	if (file_image_len == 0)
+		return fopen(filename, "r");
+
+	return fmemopen(file_image_data, file_image_len, "r");
+}
+
+
+/*
+ *  file_copy_to_guest():
+ *
+ *  Copy len bytes, from the current position of f (which must have been
+ *  opened by file_open()) in the file image, to virtual address vaddr in
+ *  emulated memory. The stream position is advanced past the copied data.
+ *
+ *  Pages which translate to plain RAM are copied into directly; anything
+ *  else (devices, unmapped addresses) goes through memory_rw().
+ *
+ *  Returns the number of bytes copied, which is less than len only if the
+ *  end of the file was reached.
+ */
+static size_t file_copy_to_guest(struct machine *m, struct memory *mem,
+	uint64_t vaddr, FILE *f, size_t len)
+{
+	struct cpu *cpu = m->cpus[0];
+	const size_t pagesize = 4096;
+	off_t pos = ftello(f);
+	unsigned char *src;
+	size_t copied = 0;
+
+	if (pos < 0 || (size_t) pos >= file_image_len)
+		return 0;
+
+	if (len > file_image_len - pos)
+		len = file_image_len - pos;
+
+	src = file_image_data + pos;
+
+	while (copied < len) {
+		size_t chunk = pagesize - (vaddr & (pagesize - 1));
+		unsigned char *host_page = NULL;
+		uint64_t paddr = vaddr;
+		int ok = 1;
+
+		if (chunk > len - copied)
+			chunk = len - copied;
+
+		if (cpu->translate_v2p != NULL)
+			ok = cpu->translate_v2p(cpu, vaddr, &paddr,
+			    FLAG_WRITEFLAG | FLAG_NOEXCEPTIONS);
+
+		if (ok && !(ok & MEMORY_NOT_FULL_PAGE) &&
+		    paddr < mem->physical_max &&
+		    (paddr < mem->mmap_dev_minaddr ||
+		    paddr >= mem->mmap_dev_maxaddr))
+			host_page = memory_paddr_to_hostaddr(mem,
+			    paddr & ~(pagesize - 1), MEM_WRITE);
+
+		if (host_page != NULL) {
+			memcpy(host_page + (paddr & (pagesize - 1)),
+			    src + copied, chunk);
+
+			if (cpu->invalidate_code_translation != NULL)
+				cpu->invalidate_code_translation(cpu, paddr,
+				    INVALIDATE_PADDR);
+		} else
+			cpu->memory_rw(cpu, mem, vaddr, src + copied, chunk,
+			    MEM_WRITE, NO_EXCEPTIONS);
+
+		vaddr += chunk;
+		copied += chunk;
+	}
+
+	fseeko(f, pos + copied, SEEK_SET);
+	return copied;
+}
+
+
 #include "file_aout.cc"
 #include "file_ecoff.cc"
 #include "file_elf.cc"
@@ -155,7 +530,7 @@ void file_load(struct machine *machine, struct memory *mem,
 	if (verbose < 2)
 		quiet_mode = 1;
 
-	f = fopen(filename, "r");
+	f = file_open(filename);
 	if (f == NULL) {
 		file_load_raw(machine, mem, filename, entrypointp);
 		goto ret;
@@ -274,13 +649,6 @@ void file_load(struct machine *machine, struct memory *mem,
 		goto ret;
 	}
 
-	/*  gzipped files are not supported:  */
-	if (buf[0]==0x1f && buf[1]==0x8b) {
-		fprintf(stderr, "\nYou need to gunzip the file before you"
-		    " try to use it.\n");
-		exit(1);
-	}
-
 	if (size > 24000000) {
 		fprintf(stderr, "\nThis file is very large (%lli bytes)\n",
 		    (long long)size);
@@ -356,6 +724,7 @@ void file_load(struct machine *machine, struct memory *mem,
 	symbol_readfile(&machine->symbol_context, filename);
 
 ret:
+	file_image_free();
 	debug_indentation(-iadd);
 	quiet_mode = old_quiet_mode;
 }
@@ -66,13 +66,13 @@ static void file_load_aout(struct machine *m, struct memory *mem,
 	uint32_t entry, datasize, textsize;
 	int32_t symbsize = 0;
 	uint32_t vaddr, total_len;
-	unsigned char buf[65536];
+	unsigned char buf[32];
 	unsigned char *syms;
 
 	if (m->cpus[0]->byte_order == EMUL_BIG_ENDIAN)
 		encoding = ELFDATA2MSB;
 
-	f = fopen(filename, "r");
+	f = file_open(filename);
 	if (f == NULL) {
 		perror(filename);
 		exit(1);
@@ -130,39 +130,11 @@ static void file_load_aout(struct machine *m, struct memory *mem,
 
 	/*  Load text and data:  */
 	total_len = textsize + datasize;
-	while (total_len != 0) {
-		len = total_len > sizeof(buf) ? sizeof(buf) : total_len;
-		len = fread(buf, 1, len, f);
-
-		/*  printf("fread len=%i vaddr=%x buf[0..]=%02x %02x %02x\n",
-		    (int)len, (int)vaddr, buf[0], buf[1], buf[2]);  */
-
-		if (len > 0) {
-			int len2 = 0;
-			uint64_t vaddr1 = vaddr &
-			    ((1 << BITS_PER_MEMBLOCK) - 1);
-			uint64_t vaddr2 = (vaddr +
-			    len) & ((1 << BITS_PER_MEMBLOCK) - 1);
-			if (vaddr2 < vaddr1) {
-				len2 = len - vaddr2;
-				m->cpus[0]->memory_rw(m->cpus[0], mem, vaddr,
-				    &buf[0], len2, MEM_WRITE, NO_EXCEPTIONS);
-			}
-			m->cpus[0]->memory_rw(m->cpus[0], mem, vaddr + len2,
-			    &buf[len2], len-len2, MEM_WRITE, NO_EXCEPTIONS);
-		} else {
-			if (flags & AOUT_FLAG_DECOSF1)
-				break;
-			else {
-				fprintf(stderr, "could not read from %s,"
-				    " wanted to read %i bytes\n", filename,
-				    (int) total_len);
-				exit(1);
-			}
-		}
-
-		vaddr += len;
-		total_len -= len;
+	len = file_copy_to_guest(m, mem, vaddr, f, total_len);
+	if (len != (int) total_len && !(flags & AOUT_FLAG_DECOSF1)) {
+		fprintf(stderr, "could not read from %s, wanted to read %i "
+		    "bytes\n", filename, (int) (total_len - len));
+		exit(1);
 	}
 
 	if (symbsize != 0) {
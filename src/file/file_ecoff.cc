@@ -63,12 +63,11 @@ static void file_load_ecoff(struct machine *m, struct memory *mem,
 	const char *format_name;
 	struct ecoff_scnhdr scnhdr;
 	FILE *f;
-	int len, secn, total_len, chunk_size;
+	int len, secn, total_len;
 	int encoding = ELFDATA2LSB;	/*  Assume little-endian. See below  */
 	int program_byte_order = -1;
-	unsigned char buf[8192];
 
-	f = fopen(filename, "r");
+	f = file_open(filename);
 	if (f == NULL) {
 		perror(filename);
 		exit(1);
@@ -162,19 +161,9 @@ static void file_load_ecoff(struct machine *m, struct memory *mem,
 	 *  Then load everything after the header to the text start address.
 	 */
 	if (f_nscns == 0 && a_magic == 0x108) {
-		uint64_t where = a_tstart;
-		total_len = 0;
 		fseek(f, 0x50, SEEK_SET);
-		while (!feof(f)) {
-			chunk_size = 256;
-			len = fread(buf, 1, chunk_size, f);
-
-			if (len > 0)
-				m->cpus[0]->memory_rw(m->cpus[0], mem, where,
-				    &buf[0], len, MEM_WRITE, NO_EXCEPTIONS);
-			where += len;
-			total_len += len;
-		}
+		total_len = file_copy_to_guest(m, mem, a_tstart, f,
+		    (size_t) -1);
 		debug("MACH/pmax hack (!), read 0x%x bytes\n", total_len);
 	}
 
@@ -237,28 +226,11 @@ static void file_load_ecoff(struct machine *m, struct memory *mem,
 
 			/*  Load the section into emulated memory:  */
 			fseek(f, s_scnptr, SEEK_SET);
-			total_len = 0;
-			chunk_size = 1;
-			if ((s_vaddr & 0xf) == 0)	chunk_size = 0x10;
-			if ((s_vaddr & 0xff) == 0)	chunk_size = 0x100;
-			if ((s_vaddr & 0xfff) == 0)	chunk_size = 0x1000;
-			while (total_len < s_size) {
-				len = chunk_size;
-				if (total_len + len > s_size)
-					len = s_size - total_len;
-				len = fread(buf, 1, chunk_size, f);
-				if (len == 0) {
-					debug("!!! total_len = %i, "
-					    "chunk_size = %i, len = %i\n",
-					    total_len, chunk_size, len);
-					break;
-				}
-
-				m->cpus[0]->memory_rw(m->cpus[0], mem, s_vaddr,
-				    &buf[0], len, MEM_WRITE, NO_EXCEPTIONS);
-				s_vaddr += len;
-				total_len += len;
-			}
+			total_len = file_copy_to_guest(m, mem, s_vaddr, f,
+			    s_size);
+			if (total_len != s_size)
+				debug("!!! total_len = %i, s_size = %i\n",
+				    total_len, s_size);
 
 			/*  Return to position inside the section headers:  */
 			fseek(f, oldpos, SEEK_SET);
@@ -311,6 +283,8 @@ static void file_load_ecoff(struct machine *m, struct memory *mem,
 			len = fread(ms_sym_buf, 1,
 			    sizeof(struct ms_sym) * f_nsyms, f);
 			sym = (struct ms_sym *) ms_sym_buf;
+			symbol_reserve(&m->symbol_context,
+			    symbol_nsymbols(&m->symbol_context) + f_nsyms);
 			for (sym_nr=0; sym_nr<f_nsyms; sym_nr++) {
 				char name[300];
 				uint32_t v, t, altname;
@@ -410,6 +384,9 @@ static void file_load_ecoff(struct machine *m, struct memory *mem,
 			extsyms[sym_nr].es_value    = value;
 		}
 
+		symbol_reserve(&m->symbol_context,
+		    symbol_nsymbols(&m->symbol_context) + nsymbols);
+
 		for (sym_nr=0; sym_nr<nsymbols; sym_nr++) {
 			/*  debug("symbol%6i: 0x%08x = %s\n",
 			    sym_nr, (int)extsyms[sym_nr].es_value,
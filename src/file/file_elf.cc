@@ -91,8 +91,6 @@ static void file_load_elf(struct machine *m, struct memory *mem,
 	Elf64_Shdr shdr64;
 	Elf32_Sym sym32;
 	Elf64_Sym sym64;
-	int ofs;
-	int chunk_len = 1024, align_len;
 	char *symbol_strings = NULL;
 	size_t symbol_length = 0;
 	const char *s;
@@ -100,7 +98,7 @@ static void file_load_elf(struct machine *m, struct memory *mem,
 	Elf32_Sym *symbols_sym32 = NULL;
 	Elf64_Sym *symbols_sym64 = NULL;
 
-	f = fopen(filename, "r");
+	f = file_open(filename);
 	if (f == NULL) {
 		perror(filename);
 		exit(1);
@@ -427,52 +425,7 @@ static void file_load_elf(struct machine *m, struct memory *mem,
 			}
 
 			fseek(f, p_offset, SEEK_SET);
-			align_len = 1;
-			if ((p_vaddr & 0xf)==0)		align_len = 0x10;
-			if ((p_vaddr & 0x3f)==0)	align_len = 0x40;
-			if ((p_vaddr & 0xff)==0)	align_len = 0x100;
-			if ((p_vaddr & 0xfff)==0)	align_len = 0x1000;
-			if ((p_vaddr & 0x3fff)==0)	align_len = 0x4000;
-			if ((p_vaddr & 0xffff)==0)	align_len = 0x10000;
-			ofs = 0;  len = chunk_len = align_len;
-			while (ofs < (int64_t)p_filesz && len==chunk_len) {
-				unsigned char *ch;
-				int i = 0;
-
-				CHECK_ALLOCATION(ch = (unsigned char *) malloc(chunk_len));
-
-				/*  Switch to larger size, if possible:  */
-				if (align_len < 0x10000 &&
-				    ((p_vaddr + ofs) & 0xffff)==0) {
-					align_len = 0x10000;
-					len = chunk_len = align_len;
-					free(ch);
-					CHECK_ALLOCATION(ch=(unsigned char *)malloc(chunk_len));
-				} else if (align_len < 0x1000 &&
-				    ((p_vaddr + ofs) & 0xfff)==0) {
-					align_len = 0x1000;
-					len = chunk_len = align_len;
-					free(ch);
-					CHECK_ALLOCATION(ch=(unsigned char *)malloc(chunk_len));
-				}
-
-				len = fread(&ch[0], 1, chunk_len, f);
-				if (ofs + len > (int64_t)p_filesz)
-					len = p_filesz - ofs;
-
-				while (i < len) {
-					size_t len_to_copy;
-					len_to_copy = (i + align_len) <= len?
-					    align_len : len - i;
-					m->cpus[0]->memory_rw(m->cpus[0], mem,
-					    p_vaddr + ofs, &ch[i], len_to_copy,
-					    MEM_WRITE, NO_EXCEPTIONS);
-					ofs += align_len;
-					i += align_len;
-				}
-
-				free(ch);
-			}
+			file_copy_to_guest(m, mem, p_vaddr, f, p_filesz);
 		}
 	}
 
@@ -612,6 +565,9 @@ static void file_load_elf(struct machine *m, struct memory *mem,
 
 	/*  Decode symbols:  */
 	if (symbol_strings != NULL) {
+		symbol_reserve(&m->symbol_context,
+		    symbol_nsymbols(&m->symbol_context) + n_symbols);
+
 		for (i=0; i<n_symbols; i++) {
 			uint64_t st_name, addr, size;
 			int st_info;
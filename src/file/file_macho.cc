@@ -65,7 +65,7 @@ static void file_load_macho(struct machine *m, struct memory *mem,
 	if (m->cpus[0]->byte_order == EMUL_BIG_ENDIAN)
 		encoding = ELFDATA2MSB;
 
-	f = fopen(filename, "r");
+	f = file_open(filename);
 	if (f == NULL) {
 		perror(filename);
 		exit(1);
@@ -170,39 +170,10 @@ static void file_load_macho(struct machine *m, struct memory *mem,
 			fseek(f, fileoff, SEEK_SET);
 
 			/*  Load data from the file:  */
-			while (filesize != 0) {
-				unsigned char buf[32768];
-				ssize_t len = filesize > sizeof(buf) ?
-				    sizeof(buf) : filesize;
-				len = fread(buf, 1, len, f);
-
-				/*  printf("fread len=%i vmaddr=%x buf[0..]="
-				    "%02x %02x %02x\n", (int)len, (int)vmaddr,
-				    buf[0], buf[1], buf[2]);  */
-
-				if (len > 0) {
-					int len2 = 0;
-					uint64_t vaddr1 = vmaddr &
-					    ((1 << BITS_PER_MEMBLOCK) - 1);
-					uint64_t vaddr2 = (vmaddr +
-					    len) & ((1 << BITS_PER_MEMBLOCK)-1);
-					if (vaddr2 < vaddr1) {
-						len2 = len - vaddr2;
-						m->cpus[0]->memory_rw(m->cpus[
-						    0], mem, vmaddr, &buf[0],
-						    len2, MEM_WRITE,
-						    NO_EXCEPTIONS);
-					}
-					m->cpus[0]->memory_rw(m->cpus[0], mem,
-					    vmaddr + len2, &buf[len2], len-len2,
-					    MEM_WRITE, NO_EXCEPTIONS);
-				} else {
-					fprintf(stderr, "error reading\n");
-					exit(1);
-				}
-
-				vmaddr += len;
-				filesize -= len;
+			if (file_copy_to_guest(m, mem, vmaddr, f, filesize)
+			    != filesize) {
+				fprintf(stderr, "error reading\n");
+				exit(1);
 			}
 
 			debug("\n");
@@ -45,8 +45,7 @@ static void file_load_raw(struct machine *m, struct memory *mem,
 	char *filename, uint64_t *entrypointp)
 {
 	FILE *f;
-	int len, sign3264;
-	unsigned char buf[16384];
+	int sign3264;
 	uint64_t entry, loadaddr, vaddr, skip = 0;
 	char *p, *p2;
 
@@ -85,7 +84,7 @@ static void file_load_raw(struct machine *m, struct memory *mem,
 		skip = (int64_t)(int32_t)skip;
 	}
 
-	f = fopen(strrchr(filename, ':')+1, "r");
+	f = file_open(strrchr(filename, ':')+1);
 	if (f == NULL) {
 		perror(p);
 		exit(1);
@@ -94,22 +93,7 @@ static void file_load_raw(struct machine *m, struct memory *mem,
 	fseek(f, skip, SEEK_SET);
 
 	/*  Load file contents:  */
-	while (!feof(f)) {
-		size_t to_read = sizeof(buf);
-
-		/*  If vaddr isn't buf-size aligned, then start with a
-		    smaller buffer:  */
-		if (vaddr & (sizeof(buf) - 1))
-			to_read = sizeof(buf) - (vaddr & (sizeof(buf)-1));
-
-		len = fread(buf, 1, to_read, f);
-
-		if (len > 0)
-			m->cpus[0]->memory_rw(m->cpus[0], mem, vaddr, &buf[0],
-			    len, MEM_WRITE, NO_EXCEPTIONS);
-
-		vaddr += len;
-	}
+	file_copy_to_guest(m, mem, vaddr, f, (size_t) -1);
 
 	debug("RAW: 0x%"PRIx64" bytes @ 0x%08"PRIx64,
 	    (uint64_t) (ftello(f) - skip), (uint64_t) loadaddr);
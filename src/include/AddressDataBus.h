@@ -139,6 +139,36 @@ public:
 	 *	because of a timeout).
 	 */
 	virtual bool WriteData(const uint64_t& data, Endianness endianness) = 0;
+
+	/**
+	 * \brief Looks up host memory which backs a page of the address space.
+	 *
+	 * Components whose contents are plain host memory (e.g. RAM) may
+	 * override this function, to allow e.g. CPUs to access the memory
+	 * directly instead of via AddressSelect() and ReadData()/WriteData().
+	 *
+	 * The default implementation returns NULL, i.e. no direct access.
+	 *
+	 * A page may be returned as read-only even if the memory is not
+	 * write protected, e.g. if it is shared copy-on-write with another
+	 * component. The caller should then look up the page again, with
+	 * writeAccess set, when it actually needs to write to it.
+	 *
+	 * \param address The address of the start of the page.
+	 * \param pageSize The size of the page, in bytes.
+	 * \param writeAccess True if the caller is about to write to the
+	 *	page, false if it only needs to read from it.
+	 * \param writable Set to true if the page may also be written to
+	 *	directly, false if it may only be read.
+	 * \return A pointer to the host memory corresponding to the first
+	 *	byte of the page, or NULL if there is no host memory page for
+	 *	the entire address range.
+	 */
+	virtual uint8_t* LookupHostPage(uint64_t address, size_t pageSize,
+		bool writeAccess, bool& writable)
+	{
+		return NULL;
+	}
 };
 
 
@@ -0,0 +1,251 @@
+#ifndef BINARYSERIALIZATION_H
+#define	BINARYSERIALIZATION_H
+
+/*
+ *  Copyright (C) 2010  Anders Gavare.  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright  
+ *     notice, this list of conditions and the following disclaimer in the 
+ *     documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE   
+ *  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ *  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ *  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ *  OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ *  SUCH DAMAGE.
+ */
+
+#include "misc.h"
+
+#include <istream>
+#include <streambuf>
+#include <string.h>
+
+
+/**
+ * \brief Helpers for reading and writing the binary serialization format.
+ *
+ * All multi-byte values are stored in little-endian byte order, regardless
+ * of host endianness, so that binary files are portable between hosts.
+ * Strings are stored as a 32-bit length followed by the raw characters.
+ * Since the length is read from a possibly corrupt file, strings longer
+ * than MaxStringLength are rejected.
+ *
+ * The Read functions return false if the stream ended prematurely.
+ *
+ * A binary stream starts with a header consisting of a magic string and a
+ * format version number. The version should be increased whenever the
+ * format changes in an incompatible way.
+ */
+class BinarySerialization
+{
+public:
+	enum {
+		MagicLength = 8,
+		Version = 2,
+		MaxStringLength = 16 * 1048576
+	};
+
+	static const char* Magic()
+	{
+		return "GXemul\x1a\x00";
+	}
+
+	/**
+	 * \brief Checks whether a buffer starts with the binary magic.
+	 *
+	 * @param buf The first bytes of a file or stream.
+	 * @param len The number of valid bytes in buf.
+	 * @return true if buf looks like the start of a binary stream.
+	 */
+	static bool HasMagic(const char* buf, size_t len)
+	{
+		return len >= MagicLength && memcmp(buf, Magic(), MagicLength) == 0;
+	}
+
+	static void WriteHeader(ostream& os)
+	{
+		os.write(Magic(), MagicLength);
+		WriteUInt32(os, Version);
+	}
+
+	static bool ReadHeader(std::istream& is, uint32_t& version)
+	{
+		char buf[MagicLength];
+		if (!is.read(buf, MagicLength) || !HasMagic(buf, MagicLength))
+			return false;
+
+		return ReadUInt32(is, version);
+	}
+
+	static void WriteUInt8(ostream& os, uint8_t value)
+	{
+		os.put((char) value);
+	}
+
+	static void WriteUInt32(ostream& os, uint32_t value)
+	{
+		char buf[4];
+		for (size_t i=0; i<sizeof(buf); ++i)
+			buf[i] = (char) (value >> (i*8));
+		os.write(buf, sizeof(buf));
+	}
+
+	static void WriteUInt64(ostream& os, uint64_t value)
+	{
+		char buf[8];
+		for (size_t i=0; i<sizeof(buf); ++i)
+			buf[i] = (char) (value >> (i*8));
+		os.write(buf, sizeof(buf));
+	}
+
+	static void WriteString(ostream& os, const string& str)
+	{
+		WriteUInt32(os, str.length());
+		os.write(str.data(), str.length());
+	}
+
+	static bool ReadUInt8(std::istream& is, uint8_t& value)
+	{
+		char c;
+		if (!is.get(c))
+			return false;
+
+		value = (uint8_t) c;
+		return true;
+	}
+
+	static bool ReadUInt32(std::istream& is, uint32_t& value)
+	{
+		unsigned char buf[4];
+		if (!is.read((char*) buf, sizeof(buf)))
+			return false;
+
+		value = 0;
+		for (size_t i=0; i<sizeof(buf); ++i)
+			value |= (uint32_t) buf[i] << (i*8);
+		return true;
+	}
+
+	static bool ReadUInt64(std::istream& is, uint64_t& value)
+	{
+		unsigned char buf[8];
+		if (!is.read((char*) buf, sizeof(buf)))
+			return false;
+
+		value = 0;
+		for (size_t i=0; i<sizeof(buf); ++i)
+			value |= (uint64_t) buf[i] << (i*8);
+		return true;
+	}
+
+	static bool ReadString(std::istream& is, string& str)
+	{
+		uint32_t len;
+		if (!ReadUInt32(is, len) || len > MaxStringLength)
+			return false;
+
+		vector<char> buf(len);
+		if (len > 0 && !is.read(&buf[0], len))
+			return false;
+
+		str = len > 0? string(&buf[0], len) : string();
+		return true;
+	}
+
+	static bool SkipBytes(std::istream& is, uint64_t len)
+	{
+		while (len > 0) {
+			std::streamsize n = len < 65536? len : 65536;
+			if (!is.ignore(n) || is.gcount() != n)
+				return false;
+
+			len -= n;
+		}
+
+		return true;
+	}
+};
+
+
+/**
+ * \brief A read-only stream buffer for a length-prefixed value.
+ *
+ * Reads at most a given number of bytes from an underlying input stream,
+ * and then reports end of file. This lets a value be deserialized directly
+ * from the underlying stream, without first copying all of it into memory.
+ */
+class BoundedInputBuffer : public std::streambuf
+{
+public:
+	BoundedInputBuffer(std::istream& is, uint64_t len)
+		: m_is(is)
+		, m_remaining(len)
+	{
+		setg(m_buf, m_buf, m_buf);
+	}
+
+	/**
+	 * \brief Skips the part of the value which has not been read yet.
+	 *
+	 * @return true if the underlying stream is positioned right after
+	 *	the value, false if it ended prematurely.
+	 */
+	bool SkipRest()
+	{
+		setg(m_buf, m_buf, m_buf);
+		bool ok = BinarySerialization::SkipBytes(m_is, m_remaining);
+		m_remaining = 0;
+		return ok;
+	}
+
+	/**
+	 * \brief Checks whether the entire value has been read.
+	 */
+	bool AtEnd() const
+	{
+		return m_remaining == 0 && gptr() == egptr();
+	}
+
+protected:
+	virtual int_type underflow()
+	{
+		if (gptr() < egptr())
+			return traits_type::to_int_type(*gptr());
+
+		if (m_remaining == 0)
+			return traits_type::eof();
+
+		std::streamsize n = m_remaining < sizeof(m_buf)?
+		    (std::streamsize) m_remaining : sizeof(m_buf);
+		m_is.read(m_buf, n);
+		n = m_is.gcount();
+		if (n <= 0)
+			return traits_type::eof();
+
+		m_remaining -= n;
+		setg(m_buf, m_buf, m_buf + n);
+		return traits_type::to_int_type(*gptr());
+	}
+
+private:
+	std::istream&	m_is;
+	uint64_t	m_remaining;
+	char		m_buf[65536];
+};
+
+
+#endif	// BINARYSERIALIZATION_H
@@ -166,6 +166,26 @@ public:
 	void DetectChanges(const refcount_ptr<Component>& oldClone,
 		ostream& changeMessages) const;
 
+	/**
+	 * \brief Marks the current state of the component tree as clean.
+	 *
+	 * Records the current value of all state variables (see
+	 * StateVariable::MarkClean()) and the set of child components,
+	 * recursively. A later call to DetectChangesSinceClean() then reports
+	 * what was modified in between. This is much cheaper than taking a
+	 * LightClone(), since no components are created.
+	 */
+	void MarkStateClean();
+
+	/**
+	 * \brief Finds changes made since the last MarkStateClean().
+	 *
+	 * The messages are the same as those produced by DetectChanges().
+	 *
+	 * @param changeMessages An output stream where to send messages.
+	 */
+	void DetectChangesSinceClean(ostream& changeMessages) const;
+
 	/**
 	 * \brief Generates an ASCII tree dump of a component tree.
 	 *
@@ -521,6 +541,31 @@ public:
 	static refcount_ptr<Component> Deserialize(ostream& messages,
 	    const string& str, size_t& pos);
 
+	/**
+	 * \brief Serializes the %Component tree into a compact binary form.
+	 *
+	 * The stream starts with a versioned header (see BinarySerialization),
+	 * followed by the component tree. Unlike Serialize, no textual
+	 * conversion of values takes place, and custom state variables
+	 * (e.g. RAM contents) may use a compact representation.
+	 *
+	 * @param os The stream to write to. For files, it should have been
+	 *	opened in binary mode.
+	 */
+	void SerializeBinary(ostream& os) const;
+
+	/**
+	 * \brief Deserializes a binary stream into a component tree.
+	 *
+	 * @param messages A stream where errors/warnings may be reported.
+	 * @param is The stream to read from, positioned at the header.
+	 * @return If deserialization was successful, the
+	 *	reference counted pointer will point to a component tree;
+	 *	on error, it will be set to NULL
+	 */
+	static refcount_ptr<Component> DeserializeBinary(ostream& messages,
+	    std::istream& is);
+
 	/**
 	 * \brief Checks consistency by serializing and deserializing the
 	 *	component (including all its child components), and comparing
@@ -711,6 +756,14 @@ private:
 	 */
 	refcount_ptr<Component> LightCloneInternal() const;
 
+	/**
+	 * \brief Internal helpers for SerializeBinary and DeserializeBinary,
+	 *	which handle the component tree (excluding the header).
+	 */
+	void SerializeBinaryTree(ostream& os) const;
+	static refcount_ptr<Component> DeserializeBinaryTree(ostream& messages,
+	    std::istream& is);
+
 	/**
 	 * \brief Disallow creation of %Component objects using the
 	 * default constructor.
@@ -723,6 +776,7 @@ private:
 	string			m_className;
 	string			m_visibleClassName;
 	StateVariableMap	m_stateVariables;
+	Components		m_cleanChildComponents;
 
 	// The following are this component's variables. Components that
 	// inherit from this class add their own instance variables.
@@ -223,6 +223,25 @@ public:
 	 */
 	void SetSnapshottingEnabled(bool enabled);
 
+	/**
+	 * \brief Sets the number of steps between periodic snapshots.
+	 *
+	 * When snapshotting is enabled, a snapshot is taken at step 0, and
+	 * then every <tt>steps</tt> steps. Running backwards starts from the
+	 * nearest earlier snapshot, so a shorter interval makes reverse
+	 * execution faster, at the cost of more frequent snapshots.
+	 *
+	 * @param steps The number of steps between snapshots.
+	 */
+	void SetSnapshotInterval(uint64_t steps);
+
+	/**
+	 * \brief Gets the number of snapshots currently kept.
+	 *
+	 * @return The number of snapshots.
+	 */
+	size_t GetNrOfSnapshots() const;
+
 	/**
 	 * \brief Gets the current quiet mode setting.
 	 *
@@ -311,9 +330,19 @@ private:
 
 	/**
 	 * \brief Takes a snapshot of the full emulation state.
+	 *
+	 * Snapshots are kept in a list, sorted by step. When the list is full,
+	 * the oldest snapshot is discarded (except for the one at step 0,
+	 * which is always kept).
 	 */
 	void TakeSnapshot();
 
+	/**
+	 * \brief Returns the step at which the next periodic snapshot
+	 *	should be taken.
+	 */
+	uint64_t GetNextSnapshotStep() const;
+
 
 	/********************************************************************/
 public:
@@ -339,9 +368,10 @@ private:
 	string			m_emulationFileName;
 	refcount_ptr<Component>	m_rootComponent;
 
-	// Snapshotting:   TODO: Multiple snapshots!
+	// Snapshotting:
 	bool			m_snapshottingEnabled;
-	refcount_ptr<Component>	m_snapshot;
+	uint64_t		m_snapshotInterval;
+	vector< refcount_ptr<Component> > m_snapshots;	// sorted by step
 };
 
 #endif	// GXEMUL_H
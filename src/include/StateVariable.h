@@ -34,6 +34,7 @@
 
 #include "misc.h"
 
+#include "BinarySerialization.h"
 #include "SerializationContext.h"
 #include "UnitTest.h"
 
@@ -56,6 +57,35 @@ public:
 	virtual void Serialize(ostream& ss) const = 0;
 	virtual bool Deserialize(const string& value) = 0;
 	virtual void CopyValueFrom(CustomStateVariableHandler* other) = 0;
+
+	/**
+	 * \brief Serializes the value in binary form.
+	 *
+	 * The default implementation stores the textual serialization as a
+	 * length-prefixed string. Handlers for large amounts of data should
+	 * override this (and DeserializeBinary) with something more compact.
+	 *
+	 * @param os The stream to write to.
+	 */
+	virtual void SerializeBinary(ostream& os) const
+	{
+		stringstream ss;
+		Serialize(ss);
+		BinarySerialization::WriteString(os, ss.str());
+	}
+
+	/**
+	 * \brief Deserializes a value written by SerializeBinary.
+	 *
+	 * @param is The stream to read from.
+	 * @return true if the value was read and set, false otherwise.
+	 */
+	virtual bool DeserializeBinary(std::istream& is)
+	{
+		string value;
+		return BinarySerialization::ReadString(is, value) &&
+		    Deserialize(value);
+	}
 };
 
 
@@ -222,6 +252,39 @@ public:
 	 */
 	void Serialize(ostream& ss, SerializationContext& context) const;
 
+	/**
+	 * \brief Serializes the variable (name, type, and value) in binary
+	 *	form.
+	 *
+	 * @param os A stream where the variable will be appended.
+	 */
+	void SerializeBinary(ostream& os) const;
+
+	/**
+	 * \brief Reads a binary value into the variable.
+	 *
+	 * The caller is expected to have read the name and type already
+	 * (see SerializeBinary), and to only call this function if the
+	 * stored type matches the type of the variable.
+	 *
+	 * @param is The stream to read from.
+	 * @return true if the value was read, false on read errors.
+	 */
+	bool DeserializeBinaryValue(std::istream& is);
+
+	/**
+	 * \brief Skips over a binary value of a specific type.
+	 *
+	 * Used when a stored variable no longer exists, or has changed type.
+	 * Custom values are stored with a length prefix, so they can be
+	 * skipped as well.
+	 *
+	 * @param is The stream to read from.
+	 * @param type The type of the stored value.
+	 * @return true if the value was skipped, false otherwise.
+	 */
+	static bool SkipBinaryValue(std::istream& is, enum Type type);
+
 	/**
 	 * \brief Copy the value from another variable into this variable.
 	 *
@@ -277,6 +340,45 @@ public:
 	 */
 	bool SetValue(uint64_t value);
 
+	/**
+	 * \brief Remembers the variable's current value as its clean value.
+	 *
+	 * Variables refer to plain C++ variables, which components modify
+	 * directly, so writes cannot be intercepted. Instead, a copy of the
+	 * value is kept, and IsDirty() compares against it. Custom variables
+	 * are never considered dirty.
+	 */
+	void MarkClean();
+
+	/**
+	 * \brief Checks whether the variable has changed since MarkClean().
+	 *
+	 * @return True if MarkClean() has been called, and the value has
+	 *	changed since then, false otherwise.
+	 */
+	bool IsDirty() const;
+
+	/**
+	 * \brief Returns the clean value as a readable string.
+	 *
+	 * The formatting is the same as for ToString().
+	 *
+	 * @return A string, representing the value at MarkClean() time.
+	 */
+	string CleanValueToString() const;
+
+	/**
+	 * \brief Returns a pointer to the variable's underlying value.
+	 *
+	 * Normally, StateVariableRef should be used instead of calling
+	 * this function directly.
+	 *
+	 * @param type The type that the caller expects.
+	 * @return A pointer to the C++ variable that this variable refers
+	 *	to, or NULL if the variable is not of the expected type.
+	 */
+	void* GetValuePointer(enum Type type) const;
+
 
 	/********************************************************************/
 
@@ -327,6 +429,124 @@ private:
 		int64_t*	psint64;
 		CustomStateVariableHandler *phandler;
 	} m_value;
+
+	// The value at the time of the last MarkClean():
+	bool			m_hasCleanValue;
+	string			m_cleanString;
+	union {
+		bool		b;
+		double		d;
+		uint8_t		u8;
+		uint16_t	u16;
+		uint32_t	u32;
+		uint64_t	u64;
+		int8_t		s8;
+		int16_t		s16;
+		int32_t		s32;
+		int64_t		s64;
+	} m_cleanValue;
+};
+
+
+/**
+ * \brief Maps C++ types to StateVariable::Type values.
+ */
+template<class T> struct StateVariableTypeOf;
+
+template<> struct StateVariableTypeOf<string>
+	{ static const enum StateVariable::Type type = StateVariable::String; };
+template<> struct StateVariableTypeOf<bool>
+	{ static const enum StateVariable::Type type = StateVariable::Bool; };
+template<> struct StateVariableTypeOf<double>
+	{ static const enum StateVariable::Type type = StateVariable::Double; };
+template<> struct StateVariableTypeOf<uint8_t>
+	{ static const enum StateVariable::Type type = StateVariable::UInt8; };
+template<> struct StateVariableTypeOf<uint16_t>
+	{ static const enum StateVariable::Type type = StateVariable::UInt16; };
+template<> struct StateVariableTypeOf<uint32_t>
+	{ static const enum StateVariable::Type type = StateVariable::UInt32; };
+template<> struct StateVariableTypeOf<uint64_t>
+	{ static const enum StateVariable::Type type = StateVariable::UInt64; };
+template<> struct StateVariableTypeOf<int8_t>
+	{ static const enum StateVariable::Type type = StateVariable::SInt8; };
+template<> struct StateVariableTypeOf<int16_t>
+	{ static const enum StateVariable::Type type = StateVariable::SInt16; };
+template<> struct StateVariableTypeOf<int32_t>
+	{ static const enum StateVariable::Type type = StateVariable::SInt32; };
+template<> struct StateVariableTypeOf<int64_t>
+	{ static const enum StateVariable::Type type = StateVariable::SInt64; };
+
+
+/**
+ * \brief A typed reference to the value of a StateVariable.
+ *
+ * Looking up a variable by name, and converting its value using
+ * StateVariable::ToInteger() or StateVariable::SetValue(), is too slow
+ * for code which runs once per scheduling slice. A %StateVariableRef is
+ * resolved once, and then reads and writes the underlying C++ variable
+ * directly.
+ *
+ * The reference is only valid as long as the component owning the
+ * variable exists. Note that writes through a %StateVariableRef, just
+ * like writes to the variable itself from within the component, are
+ * not type checked or range checked.
+ */
+template<class T>
+class StateVariableRef
+{
+public:
+	/**
+	 * \brief Constructs an invalid reference.
+	 */
+	StateVariableRef()
+		: m_ptr(NULL)
+	{
+	}
+
+	/**
+	 * \brief Constructs a reference to a variable's value.
+	 *
+	 * @param var The variable. If it is NULL, or not of type T, the
+	 *	reference will be invalid.
+	 */
+	StateVariableRef(const StateVariable* var)
+		: m_ptr(var == NULL? NULL : (T*)
+		    var->GetValuePointer(StateVariableTypeOf<T>::type))
+	{
+	}
+
+	/**
+	 * \brief Checks whether the reference refers to a variable.
+	 *
+	 * @return True if the reference may be used, false otherwise.
+	 */
+	bool IsValid() const
+	{
+		return m_ptr != NULL;
+	}
+
+	/**
+	 * \brief Returns the variable's value.
+	 *
+	 * @return The value. The reference must be valid.
+	 */
+	T Get() const
+	{
+		return *m_ptr;
+	}
+
+	/**
+	 * \brief Sets the variable's value.
+	 *
+	 * @param value The new value. The reference must be valid.
+	 */
+	void Set(const T& value)
+	{
+		*m_ptr = value;
+	}
+
+private:
+	T*	m_ptr;
 };
 
 
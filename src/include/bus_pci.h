@@ -47,6 +47,10 @@ struct pci_data;
 
 #else
 
+#define	PCI_N_BUSES		256
+#define	PCI_N_DEVFNS		256
+#define	PCI_DEVFN(dev,func)	(((dev) << 3) | (func))
+
 struct pci_data {
 	/*
 	 *  IRQ paths:
@@ -80,14 +84,23 @@ struct pci_data {
 	uint64_t	cur_pci_portbase;
 	uint64_t	cur_pci_membase;
 
-	/*  Current register access:  */
+	/*  Current register access, and the device it decodes to:  */
 	int		cur_bus, cur_device, cur_func, cur_reg;
 	int		last_was_write_ffffffff;
+	struct pci_device *cur_pd;
 
 	struct pci_device *first_device;
+
+	/*
+	 *  Direct-indexed device lookup. device_table[bus] is NULL until a
+	 *  device is added on that bus, and is otherwise indexed by
+	 *  PCI_DEVFN(device, function).
+	 */
+	struct pci_device **device_table[PCI_N_BUSES];
 };
 
 #define	PCI_CFG_MEM_SIZE	0x100
+#define	PCI_N_MAPREGS		((PCI_MAPREG_END - PCI_MAPREG_START) / 4)
 
 struct pci_device {
 	/*  Pointer to the next PCI device on this bus:  */
@@ -107,6 +120,15 @@ struct pci_device {
 	/*  Used when setting up the configuration registers:  */
 	int			cur_mapreg_offset;
 
+	/*
+	 *  Memory which the device' emulated registers were added to, and
+	 *  the size of each base address register which was allocated using
+	 *  allocate_device_space() (0 if not). These are used to move the
+	 *  emulated device when the guest OS rewrites a base address register.
+	 */
+	struct memory		*mem;
+	uint64_t		mapreg_size[PCI_N_MAPREGS];
+
 	/*  Function to handle device-specific cfg register writes:  */
 	int			(*cfg_reg_write)(struct pci_device *pd,
 				    int reg, uint32_t value);
@@ -149,12 +171,17 @@ void bus_pci_setaddr(struct cpu *cpu, struct pci_data *pci_data,
 	int bus, int device, int function, int reg);
 void bus_pci_data_access(struct cpu *cpu, struct pci_data *pci_data,
 	uint64_t *data, int len, int writeflag);
+int dev_pci_ecam_access(struct cpu *cpu, struct memory *mem,
+	uint64_t relative_addr, unsigned char *data, size_t len,
+	int writeflag, void *extra);
 
 /*  Initialization:  */
 struct pci_data *bus_pci_init(struct machine *machine, const char *irq_path,
 	uint64_t pci_actual_io_offset, uint64_t pci_actual_mem_offset,
 	uint64_t pci_portbase, uint64_t pci_membase, const char *pci_irqbase,
 	uint64_t isa_portbase, uint64_t isa_membase, const char *isa_irqbase);
+void bus_pci_ecam_init(struct machine *machine, struct memory *mem,
+	struct pci_data *pci_data, uint64_t baseaddr, int n_buses);
 
 /*  Add a PCI device to a PCI bus:  */
 void bus_pci_add(struct machine *machine, struct pci_data *pci_data,
@@ -176,6 +176,60 @@ protected:
 		return pc;
 	}
 
+	/**
+	 * \brief Reads data from emulated memory, at a virtual address.
+	 *
+	 * If the page is backed by host memory, the data is read directly
+	 * via the host TLB. Otherwise this is the same as AddressSelect()
+	 * followed by ReadData(), using the CPU's endianness.
+	 *
+	 * @param vaddr The virtual address. Must be naturally aligned.
+	 * @param data A reference to a variable which will receive the data.
+	 * @return True if the access was successful, false otherwise.
+	 */
+	template<typename T> bool MemoryReadData(uint64_t vaddr, T& data)
+	{
+		uint8_t* hostPage = HostTLBLookup(vaddr, false);
+		if (hostPage != NULL) {
+			data = GuestToHostEndian(*(T*)(hostPage +
+			    (vaddr & (HostTLBPageSize-1))));
+			return true;
+		}
+
+		AddressSelect(vaddr);
+		return ReadData(data, m_isBigEndian? BigEndian : LittleEndian);
+	}
+
+	/**
+	 * \brief Writes data to emulated memory, at a virtual address.
+	 *
+	 * See MemoryReadData().
+	 *
+	 * @param vaddr The virtual address. Must be naturally aligned.
+	 * @param data A reference to a variable which contains the data.
+	 * @return True if the access was successful, false otherwise.
+	 */
+	template<typename T> bool MemoryWriteData(uint64_t vaddr, const T& data)
+	{
+		uint8_t* hostPage = HostTLBLookup(vaddr, true);
+		if (hostPage != NULL) {
+			*(T*)(hostPage + (vaddr & (HostTLBPageSize-1))) =
+			    GuestToHostEndian(data);
+			return true;
+		}
+
+		AddressSelect(vaddr);
+		return WriteData(data, m_isBigEndian? BigEndian : LittleEndian);
+	}
+
+	/**
+	 * \brief Invalidates all entries in the host TLB.
+	 *
+	 * CPU implementations must call this whenever the virtual to
+	 * physical mapping (i.e. the result of VirtualToPhysical()) changes.
+	 */
+	void HostTLBInvalidate();
+
 	// CPUComponent:
 	bool FunctionTraceCall();
 	bool FunctionTraceReturn();
@@ -188,6 +242,72 @@ protected:
 private:
 	bool LookupAddressDataBus(GXemul* gxemul = NULL);
 
+	/*
+	 * The host TLB is a direct-mapped cache of virtual page to host memory
+	 * page translations. Pages which are not backed by host memory (e.g.
+	 * device registers) are also cached, with hostPage = NULL, so that
+	 * accesses to them go directly to the slow path.
+	 *
+	 * Host pages are first looked up for reading only, since a page
+	 * which is shared copy-on-write should stay shared until it is
+	 * actually written to. The first write to such a page refills the
+	 * entry for writing.
+	 */
+	static const int	HostTLBPageShift = 12;
+	static const uint64_t	HostTLBPageSize = 1 << HostTLBPageShift;
+	static const size_t	HostTLBSize = 512;
+
+	struct HostTLBEntry {
+		bool		valid;
+		bool		writable;
+		bool		filledForWrite;
+		uint64_t	vaddrPage;
+		uint8_t *	hostPage;
+	};
+
+	uint8_t* HostTLBLookup(uint64_t vaddr, bool writeAccess)
+	{
+		uint64_t vaddrPage = vaddr >> HostTLBPageShift;
+		HostTLBEntry& entry = m_hostTLB[vaddrPage & (HostTLBSize-1)];
+
+		if (!entry.valid || entry.vaddrPage != vaddrPage)
+			HostTLBFill(entry, vaddrPage, false);
+
+		if (writeAccess && !entry.writable) {
+			if (entry.hostPage == NULL || entry.filledForWrite)
+				return NULL;
+
+			HostTLBFill(entry, vaddrPage, true);
+			if (!entry.writable)
+				return NULL;
+		}
+
+		return entry.hostPage;
+	}
+
+	void HostTLBFill(HostTLBEntry& entry, uint64_t vaddrPage,
+		bool writeAccess);
+
+	uint8_t GuestToHostEndian(uint8_t data) const
+	{
+		return data;
+	}
+
+	uint16_t GuestToHostEndian(uint16_t data) const
+	{
+		return m_isBigEndian? BE16_TO_HOST(data) : LE16_TO_HOST(data);
+	}
+
+	uint32_t GuestToHostEndian(uint32_t data) const
+	{
+		return m_isBigEndian? BE32_TO_HOST(data) : LE32_TO_HOST(data);
+	}
+
+	uint64_t GuestToHostEndian(uint64_t data) const
+	{
+		return m_isBigEndian? BE64_TO_HOST(data) : LE64_TO_HOST(data);
+	}
+
 protected:
 	/*
 	 * Variables common to all (or most) kinds of CPUs:
@@ -230,6 +350,9 @@ protected:
 	uint64_t		m_addressSelect;
 	bool			m_exceptionOrAbortInDelaySlot;
 
+private:
+	HostTLBEntry		m_hostTLB[HostTLBSize];
+
 private:
 	SymbolRegistry		m_symbolRegistry;
 };
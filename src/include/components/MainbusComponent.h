@@ -87,6 +87,8 @@ public:
 	virtual bool WriteData(const uint16_t& data, Endianness endianness);
 	virtual bool WriteData(const uint32_t& data, Endianness endianness);
 	virtual bool WriteData(const uint64_t& data, Endianness endianness);
+	virtual uint8_t* LookupHostPage(uint64_t address, size_t pageSize,
+		bool writeAccess, bool& writable);
 
 
 	/********************************************************************/
@@ -97,26 +99,35 @@ protected:
 	virtual void FlushCachedStateForComponent();
 	virtual bool PreRunCheckForComponent(GXemul* gxemul);
 
-private:
-	bool MakeSureMemoryMapExists(GXemul* gxemul = NULL);
-
 private:
 	struct MemoryMapEntry {
 		uint64_t		base;
 		uint64_t		size;
 		uint64_t		addrMul;
 		AddressDataBus *	addressDataBus;
+
+		bool operator < (const MemoryMapEntry& other) const
+		{
+			return base < other.base;
+		}
 	};
 
+	bool MakeSureMemoryMapExists(GXemul* gxemul = NULL);
+	const MemoryMapEntry* FindMemoryMapEntry(uint64_t address);
+
+private:
+	// The memory map is sorted by base address, so that entries can be
+	// found using binary search. (Entries never overlap.)
 	typedef vector<MemoryMapEntry> MemoryMap;
 	MemoryMap			m_memoryMap;
 	bool				m_memoryMapFailed;
 	bool				m_memoryMapValid;
 
+	// The most recently used entry in the memory map, or NULL:
+	const MemoryMapEntry *		m_lastHitEntry;
+
 	// For the currently selected address:
 	AddressDataBus *	m_currentAddressDataBus;
-
-	// TODO: direct page access...
 };
 
 
@@ -69,6 +69,12 @@
  *
  * Note 2: The RAM component's size and base offset are defined by state
  * variables in the MemoryMappedComponent base class.
+ *
+ * Note 3: When a RAMComponent is cloned (e.g. when a snapshot is taken),
+ * the host memory blocks are shared between the original and the clone.
+ * A shared block is copied when it is written to (copy-on-write), so each
+ * snapshot only costs as much host memory as the blocks that have been
+ * modified since it was taken.
  */
 class RAMComponent
 	: public MemoryMappedComponent
@@ -127,16 +133,40 @@ public:
 	virtual bool WriteData(const uint16_t& data, Endianness endianness);
 	virtual bool WriteData(const uint32_t& data, Endianness endianness);
 	virtual bool WriteData(const uint64_t& data, Endianness endianness);
+	virtual uint8_t* LookupHostPage(uint64_t address, size_t pageSize,
+		bool writeAccess, bool& writable);
 
 
 	/********************************************************************/
 
 	static void RunUnitTests(int& nSucceeded, int& nFailures);
 
+protected:
+	virtual bool CheckVariableWrite(StateVariable& var, const string& oldValue);
+
 private:
 	void ReleaseAllBlocks();
 
-	void* AllocateBlock();
+	void* AllocateBlock(uint64_t blockNr);
+
+	/**
+	 * \brief Returns a block which may be written to.
+	 *
+	 * The block is allocated if it did not exist, and copied if it
+	 * was shared with another RAMComponent.
+	 *
+	 * @param blockNr The block number.
+	 * @return A pointer to the host memory of the block.
+	 */
+	void* GetWritableBlock(uint64_t blockNr);
+
+	/**
+	 * \brief Flushes cached state in the entire component tree.
+	 *
+	 * This makes sure that no CPU keeps on using host page pointers
+	 * (from LookupHostPage) which are no longer valid.
+	 */
+	void FlushCachedHostPages();
 
 	class RAMDataHandler : public CustomStateVariableHandler
 	{
@@ -153,8 +183,8 @@ private:
 		virtual void Serialize(ostream& ss) const
 		{
 			for (size_t i=0; i<m_ram.m_memoryBlocks.size(); ++i)
-				if (m_ram.m_memoryBlocks[i] != NULL)
-					SerializeMemoryBlock(ss, i, m_ram.m_memoryBlocks[i]);
+				if (!m_ram.m_memoryBlocks[i].IsNULL())
+					SerializeMemoryBlock(ss, i, m_ram.m_memoryBlocks[i]->data);
 
 			// End of data.
 			ss << ".";
@@ -238,16 +268,19 @@ private:
 			return true;
 		}
 		
-		virtual void CopyValueFrom(CustomStateVariableHandler* other)
-		{
-			// NOTE/TODO: Not space efficient, but works for now.
+		virtual void CopyValueFrom(CustomStateVariableHandler* other);
 
-			stringstream ss;
-			other->Serialize(ss);
-			Deserialize(ss.str());
-		}
+		virtual void SerializeBinary(ostream& os) const;
+		virtual bool DeserializeBinary(std::istream& is);
 
 	private:
+		/**
+		 * \brief Loads binary RAM data into the (empty) RAM.
+		 *
+		 * @return true if all of the data was loaded.
+		 */
+		bool DeserializePages(std::istream& is);
+
 		void SerializeMemoryBlock(ostream& ss, size_t blockNr, void *block) const
 		{
 			const size_t rowSize = 1024;
@@ -297,8 +330,26 @@ private:
 
 	RAMDataHandler m_dataHandler;
 	
+	// A host memory block, possibly shared with clones of this component.
+	class MemoryBlock : public ReferenceCountable
+	{
+	public:
+		MemoryBlock(void* p, size_t size)
+			: data(p)
+			, m_size(size)
+		{
+		}
+
+		~MemoryBlock();
+
+		void*	data;
+
+	private:
+		size_t	m_size;
+	};
+
 	// State:
-	typedef vector<void *> BlockNrToMemoryBlockVector;
+	typedef vector< refcount_ptr<MemoryBlock> > BlockNrToMemoryBlockVector;
 	BlockNrToMemoryBlockVector	m_memoryBlocks;
 	bool				m_writeProtected;
 	uint64_t			m_lastDumpAddr;
@@ -306,6 +357,7 @@ private:
 	// Cached/runtime state:
 	uint64_t	m_addressSelect;  // For AddressDataBus read/write
 	void *		m_selectedHostMemoryBlock;
+	void *		m_selectedWritableHostMemoryBlock; // NULL if shared
 	size_t		m_selectedOffsetWithinBlock;
 };
 
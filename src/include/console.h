@@ -45,6 +45,8 @@ int console_charavail(int handle);
 int console_readchar(int handle);
 void console_putchar(int handle, int ch);
 void console_flush(void);
+void console_poll(void);
+void console_poll_wait(int timeout_ms);
 void console_mouse_coordinates(int x, int y, int fb_nr);
 void console_mouse_button(int, int);
 void console_getmouse(int *x, int *y, int *buttons, int *fb_nr);
@@ -58,6 +60,7 @@ int console_change_inputability(int handle, int inputability);
 void console_init_main(struct emul *);
 void console_debug_dump(struct machine *);
 void console_allow_slaves(int);
+void console_use_sockets(const char *spec);
 
 void console_init(void);
 void console_deinit(void);
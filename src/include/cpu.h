@@ -68,7 +68,17 @@
  *  length; to extend the list, the list should be made to point to another
  *  list, and so forth. (Bad, O(n) find/insert complexity. Should be fixed some
  *  day. TODO)  See definition of physpage_ranges below.
+ *
+ *  arch_combination is an entry in a table of instruction combinations. n is
+ *  the number of instruction calls in the sequence, f[] are the instruction
+ *  functions that the calls must have (the last one being the instruction
+ *  which was just translated), and check is an optional function which is
+ *  called with a pointer to the first call in the sequence, to verify that
+ *  the arguments match. If everything matches, the first call's function is
+ *  replaced by combined. Tables end with an entry with n = 0.
  */
+#define	DYNTRANS_MAX_COMBINATION_LEN	8
+
 #define DYNTRANS_MISC_DECLARATIONS(arch,ARCH,addrtype)  struct \
 	arch ## _instr_call {					\
 		void	(*f)(struct cpu *, struct arch ## _instr_call *); \
@@ -90,6 +100,16 @@
 		addrtype	vaddr_page;				\
 		addrtype	paddr_page;				\
 		unsigned char	*host_page;				\
+	};								\
+									\
+	struct arch ## _combination {					\
+		int		n;					\
+		void		(*f[DYNTRANS_MAX_COMBINATION_LEN])(	\
+				    struct cpu *, struct arch ## _instr_call *);\
+		int		(*check)(struct cpu *,			\
+				    struct arch ## _instr_call *);	\
+		void		(*combined)(struct cpu *,		\
+				    struct arch ## _instr_call *);	\
 	};
 
 #define	DYNTRANS_MISC64_DECLARATIONS(arch,ARCH,tlbindextype)		\
@@ -392,9 +412,28 @@ struct cpu {
 	 *  If has_been_idling is true when printing the number of executed
 	 *  instructions per second, "idling" is printed instead. (The number
 	 *  of instrs per second when idling is meaningless anyway.)
+	 *
+	 *  is_idle is set by cpu_idle() when the cpu is waiting for an
+	 *  interrupt, and cleared before each run and whenever an interrupt
+	 *  is asserted. machine_run() uses it to find out if all cpus in a
+	 *  machine are idle, in which case the host may sleep.
 	 */
 	char		is_halted;
 	char		has_been_idling;
+	char		is_idle;
+
+	/*
+	 *  ninstrs_till_event is the number of instructions until the cpu's
+	 *  own timer (e.g. the PowerPC decrementer) interrupts, or 0 if there
+	 *  is no such timer. The host does not sleep past that point.
+	 *
+	 *  idle_credit is host time which was slept while all cpus were idle,
+	 *  converted to instructions. It is accounted for as executed
+	 *  instructions in the next run, so that instruction driven clocks
+	 *  keep up with the host time.
+	 */
+	int64_t		ninstrs_till_event;
+	int		idle_credit;
 
 	/*
 	 *  Dynamic translation:
@@ -458,6 +497,8 @@ int cpu_disassemble_instr(struct machine *m, struct cpu *cpu,
 
 void cpu_functioncall_trace(struct cpu *cpu, uint64_t f);
 void cpu_functioncall_trace_return(struct cpu *cpu);
+void cpu_profile_sample(struct cpu *cpu);
+void cpu_idle(struct cpu *cpu);
 
 void cpu_create_or_reset_tc(struct cpu *cpu);
 
@@ -84,6 +84,20 @@ struct arm_cpu_type_def {
 #define	ARM_F_C		2	/*  of cpsr.                       */
 #define	ARM_F_V		1
 
+#define	ARM_LAZY_NONE	0	/*  'flags' is up to date            */
+#define	ARM_LAZY_LOGIC	1	/*  N,Z from result, C,V from 'flags'  */
+#define	ARM_LAZY_ADD	2	/*  N,Z,C,V from a + b = result      */
+#define	ARM_LAZY_SUB	3	/*  N,Z,C,V from a - b = result      */
+
+#define	ARM_FLAGS(cpu)	(*((cpu)->cd.arm.lazy_flags_op != ARM_LAZY_NONE?   \
+			    arm_materialize_flags(cpu) : &(cpu)->cd.arm.flags))
+#define	ARM_FLAGS_Z(cpu)	((cpu)->cd.arm.lazy_flags_op != ARM_LAZY_NONE?	    \
+			    (cpu)->cd.arm.lazy_flags_result == 0 :	    \
+			    ((cpu)->cd.arm.flags & ARM_F_Z) != 0)
+#define	ARM_FLAGS_N(cpu)	((cpu)->cd.arm.lazy_flags_op != ARM_LAZY_NONE?	    \
+			    (int32_t)(cpu)->cd.arm.lazy_flags_result < 0 :  \
+			    ((cpu)->cd.arm.flags & ARM_F_N) != 0)
+
 #define	ARM_FLAG_N	0x80000000	/*  Negative flag  */
 #define	ARM_FLAG_Z	0x40000000	/*  Zero flag  */
 #define	ARM_FLAG_C	0x20000000	/*  Carry flag  */
@@ -162,8 +176,20 @@ struct arm_cpu {
 	 *  NOTE: 'flags' just contains the 4 flag bits. When cpsr is read,
 	 *  the flags should be copied from 'flags', and when cpsr is written
 	 *  to, 'flags' should be updated as well.
+	 *
+	 *  Data processing instructions with the S-bit set usually don't
+	 *  update 'flags' directly. Instead, they record what kind of
+	 *  operation was performed (lazy_flags_op), with which operands and
+	 *  with what result, and the flags are only calculated when they are
+	 *  actually needed. 'flags' should therefore never be accessed
+	 *  directly, but via ARM_FLAGS(cpu), or ARM_FLAGS_Z(cpu) and
+	 *  ARM_FLAGS_N(cpu) which don't need to calculate the other flags.
 	 */
 	size_t			flags;
+	int			lazy_flags_op;
+	uint32_t		lazy_flags_a;
+	uint32_t		lazy_flags_b;
+	uint32_t		lazy_flags_result;
 	uint32_t		cpsr;
 	uint32_t		spsr_svc;
 	uint32_t		spsr_abt;
@@ -295,6 +321,7 @@ void arm_invalidate_translation_caches(struct cpu *cpu, uint64_t, int);
 void arm_invalidate_code_translation(struct cpu *cpu, uint64_t, int);
 void arm_load_register_bank(struct cpu *cpu);
 void arm_save_register_bank(struct cpu *cpu);
+size_t *arm_materialize_flags(struct cpu *cpu);
 int arm_memory_rw(struct cpu *cpu, struct memory *mem, uint64_t vaddr,
 	unsigned char *data, size_t len, int writeflag, int cache_flags);
 int arm_cpu_family_init(struct cpu_family *);
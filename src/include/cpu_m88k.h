@@ -213,12 +213,37 @@ DYNTRANS_MISC_DECLARATIONS(m88k,M88K,uint32_t)
 #define	N_M88200_PATC_ENTRIES		56
 #define	M8820X_PATC_SUPERVISOR_BIT	0x00000001
 
+/*
+ *  PATC hash: Each PATC entry is linked into the bucket for its virtual
+ *  page. Indices in the chains are stored as entry number + 1, so that an
+ *  all-zero (memset) cmmu struct has empty buckets.
+ */
+#define	M8820X_PATC_HASH_SIZE		64
+#define	M8820X_PATC_HASH(vaddr)		\
+	((((vaddr) >> 12) ^ ((vaddr) >> 18)) & (M8820X_PATC_HASH_SIZE - 1))
+
+/*
+ *  BATC range table: For each 512 KB block of the virtual address space,
+ *  and for user (0) and supervisor (1) mode, the number + 1 of the first
+ *  valid BATC entry which maps the block (or 0 if there is none).
+ */
+#define	M8820X_BATC_BLOCKS		(1 << 13)
+
 struct m8820x_cmmu {
 	uint32_t	reg[M8820X_LENGTH / sizeof(uint32_t)];
 	uint32_t	batc[N_M88200_BATC_REGS];
 	uint32_t	patc_v_and_control[N_M88200_PATC_ENTRIES];
 	uint32_t	patc_p_and_supervisorbit[N_M88200_PATC_ENTRIES];
 	int		patc_update_index;
+
+	/*  Lookup indices, maintained by memory_m88k.cc:  */
+	uint8_t		patc_hash[M8820X_PATC_HASH_SIZE];
+	uint8_t		patc_hash_next[N_M88200_PATC_ENTRIES];
+	uint8_t		batc_index[2][M8820X_BATC_BLOCKS];
+
+	/*  Host page of the most recently walked segment table:  */
+	uint32_t	last_seg_table_paddr;
+	uint32_t	*last_seg_table_host;
 };
 
 
@@ -287,6 +312,7 @@ void m88k_fstcr(struct cpu *cpu, uint32_t value, int fcr);
 void m88k_exception(struct cpu *cpu, int vector, int is_trap);
 
 /*  memory_m88k.c:  */
+void m8820x_batc_update(struct m8820x_cmmu *cmmu);
 int m88k_translate_v2p(struct cpu *cpu, uint64_t vaddr,
 	uint64_t *return_addr, int flags);
 
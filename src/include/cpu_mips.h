@@ -94,6 +94,7 @@ struct mips_tlb {
 #define	MIPS_FPU_FCSR			31
 #define	   MIPS_FCSR_FCC0_SHIFT		   23
 #define	   MIPS_FCSR_FCC1_SHIFT		   25
+#define	   MIPS_FCSR_RM_MASK		   0x00000003
 
 #define	N_VADDR_TO_TLB_INDEX_ENTRIES	(1 << 20)
 
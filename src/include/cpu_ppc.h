@@ -154,6 +154,7 @@ struct ppc_cpu {
 #define	PPC_MSR_HV	(1ULL << 60)	/*  Hypervisor  */
 /*  bits 59..17  are reserved  */
 #define	PPC_MSR_VEC	(1 << 25)	/*  Altivec Enable  */
+#define	PPC_MSR_POW	(1 << 18)	/*  Power Management Enable  */
 #define	PPC_MSR_TGPR	(1 << 17)	/*  Temporary gpr0..3  */
 #define	PPC_MSR_ILE	(1 << 16)	/*  Interrupt Little-Endian Mode  */
 #define	PPC_MSR_EE	(1 << 15)	/*  External Interrupt Enable  */
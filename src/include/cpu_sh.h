@@ -164,6 +164,8 @@ struct sh_cpu {
 	uint32_t	dmac_dar[N_SH4_DMA_CHANNELS];
 	uint32_t	dmac_tcr[N_SH4_DMA_CHANNELS];
 	uint32_t	dmac_chcr[N_SH4_DMA_CHANNELS];
+	uint32_t	dmac_dmaor;
+	struct interrupt dmac_irq[N_SH4_DMA_INTERRUPTS];
 
 	/*  PCI controller:  */
 	struct pci_data	*pcic_pcibus;
@@ -421,6 +421,14 @@ int dev_sgi_mte_access(struct cpu *cpu, struct memory *mem,
 	int writeflag, void *);
 void dev_sgi_mte_init(struct memory *mem, uint64_t baseaddr);
 
+/*  dev_sh4.c:  */
+int sh4_dmac_setup(struct cpu *cpu, int channel, uint32_t *countp,
+	int *transmit_sizep, int *src_deltap, int *dst_deltap);
+void sh4_dmac_copy(struct cpu *cpu, uint32_t *sarp, uint32_t *darp,
+	uint32_t count, int transmit_size, int src_delta, int dst_delta);
+void sh4_dmac_transfer_end(struct cpu *cpu, int channel, uint32_t sar,
+	uint32_t dar);
+
 /*  dev_sii.c:  */
 #define	DEV_SII_LENGTH			0x100
 void dev_sii_tick(struct cpu *cpu, void *);
@@ -110,4 +110,42 @@ void interrupt_connect(struct interrupt *i, int exclusive);
 void interrupt_disconnect(struct interrupt *i, int exclusive);
 
 
+/*
+ *  Generic bitmask interrupt controllers:
+ *
+ *  Many interrupt controllers are simply a status word and an enable word,
+ *  and assert their parent interrupt whenever (status & enabled) != 0. Such
+ *  controllers may embed a struct interrupt_mask and register their lines
+ *  using interrupt_mask_register_line(); each line then corresponds to a
+ *  precomputed bit in the status word.
+ *
+ *  Assertions which do not change the controller's output level (already
+ *  asserted, or masked) return after a single test. When a mask controller
+ *  is cascaded onto another mask controller, the cascade is resolved once
+ *  at connect time, and level changes propagate upwards without any
+ *  indirect calls until a level no longer changes, or the root interrupt
+ *  (usually a CPU) is reached.
+ *
+ *  Code which modifies status or enabled directly (e.g. on guest register
+ *  writes) must call interrupt_mask_update() afterwards.
+ */
+struct interrupt_mask {
+	uint32_t		status;
+	uint32_t		enabled;
+	int			asserted;
+
+	/*  Parent interrupt, and the collapsed cascade (if any):  */
+	struct interrupt	parent;
+	struct interrupt_mask	*parent_mask;
+	uint32_t		parent_bit;
+};
+
+void interrupt_mask_init(struct interrupt_mask *m, const char *parent_path);
+void interrupt_mask_register_line(struct interrupt_mask *m, const char *name,
+	uint32_t bit);
+void interrupt_mask_assert(struct interrupt *interrupt);
+void interrupt_mask_deassert(struct interrupt *interrupt);
+void interrupt_mask_update(struct interrupt_mask *m);
+
+
 #endif	/*  INTERRUPT_H  */
@@ -52,12 +52,59 @@ struct isa_pic_data {
 	int			last_int;
 };
 
+/*
+ *  Breakpoints and watchpoints are also counted in a small hash table of
+ *  the (virtual) pages they are on. An address on a page without any
+ *  breakpoints or watchpoints, which is the common case, can then be
+ *  rejected by looking at a single counter. Only bits 12..31 of the
+ *  address are used, so that the hash is the same for 32-bit and
+ *  sign-extended 64-bit addresses.
+ */
+#define	DEBUG_PAGE_SHIFT		12
+#define	DEBUG_PAGE_HASH_SIZE		1024
+#define	DEBUG_PAGE_HASH(a)		((((a) >> DEBUG_PAGE_SHIFT) ^	\
+		((a) >> (DEBUG_PAGE_SHIFT + 10))) & (DEBUG_PAGE_HASH_SIZE - 1))
+
 struct breakpoints {
 	int		n;
 
 	/*  Arrays, with one element for each entry:  */
 	char		**string;
 	uint64_t	*addr;
+
+	/*  Number of breakpoints on pages in each hash bucket:  */
+	int		page_count[DEBUG_PAGE_HASH_SIZE];
+};
+
+#define	WATCHPOINT_READ			1
+#define	WATCHPOINT_WRITE		2
+
+struct watchpoints {
+	int		n;
+
+	/*  Arrays, with one element for each entry:  */
+	char		**string;
+	uint64_t	*addr;
+	uint64_t	*len;
+	int		*flags;
+
+	/*  Number of watchpoints on pages in each hash bucket:  */
+	int		page_count[DEBUG_PAGE_HASH_SIZE];
+};
+
+#define	STATISTICS_MAX_FIELDS		3
+#define	STATISTICS_BINARY_MAGIC		"GXstat1"
+
+struct statistics_entry {
+	uint64_t	value[STATISTICS_MAX_FIELDS];
+	uint64_t	count;
+};
+
+/*  Aggregation hash table (open addressing):  */
+struct statistics_table {
+	struct statistics_entry *entries;
+	size_t	n_entries;
+	size_t	table_size;		/*  Always a power of two  */
 };
 
 struct statistics {
@@ -65,6 +112,33 @@ struct statistics {
 	FILE	*file;
 	int	enabled;
 	char	*fields;		/*  "vpi" etc.  */
+
+	int	aggregate;		/*  Count in-process, dump at exit  */
+	int	binary;			/*  Binary records instead of text  */
+	int	sample_interval;	/*  Every n:th instruction  */
+	int	sample_countdown;
+
+	struct statistics_table table;
+};
+
+#define	PROFILE_DEFAULT_INTERVAL	10000
+
+/*
+ *  Sampling profiler: every interval:th instruction (approximately, since
+ *  samples are only taken between dyntrans runs), the program counter and
+ *  optionally the return address are recorded in the samples table. At
+ *  exit, a symbolized flat profile is written to filename, and a folded
+ *  call stack profile to filename.folded.
+ */
+struct profile {
+	char	*filename;
+	int	enabled;
+	int	callers;		/*  Record return addresses too  */
+	int	interval;
+	int	countdown;
+
+	uint64_t n_samples;
+	struct statistics_table samples;
 };
 
 struct tick_functions {
@@ -130,6 +204,9 @@ struct machine {
 	/*  Tick functions (e.g. hardware devices):  */
 	struct tick_functions tick_functions;
 
+	/*  Number of cpu0 instructions during which all cpus have been idle:  */
+	int64_t	idle_ninstrs;
+
 	char	*cpu_name;  /*  TODO: remove this, there could be several
 				cpus with different names in a machine  */
 	int	byte_order_override;
@@ -155,8 +232,9 @@ struct machine {
 	char	*bootstr;
 	char	*bootarg;
 
-	/*  Breakpoints:  */
+	/*  Breakpoints and watchpoints:  */
 	struct breakpoints breakpoints;
+	struct watchpoints watchpoints;
 
 	int	halt_on_nonexistant_memaccess;
 	int	instruction_trace;
@@ -175,6 +253,9 @@ struct machine {
 	/*  Instruction statistics:  */
 	struct statistics statistics;
 
+	/*  Sampling profiler:  */
+	struct profile profile;
+
 	/*  X11/framebuffer stuff (per machine):  */
 	struct x11_md x11_md;
 
@@ -368,15 +449,30 @@ void machine_destroy(struct machine *machine);
 int machine_name_to_type(char *stype, char *ssubtype,
 	int *type, int *subtype, int *arch);
 void machine_add_breakpoint_string(struct machine *machine, char *str);
+void machine_breakpoints_rehash(struct machine *machine);
+void machine_add_watchpoint(struct machine *machine, uint64_t addr,
+	uint64_t len, int flags, const char *str);
+void machine_remove_watchpoint(struct machine *machine, int i);
+int machine_watched_page(struct cpu *cpu, uint64_t addr);
+int machine_watchpoint_hit(struct cpu *cpu, uint64_t addr, size_t len,
+	int writeflag);
 void machine_add_tickfunction(struct machine *machine,
 	void (*func)(struct cpu *, void *), void *extra, int clockshift);
 void machine_statistics_init(struct machine *, char *fname);
+void machine_statistics_add(struct machine *, uint64_t *values);
+void machine_statistics_finish(struct machine *);
+void machine_profile_init(struct machine *, char *fname);
+void machine_profile_add(struct machine *, uint64_t *values);
+void machine_profile_finish(struct machine *);
 void machine_register(char *name, MACHINE_SETUP_TYPE(setup));
 void machine_setup(struct machine *);
 void machine_memsize_fix(struct machine *);
 void machine_default_cputype(struct machine *);
 void machine_dumpinfo(struct machine *);
 int machine_run(struct machine *machine);
+int machine_is_idle(struct machine *machine);
+double machine_time_to_next_tick(struct machine *machine);
+void machine_idle_slept(struct machine *machine, double seconds);
 void machine_list_available_types_and_cpus(void);
 struct machine_entry *machine_entry_new(const char *name, 
 	int arch, int oldstyle_type);
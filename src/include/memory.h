@@ -101,6 +101,11 @@ void memory_writemax64(struct cpu *cpu, unsigned char *buf, int len,
 
 void *zeroed_alloc(size_t s);
 
+void memory_sharing_enable(int interval);
+int memory_sharing_enabled(void);
+void memory_sharing_scan(int report);
+void memory_sharing_tick(void);
+
 struct memory *memory_new(uint64_t physical_max, int arch);
 
 int memory_points_to_string(struct cpu *cpu, struct memory *mem,
@@ -110,6 +115,8 @@ char *memory_conv_to_string(struct cpu *cpu, struct memory *mem,
 
 unsigned char *memory_paddr_to_hostaddr(struct memory *mem,
 	uint64_t paddr, int writeflag);
+unsigned char *memory_paddr_to_hostrange(struct memory *mem,
+	uint64_t paddr, int writeflag, size_t *lenp);
 
 
 /*  Writeflag:  */
@@ -157,6 +164,8 @@ void memory_device_register(struct memory *mem, const char *,
 	    struct memory *,uint64_t,unsigned char *,size_t,int,void *),
 	void *extra, int flags, unsigned char *dyntrans_data);
 void memory_device_remove(struct memory *mem, int i);
+int memory_device_remap(struct memory *mem, uint64_t oldaddr, uint64_t len,
+	uint64_t newaddr);
 
 uint64_t memory_checksum(struct memory *mem);
 
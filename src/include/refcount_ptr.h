@@ -91,6 +91,17 @@ public:
 		return (-- m_refCount);
 	}
 
+	/**
+	 * \brief Gets the current reference count of the object.
+	 *
+	 * @return The number of reference counted pointers which currently
+	 *	point to the object.
+	 */
+	int get_refcount() const
+	{
+		return m_refCount;
+	}
+
 private:
 	mutable int	m_refCount;
 };
@@ -130,5 +130,18 @@
 #define	CHCR_TD		0x00000001	/*  DMAC Enable  */
 
 #define	SH4_DMAOR	0xffa00040	/*  DMA operation register  */
+#define	DMAOR_DDT	0x00008000	/*  On-Demand Data Transfer  */
+#define	DMAOR_PR	0x00000300	/*  Priority Mode  */
+#define	DMAOR_AE	0x00000004	/*  Address Error  */
+#define	DMAOR_NMIF	0x00000002	/*  NMI Flag  */
+#define	DMAOR_DME	0x00000001	/*  DMAC Master Enable  */
+
+/*  Interrupt event codes (SH7750 layout, channels 0..3 only):  */
+#define	N_SH4_DMA_INTERRUPTS	4
+#define	SH4_INTEVT_DMAC_DMTE0	0x640	/*  Transfer End, channel 0  */
+#define	SH4_INTEVT_DMAC_DMTE1	0x660
+#define	SH4_INTEVT_DMAC_DMTE2	0x680
+#define	SH4_INTEVT_DMAC_DMTE3	0x6a0
+#define	SH4_INTEVT_DMAC_DMAE	0x6c0	/*  Address Error  */
 
 #endif	/*  SH4_DMACREG_H  */
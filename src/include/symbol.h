@@ -35,7 +35,6 @@
 
 /*  This should actually only be used within symbol.c:  */
 struct symbol {
-	struct symbol	*next;
 	uint64_t	addr;
 	uint64_t	len;
 	char		*name;
@@ -43,24 +42,38 @@ struct symbol {
 
 	int		n_args;
 	/*  TODO: argument types  */
+
+	/*  Index of the next symbol in the same name hash chain, or -1:  */
+	int		next_by_name;
 };
 
 
 struct symbol_context {
-	struct symbol	*first_symbol;
-	int		sorted_array;
+	/*  All symbols, sorted by address when sorted_array is set:  */
+	struct symbol	*symbols;
 	int		n_symbols;
+	int		max_symbols;
+	int		sorted_array;
+
+	/*  max_end[i] is the highest end address of symbols 0..i:  */
+	uint64_t	*max_end;
 
+	/*  Name hash buckets (symbol indices, or -1):  */
+	int		*name_hash;
+	int		name_hash_size;
 };
 
 /*  symbol.c:  */
 int symbol_nsymbols(struct symbol_context *);
 int get_symbol_addr(struct symbol_context *, const char *symbol, uint64_t *addr);
+char *get_symbol_name_and_n_args_r(struct symbol_context *, uint64_t addr,
+	uint64_t *offset, int *n_argsp, char *buf, size_t bufsize);
 char *get_symbol_name_and_n_args(struct symbol_context *, uint64_t addr,
 	uint64_t *offset, int *n_argsp);
 char *get_symbol_name(struct symbol_context *, uint64_t addr, uint64_t *offset);
 void add_symbol_name(struct symbol_context *, uint64_t addr,
 	uint64_t len, const char *name, int type, int n_args);
+void symbol_reserve(struct symbol_context *, int n);
 void symbol_readfile(struct symbol_context *, char *fname);
 void symbol_recalc_sizes(struct symbol_context *);
 void symbol_init(struct symbol_context *);
@@ -299,6 +299,8 @@
 
 #define	PVRREG_TA_LUMINANCE	0x118	/*  todo  */
 
+#define	PVRREG_PT_ALPHA_REF	0x11c	/*  punch-through alpha reference  */
+
 #define	PVRREG_TA_OPB_START	0x124
 #define	TA_OPB_START_MASK	0x00ffff80
 
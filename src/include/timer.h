@@ -29,9 +29,15 @@
  */
 
 struct timer;
+struct timeval;
 
 #define	TIMER_BASE_FREQUENCY	65.0	/*  Hz  */
 
+/*  Deterministic mode: instructions per emulated second, if the machine
+    has no emulated_hz, and the time of day at startup (2010-01-01):  */
+#define	TIMER_DETERMINISTIC_DEFAULT_HZ	100000000
+#define	TIMER_DETERMINISTIC_START_TIME	1262304000
+
 struct timer *timer_add(double freq, void (*timer_tick)(struct timer *timer,
 	void *extra), void *extra);
 void timer_remove(struct timer *t);
@@ -41,6 +47,13 @@ void timer_update_frequency(struct timer *t, double new_freq);
 void timer_start(void);
 void timer_stop(void);
 
+void timer_set_deterministic(double instructions_per_second);
+int timer_is_deterministic(void);
+void timer_advance_instructions(int64_t n);
+double timer_time_to_next_tick(double limit);
+void timer_gettimeofday(struct timeval *tv);
+time_t timer_time(void);
+
 void timer_init(void);
 
 
@@ -36,6 +36,7 @@
 #include <unistd.h>
 
 #include "cpu.h"
+#include "debugger.h"
 #include "device.h"
 #include "diskimage.h"
 #include "emul.h"
@@ -46,6 +47,9 @@
 #include "symbol.h"
 
 
+extern volatile int single_step;
+
+
 /*  This is initialized by machine_init():  */
 struct machine_entry *first_machine_entry = NULL;
 
@@ -111,6 +115,9 @@ struct machine *machine_new(char *name, struct emul *emul, int id)
 	settings_add(m->settings, "statistics_enabled", 1,
 	    SETTINGS_TYPE_INT, SETTINGS_FORMAT_YESNO,
 	    (void *) &m->statistics.enabled);
+	settings_add(m->settings, "profile_enabled", 1,
+	    SETTINGS_TYPE_INT, SETTINGS_FORMAT_YESNO,
+	    (void *) &m->profile.enabled);
 
 	return m;
 }
@@ -128,6 +135,9 @@ void machine_destroy(struct machine *machine)
 	for (i=0; i<machine->ncpus; i++)
 		cpu_destroy(machine->cpus[i]);
 
+	machine_statistics_finish(machine);
+	machine_profile_finish(machine);
+
 	if (machine->name != NULL)
 		free(machine->name);
 
@@ -263,6 +273,203 @@ void machine_add_breakpoint_string(struct machine *machine, char *str)
 }
 
 
+/*
+ *  machine_breakpoints_rehash():
+ *
+ *  Recount the breakpoints per page hash bucket. This must be called
+ *  whenever a breakpoint address has been added, changed, or removed.
+ */
+void machine_breakpoints_rehash(struct machine *machine)
+{
+	int i;
+
+	memset(machine->breakpoints.page_count, 0,
+	    sizeof(machine->breakpoints.page_count));
+
+	for (i=0; i<machine->breakpoints.n; i++)
+		machine->breakpoints.page_count[DEBUG_PAGE_HASH(
+		    machine->breakpoints.addr[i])] ++;
+}
+
+
+/*
+ *  machine_watchpoints_changed():
+ *
+ *  Count the pages of watchpoint i in the page hash (delta = 1 or -1), and
+ *  drop those pages from the cpus' fast translation arrays, so that the
+ *  next access to them goes through memory_rw().
+ */
+static void machine_watchpoints_changed(struct machine *machine, int i,
+	int delta)
+{
+	uint64_t page = machine->watchpoints.addr[i] >> DEBUG_PAGE_SHIFT;
+	uint64_t last = (machine->watchpoints.addr[i] +
+	    machine->watchpoints.len[i] - 1) >> DEBUG_PAGE_SHIFT;
+	int j;
+
+	for (; page <= last; page++) {
+		uint64_t addr = page << DEBUG_PAGE_SHIFT;
+
+		machine->watchpoints.page_count[DEBUG_PAGE_HASH(addr)] += delta;
+
+		for (j=0; j<machine->ncpus; j++)
+			if (machine->cpus[j]->invalidate_translation_caches
+			    != NULL)
+				machine->cpus[j]->invalidate_translation_caches(
+				    machine->cpus[j], addr, INVALIDATE_VADDR);
+
+		if (page == last)
+			break;
+	}
+}
+
+
+/*
+ *  machine_add_watchpoint():
+ *
+ *  Add a watchpoint for len bytes at virtual address addr. flags is
+ *  WATCHPOINT_READ, WATCHPOINT_WRITE, or both. str (which may be NULL) is
+ *  the expression the address was given as.
+ */
+void machine_add_watchpoint(struct machine *machine, uint64_t addr,
+	uint64_t len, int flags, const char *str)
+{
+	struct watchpoints *w = &machine->watchpoints;
+	int n = w->n + 1;
+
+	CHECK_ALLOCATION(w->string = (char **)
+	    realloc(w->string, n * sizeof(char *)));
+	CHECK_ALLOCATION(w->addr = (uint64_t *)
+	    realloc(w->addr, n * sizeof(uint64_t)));
+	CHECK_ALLOCATION(w->len = (uint64_t *)
+	    realloc(w->len, n * sizeof(uint64_t)));
+	CHECK_ALLOCATION(w->flags = (int *)
+	    realloc(w->flags, n * sizeof(int)));
+
+	w->string[w->n] = NULL;
+	if (str != NULL)
+		CHECK_ALLOCATION(w->string[w->n] = strdup(str));
+
+	w->addr[w->n] = addr;
+	w->len[w->n] = len > 0? len : 1;
+	w->flags[w->n] = flags;
+	w->n ++;
+
+	machine_watchpoints_changed(machine, w->n - 1, 1);
+}
+
+
+/*
+ *  machine_remove_watchpoint():
+ *
+ *  Remove watchpoint nr i.
+ */
+void machine_remove_watchpoint(struct machine *machine, int i)
+{
+	struct watchpoints *w = &machine->watchpoints;
+
+	machine_watchpoints_changed(machine, i, -1);
+
+	free(w->string[i]);
+
+	for (; i<w->n-1; i++) {
+		w->string[i] = w->string[i+1];
+		w->addr[i]   = w->addr[i+1];
+		w->len[i]    = w->len[i+1];
+		w->flags[i]  = w->flags[i+1];
+	}
+
+	w->n --;
+}
+
+
+/*
+ *  machine_watched_page():
+ *
+ *  Return the WATCHPOINT_* flags of all watchpoints which overlap the
+ *  (virtual) page containing addr, or 0 if the page is not watched.
+ */
+int machine_watched_page(struct cpu *cpu, uint64_t addr)
+{
+	struct watchpoints *w = &cpu->machine->watchpoints;
+	uint64_t mask = cpu->is_32bit? 0xffffffffULL : (uint64_t) -1;
+	uint64_t page = (addr & mask) >> DEBUG_PAGE_SHIFT;
+	int i, flags = 0;
+
+	if (w->page_count[DEBUG_PAGE_HASH(addr)] == 0)
+		return 0;
+
+	for (i=0; i<w->n; i++) {
+		uint64_t first = (w->addr[i] & mask) >> DEBUG_PAGE_SHIFT;
+		uint64_t last = ((w->addr[i] + w->len[i] - 1) & mask)
+		    >> DEBUG_PAGE_SHIFT;
+
+		if (page >= first && page <= last)
+			flags |= w->flags[i];
+	}
+
+	return flags;
+}
+
+
+/*
+ *  machine_watchpoint_hit():
+ *
+ *  Called by memory_rw() for data accesses to watched pages. If the access
+ *  of len bytes at addr touches a watchpoint, a message is printed, the
+ *  emulator is made to enter the debugger, and the watchpoint nr is
+ *  returned. Otherwise, -1 is returned.
+ *
+ *  (It is up to memory_rw() to make the cpu stop running translated code
+ *  after the current instruction.)
+ */
+int machine_watchpoint_hit(struct cpu *cpu, uint64_t addr, size_t len,
+	int writeflag)
+{
+	struct watchpoints *w = &cpu->machine->watchpoints;
+	uint64_t mask = cpu->is_32bit? 0xffffffffULL : (uint64_t) -1;
+	int i, flag = writeflag == MEM_WRITE?
+	    WATCHPOINT_WRITE : WATCHPOINT_READ;
+
+	if (w->page_count[DEBUG_PAGE_HASH(addr)] == 0)
+		return -1;
+
+	addr &= mask;
+
+	for (i=0; i<w->n; i++) {
+		uint64_t wa = w->addr[i] & mask;
+
+		if (!(w->flags[i] & flag) ||
+		    addr + len <= wa || addr >= wa + w->len[i])
+			continue;
+
+		/*  Only report the first hit before the debugger is entered:  */
+		if (single_step == ENTER_SINGLE_STEPPING)
+			return i;
+
+		if (cpu->delay_slot == NOT_DELAYED)
+			fatal("WATCHPOINT %i: %s of %i byte%s at 0x%"PRIx64
+			    ", pc = 0x%"PRIx64"\n(The access has been "
+			    "performed. The debugger is entered after this "
+			    "instruction.)\n", i, writeflag == MEM_WRITE?
+			    "write" : "read", (int) len, len == 1? "" : "s",
+			    (uint64_t) addr, (uint64_t) cpu->pc);
+		else
+			fatal("WATCHPOINT %i: %s of %i byte%s at 0x%"PRIx64
+			    ", in a delay slot\n(The access has been performed."
+			    " The debugger is entered shortly after the "
+			    "branch.)\n", i, writeflag == MEM_WRITE?
+			    "write" : "read", (int) len, len == 1? "" : "s",
+			    (uint64_t) addr);
+
+		single_step = ENTER_SINGLE_STEPPING;
+		return i;
+	}
+
+	return -1;
+}
+
+
 /*
  *  machine_add_tickfunction():
  *
@@ -320,7 +527,7 @@ void machine_add_tickfunction(struct machine *machine, void (*func)
  */
 void machine_statistics_init(struct machine *machine, char *fname)
 {
-	int n_fields = 0;
+	int n_fields = 0, sample_interval = 0;
 	char *pcolon = fname;
 	const char *mode = "a";	/*  Append by default  */
 
@@ -352,6 +559,12 @@ void machine_statistics_init(struct machine *machine, char *fname)
 		case 'v':
 		case 'i':
 		case 'p':
+			if (n_fields >= STATISTICS_MAX_FIELDS) {
+				fprintf(stderr, "At most %i type flags can be"
+				    " used with the -s option.\n",
+				    STATISTICS_MAX_FIELDS);
+				exit(1);
+			}
 			CHECK_ALLOCATION(machine->statistics.fields = (char *) realloc(
 			    machine->statistics.fields, strlen(
 			    machine->statistics.fields) + 2));
@@ -366,6 +579,16 @@ void machine_statistics_init(struct machine *machine, char *fname)
 		case 'd':
 			machine->statistics.enabled = 0;
 			break;
+		case 'a':
+			machine->statistics.aggregate = 1;
+			break;
+		case 'b':
+			machine->statistics.binary = 1;
+			break;
+		case '0': case '1': case '2': case '3': case '4':
+		case '5': case '6': case '7': case '8': case '9':
+			sample_interval = sample_interval * 10 + *fname - '0';
+			break;
 
 		default:fprintf(stderr, "Unknown flag '%c' used with the"
 			    " -s option. Aborting.\n", *fname);
@@ -376,8 +599,390 @@ void machine_statistics_init(struct machine *machine, char *fname)
 
 	fname ++;	/*  point to the filename after the colon  */
 
+	if (machine->statistics.aggregate && machine->statistics.binary) {
+		fprintf(stderr, "The a and b flags cannot be combined.\n");
+		exit(1);
+	}
+
+	machine->statistics.sample_interval =
+	    sample_interval > 0? sample_interval : 1;
+	machine->statistics.sample_countdown =
+	    machine->statistics.sample_interval;
+
+	/*  The summary is written from scratch at exit:  */
+	if (machine->statistics.aggregate)
+		mode = "w";
+
 	CHECK_ALLOCATION(machine->statistics.filename = strdup(fname));
 	machine->statistics.file = fopen(machine->statistics.filename, mode);
+
+	/*
+	 *  Binary traces start with a header: the magic string (including
+	 *  the terminating nul char), and then the type flags, one byte
+	 *  each, padded with nul chars to STATISTICS_MAX_FIELDS bytes. Each
+	 *  record is then one little-endian uint64_t per type flag.
+	 */
+	if (machine->statistics.binary && machine->statistics.file != NULL) {
+		char header[sizeof(STATISTICS_BINARY_MAGIC) +
+		    STATISTICS_MAX_FIELDS];
+		memset(header, 0, sizeof(header));
+		memcpy(header, STATISTICS_BINARY_MAGIC,
+		    sizeof(STATISTICS_BINARY_MAGIC));
+		memcpy(header + sizeof(STATISTICS_BINARY_MAGIC),
+		    machine->statistics.fields, n_fields);
+		fwrite(header, 1, sizeof(header), machine->statistics.file);
+	}
+}
+
+
+/*
+ *  statistics_lookup():
+ *
+ *  Returns the aggregation hash table entry for a combination of field
+ *  values. If there is no such entry, a free entry is returned (with count
+ *  zero); the caller must then fill it in.
+ */
+static struct statistics_entry *statistics_lookup(struct statistics_table *t,
+	uint64_t *values, int n_fields)
+{
+	uint64_t hash = 0;
+	size_t i;
+	int j;
+
+	for (j=0; j<n_fields; j++)
+		hash = (hash ^ values[j]) * 0x9e3779b97f4a7c15ULL;
+	i = (hash >> 32) & (t->table_size - 1);
+
+	for (;;) {
+		struct statistics_entry *e = &t->entries[i];
+
+		if (e->count == 0 || memcmp(e->value, values,
+		    n_fields * sizeof(uint64_t)) == 0)
+			return e;
+
+		i = (i + 1) & (t->table_size - 1);
+	}
+}
+
+
+/*
+ *  statistics_table_add():
+ *
+ *  Add count occurrences of a combination of field values to an aggregation
+ *  hash table. Unused values (at index n_fields and above) must be zero.
+ */
+static void statistics_table_add(struct statistics_table *t,
+	uint64_t *values, int n_fields, uint64_t count)
+{
+	struct statistics_entry *e;
+
+	/*  Grow the table when it becomes half full:  */
+	if (t->n_entries * 2 >= t->table_size) {
+		struct statistics_entry *old = t->entries;
+		size_t i, old_size = t->table_size;
+
+		t->table_size = old_size == 0? 65536 : old_size * 2;
+		CHECK_ALLOCATION(t->entries = (struct statistics_entry *)
+		    calloc(t->table_size, sizeof(struct statistics_entry)));
+
+		for (i=0; i<old_size; i++)
+			if (old[i].count != 0)
+				*statistics_lookup(t, old[i].value,
+				    n_fields) = old[i];
+
+		free(old);
+	}
+
+	e = statistics_lookup(t, values, n_fields);
+	if (e->count == 0) {
+		memcpy(e->value, values, n_fields * sizeof(uint64_t));
+		t->n_entries ++;
+	}
+
+	e->count += count;
+}
+
+
+static int statistics_entry_cmp(const void *a, const void *b)
+{
+	const struct statistics_entry *ea = (const struct statistics_entry *)a;
+	const struct statistics_entry *eb = (const struct statistics_entry *)b;
+
+	if (ea->count != eb->count)
+		return ea->count > eb->count? -1 : 1;
+	return memcmp(ea->value, eb->value, sizeof(ea->value));
+}
+
+
+/*
+ *  statistics_table_sort():
+ *
+ *  Compacts an aggregation hash table into a plain array, sorted with the
+ *  most common entries first. Returns the number of entries. (The table
+ *  can no longer be used for lookups afterwards.)
+ */
+static size_t statistics_table_sort(struct statistics_table *t)
+{
+	size_t i, n = 0;
+
+	for (i=0; i<t->table_size; i++)
+		if (t->entries[i].count != 0)
+			t->entries[n++] = t->entries[i];
+
+	qsort(t->entries, n, sizeof(struct statistics_entry),
+	    statistics_entry_cmp);
+
+	return n;
+}
+
+
+static void statistics_table_free(struct statistics_table *t)
+{
+	free(t->entries);
+	t->entries = NULL;
+	t->n_entries = t->table_size = 0;
+}
+
+
+/*
+ *  machine_statistics_add():
+ *
+ *  Count one occurrence of a combination of field values (one value per
+ *  type flag), when aggregating statistics in-process.
+ */
+void machine_statistics_add(struct machine *machine, uint64_t *values)
+{
+	struct statistics *st = &machine->statistics;
+
+	statistics_table_add(&st->table, values, strlen(st->fields), 1);
+}
+
+
+/*
+ *  machine_statistics_finish():
+ *
+ *  Called when a machine is destroyed. If statistics were aggregated
+ *  in-process, then a summary is written, in CSV format: a header line,
+ *  and then one line per unique combination of field values, with the
+ *  most common combinations first.
+ */
+void machine_statistics_finish(struct machine *machine)
+{
+	struct statistics *st = &machine->statistics;
+	size_t i, n;
+	int j, n_fields;
+
+	if (st->file == NULL)
+		return;
+
+	if (st->aggregate) {
+		struct statistics_entry *entries = st->table.entries;
+
+		n_fields = strlen(st->fields);
+		n = statistics_table_sort(&st->table);
+
+		fprintf(st->file, "count");
+		for (j=0; j<n_fields; j++)
+			fprintf(st->file, ",%c", st->fields[j]);
+		fprintf(st->file, "\n");
+
+		for (i=0; i<n; i++) {
+			fprintf(st->file, "%"PRIu64, entries[i].count);
+			for (j=0; j<n_fields; j++)
+				fprintf(st->file, ",0x%"PRIx64,
+				    entries[i].value[j]);
+			fprintf(st->file, "\n");
+		}
+
+		statistics_table_free(&st->table);
+	}
+
+	fclose(st->file);
+	st->file = NULL;
+}
+
+
+/*
+ *  machine_profile_init():
+ *
+ *  Enable the sampling profiler. The fname argument contains
+ *  "flags:filename", where the flags are optional.
+ */
+void machine_profile_init(struct machine *machine, char *fname)
+{
+	struct profile *p = &machine->profile;
+	char *pcolon = strchr(fname, ':');
+	int interval = 0;
+
+	if (p->filename != NULL) {
+		fprintf(stderr, "Only one -P option is allowed.\n");
+		exit(1);
+	}
+
+	p->enabled = 1;
+
+	if (pcolon != NULL) {
+		for (; fname != pcolon; fname++) {
+			switch (*fname) {
+			case 'c':
+				p->callers = 1;
+				break;
+			case 'd':
+				p->enabled = 0;
+				break;
+			case '0': case '1': case '2': case '3': case '4':
+			case '5': case '6': case '7': case '8': case '9':
+				interval = interval * 10 + *fname - '0';
+				break;
+			default:fprintf(stderr, "Unknown flag '%c' used with"
+				    " the -P option. Aborting.\n", *fname);
+				exit(1);
+			}
+		}
+
+		fname ++;
+	}
+
+	p->interval = interval > 0? interval : PROFILE_DEFAULT_INTERVAL;
+	p->countdown = p->interval;
+
+	CHECK_ALLOCATION(p->filename = strdup(fname));
+}
+
+
+/*
+ *  machine_profile_add():
+ *
+ *  Count one sample. values[0] is the program counter, values[1] is the
+ *  return address (or zero, if return addresses are not recorded).
+ */
+void machine_profile_add(struct machine *machine, uint64_t *values)
+{
+	machine->profile.n_samples ++;
+	statistics_table_add(&machine->profile.samples, values, 2, 1);
+}
+
+
+/*
+ *  profile_function():
+ *
+ *  Returns the start address of the function containing addr, or addr
+ *  itself if there is no symbol for it.
+ */
+static uint64_t profile_function(struct machine *machine, uint64_t addr)
+{
+	uint64_t offset;
+
+	if (get_symbol_name(&machine->symbol_context, addr, &offset) == NULL)
+		return addr;
+
+	return addr - offset;
+}
+
+
+static void profile_print_function(struct machine *machine, FILE *f,
+	uint64_t addr)
+{
+	char *symbol = get_symbol_name(&machine->symbol_context, addr, NULL);
+
+	if (symbol != NULL)
+		fprintf(f, "%s", symbol);
+	else
+		fprintf(f, "0x%"PRIx64, addr);
+}
+
+
+/*
+ *  machine_profile_finish():
+ *
+ *  Called when a machine is destroyed. The raw samples are folded into
+ *  functions, and written as a flat profile (one line per function, with
+ *  the most sampled functions first) to the profile filename, and as
+ *  "caller;function count" lines to filename.folded. The folded format
+ *  can be used directly by common flame graph tools.
+ *
+ *  A return address which points into the sampled function itself is
+ *  ignored; in non-leaf functions, the link register is often stale.
+ */
+void machine_profile_finish(struct machine *machine)
+{
+	struct profile *p = &machine->profile;
+	struct statistics_table flat, folded;
+	size_t i, n;
+	char *folded_name;
+	FILE *f;
+
+	if (p->filename == NULL)
+		return;
+
+	memset(&flat, 0, sizeof(flat));
+	memset(&folded, 0, sizeof(folded));
+
+	for (i=0; i<p->samples.table_size; i++) {
+		struct statistics_entry *e = &p->samples.entries[i];
+		uint64_t v[STATISTICS_MAX_FIELDS];
+
+		if (e->count == 0)
+			continue;
+
+		memset(v, 0, sizeof(v));
+		v[0] = profile_function(machine, e->value[0]);
+		statistics_table_add(&flat, v, 1, e->count);
+
+		if (p->callers && e->value[1] != 0) {
+			v[1] = profile_function(machine, e->value[1]);
+			if (v[1] == v[0])
+				v[1] = 0;
+		}
+		statistics_table_add(&folded, v, 2, e->count);
+	}
+
+	f = fopen(p->filename, "w");
+	if (f == NULL) {
+		perror(p->filename);
+	} else {
+		n = statistics_table_sort(&flat);
+		fprintf(f, "# %"PRIu64" samples, one every %i instructions\n",
+		    p->n_samples, p->interval);
+		fprintf(f, "#  samples       %%  function\n");
+		for (i=0; i<n; i++) {
+			fprintf(f, "%10"PRIu64"  %6.2f  ", flat.entries[i].count,
+			    100.0 * flat.entries[i].count / p->n_samples);
+			profile_print_function(machine, f,
+			    flat.entries[i].value[0]);
+			fprintf(f, "\n");
+		}
+		fclose(f);
+	}
+
+	CHECK_ALLOCATION(folded_name = (char *)
+	    malloc(strlen(p->filename) + 8));
+	snprintf(folded_name, strlen(p->filename) + 8, "%s.folded",
+	    p->filename);
+	f = fopen(folded_name, "w");
+	if (f == NULL) {
+		perror(folded_name);
+	} else {
+		n = statistics_table_sort(&folded);
+		for (i=0; i<n; i++) {
+			if (folded.entries[i].value[1] != 0) {
+				profile_print_function(machine, f,
+				    folded.entries[i].value[1]);
+				fprintf(f, ";");
+			}
+			profile_print_function(machine, f,
+			    folded.entries[i].value[0]);
+			fprintf(f, " %"PRIu64"\n", folded.entries[i].count);
+		}
+		fclose(f);
+	}
+
+	free(folded_name);
+	statistics_table_free(&flat);
+	statistics_table_free(&folded);
+	statistics_table_free(&p->samples);
+	free(p->filename);
+	p->filename = NULL;
 }
 
 
@@ -619,7 +1224,10 @@ int machine_run(struct machine *machine)
 
 	for (i=0; i<ncpus; i++) {
 		if (cpus[i]->running) {
-			int instrs_run = cpus[i]->run_instr(cpus[i]);
+			int instrs_run;
+
+			cpus[i]->is_idle = 0;
+			instrs_run = cpus[i]->run_instr(cpus[i]);
 			if (i == 0)
 				cpu0instrs += instrs_run;
 		}
@@ -647,6 +1255,16 @@ int machine_run(struct machine *machine)
 		}
 	}
 
+	/*  Have all cpus been idle during this run?  */
+	for (i=0; i<ncpus; i++)
+		if (cpus[i]->running && !cpus[i]->is_idle)
+			break;
+
+	if (i < ncpus)
+		machine->idle_ninstrs = 0;
+	else
+		machine->idle_ninstrs += cpu0instrs;
+
 	/*  Is any CPU still alive?  */
 	for (i=0; i<ncpus; i++)
 		if (cpus[i]->running)
@@ -656,6 +1274,93 @@ int machine_run(struct machine *machine)
 }
 
 
+/*
+ *  machine_is_idle():
+ *
+ *  Returns 1 if all cpus in the machine have been idle for long enough for
+ *  every tick function to have run at least once (so that any interrupts
+ *  caused by expired timers have been delivered), 0 otherwise.
+ */
+int machine_is_idle(struct machine *machine)
+{
+	int64_t needed = N_SAFE_DYNTRANS_LIMIT;
+	int te;
+
+	for (te=0; te<machine->tick_functions.n_entries; te++)
+		if (machine->tick_functions.ticks_reset_value[te] > needed)
+			needed = machine->tick_functions.ticks_reset_value[te];
+
+	return machine->idle_ninstrs >= needed;
+}
+
+
+/*
+ *  machine_time_to_next_tick():
+ *
+ *  Returns the number of seconds until the next instruction driven event
+ *  in the machine (a tick function, or a cpu's own timer, such as the
+ *  PowerPC decrementer), at the machine's emulated_hz. Returns 1.0 if
+ *  there is no such event, or if emulated_hz is not known.
+ */
+double machine_time_to_next_tick(struct machine *machine)
+{
+	int64_t n = -1;
+	int i, te;
+
+	if (machine->emulated_hz <= 0)
+		return 1.0;
+
+	for (te=0; te<machine->tick_functions.n_entries; te++)
+		if (n < 0 || machine->tick_functions.ticks_till_next[te] < n)
+			n = machine->tick_functions.ticks_till_next[te];
+
+	for (i=0; i<machine->ncpus; i++) {
+		struct cpu *cpu = machine->cpus[i];
+		if (cpu->running && cpu->ninstrs_till_event > 0 &&
+		    (n < 0 || cpu->ninstrs_till_event < n))
+			n = cpu->ninstrs_till_event;
+	}
+
+	if (n < 0)
+		return 1.0;
+
+	return (double) n / machine->emulated_hz;
+}
+
+
+/*
+ *  machine_idle_slept():
+ *
+ *  Called after the host has slept, because all cpus in all machines were
+ *  idle. The slept time is credited to the machine's cpus as executed
+ *  instructions, at the machine's emulated_hz, so that the emulated time
+ *  of instruction driven clocks stays in step with the host time.
+ *
+ *  If emulated_hz is not known, the cpus instead have to be idle for a
+ *  while again (see machine_is_idle()) before the host may sleep again.
+ */
+void machine_idle_slept(struct machine *machine, double seconds)
+{
+	int64_t n;
+	int i;
+
+	if (machine->emulated_hz <= 0) {
+		machine->idle_ninstrs = 0;
+		return;
+	}
+
+	n = (int64_t) (seconds * machine->emulated_hz);
+
+	/*  (Limited, so that 32-bit counters can not wrap in one run.)  */
+	if (n > 0x40000000)
+		n = 0x40000000;
+
+	for (i=0; i<machine->ncpus; i++)
+		if (machine->cpus[i]->running)
+			machine->cpus[i]->idle_credit = n;
+}
+
+
 /*****************************************************************************/
 
 
@@ -40,6 +40,7 @@
 #include "machine.h"
 #include "memory.h"
 #include "misc.h"
+#include "timer.h"
 
 #define PLAYSTATION2_BDA        0xffffffffa0001000ULL
 #define PLAYSTATION2_OPTARGS    0xffffffff81fff100ULL
@@ -138,7 +139,7 @@ MACHINE_SETUP(playstation2)
 	/*  TODO:  netbsd's bootinfo.h, for symbolic names  */
 
 	/*  RTC data given by the BIOS:  */
-	timet = time(NULL) + 9*3600;	/*  PS2 uses Japanese time  */
+	timet = timer_time() + 9*3600;	/*  PS2 uses Japanese time  */
 	tm_ptr = gmtime(&timet);
 	/*  TODO:  are these 0- or 1-based?  */
 	store_byte(cpu, 0xa0000000 + machine->physical_ram_in_mb
@@ -725,8 +725,7 @@ void CommandInterpreter::VariableAssignment(const string& componentPath,
 		throw std::exception();
 	}
 
-	const refcount_ptr<Component> lightClone =
-	    m_GXemul->GetRootComponent()->LightClone();
+	m_GXemul->GetRootComponent()->MarkStateClean();
 
 	// Attempt to assign the expression to the variable:
 	if (!component->SetVariableValue(variableName, expression))
@@ -736,7 +735,7 @@ void CommandInterpreter::VariableAssignment(const string& componentPath,
 	// side effects, then this makes sure that the user sees all such side
 	// effects):
 	stringstream changeMessages;
-	m_GXemul->GetRootComponent()->DetectChanges(lightClone, changeMessages);
+	m_GXemul->GetRootComponent()->DetectChangesSinceClean(changeMessages);
 
 	string msg = changeMessages.str();
 	if (msg == "")
@@ -335,6 +335,70 @@ void Component::DetectChanges(const refcount_ptr<Component>& oldClone,
 }
 
 
+void Component::MarkStateClean()
+{
+	StateVariableMap::iterator varIt = m_stateVariables.begin();
+	for ( ; varIt != m_stateVariables.end(); ++varIt)
+		varIt->second.MarkClean();
+
+	m_cleanChildComponents = m_childComponents;
+
+	for (size_t i = 0; i < m_childComponents.size(); ++ i)
+		m_childComponents[i]->MarkStateClean();
+}
+
+
+void Component::DetectChangesSinceClean(ostream& changeMessages) const
+{
+	StateVariableMap::const_iterator varIt = m_stateVariables.begin();
+	for ( ; varIt != m_stateVariables.end(); ++varIt) {
+		const string& varName = varIt->first;
+		const StateVariable& variable = varIt->second;
+
+		// Don't output "step" changes, because they happen all
+		// the time for all executable components.
+		if (varName == "step" || !variable.IsDirty())
+			continue;
+
+		changeMessages << "=> " << GenerateShortestPossiblePath() << "."
+		    << varName << ": " << variable.CleanValueToString()
+		    << " -> " << variable.ToString() << "\n";
+	}
+
+	// Children are compared by identity, not by name as in
+	// DetectChanges(), since there is no clone tree involved.
+	for (size_t i = 0; i < m_childComponents.size(); ++ i) {
+		bool found = false;
+		for (size_t j = 0; j < m_cleanChildComponents.size(); ++ j)
+			if (m_cleanChildComponents[j] == m_childComponents[i]) {
+				found = true;
+				break;
+			}
+
+		if (found)
+			m_childComponents[i]->DetectChangesSinceClean(
+			    changeMessages);
+		else
+			changeMessages << m_childComponents[i]->
+			    GenerateShortestPossiblePath() << " (appeared)\n";
+	}
+
+	for (size_t j = 0; j < m_cleanChildComponents.size(); ++ j) {
+		bool found = false;
+		for (size_t k = 0; k < m_childComponents.size(); ++ k)
+			if (m_childComponents[k] == m_cleanChildComponents[j]) {
+				found = true;
+				break;
+			}
+
+		if (!found)
+			changeMessages << GenerateShortestPossiblePath() << "." <<
+			    m_cleanChildComponents[j]->GetVariable("name")->
+			    ToString() << " (disappeared)\n";
+	}
+}
+
+
 void Component::Reset()
 {
 	ResetState();
@@ -1280,6 +1344,140 @@ refcount_ptr<Component> Component::Deserialize(ostream& messages, const string&
 }
 
 
+void Component::SerializeBinary(ostream& os) const
+{
+	BinarySerialization::WriteHeader(os);
+	SerializeBinaryTree(os);
+}
+
+
+void Component::SerializeBinaryTree(ostream& os) const
+{
+	BinarySerialization::WriteString(os, m_className);
+
+	// Custom values are written last, since their handlers may depend
+	// on ordinary variables (e.g. RAM data is checked against the
+	// RAM's size) when they are deserialized.
+	BinarySerialization::WriteUInt32(os, m_stateVariables.size());
+	for (StateVariableMap::const_iterator it = m_stateVariables.begin();
+	    it != m_stateVariables.end(); ++it)
+		if ((it->second).GetType() != StateVariable::Custom)
+			(it->second).SerializeBinary(os);
+
+	for (StateVariableMap::const_iterator it = m_stateVariables.begin();
+	    it != m_stateVariables.end(); ++it)
+		if ((it->second).GetType() == StateVariable::Custom)
+			(it->second).SerializeBinary(os);
+
+	BinarySerialization::WriteUInt32(os, m_childComponents.size());
+	for (size_t i = 0, n = m_childComponents.size(); i < n; ++ i)
+		m_childComponents[i]->SerializeBinaryTree(os);
+}
+
+
+refcount_ptr<Component> Component::DeserializeBinary(ostream& messages,
+	std::istream& is)
+{
+	uint32_t version;
+	if (!BinarySerialization::ReadHeader(is, version)) {
+		messages << "Not a binary GXemul stream.\n";
+		return NULL;
+	}
+
+	if (version != BinarySerialization::Version) {
+		messages << "Unsupported binary format version " << version
+		    << " (expected " << (int) BinarySerialization::Version
+		    << ").\n";
+		return NULL;
+	}
+
+	return DeserializeBinaryTree(messages, is);
+}
+
+
+refcount_ptr<Component> Component::DeserializeBinaryTree(ostream& messages,
+	std::istream& is)
+{
+	refcount_ptr<Component> deserializedTree = NULL;
+
+	string className;
+	if (!BinarySerialization::ReadString(is, className)) {
+		messages << "Expecting a class name.\n";
+		return deserializedTree;
+	}
+
+	// See Deserialize() regarding root.
+	if (className == "root") {
+		deserializedTree = new RootComponent;
+	} else {
+		deserializedTree = ComponentFactory::CreateComponent(className);
+		if (deserializedTree.IsNULL()) {
+			messages << "Could not create a '" << className << "' component.\n";
+			return deserializedTree;
+		}
+	}
+
+	uint32_t nVariables;
+	if (!BinarySerialization::ReadUInt32(is, nVariables)) {
+		messages << "Failure. (0)\n";
+		return NULL;
+	}
+
+	for (uint32_t i = 0; i < nVariables; ++ i) {
+		string name;
+		uint8_t type;
+		if (!BinarySerialization::ReadString(is, name) ||
+		    !BinarySerialization::ReadUInt8(is, type)) {
+			messages << "Failure. (1)\n";
+			return NULL;
+		}
+
+		StateVariable* var = deserializedTree->GetVariable(name);
+		if (var != NULL && var->GetType() == type) {
+			if (var->DeserializeBinaryValue(is))
+				continue;
+
+			// A value which was rejected by its handler also
+			// fails the load, since the component would otherwise
+			// be left only partially restored.
+			messages << "Failure: variable '" << name <<
+			    "' for component class " << className <<
+			    " could not be deserialized.\n";
+			return NULL;
+		}
+
+		if (!StateVariable::SkipBinaryValue(is,
+		    (StateVariable::Type) type)) {
+			messages << "Failure: unknown variable '" << name <<
+			    "' for component class " << className <<
+			    " could not be skipped.\n";
+			return NULL;
+		}
+
+		messages << "Warning: variable '" << name <<
+		    "' for component class " << className <<
+		    " could not be deserialized; skipping.\n";
+	}
+
+	uint32_t nChildren;
+	if (!BinarySerialization::ReadUInt32(is, nChildren)) {
+		messages << "Failure. (2)\n";
+		return NULL;
+	}
+
+	for (uint32_t i = 0; i < nChildren; ++ i) {
+		refcount_ptr<Component> child =
+		    DeserializeBinaryTree(messages, is);
+		if (child.IsNULL())
+			return NULL;
+
+		deserializedTree->AddChild(child);
+	}
+
+	return deserializedTree;
+}
+
+
 bool Component::CheckConsistency() const
 {
 	// Serialize
@@ -1303,7 +1501,21 @@ bool Component::CheckConsistency() const
 	tmpDeserializedTree->AddChecksum(checksumDeserialized);
 
 	// ... and compare the checksums:
-	return checksumOriginal == checksumDeserialized;
+	if (checksumOriginal != checksumDeserialized)
+		return false;
+
+	// Do the same thing using the binary format:
+	stringstream binary;
+	SerializeBinary(binary);
+
+	refcount_ptr<Component> tmpBinaryTree = DeserializeBinary(messages, binary);
+	if (tmpBinaryTree.IsNULL())
+		return false;
+
+	Checksum checksumBinary;
+	tmpBinaryTree->AddChecksum(checksumBinary);
+
+	return checksumOriginal == checksumBinary;
 }
 
 
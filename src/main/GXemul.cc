@@ -164,6 +164,12 @@
 #include <iostream>
 
 
+// Default number of steps between periodic snapshots, and the maximum
+// number of snapshots to keep, when snapshotting is enabled.
+static const uint64_t DefaultSnapshotInterval = 1000000;
+static const size_t MaxNrOfSnapshots = 16;
+
+
 GXemul::GXemul()
 	: m_quietMode(false)
 	, m_ui(new NullUI(this))
@@ -173,6 +179,7 @@ GXemul::GXemul()
 	, m_nrOfSingleStepsLeft(1)
 	, m_rootComponent(new RootComponent(this))
 	, m_snapshottingEnabled(false)
+	, m_snapshotInterval(DefaultSnapshotInterval)
 {
 	gettimeofday(&m_lastOutputTime, NULL);
 	m_lastOutputStep = 0;
@@ -188,6 +195,7 @@ void GXemul::ClearEmulation()
 
 	m_rootComponent = new RootComponent(this);
 	m_emulationFileName = "";
+	m_snapshots.clear();
 
 	GetUI()->UpdateUI();
 }
@@ -693,8 +701,10 @@ void GXemul::SetRootComponent(refcount_ptr<Component> newRootComponent)
 
 bool GXemul::Reset()
 {
-	// 1. Reset all components in the tree.
+	// 1. Reset all components in the tree. Any snapshots are of the
+	//    old state, and can no longer be used.
 	GetRootComponent()->Reset();
+	m_snapshots.clear();
 
 	// 2. Run "on reset" commands. (These are usually commands to load
 	//    binaries into CPUs.)
@@ -779,6 +789,21 @@ void GXemul::SetSnapshottingEnabled(bool enabled)
 }
 
 
+void GXemul::SetSnapshotInterval(uint64_t steps)
+{
+	if (steps < 1)
+		steps = 1;
+
+	m_snapshotInterval = steps;
+}
+
+
+size_t GXemul::GetNrOfSnapshots() const
+{
+	return m_snapshots.size();
+}
+
+
 bool GXemul::GetQuietMode() const
 {
 	return m_quietMode;
@@ -800,6 +825,12 @@ void GXemul::SetNrOfSingleStepsInARow(uint64_t steps)
 }
 
 
+static uint64_t GetSnapshotStep(const refcount_ptr<Component>& snapshot)
+{
+	return snapshot->GetVariable("step")->ToInteger();
+}
+
+
 bool GXemul::ModifyStep(int64_t oldStep, int64_t newStep)
 {
 	if (!GetSnapshottingEnabled())
@@ -810,10 +841,22 @@ bool GXemul::ModifyStep(int64_t oldStep, int64_t newStep)
 
 	if (newStep < oldStep) {
 		// Run in reverse, by running forward from the most suitable
-		// snapshot.
+		// snapshot, i.e. the last one taken at or before newStep.
+		// Snapshots after newStep are discarded, since the user may
+		// change the state before continuing.
+		while (m_snapshots.size() > 1 &&
+		    GetSnapshotStep(m_snapshots.back()) > (uint64_t) newStep)
+			m_snapshots.pop_back();
+
+		if (m_snapshots.empty() ||
+		    GetSnapshotStep(m_snapshots.back()) > (uint64_t) newStep) {
+			GetUI()->ShowDebugMessage("No snapshot to run from.\n");
+			return false;
+		}
 
-		// TODO: Multiple snapshots!
-		refcount_ptr<Component> newRoot = m_snapshot->Clone();
+		// RAM blocks are shared with the snapshot, and only copied
+		// when written to, so this is cheap even for large machines.
+		refcount_ptr<Component> newRoot = m_snapshots.back()->Clone();
 		SetRootComponent(newRoot);
 
 		// GetStep will now return the step count for the new root.
@@ -835,17 +878,33 @@ bool GXemul::ModifyStep(int64_t oldStep, int64_t newStep)
 }
 
 
+uint64_t GXemul::GetNextSnapshotStep() const
+{
+	if (m_snapshots.empty())
+		return 0;
+
+	return GetSnapshotStep(m_snapshots.back()) + m_snapshotInterval;
+}
+
+
 void GXemul::TakeSnapshot()
 {
-	// TODO: Multiple snapshots!
+	uint64_t step = GetStep();
 
-	if (m_snapshot.IsNULL()) {
-		stringstream ss;
-		ss << "(snapshot at step " << GetStep() << ")\n";
-		GetUI()->ShowDebugMessage(ss.str());
+	// Re-running forward after going backwards reaches steps where
+	// snapshots have already been taken.
+	if (!m_snapshots.empty() && GetSnapshotStep(m_snapshots.back()) >= step)
+		return;
 
-		m_snapshot = GetRootComponent()->Clone();
-	}
+	stringstream ss;
+	ss << "(snapshot at step " << step << ")\n";
+	GetUI()->ShowDebugMessage(ss.str());
+
+	m_snapshots.push_back(GetRootComponent()->Clone());
+
+	// Keep the snapshot at step 0, but discard the oldest of the others.
+	if (m_snapshots.size() > MaxNrOfSnapshots)
+		m_snapshots.erase(m_snapshots.begin() + 1);
 }
 
 
@@ -853,7 +912,7 @@ struct ComponentAndFrequency
 {
 	refcount_ptr<Component>	component;
 	double			frequency;
-	StateVariable*		step;
+	StateVariableRef<uint64_t> step;
 
 	uint64_t		nextTimeToExecute;
 };
@@ -866,15 +925,15 @@ static void GetComponentsAndFrequencies(refcount_ptr<Component> component,
 {
 	const StateVariable* paused = component->GetVariable("paused");
 	const StateVariable* freq = component->GetVariable("frequency");
-	StateVariable* step = component->GetVariable("step");
-	if (freq != NULL && step != NULL &&
+	StateVariableRef<uint64_t> step(component->GetVariable("step"));
+	if (freq != NULL && step.IsValid() &&
 	    (paused == NULL || paused->ToInteger() == 0)) {
 		struct ComponentAndFrequency caf;
-		memset(&caf, 0, sizeof(caf));
 
 		caf.component = component;
 		caf.frequency = freq->ToDouble();
 		caf.step      = step;
+		caf.nextTimeToExecute = 0;
 
 		componentsAndFrequencies.push_back(caf);
 	}
@@ -897,8 +956,16 @@ void GXemul::Execute(const int longestTotalRun)
 		return;
 	}
 
+	// The root component's step counter is read and written once per
+	// scheduling slice, so it is resolved only once:
+	StateVariableRef<uint64_t> rootStep(GetRootComponent()->GetVariable("step"));
+	if (!rootStep.IsValid()) {
+		std::cerr << "root component has no 'step' variable? aborting.\n";
+		throw std::exception();
+	}
+
 	// Take an initial snapshot at step 0, if snapshotting is enabled:
-	if (m_snapshottingEnabled && GetStep() == 0)
+	if (m_snapshottingEnabled && m_snapshots.empty() && GetStep() == 0)
 		TakeSnapshot();
 
 	// Find the fastest component:
@@ -921,7 +988,7 @@ void GXemul::Execute(const int longestTotalRun)
 		// Note that setting run state to something else, OR
 		// decreasing nr of single steps left to 0, will break the loop.
 		while (!m_interrupting && m_nrOfSingleStepsLeft > 0 && GetRunState() == SingleStepping) {
-			uint64_t step = GetStep();
+			uint64_t step = rootStep.Get();
 
 			if (printEmptyLineBetweenSteps)
 				GetUI()->ShowDebugMessage("\n");
@@ -942,7 +1009,7 @@ void GXemul::Execute(const int longestTotalRun)
 				uint64_t nsteps = (k == fastestComponentIndex ? step
 				    : (uint64_t) (step * componentsAndFrequencies[k].frequency / fastestFrequency));
 
-				uint64_t stepsExecutedSoFar = componentsAndFrequencies[k].step->ToInteger();
+				uint64_t stepsExecutedSoFar = componentsAndFrequencies[k].step.Get();
 
 				if (stepsExecutedSoFar > nsteps) {
 					std::cerr << "Internal error: " <<
@@ -954,8 +1021,7 @@ void GXemul::Execute(const int longestTotalRun)
 				if (stepsExecutedSoFar < nsteps) {
 					++ stepsExecutedSoFar;
 
-					const refcount_ptr<Component> lightClone =
-					    GetRootComponent()->LightClone();
+					GetRootComponent()->MarkStateClean();
 
 					// Execute one step...
 					int n = componentsAndFrequencies[k].component->Execute(this, 1);
@@ -966,20 +1032,22 @@ void GXemul::Execute(const int longestTotalRun)
 					}
 					
 					// ... and write back the number of executed steps:
-					componentsAndFrequencies[k].step->SetValue(stepsExecutedSoFar);
+					componentsAndFrequencies[k].step.Set(stepsExecutedSoFar);
 
-					// Now, let's compare the clone of the component tree
-					// before execution with what we have now.
+					// Now, let's see what was changed by the step.
 					stringstream changeMessages;
-					GetRootComponent()->DetectChanges(lightClone, changeMessages);
+					GetRootComponent()->DetectChangesSinceClean(changeMessages);
 					string msg = changeMessages.str();
 					if (msg.length() > 0)
 						GetUI()->ShowDebugMessage(msg);
 				}
 			}
 
-			SetStep(step);
+			rootStep.Set(step);
 			-- m_nrOfSingleStepsLeft;
+
+			if (m_snapshottingEnabled && step >= GetNextSnapshotStep())
+				TakeSnapshot();
 		}
 
 		// Done. Let's pause again.
@@ -989,7 +1057,7 @@ void GXemul::Execute(const int longestTotalRun)
 
 	case Running:
 		{
-			uint64_t step = GetStep();
+			uint64_t step = rootStep.Get();
 			uint64_t startingStep = step;
 
 			// TODO: sloppy vs cycle accuracy.
@@ -1025,7 +1093,7 @@ void GXemul::Execute(const int longestTotalRun)
 						double q = (k == fastestComponentIndex ? 1.0
 						    : fastestFrequency / componentsAndFrequencies[k].frequency);
 
-						double c = (componentsAndFrequencies[k].step->ToInteger()+1) * q;
+						double c = (componentsAndFrequencies[k].step.Get()+1) * q;
 						componentsAndFrequencies[k].nextTimeToExecute = (uint64_t) ceil(c) - 1;
 					}
 
@@ -1050,6 +1118,14 @@ void GXemul::Execute(const int longestTotalRun)
 				if (step + toExecute > startingStep + longestTotalRun)
 					toExecute = startingStep + longestTotalRun - step;
 
+				// Stop at the next snapshot step, if snapshotting:
+				if (m_snapshottingEnabled) {
+					uint64_t nextSnapshotStep = GetNextSnapshotStep();
+					if (nextSnapshotStep > step &&
+					    step + toExecute > nextSnapshotStep)
+						toExecute = nextSnapshotStep - step;
+				}
+
 				// std::cerr << "  toExecute = " << toExecute << "\n";
 
 				// Run the components.
@@ -1065,9 +1141,8 @@ void GXemul::Execute(const int longestTotalRun)
 					int n = componentsAndFrequencies[k].component->Execute(this, toExecute);
 
 					// ... and write back the number of executed steps:
-					uint64_t stepsExecutedSoFar = n +
-					    componentsAndFrequencies[k].step->ToInteger();
-					componentsAndFrequencies[k].step->SetValue(stepsExecutedSoFar);
+					componentsAndFrequencies[k].step.Set(
+					    componentsAndFrequencies[k].step.Get() + n);
 
 					if (k == fastestComponentIndex)
 						maxExecuted = n;
@@ -1098,7 +1173,10 @@ void GXemul::Execute(const int longestTotalRun)
 				}
 
 				step += maxExecuted;
-				SetStep(step);
+				rootStep.Set(step);
+
+				if (m_snapshottingEnabled && step >= GetNextSnapshotStep())
+					TakeSnapshot();
 			}
 
 			// Output nr of steps (and speed) every second:
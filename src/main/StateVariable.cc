@@ -27,6 +27,7 @@
 
 #include <assert.h>
 #include <math.h>
+#include <string.h>
 
 #include "EscapedString.h"
 #include "StateVariable.h"
@@ -87,6 +88,7 @@ static uint64_t parse_number(const char* str, bool& error)
 
 StateVariable::StateVariable()
 	: m_type(String)
+	, m_hasCleanValue(false)
 {
 	m_value.pstr = NULL;
 }
@@ -95,6 +97,7 @@ StateVariable::StateVariable()
 StateVariable::StateVariable(const string& name, string* ptrToString)
 	: m_name(name)
 	, m_type(String)
+	, m_hasCleanValue(false)
 {
 	m_value.pstr = ptrToString;
 }
@@ -103,6 +106,7 @@ StateVariable::StateVariable(const string& name, string* ptrToString)
 StateVariable::StateVariable(const string& name, bool* ptrToVar)
 	: m_name(name)
 	, m_type(Bool)
+	, m_hasCleanValue(false)
 {
 	m_value.pbool = ptrToVar;
 }
@@ -111,6 +115,7 @@ StateVariable::StateVariable(const string& name, bool* ptrToVar)
 StateVariable::StateVariable(const string& name, double* ptrToVar)
 	: m_name(name)
 	, m_type(Double)
+	, m_hasCleanValue(false)
 {
 	m_value.pdouble = ptrToVar;
 }
@@ -119,6 +124,7 @@ StateVariable::StateVariable(const string& name, double* ptrToVar)
 StateVariable::StateVariable(const string& name, uint8_t* ptrToVar)
 	: m_name(name)
 	, m_type(UInt8)
+	, m_hasCleanValue(false)
 {
 	m_value.puint8 = ptrToVar;
 }
@@ -127,6 +133,7 @@ StateVariable::StateVariable(const string& name, uint8_t* ptrToVar)
 StateVariable::StateVariable(const string& name, uint16_t* ptrToVar)
 	: m_name(name)
 	, m_type(UInt16)
+	, m_hasCleanValue(false)
 {
 	m_value.puint16 = ptrToVar;
 }
@@ -135,6 +142,7 @@ StateVariable::StateVariable(const string& name, uint16_t* ptrToVar)
 StateVariable::StateVariable(const string& name, uint32_t* ptrToVar)
 	: m_name(name)
 	, m_type(UInt32)
+	, m_hasCleanValue(false)
 {
 	m_value.puint32 = ptrToVar;
 }
@@ -143,6 +151,7 @@ StateVariable::StateVariable(const string& name, uint32_t* ptrToVar)
 StateVariable::StateVariable(const string& name, uint64_t* ptrToVar)
 	: m_name(name)
 	, m_type(UInt64)
+	, m_hasCleanValue(false)
 {
 	m_value.puint64 = ptrToVar;
 }
@@ -151,6 +160,7 @@ StateVariable::StateVariable(const string& name, uint64_t* ptrToVar)
 StateVariable::StateVariable(const string& name, int8_t* ptrToVar)
 	: m_name(name)
 	, m_type(SInt8)
+	, m_hasCleanValue(false)
 {
 	m_value.psint8 = ptrToVar;
 }
@@ -159,6 +169,7 @@ StateVariable::StateVariable(const string& name, int8_t* ptrToVar)
 StateVariable::StateVariable(const string& name, int16_t* ptrToVar)
 	: m_name(name)
 	, m_type(SInt16)
+	, m_hasCleanValue(false)
 {
 	m_value.psint16 = ptrToVar;
 }
@@ -167,6 +178,7 @@ StateVariable::StateVariable(const string& name, int16_t* ptrToVar)
 StateVariable::StateVariable(const string& name, int32_t* ptrToVar)
 	: m_name(name)
 	, m_type(SInt32)
+	, m_hasCleanValue(false)
 {
 	m_value.psint32 = ptrToVar;
 }
@@ -175,6 +187,7 @@ StateVariable::StateVariable(const string& name, int32_t* ptrToVar)
 StateVariable::StateVariable(const string& name, int64_t* ptrToVar)
 	: m_name(name)
 	, m_type(SInt64)
+	, m_hasCleanValue(false)
 {
 	m_value.psint64 = ptrToVar;
 }
@@ -183,6 +196,7 @@ StateVariable::StateVariable(const string& name, int64_t* ptrToVar)
 StateVariable::StateVariable(const string& name, CustomStateVariableHandler* ptrToHandler)
 	: m_name(name)
 	, m_type(Custom)
+	, m_hasCleanValue(false)
 {
 	m_value.phandler = ptrToHandler;
 }
@@ -336,6 +350,174 @@ string StateVariable::ToString() const
 }
 
 
+void StateVariable::MarkClean()
+{
+	m_hasCleanValue = true;
+
+	switch (m_type) {
+	case String:
+		m_cleanString = m_value.pstr == NULL? "" : *m_value.pstr;
+		break;
+	case Bool:
+		m_cleanValue.b = *m_value.pbool;
+		break;
+	case Double:
+		m_cleanValue.d = *m_value.pdouble;
+		break;
+	case UInt8:
+		m_cleanValue.u8 = *m_value.puint8;
+		break;
+	case UInt16:
+		m_cleanValue.u16 = *m_value.puint16;
+		break;
+	case UInt32:
+		m_cleanValue.u32 = *m_value.puint32;
+		break;
+	case UInt64:
+		m_cleanValue.u64 = *m_value.puint64;
+		break;
+	case SInt8:
+		m_cleanValue.s8 = *m_value.psint8;
+		break;
+	case SInt16:
+		m_cleanValue.s16 = *m_value.psint16;
+		break;
+	case SInt32:
+		m_cleanValue.s32 = *m_value.psint32;
+		break;
+	case SInt64:
+		m_cleanValue.s64 = *m_value.psint64;
+		break;
+	case Custom:
+		m_hasCleanValue = false;
+		break;
+	}
+}
+
+
+bool StateVariable::IsDirty() const
+{
+	if (!m_hasCleanValue)
+		return false;
+
+	switch (m_type) {
+	case String:
+		return m_cleanString != (m_value.pstr == NULL? "" : *m_value.pstr);
+	case Bool:
+		return m_cleanValue.b != *m_value.pbool;
+	case Double:
+		return m_cleanValue.d != *m_value.pdouble;
+	case UInt8:
+		return m_cleanValue.u8 != *m_value.puint8;
+	case UInt16:
+		return m_cleanValue.u16 != *m_value.puint16;
+	case UInt32:
+		return m_cleanValue.u32 != *m_value.puint32;
+	case UInt64:
+		return m_cleanValue.u64 != *m_value.puint64;
+	case SInt8:
+		return m_cleanValue.s8 != *m_value.psint8;
+	case SInt16:
+		return m_cleanValue.s16 != *m_value.psint16;
+	case SInt32:
+		return m_cleanValue.s32 != *m_value.psint32;
+	case SInt64:
+		return m_cleanValue.s64 != *m_value.psint64;
+	case Custom:
+		return false;
+	}
+
+	return false;
+}
+
+
+string StateVariable::CleanValueToString() const
+{
+	// Format a copy of the clean value using a temporary variable
+	// referring to it, so that the output matches ToString():
+	string cleanString = m_cleanString;
+	StateVariable tmp;
+	tmp.m_type = m_type;
+	tmp.m_cleanValue = m_cleanValue;
+
+	switch (m_type) {
+	case String:
+		tmp.m_value.pstr = &cleanString;
+		break;
+	case Bool:
+		tmp.m_value.pbool = &tmp.m_cleanValue.b;
+		break;
+	case Double:
+		tmp.m_value.pdouble = &tmp.m_cleanValue.d;
+		break;
+	case UInt8:
+		tmp.m_value.puint8 = &tmp.m_cleanValue.u8;
+		break;
+	case UInt16:
+		tmp.m_value.puint16 = &tmp.m_cleanValue.u16;
+		break;
+	case UInt32:
+		tmp.m_value.puint32 = &tmp.m_cleanValue.u32;
+		break;
+	case UInt64:
+		tmp.m_value.puint64 = &tmp.m_cleanValue.u64;
+		break;
+	case SInt8:
+		tmp.m_value.psint8 = &tmp.m_cleanValue.s8;
+		break;
+	case SInt16:
+		tmp.m_value.psint16 = &tmp.m_cleanValue.s16;
+		break;
+	case SInt32:
+		tmp.m_value.psint32 = &tmp.m_cleanValue.s32;
+		break;
+	case SInt64:
+		tmp.m_value.psint64 = &tmp.m_cleanValue.s64;
+		break;
+	case Custom:
+		return ToString();
+	}
+
+	return tmp.ToString();
+}
+
+
+void* StateVariable::GetValuePointer(enum Type type) const
+{
+	if (type != m_type)
+		return NULL;
+
+	switch (m_type) {
+	case String:
+		return m_value.pstr;
+	case Bool:
+		return m_value.pbool;
+	case Double:
+		return m_value.pdouble;
+	case UInt8:
+		return m_value.puint8;
+	case UInt16:
+		return m_value.puint16;
+	case UInt32:
+		return m_value.puint32;
+	case UInt64:
+		return m_value.puint64;
+	case SInt8:
+		return m_value.psint8;
+	case SInt16:
+		return m_value.psint16;
+	case SInt32:
+		return m_value.psint32;
+	case SInt64:
+		return m_value.psint64;
+	case Custom:
+		break;
+	}
+
+	return NULL;
+}
+
+
 uint64_t StateVariable::ToInteger() const
 {
 	switch (m_type) {
@@ -447,6 +629,213 @@ void StateVariable::Serialize(ostream& ss, SerializationContext& context) const
 }
 
 
+void StateVariable::SerializeBinary(ostream& os) const
+{
+	BinarySerialization::WriteString(os, m_name);
+	BinarySerialization::WriteUInt8(os, m_type);
+
+	switch (m_type) {
+
+	case String:
+		BinarySerialization::WriteString(os, *m_value.pstr);
+		break;
+
+	case Bool:
+		BinarySerialization::WriteUInt8(os, *m_value.pbool? 1 : 0);
+		break;
+
+	case Double:
+		{
+			uint64_t bits;
+			memcpy(&bits, m_value.pdouble, sizeof(bits));
+			BinarySerialization::WriteUInt64(os, bits);
+		}
+		break;
+
+	case UInt8:
+		BinarySerialization::WriteUInt8(os, *m_value.puint8);
+		break;
+
+	case UInt16:
+		BinarySerialization::WriteUInt32(os, *m_value.puint16);
+		break;
+
+	case UInt32:
+		BinarySerialization::WriteUInt32(os, *m_value.puint32);
+		break;
+
+	case UInt64:
+		BinarySerialization::WriteUInt64(os, *m_value.puint64);
+		break;
+
+	case SInt8:
+		BinarySerialization::WriteUInt8(os, *m_value.psint8);
+		break;
+
+	case SInt16:
+		BinarySerialization::WriteUInt32(os, *m_value.psint16);
+		break;
+
+	case SInt32:
+		BinarySerialization::WriteUInt32(os, *m_value.psint32);
+		break;
+
+	case SInt64:
+		BinarySerialization::WriteUInt64(os, *m_value.psint64);
+		break;
+
+	case Custom:
+		{
+			// Custom values are length-prefixed, so that values
+			// which can not be deserialized can still be skipped.
+			// The value may be large (e.g. all of RAM), so the
+			// length is patched in afterwards, instead of
+			// buffering the value, whenever the stream is seekable.
+			std::streampos lengthPos = os.tellp();
+			if (lengthPos == std::streampos(-1)) {
+				stringstream value;
+				m_value.phandler->SerializeBinary(value);
+				const string& str = value.str();
+				BinarySerialization::WriteUInt64(os, str.length());
+				os.write(str.data(), str.length());
+				break;
+			}
+
+			BinarySerialization::WriteUInt64(os, 0);
+			m_value.phandler->SerializeBinary(os);
+
+			std::streampos endPos = os.tellp();
+			os.seekp(lengthPos);
+			BinarySerialization::WriteUInt64(os,
+			    endPos - lengthPos - sizeof(uint64_t));
+			os.seekp(endPos);
+		}
+		break;
+	}
+}
+
+
+bool StateVariable::DeserializeBinaryValue(std::istream& is)
+{
+	uint8_t value8;
+	uint32_t value32;
+	uint64_t value64;
+
+	switch (m_type) {
+
+	case String:
+		return BinarySerialization::ReadString(is, *m_value.pstr);
+
+	case Bool:
+		if (!BinarySerialization::ReadUInt8(is, value8))
+			return false;
+		*m_value.pbool = value8 != 0;
+		return true;
+
+	case Double:
+		if (!BinarySerialization::ReadUInt64(is, value64))
+			return false;
+		memcpy(m_value.pdouble, &value64, sizeof(value64));
+		return true;
+
+	case UInt8:
+		return BinarySerialization::ReadUInt8(is, *m_value.puint8);
+
+	case UInt16:
+		if (!BinarySerialization::ReadUInt32(is, value32))
+			return false;
+		*m_value.puint16 = value32;
+		return true;
+
+	case UInt32:
+		return BinarySerialization::ReadUInt32(is, *m_value.puint32);
+
+	case UInt64:
+		return BinarySerialization::ReadUInt64(is, *m_value.puint64);
+
+	case SInt8:
+		if (!BinarySerialization::ReadUInt8(is, value8))
+			return false;
+		*m_value.psint8 = value8;
+		return true;
+
+	case SInt16:
+		if (!BinarySerialization::ReadUInt32(is, value32))
+			return false;
+		*m_value.psint16 = value32;
+		return true;
+
+	case SInt32:
+		if (!BinarySerialization::ReadUInt32(is, value32))
+			return false;
+		*m_value.psint32 = value32;
+		return true;
+
+	case SInt64:
+		if (!BinarySerialization::ReadUInt64(is, value64))
+			return false;
+		*m_value.psint64 = value64;
+		return true;
+
+	case Custom:
+		{
+			if (!BinarySerialization::ReadUInt64(is, value64))
+				return false;
+
+			// The handler reads the value directly from the
+			// stream, but may not read past its end, and must
+			// consume all of it.
+			BoundedInputBuffer buf(is, value64);
+			std::istream value(&buf);
+			bool ok = m_value.phandler->DeserializeBinary(value) &&
+			    buf.AtEnd();
+
+			return buf.SkipRest() && ok;
+		}
+	}
+
+	return false;
+}
+
+
+bool StateVariable::SkipBinaryValue(std::istream& is, enum Type type)
+{
+	uint8_t value8;
+	uint32_t value32;
+	uint64_t value64;
+	string str;
+
+	switch (type) {
+
+	case String:
+		return BinarySerialization::ReadString(is, str);
+
+	case Bool:
+	case UInt8:
+	case SInt8:
+		return BinarySerialization::ReadUInt8(is, value8);
+
+	case UInt16:
+	case UInt32:
+	case SInt16:
+	case SInt32:
+		return BinarySerialization::ReadUInt32(is, value32);
+
+	case Double:
+	case UInt64:
+	case SInt64:
+		return BinarySerialization::ReadUInt64(is, value64);
+
+	case Custom:
+		return BinarySerialization::ReadUInt64(is, value64) &&
+		    BinarySerialization::SkipBytes(is, value64);
+
+	default:
+		return false;
+	}
+}
+
+
 string StateVariable::EvaluateExpression(const string& expression,
 	bool& success) const
 {
@@ -997,6 +1386,205 @@ static void Test_StateVariable_Numeric_SetValue()
 	// Tests for other numeric types: TODO
 }
 
+static void Test_StateVariable_SerializeBinary()
+{
+	string myString = "a \"quoted\" string";
+	int16_t mySInt16 = -400;
+	double myDouble = 3.25;
+
+	StateVariable varString("s", &myString);
+	StateVariable varSInt16("i", &mySInt16);
+	StateVariable varDouble("d", &myDouble);
+
+	stringstream ss;
+	varString.SerializeBinary(ss);
+	varSInt16.SerializeBinary(ss);
+	varDouble.SerializeBinary(ss);
+
+	myString = "";
+	mySInt16 = 0;
+	myDouble = 0.0;
+
+	string name;
+	uint8_t type = 0;
+	UnitTest::Assert("string name", BinarySerialization::ReadString(ss, name)
+	    && name == "s");
+	UnitTest::Assert("string type", BinarySerialization::ReadUInt8(ss, type)
+	    && type == StateVariable::String);
+	UnitTest::Assert("string value", varString.DeserializeBinaryValue(ss));
+	UnitTest::Assert("string should have been restored",
+	    myString, "a \"quoted\" string");
+
+	// The int16 is skipped, the double is read.
+	UnitTest::Assert("int16 name", BinarySerialization::ReadString(ss, name)
+	    && name == "i");
+	UnitTest::Assert("int16 type", BinarySerialization::ReadUInt8(ss, type)
+	    && type == StateVariable::SInt16);
+	UnitTest::Assert("skipping int16 should work",
+	    StateVariable::SkipBinaryValue(ss, (StateVariable::Type) type));
+	UnitTest::Assert("double name", BinarySerialization::ReadString(ss, name)
+	    && name == "d");
+	UnitTest::Assert("double type", BinarySerialization::ReadUInt8(ss, type)
+	    && type == StateVariable::Double);
+	UnitTest::Assert("double value", varDouble.DeserializeBinaryValue(ss));
+	UnitTest::Assert("double should have been restored",
+	    myDouble == 3.25);
+	UnitTest::Assert("int16 should not have been touched", mySInt16, 0);
+
+	UnitTest::Assert("reading past the end should fail",
+	    !varDouble.DeserializeBinaryValue(ss));
+}
+
+class TestCustomHandler : public CustomStateVariableHandler
+{
+public:
+	TestCustomHandler(const string& value)
+		: m_value(value)
+	{
+	}
+
+	virtual void Serialize(ostream& ss) const
+	{
+		ss << m_value;
+	}
+
+	virtual bool Deserialize(const string& value)
+	{
+		// Only values starting with "ok" are accepted.
+		if (value.substr(0, 2) != "ok")
+			return false;
+
+		m_value = value;
+		return true;
+	}
+
+	virtual void CopyValueFrom(CustomStateVariableHandler* other)
+	{
+		m_value = ((TestCustomHandler*)other)->m_value;
+	}
+
+	string m_value;
+};
+
+static void Test_StateVariable_SerializeBinary_Custom()
+{
+	TestCustomHandler handler("stale value");
+	uint32_t myUInt32 = 0x1234;
+
+	StateVariable varCustom("c", &handler);
+	StateVariable varUInt32("u", &myUInt32);
+
+	stringstream ss;
+	varCustom.SerializeBinary(ss);
+	varCustom.SerializeBinary(ss);
+	varUInt32.SerializeBinary(ss);
+
+	string name;
+	uint8_t type = 0;
+	UnitTest::Assert("custom type", BinarySerialization::ReadString(ss, name)
+	    && BinarySerialization::ReadUInt8(ss, type)
+	    && type == StateVariable::Custom);
+	UnitTest::Assert("stale custom value should be rejected",
+	    !varCustom.DeserializeBinaryValue(ss));
+	UnitTest::Assert("rejected value should be consumed", ss.good());
+
+	UnitTest::Assert("custom type 2", BinarySerialization::ReadString(ss, name)
+	    && BinarySerialization::ReadUInt8(ss, type)
+	    && type == StateVariable::Custom);
+	UnitTest::Assert("skipping custom value should work",
+	    StateVariable::SkipBinaryValue(ss, (StateVariable::Type) type));
+
+	myUInt32 = 0;
+	UnitTest::Assert("uint32 type", BinarySerialization::ReadString(ss, name)
+	    && BinarySerialization::ReadUInt8(ss, type)
+	    && type == StateVariable::UInt32);
+	UnitTest::Assert("uint32 value", varUInt32.DeserializeBinaryValue(ss));
+	UnitTest::Assert("uint32 after custom values", myUInt32, 0x1234);
+
+	handler.m_value = "ok value";
+	stringstream ss2;
+	varCustom.SerializeBinary(ss2);
+	handler.m_value = "";
+	UnitTest::Assert("custom name and type",
+	    BinarySerialization::ReadString(ss2, name) &&
+	    BinarySerialization::ReadUInt8(ss2, type));
+	UnitTest::Assert("valid custom value", varCustom.DeserializeBinaryValue(ss2));
+	UnitTest::Assert("custom value should have been restored",
+	    handler.m_value, "ok value");
+}
+
+static void Test_StateVariable_SerializeBinary_LongString()
+{
+	stringstream ss;
+	BinarySerialization::WriteUInt32(ss, 0xfffffff0);
+	ss << "not nearly that long";
+
+	string str;
+	UnitTest::Assert("too long strings should be rejected",
+	    !BinarySerialization::ReadString(ss, str));
+}
+
+static void Test_StateVariable_MarkClean()
+{
+	string myString = "hello";
+	uint32_t myUInt32 = 0x1234;
+	StateVariable varString("s", &myString);
+	StateVariable varUInt32("u", &myUInt32);
+
+	UnitTest::Assert("should not be dirty before MarkClean",
+	    !varUInt32.IsDirty());
+
+	myUInt32 = 0x5678;
+	UnitTest::Assert("should still not be dirty", !varUInt32.IsDirty());
+
+	varString.MarkClean();
+	varUInt32.MarkClean();
+	UnitTest::Assert("should not be dirty after MarkClean",
+	    !varUInt32.IsDirty() && !varString.IsDirty());
+
+	myUInt32 = 0x9abc;
+	myString = "world";
+	UnitTest::Assert("uint32 should be dirty", varUInt32.IsDirty());
+	UnitTest::Assert("string should be dirty", varString.IsDirty());
+	UnitTest::Assert("clean uint32 value",
+	    varUInt32.CleanValueToString(), "0x5678");
+	UnitTest::Assert("clean string value",
+	    varString.CleanValueToString(), "hello");
+
+	myUInt32 = 0x5678;
+	UnitTest::Assert("writing back the clean value should not be dirty",
+	    !varUInt32.IsDirty());
+}
+
+static void Test_StateVariable_Ref()
+{
+	uint64_t myUInt64 = 42;
+	uint32_t myUInt32 = 43;
+	StateVariable varUInt64("u64", &myUInt64);
+	StateVariable varUInt32("u32", &myUInt32);
+
+	StateVariableRef<uint64_t> ref(&varUInt64);
+	UnitTest::Assert("ref should be valid", ref.IsValid());
+	UnitTest::Assert("value mismatch", ref.Get(), 42);
+
+	ref.Set(0x123456789abcULL);
+	UnitTest::Assert("underlying variable should have been set",
+	    myUInt64 == 0x123456789abcULL);
+	UnitTest::Assert("variable should see the new value",
+	    varUInt64.ToInteger() == 0x123456789abcULL);
+
+	myUInt64 = 7;
+	UnitTest::Assert("ref should see the new value", ref.Get(), 7);
+
+	StateVariableRef<uint64_t> wrongType(&varUInt32);
+	UnitTest::Assert("ref of wrong type should not be valid",
+	    !wrongType.IsValid());
+
+	StateVariableRef<uint64_t> noVariable(NULL);
+	UnitTest::Assert("ref to NULL should not be valid",
+	    !noVariable.IsValid());
+}
+
 UNITTESTS(StateVariable)
 {
 	// String tests
@@ -1018,6 +1606,17 @@ UNITTESTS(StateVariable)
 	//UNITTEST(Test_StateVariable_Numeric_CopyValueFrom);
 	//UNITTEST(Test_StateVariable_Numeric_Serialize);
 
+	// Binary serialization
+	UNITTEST(Test_StateVariable_SerializeBinary);
+	UNITTEST(Test_StateVariable_SerializeBinary_Custom);
+	UNITTEST(Test_StateVariable_SerializeBinary_LongString);
+
+	// Change tracking
+	UNITTEST(Test_StateVariable_MarkClean);
+
+	// Typed references
+	UNITTEST(Test_StateVariable_Ref);
+
 	// TODO: ToInteger tests.
 
 	// TODO: Custom tests.
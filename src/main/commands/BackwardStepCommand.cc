@@ -265,12 +265,62 @@ static void Test_BackwardStepCommand_ManualAddAndLoad()
 	UnitTest::Assert("X: cpu0.v1", cpu->GetVariable("v1")->ToString(), "0");
 }
 
+static void Test_BackwardStepCommand_PeriodicSnapshots()
+{
+	refcount_ptr<Command> cmd = new BackwardStepCommand;
+	vector<string> dummyArguments;
+	
+	GXemul gxemul;
+
+	char filename[] = "test/FileLoader_ELF_MIPS";
+	char *filenames[] = { filename };
+	gxemul.ParseFilenames("testmips", 1, filenames);
+	gxemul.Reset();
+
+	gxemul.SetSnapshottingEnabled(true);
+	gxemul.SetSnapshotInterval(2);
+
+	gxemul.GetCommandInterpreter().RunCommand("step 3");
+	gxemul.Execute();
+
+	UnitTest::Assert("root.step should initially be 3", gxemul.GetStep(), 3);
+	UnitTest::Assert("snapshots at step 0 and 2", gxemul.GetNrOfSnapshots(), 2);
+
+	// Going back to step 2 restores the snapshot at step 2.
+	cmd->Execute(gxemul, dummyArguments);
+	UnitTest::Assert("root.step should be 2", gxemul.GetStep(), 2);
+	UnitTest::Assert("both snapshots should be kept", gxemul.GetNrOfSnapshots(), 2);
+	refcount_ptr<Component> cpu = gxemul.GetRootComponent()->LookupPath("cpu0");
+	UnitTest::Assert("2: cpu0.pc", cpu->GetVariable("pc")->ToString(), "0xffffffff80010100");
+	UnitTest::Assert("2: cpu0.v0", cpu->GetVariable("v0")->ToString(), "0");
+	UnitTest::Assert("2: cpu0.v1", cpu->GetVariable("v1")->ToString(), "0xffffffffcccc0000");
+
+	// Going back to step 1 runs from the snapshot at step 0, and
+	// discards the one at step 2.
+	cmd->Execute(gxemul, dummyArguments);
+	UnitTest::Assert("root.step should be 1", gxemul.GetStep(), 1);
+	UnitTest::Assert("only the step 0 snapshot should be kept", gxemul.GetNrOfSnapshots(), 1);
+	cpu = gxemul.GetRootComponent()->LookupPath("cpu0");
+	UnitTest::Assert("1: cpu0.pc", cpu->GetVariable("pc")->ToString(), "0xffffffff800100fc");
+	UnitTest::Assert("1: cpu0.v1", cpu->GetVariable("v1")->ToString(), "0");
+
+	// Running forward again re-creates the snapshot at step 2.
+	gxemul.GetCommandInterpreter().RunCommand("step 2");
+	gxemul.Execute();
+	UnitTest::Assert("root.step should be 3", gxemul.GetStep(), 3);
+	UnitTest::Assert("snapshot at step 2 again", gxemul.GetNrOfSnapshots(), 2);
+	cpu = gxemul.GetRootComponent()->LookupPath("cpu0");
+	UnitTest::Assert("3: cpu0.pc", cpu->GetVariable("pc")->ToString(), "0xffffffff80010104");
+	UnitTest::Assert("3: cpu0.v0", cpu->GetVariable("v0")->ToString(), "0xffffffff88880000");
+}
+
 UNITTESTS(BackwardStepCommand)
 {
 	UNITTEST(Test_BackwardStepCommand_AlreadyAtStep0);
 	UNITTEST(Test_BackwardStepCommand_NotWhenSnapshotsAreDisabled);
 	UNITTEST(Test_BackwardStepCommand_Basic);
 	UNITTEST(Test_BackwardStepCommand_ManualAddAndLoad);
+	UNITTEST(Test_BackwardStepCommand_PeriodicSnapshots);
 }
 
 #endif
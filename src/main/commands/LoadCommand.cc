@@ -62,8 +62,10 @@ bool LoadCommand::IsComponentTree(GXemul& gxemul, const string& filename) const
 	if (file.gcount() < 10)
 		return false;
 
-	// Saved component trees start with the string "component ".
-	return (strncmp(buf, "component ", 10) == 0);
+	// Saved component trees start with the string "component ", or
+	// with the binary serialization header.
+	return (strncmp(buf, "component ", 10) == 0) ||
+	    BinarySerialization::HasMagic(buf, file.gcount());
 }
 
 
@@ -79,39 +81,51 @@ bool LoadCommand::LoadComponentTree(GXemul& gxemul, const string&filename,
 	refcount_ptr<Component> component;
 
 	// Load from the file
-	std::ifstream file(filename.c_str());
+	std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
 	if (file.fail()) {
 		ShowMsg(gxemul, "Unable to open " + filename + " for reading.\n");
 		return false;
 	}
 
-	// Figure out the file's size:
-	file.seekg(0, std::ios::end);
-	std::streampos fileSize = file.tellg();
+	char magic[BinarySerialization::MagicLength];
+	file.read(magic, sizeof(magic));
+	bool isBinary = BinarySerialization::HasMagic(magic, file.gcount());
+	file.clear();
 	file.seekg(0, std::ios::beg);
 
-	// Read the entire file into a string.
-	// TODO: This is wasteful, of course. It actually takes twice the
-	// size of the file, since the string constructor generates a _copy_.
-	// But string takes care of unicode and such (if compiled as ustring).
-	vector<char> buf;
-	buf.resize((size_t)fileSize + 1);
+	stringstream messages;
 
-	memset(&buf[0], 0, fileSize);
-	file.read(&buf[0], fileSize);
-	if (file.gcount() != fileSize) {
-		ShowMsg(gxemul, "Loading from " + filename + " failed; "
-		    "could not read all of the file?\n");
-		return false;
-	}
+	if (isBinary) {
+		// The binary format is streamed directly from the file.
+		component = Component::DeserializeBinary(messages, file);
+	} else {
+		// Figure out the file's size:
+		file.seekg(0, std::ios::end);
+		std::streampos fileSize = file.tellg();
+		file.seekg(0, std::ios::beg);
+
+		// Read the entire file into a string.
+		// TODO: This is wasteful, of course. It actually takes twice the
+		// size of the file, since the string constructor generates a _copy_.
+		// But string takes care of unicode and such (if compiled as ustring).
+		vector<char> buf;
+		buf.resize((size_t)fileSize + 1);
+
+		memset(&buf[0], 0, fileSize);
+		file.read(&buf[0], fileSize);
+		if (file.gcount() != fileSize) {
+			ShowMsg(gxemul, "Loading from " + filename + " failed; "
+			    "could not read all of the file?\n");
+			return false;
+		}
 
-	string str(&buf[0], fileSize);
+		string str(&buf[0], fileSize);
 
-	file.close();
+		size_t strPos = 0;
+		component = Component::Deserialize(messages, str, strPos);
+	}
 
-	size_t strPos = 0;
-	stringstream messages;
-	component = Component::Deserialize(messages, str, strPos);
+	file.close();
 
 	if (messages.str().length() > 0)
 		ShowMsg(gxemul, messages.str());
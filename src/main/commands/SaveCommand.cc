@@ -98,15 +98,21 @@ bool SaveCommand::Execute(GXemul& gxemul, const vector<string>& arguments)
 	// Write to the file:
 	{
 		std::fstream outputstream(filename.c_str(),
-		    std::ios::out | std::ios::trunc);
+		    std::ios::out | std::ios::trunc | std::ios::binary);
 		if (outputstream.fail()) {
 			ShowMsg(gxemul, "Error: Could not open " + filename +
 			    " for writing.\n");
 			return false;
 		}
 
-		SerializationContext context;
-		component->Serialize(outputstream, context);
+		component->SerializeBinary(outputstream);
+
+		outputstream.flush();
+		if (outputstream.fail()) {
+			ShowMsg(gxemul, "Error: Could not write to " +
+			    filename + ".\n");
+			return false;
+		}
 	}
 
 	// Check that the file exists:
@@ -141,6 +147,10 @@ string SaveCommand::GetLongDescription() const
 	    "command. If the component path is omitted, the entire emulation setup, starting\n"
 	    "from the 'root' component, is saved.\n"
 	    "\n"
+	    "The emulation is saved in a compact binary format, where RAM contents are\n"
+	    "stored as (possibly compressed) pages, and pages containing only zeroes are\n"
+	    "omitted. The load command accepts both this format and the older text format.\n"
+	    "\n"
 	    "The filename extension should usually be .gxemul.\n"
 	    "\n"
 	    "See also:  load    (to load an emulation setup)\n";
@@ -34,6 +34,7 @@
 #include <limits.h>
 #include <stdarg.h>
 #include <string.h>
+#include <sys/time.h>
 #include <unistd.h>
 
 #include "arcbios.h"
@@ -123,6 +124,8 @@ static void add_breakpoints(struct machine *m)
 			debug(" (%s)", m->breakpoints.string[i]);
 		debug("\n");
 	}
+
+	machine_breakpoints_rehash(m);
 }
 
 
@@ -463,7 +466,9 @@ void emul_machine_setup(struct machine *m, int n_load, char **load_names,
 	}
 
 	while (n_load > 0) {
+#ifndef WITH_ZLIB
 		FILE *tmp_f;
+#endif
 		char *name_to_load = *load_names;
 		int remove_after_load = 0;
 
@@ -473,8 +478,10 @@ void emul_machine_setup(struct machine *m, int n_load, char **load_names,
 			remove_after_load = 1;
 		}
 
+#ifndef WITH_ZLIB
 		/*
-		 *  gzipped files are automagically gunzipped:
+		 *  gzipped files are automagically gunzipped. (With zlib,
+		 *  file_load() decompresses them in memory instead.)
 		 *  NOTE/TODO: This isn't secure. system() is used.
 		 */
 		tmp_f = fopen(name_to_load, "r");
@@ -535,6 +542,7 @@ void emul_machine_setup(struct machine *m, int n_load, char **load_names,
 			}
 			fclose(tmp_f);
 		}
+#endif
 
 		byte_order = NO_BYTE_ORDER_OVERRIDE;
 
@@ -772,6 +780,7 @@ struct emul *emul_create_from_configfile(char *fname)
 void emul_run(struct emul *emul)
 {
 	int i = 0, j, go = 1, n, anything;
+	int64_t timer_ninstrs;
 
 	atexit(fix_console);
 
@@ -835,8 +844,14 @@ void emul_run(struct emul *emul)
 		cpu_functioncall_trace(emul->machines[0]->cpus[0],
 		    emul->machines[0]->cpus[0]->pc);
 
+	/*  Deterministic timing: use the machine's clock rate, if known.  */
+	if (timer_is_deterministic() && emul->machines[0]->emulated_hz > 0)
+		timer_set_deterministic(emul->machines[0]->emulated_hz);
+
 	/*  Start emulated clocks:  */
 	timer_start();
+	timer_ninstrs = emul->machines[0]->cpus[
+	    emul->machines[0]->bootstrap_cpu]->ninstrs;
 
 
 	/*
@@ -851,10 +866,13 @@ void emul_run(struct emul *emul)
 
 		go = 0;
 
-		/*  Flush X11 and serial console output every now and then:  */
+		/*  Flush X11 and serial console output, and check for
+		    console input, every now and then:  */
 		if (bootcpu->ninstrs > bootcpu->ninstrs_flush + (1<<19)) {
 			x11_check_event(emul);
 			console_flush();
+			console_poll();
+			memory_sharing_tick();
 			bootcpu->ninstrs_flush = bootcpu->ninstrs;
 		}
 
@@ -886,6 +904,52 @@ void emul_run(struct emul *emul)
 			if (anything)
 				go = 1;
 		}
+
+		/*  Advance emulated clocks, if they are not host driven:  */
+		if (timer_is_deterministic()) {
+			timer_advance_instructions(bootcpu->ninstrs -
+			    timer_ninstrs);
+			timer_ninstrs = bootcpu->ninstrs;
+		} else if (go && single_step == NOT_SINGLE_STEPPING) {
+			/*
+			 *  All cpus in all machines idle? Then let the host
+			 *  sleep until the next timer deadline, or until
+			 *  there is console input. The slept time is then
+			 *  credited to the cpus as executed instructions.
+			 *  (In deterministic mode, idle cpus just skip ahead
+			 *  instead.)
+			 */
+			for (j=0; j<emul->n_machines; j++)
+				if (!machine_is_idle(emul->machines[j]))
+					break;
+
+			if (j == emul->n_machines) {
+				struct timeval tv0, tv1;
+				double t = 1.0, slept;
+
+				/*  Don't sleep past instruction driven events:  */
+				for (j=0; j<emul->n_machines; j++) {
+					double tm = machine_time_to_next_tick(
+					    emul->machines[j]);
+					if (tm < t)
+						t = tm;
+				}
+
+				x11_check_event(emul);
+				console_flush();
+
+				gettimeofday(&tv0, NULL);
+				console_poll_wait((int) (1000.0 *
+				    timer_time_to_next_tick(t)) + 1);
+				gettimeofday(&tv1, NULL);
+
+				slept = (tv1.tv_sec - tv0.tv_sec) +
+				    (tv1.tv_usec - tv0.tv_usec) / 1000000.0;
+				for (j=0; j<emul->n_machines; j++)
+					machine_idle_slept(emul->machines[j],
+					    slept);
+			}
+		}
 	}
 
 	/*  Stop any running timers:  */
@@ -895,6 +959,9 @@ void emul_run(struct emul *emul)
 	for (j=0; j<emul->n_machines; j++)
 		cpu_run_deinit(emul->machines[j]);
 
+	/*  Final page sharing scan and statistics (if -m was used):  */
+	memory_sharing_scan(1);
+
 	/*  force_debugger_at_exit flag set? Then enter the debugger:  */
 	if (force_debugger_at_exit) {
 		quiet_mode = 0;
@@ -912,6 +979,7 @@ void emul_run(struct emul *emul)
 		printf("Press enter to quit.\n");
 		while (!console_charavail(MAIN_CONSOLE)) {
 			x11_check_event(emul);
+			console_poll();
 			usleep(10000);
 		}
 		console_readchar(MAIN_CONSOLE);
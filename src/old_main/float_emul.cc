@@ -53,6 +53,30 @@ void ieee_interpret_float_value(uint64_t x, struct ieee_float_value *fvp,
 	int i, nan, sign = 0, exponent;
 	double fraction;
 
+	/*
+	 *  Fast path: Normal numbers and zeroes are already in the host's
+	 *  native IEEE 754 format, so the bit pattern can be used as is.
+	 *  Denormals, infinities and NaNs take the slow path below.
+	 */
+	if (fmt == IEEE_FMT_S) {
+		uint32_t x32 = x;
+		int e = (x32 >> 23) & 0xff;
+		if (e != 0xff && (e != 0 || (x32 & 0x7fffff) == 0)) {
+			float f;
+			memcpy(&f, &x32, sizeof(f));
+			fvp->f = f;
+			fvp->nan = 0;
+			return;
+		}
+	} else if (fmt == IEEE_FMT_D) {
+		int e = (x >> 52) & 0x7ff;
+		if (e != 0x7ff && (e != 0 || (x & 0xfffffffffffffULL) == 0)) {
+			memcpy(&fvp->f, &x, sizeof(fvp->f));
+			fvp->nan = 0;
+			return;
+		}
+	}
+
 	memset(fvp, 0, sizeof(struct ieee_float_value));
 
 	/*  n_frac and n_exp:  */
@@ -203,6 +227,30 @@ uint64_t ieee_store_float_value(double nf, int fmt, int nan)
 	if ((fmt == IEEE_FMT_S || fmt == IEEE_FMT_D) && nan)
 		goto store_nan;
 
+	/*
+	 *  Fast path: If the result is zero, or a normal number in the target
+	 *  format, then the native bit pattern can be used. For single
+	 *  precision, the fraction is truncated, just like the slow path below
+	 *  does it.
+	 */
+	if (fmt == IEEE_FMT_S || fmt == IEEE_FMT_D) {
+		uint64_t x;
+
+		if (nf == 0.0)
+			return 0;
+
+		memcpy(&x, &nf, sizeof(x));
+		exponent = (int)((x >> 52) & 0x7ff) - 1023;
+
+		if (fmt == IEEE_FMT_D && exponent >= -1022 && exponent <= 1023)
+			return x;
+
+		if (fmt == IEEE_FMT_S && exponent >= -126 && exponent <= 127)
+			return ((x >> 32) & 0x80000000ULL) |
+			    ((uint64_t)(exponent + 127) << 23) |
+			    ((x >> 29) & 0x7fffff);
+	}
+
 	/*  fraction:  */
 	switch (fmt) {
 	case IEEE_FMT_W:
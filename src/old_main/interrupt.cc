@@ -279,3 +279,109 @@ void interrupt_disconnect(struct interrupt *in, int exclusive)
 }
 
 
+
+
+/*
+ *  interrupt_mask_init():
+ *
+ *  Initializes a generic bitmask interrupt controller, and connects it to
+ *  its parent interrupt. All lines start out deasserted, and enabled.
+ *
+ *  If the parent is itself a line of a bitmask interrupt controller, then
+ *  the cascade is collapsed: level changes are propagated by setting or
+ *  clearing the parent's status bit directly.
+ */
+void interrupt_mask_init(struct interrupt_mask *m, const char *parent_path)
+{
+	memset(m, 0, sizeof(struct interrupt_mask));
+	m->enabled = 0xffffffff;
+
+	INTERRUPT_CONNECT(parent_path, m->parent);
+
+	if (m->parent.interrupt_assert == interrupt_mask_assert) {
+		m->parent_mask = (struct interrupt_mask *) m->parent.extra;
+		m->parent_bit = m->parent.line;
+	}
+}
+
+
+/*
+ *  interrupt_mask_register_line():
+ *
+ *  Registers an interrupt line of a bitmask interrupt controller. bit is
+ *  the mask (not the bit number) in the controller's status word.
+ */
+void interrupt_mask_register_line(struct interrupt_mask *m, const char *name,
+	uint32_t bit)
+{
+	struct interrupt templ;
+
+	memset(&templ, 0, sizeof(templ));
+	templ.line = bit;
+	templ.name = (char *) name;
+	templ.extra = m;
+	templ.interrupt_assert = interrupt_mask_assert;
+	templ.interrupt_deassert = interrupt_mask_deassert;
+	interrupt_handler_register(&templ);
+}
+
+
+/*
+ *  interrupt_mask_update():
+ *
+ *  Recalculates the output level of a bitmask interrupt controller, and
+ *  propagates any change up through the collapsed cascade.
+ */
+void interrupt_mask_update(struct interrupt_mask *m)
+{
+	for (;;) {
+		int level = (m->status & m->enabled)? 1 : 0;
+
+		if (level == m->asserted)
+			return;
+
+		m->asserted = level;
+
+		if (m->parent_mask == NULL) {
+			if (level)
+				INTERRUPT_ASSERT(m->parent);
+			else
+				INTERRUPT_DEASSERT(m->parent);
+			return;
+		}
+
+		if (level)
+			m->parent_mask->status |= m->parent_bit;
+		else
+			m->parent_mask->status &= ~m->parent_bit;
+
+		m = m->parent_mask;
+	}
+}
+
+
+/*
+ *  interrupt_mask_assert(), interrupt_mask_deassert():
+ *
+ *  Assert or deassert a line of a bitmask interrupt controller.
+ */
+void interrupt_mask_assert(struct interrupt *interrupt)
+{
+	struct interrupt_mask *m = (struct interrupt_mask *) interrupt->extra;
+
+	m->status |= interrupt->line;
+	if (m->asserted || !(interrupt->line & m->enabled))
+		return;
+
+	interrupt_mask_update(m);
+}
+void interrupt_mask_deassert(struct interrupt *interrupt)
+{
+	struct interrupt_mask *m = (struct interrupt_mask *) interrupt->extra;
+
+	m->status &= ~interrupt->line;
+	if (!m->asserted || (m->status & m->enabled))
+		return;
+
+	interrupt_mask_update(m);
+}
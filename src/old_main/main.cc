@@ -43,6 +43,7 @@
 #include "emul.h"
 #include "GXemul.h"
 #include "machine.h"
+#include "memory.h"
 #include "misc.h"
 #include "settings.h"
 #include "timer.h"
@@ -285,6 +286,10 @@ static void usage(int longusage)
 	printf("            For other emulation modes, if the boot disk is an"
 	    " ISO9660\n            filesystem, -j sets the name of the"
 	    " kernel to load.\n");
+	printf("  -L spec   make emulated serial ports available as sockets "
+	    "instead of xterms;\n            spec is a TCP port number "
+	    "(the first of several consecutive\n            ports on "
+	    "127.0.0.1), or a path prefix for UNIX domain sockets\n");
 	printf("  -M m      emulate m MBs of physical RAM\n");
 	printf("  -N        display nr of instructions/second average, at"
 	    " regular intervals\n");
@@ -295,6 +300,14 @@ static void usage(int longusage)
 	printf("  -o arg    set the boot argument, for DEC, ARC, or SGI"
 	    " emulation\n");
 	printf("            (default arg for DEC is -a, for ARC/SGI -aN)\n");
+	printf("  -P f:name write a sampling profile to file 'name' (and "
+	    "'name.folded') at\n            exit, f is optional and may "
+	    "contain:\n");
+	printf("                c    also record return addresses, for "
+	    "the folded output\n");
+	printf("                d    disable profiling at startup\n");
+	printf("                N    (a number) sample every N:th "
+	    "instruction (default %i)\n", PROFILE_DEFAULT_INTERVAL);
 	printf("  -p pc     add a breakpoint (remember to use the '0x' "
 	    "prefix for hex!)\n");
 	printf("  -Q        no built-in PROM emulation  (use this for "
@@ -310,9 +323,15 @@ static void usage(int longusage)
 	printf("                i    internal ic->f representation of "
 	    "the program counter\n");
 	printf("            and optionally:\n");
+	printf("                a    aggregate counts in memory, and write "
+	    "a CSV summary at exit\n");
+	printf("                b    write binary records instead of "
+	    "text lines\n");
 	printf("                d    disable statistics gathering at "
 	    "startup\n");
 	printf("                o    overwrite instead of append\n");
+	printf("                N    (a number) only sample every N:th "
+	    "instruction\n");
 	printf("  -T        halt on non-existant memory accesses\n");
 	printf("  -t        show function trace tree\n");
 	printf("  -U        enable slow_serial_interrupts_hack_for_linux\n");
@@ -333,6 +352,10 @@ static void usage(int longusage)
 	printf("  -c cmd    add cmd as a command to run before starting "
 	    "the simulation\n");
 	printf("  -D        skip the srandom call at startup\n");
+	printf("  -G        deterministic timing: emulated clocks advance with the"
+	    " number of\n            executed instructions (at the -I rate,"
+	    " or %i MHz), not host time\n",
+	    TIMER_DETERMINISTIC_DEFAULT_HZ / 1000000);
 	printf("  -H        display a list of possible CPU and "
 	    "machine types\n");
 	printf("  -h        display this help message\n");
@@ -340,6 +363,9 @@ static void usage(int longusage)
 	    " size is %i MB)\n", DEFAULT_DYNTRANS_CACHE_SIZE / 1048576);
 	printf("  -K        force the debugger to be entered at the end "
 	    "of a simulation\n");
+	printf("  -m n      share identical RAM pages between (and within)"
+	    " machines, scanning\n            every n seconds (0 = only at"
+	    " the end); statistics are shown at the end\n");
 	printf("  -q        quiet mode (don't print startup messages)\n");
 	printf("  -V        start up in the single-step debugger, paused\n");
 	printf("  -v        verbose debug messages\n");
@@ -379,7 +405,7 @@ int get_cmd_args(int argc, char *argv[], struct emul *emul,
 	struct machine *m = emul_add_machine(emul, NULL);
 
 	const char *opts =
-	    "BC:c:Dd:E:e:HhI:iJj:k:KM:Nn:Oo:p:QqRrSs:TtUuVvW:"
+	    "BC:c:Dd:E:e:GHhI:iJj:k:KL:M:m:Nn:Oo:P:p:QqRrSs:TtUuVvW:"
 #ifdef WITH_X11
 	    "XxY:"
 #endif
@@ -432,6 +458,9 @@ int get_cmd_args(int argc, char *argv[], struct emul *emul,
 			subtype = optarg;
 			msopts = 1;
 			break;
+		case 'G':
+			timer_set_deterministic(TIMER_DETERMINISTIC_DEFAULT_HZ);
+			break;
 		case 'H':
 			GXemul::ListTemplates();
 			printf("--------------------------------------------------------------------------\n\n");
@@ -469,10 +498,21 @@ int get_cmd_args(int argc, char *argv[], struct emul *emul,
 		case 'K':
 			force_debugger_at_exit = 1;
 			break;
+		case 'L':
+			console_use_sockets(optarg);
+			break;
 		case 'M':
 			m->physical_ram_in_mb = atoi(optarg);
 			msopts = 1;
 			break;
+		case 'm':
+			if (atoi(optarg) < 0) {
+				fprintf(stderr, "The page sharing scan interval"
+				    " must not be negative.\n");
+				exit(1);
+			}
+			memory_sharing_enable(atoi(optarg));
+			break;
 		case 'N':
 			m->show_nr_of_instructions = 1;
 			msopts = 1;
@@ -491,6 +531,10 @@ int get_cmd_args(int argc, char *argv[], struct emul *emul,
 			    strdup(optarg));
 			msopts = 1;
 			break;
+		case 'P':
+			machine_profile_init(m, optarg);
+			msopts = 1;
+			break;
 		case 'p':
 			machine_add_breakpoint_string(m, optarg);
 			msopts = 1;
@@ -811,7 +855,9 @@ int main(int argc, char *argv[])
 
 	get_cmd_args(argc, argv, emul, &diskimages, &n_diskimages);
 
-	if (!skip_srandom_call) {
+	if (timer_is_deterministic())
+		srandom(1);
+	else if (!skip_srandom_call) {
 		struct timeval tv;
 		gettimeofday(&tv, NULL);
 		srandom(tv.tv_sec ^ getpid() ^ tv.tv_usec);
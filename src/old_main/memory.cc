@@ -33,6 +33,8 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/mman.h>
+#include <sys/time.h>
+#include <unistd.h>
 
 #include "cpu.h"
 #include "machine.h"
@@ -137,6 +139,216 @@ void *zeroed_alloc(size_t s)
 }
 
 
+/*
+ *  Page sharing:
+ *
+ *  When enabled (using the -m command line option), the RAM memblocks of all
+ *  machines are registered here, and marked as mergeable, so that the host
+ *  kernel (Linux KSM) may merge identical pages copy-on-write, also across
+ *  different emulated machines. memory_sharing_scan() periodically releases
+ *  pages which contain only zeroes back to the host, and counts how many of
+ *  the remaining pages are duplicates of other pages.
+ */
+
+static int memory_sharing_interval = -1;	/*  -1 = disabled  */
+static struct timeval memory_sharing_last_scan;
+
+static int n_sharing_memblocks = 0;
+static unsigned char **sharing_memblocks = NULL;
+
+
+/*
+ *  memory_sharing_enable():
+ *
+ *  Enables page sharing for all memblocks allocated from now on. interval
+ *  is the number of seconds between scans; 0 means scan only at the end of
+ *  the emulation (see emul_run()).
+ */
+void memory_sharing_enable(int interval)
+{
+#ifndef MADV_MERGEABLE
+	fatal("WARNING: The host does not support merging of identical pages"
+	    " (MADV_MERGEABLE).\nOnly pages containing zeroes will be"
+	    " shared.\n");
+#endif
+
+	memory_sharing_interval = interval;
+	gettimeofday(&memory_sharing_last_scan, NULL);
+}
+
+
+/*
+ *  memory_sharing_enabled():
+ */
+int memory_sharing_enabled(void)
+{
+	return memory_sharing_interval >= 0;
+}
+
+
+/*
+ *  memory_sharing_add_memblock():
+ *
+ *  Registers a newly allocated memblock for page sharing.
+ */
+static void memory_sharing_add_memblock(unsigned char *p)
+{
+#ifdef MADV_MERGEABLE
+	if (madvise(p, 1 << BITS_PER_MEMBLOCK, MADV_MERGEABLE) != 0 &&
+	    n_sharing_memblocks == 0)
+		fatal("WARNING: madvise(MADV_MERGEABLE) failed. Is KSM"
+		    " enabled in the host kernel?\n");
+#endif
+
+	n_sharing_memblocks ++;
+	CHECK_ALLOCATION(sharing_memblocks = (unsigned char **) realloc(
+	    sharing_memblocks, sizeof(unsigned char *) * n_sharing_memblocks));
+	sharing_memblocks[n_sharing_memblocks - 1] = p;
+}
+
+
+/*
+ *  memory_sharing_host_merged_pages():
+ *
+ *  Returns the number of pages of this process which the host kernel has
+ *  merged, or -1 if unknown.
+ */
+static int64_t memory_sharing_host_merged_pages(void)
+{
+	long long n = -1;
+	FILE *f = fopen("/proc/self/ksm_merging_pages", "r");
+
+	if (f == NULL)
+		return -1;
+	if (fscanf(f, "%lli", &n) != 1)
+		n = -1;
+	fclose(f);
+
+	return n;
+}
+
+
+/*
+ *  memory_sharing_scan():
+ *
+ *  Scans all registered memblocks, one host page at a time. Pages containing
+ *  only zeroes are given back to the host (they read as zeroes until written
+ *  to again, so any host pointers into them stay valid). The other pages are
+ *  hashed, to find out how many of them are identical to some other page. If
+ *  report is non-zero, the result is printed.
+ *
+ *  madvise() works on whole host pages, so if the host page size does not
+ *  divide the memblock size, the memblocks are scanned as a whole, and
+ *  nothing is given back.
+ */
+void memory_sharing_scan(int report)
+{
+	const size_t memblock_size = 1 << BITS_PER_MEMBLOCK;
+	long host_pagesize = sysconf(_SC_PAGESIZE);
+	int release_zero_pages = 1;
+	size_t pagesize, pages_per_memblock, n_pages;
+	size_t table_size = 1, i, j, k;
+	uint64_t n_zero = 0, n_dup = 0, *hashes;
+	unsigned char **pages;
+	int64_t merged;
+
+	if (!memory_sharing_enabled())
+		return;
+
+	pagesize = host_pagesize;
+	if (host_pagesize <= 0 || memblock_size % pagesize != 0) {
+		pagesize = memblock_size;
+		release_zero_pages = 0;
+	}
+
+	pages_per_memblock = memblock_size / pagesize;
+	n_pages = n_sharing_memblocks * pages_per_memblock;
+
+	while (table_size < n_pages * 2)
+		table_size <<= 1;
+
+	CHECK_ALLOCATION(pages = (unsigned char **)
+	    calloc(table_size, sizeof(unsigned char *)));
+	CHECK_ALLOCATION(hashes = (uint64_t *)
+	    calloc(table_size, sizeof(uint64_t)));
+
+	for (i=0; i<(size_t)n_sharing_memblocks; i++) {
+		for (j=0; j<pages_per_memblock; j++) {
+			unsigned char *p = sharing_memblocks[i] + j * pagesize;
+			uint64_t *q = (uint64_t *) p, h = 0xcbf29ce484222325ULL;
+			int nonzero = 0;
+
+			/*  64-bit FNV-1a over 64-bit words:  */
+			for (k=0; k<pagesize / sizeof(uint64_t); k++) {
+				h = (h ^ q[k]) * 0x100000001b3ULL;
+				nonzero |= q[k] != 0;
+			}
+
+			if (!nonzero) {
+				n_zero ++;
+				if (release_zero_pages)
+					madvise(p, pagesize, MADV_DONTNEED);
+				continue;
+			}
+
+			/*  Look for an identical page:  */
+			for (k=h & (table_size-1); pages[k] != NULL;
+			    k = (k+1) & (table_size-1))
+				if (hashes[k] == h &&
+				    memcmp(pages[k], p, pagesize) == 0)
+					break;
+
+			if (pages[k] != NULL) {
+				n_dup ++;
+			} else {
+				pages[k] = p;
+				hashes[k] = h;
+			}
+		}
+	}
+
+	free(pages);
+	free(hashes);
+
+	gettimeofday(&memory_sharing_last_scan, NULL);
+
+	if (!report)
+		return;
+
+	printf("page sharing: %i memblocks, %lli pages: %lli zero, %lli"
+	    " duplicates (%lli MB shareable)\n", n_sharing_memblocks,
+	    (long long) n_pages, (long long) n_zero, (long long) n_dup,
+	    (long long) ((n_zero + n_dup) * pagesize / 1048576));
+
+	merged = memory_sharing_host_merged_pages();
+	if (merged >= 0)
+		printf("page sharing: %lli pages merged by the host kernel\n",
+		    (long long) merged);
+}
+
+
+/*
+ *  memory_sharing_tick():
+ *
+ *  Called every now and then from the main loop. Runs a scan if the scan
+ *  interval has passed.
+ */
+void memory_sharing_tick(void)
+{
+	struct timeval tv;
+
+	if (memory_sharing_interval <= 0)
+		return;
+
+	gettimeofday(&tv, NULL);
+	if (tv.tv_sec - memory_sharing_last_scan.tv_sec <
+	    memory_sharing_interval)
+		return;
+
+	memory_sharing_scan(verbose > 0);
+}
+
+
 /*
  *  memory_new():
  *
@@ -482,6 +694,90 @@ void memory_device_remove(struct memory *mem, int i)
 }
 
 
+/*
+ *  memory_device_remap():
+ *
+ *  Move all memory mapped devices within the window [oldaddr, oldaddr+len)
+ *  to the same offsets within [newaddr, newaddr+len), e.g. when a guest OS
+ *  rewrites a PCI base address register. Only the affected entries of the
+ *  (sorted) device array are moved; the rest of the map is left untouched.
+ *
+ *  Returns the number of devices that were moved, or -1 if a device only
+ *  partially overlaps the old window or if the new window would collide
+ *  with some other device. (Nothing is changed in that case.)
+ *
+ *  NOTE: The caller is responsible for invalidating translation caches for
+ *  both the old and the new window.
+ */
+int memory_device_remap(struct memory *mem, uint64_t oldaddr, uint64_t len,
+	uint64_t newaddr)
+{
+	struct memory_device *tmp;
+	int i, lo, hi, n;
+
+	if (oldaddr == newaddr || len == 0)
+		return 0;
+
+	for (lo=0; lo<mem->n_mmapped_devices; lo++)
+		if (mem->devices[lo].endaddr > oldaddr)
+			break;
+	for (hi=lo; hi<mem->n_mmapped_devices; hi++)
+		if (mem->devices[hi].baseaddr >= oldaddr + len)
+			break;
+
+	n = hi - lo;
+	if (n == 0)
+		return 0;
+
+	if (mem->devices[lo].baseaddr < oldaddr ||
+	    mem->devices[hi-1].endaddr > oldaddr + len)
+		return -1;
+
+	for (i=0; i<mem->n_mmapped_devices; i++) {
+		if (i >= lo && i < hi)
+			continue;
+		if (newaddr + len <= mem->devices[i].baseaddr ||
+		    newaddr >= mem->devices[i].endaddr)
+			continue;
+		return -1;
+	}
+
+	CHECK_ALLOCATION(tmp = (struct memory_device *)
+	    malloc(sizeof(struct memory_device) * n));
+	memcpy(tmp, &mem->devices[lo], sizeof(struct memory_device) * n);
+
+	memmove(&mem->devices[lo], &mem->devices[hi],
+	    sizeof(struct memory_device) * (mem->n_mmapped_devices - hi));
+	mem->n_mmapped_devices -= n;
+
+	for (i=0; i<n; i++) {
+		tmp[i].baseaddr = tmp[i].baseaddr - oldaddr + newaddr;
+		tmp[i].endaddr  = tmp[i].baseaddr + tmp[i].length;
+	}
+
+	/*  Re-insert the moved entries at their new sorted position:  */
+	for (i=0; i<mem->n_mmapped_devices; i++)
+		if (mem->devices[i].baseaddr >= newaddr)
+			break;
+
+	memmove(&mem->devices[i+n], &mem->devices[i],
+	    sizeof(struct memory_device) * (mem->n_mmapped_devices - i));
+	memcpy(&mem->devices[i], tmp, sizeof(struct memory_device) * n);
+	mem->n_mmapped_devices += n;
+	free(tmp);
+
+	if (newaddr < mem->mmap_dev_minaddr)
+		mem->mmap_dev_minaddr = newaddr & ~mem->dev_dyntrans_alignment;
+	if (newaddr + len > mem->mmap_dev_maxaddr)
+		mem->mmap_dev_maxaddr = (((newaddr + len) - 1) |
+		    mem->dev_dyntrans_alignment) + 1;
+
+	mem->last_accessed_device = 0;
+
+	return n;
+}
+
+
 /*
  *  memory_paddr_to_hostaddr():
  *
@@ -529,10 +825,12 @@ unsigned char *memory_paddr_to_hostaddr(struct memory *mem,
 		    try malloc + memset if mmap failed.  */
 		table[entry] = (void *) mmap(NULL, alloclen,
 		    PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
-		if (table[entry] == NULL) {
+		if (table[entry] == MAP_FAILED) {
 			CHECK_ALLOCATION(table[entry] = malloc(alloclen));
 			memset(table[entry], 0, alloclen);
-		}
+		} else if (memory_sharing_enabled())
+			memory_sharing_add_memblock(
+			    (unsigned char *) table[entry]);
 	}
 
 	hostptr = (unsigned char *) table[entry];
@@ -544,6 +842,89 @@ unsigned char *memory_paddr_to_hostaddr(struct memory *mem,
 }
 
 
+/*
+ *  memory_paddr_to_hostrange():
+ *
+ *  Translate a physical address into a host address, for bulk transfers
+ *  (e.g. DMA) which should not go through memory_rw() one access at a time.
+ *  Unlike memory_paddr_to_hostaddr(), memory mapped devices are taken into
+ *  account: devices which are backed by host memory (DM_DYNTRANS_OK, or
+ *  DM_DYNTRANS_WRITE_OK when writing) are handled just like RAM, but for
+ *  any other device NULL is returned, and the caller has to fall back to
+ *  normal memory_rw() accesses.
+ *
+ *  *lenp should be set to the number of bytes that the caller wants to
+ *  access. On success, it is lowered to the number of bytes which may
+ *  actually be accessed, starting at the returned host address. Writes to
+ *  devices are recorded in the device's dyntrans_write_low/high range, but
+ *  invalidating code translations is up to the caller.
+ */
+unsigned char *memory_paddr_to_hostrange(struct memory *mem,
+	uint64_t paddr, int writeflag, size_t *lenp)
+{
+	const uint64_t memblock_mask = (1 << BITS_PER_MEMBLOCK) - 1;
+	unsigned char *hostptr;
+	uint64_t avail, next_device = (uint64_t) -1;
+	int i;
+
+	for (i=0; i<mem->n_mmapped_devices; i++) {
+		struct memory_device *dev = &mem->devices[i];
+		uint64_t ofs;
+
+		if (paddr < dev->baseaddr || paddr >= dev->endaddr) {
+			if (dev->baseaddr > paddr && dev->baseaddr < next_device)
+				next_device = dev->baseaddr;
+			continue;
+		}
+
+		if (!(dev->flags & DM_DYNTRANS_OK) ||
+		    (writeflag == MEM_WRITE &&
+		    !(dev->flags & DM_DYNTRANS_WRITE_OK)))
+			return NULL;
+
+		ofs = paddr - dev->baseaddr;
+
+		if (dev->flags & DM_EMULATED_RAM) {
+			uint64_t p = ofs + *(uint64_t *) dev->dyntrans_data;
+			avail = (1 << BITS_PER_MEMBLOCK) - (p & memblock_mask);
+			if (avail > dev->endaddr - paddr)
+				avail = dev->endaddr - paddr;
+			if (*lenp > avail)
+				*lenp = avail;
+			return memory_paddr_to_hostaddr(mem, p, MEM_WRITE);
+		}
+
+		if (*lenp > dev->endaddr - paddr)
+			*lenp = dev->endaddr - paddr;
+
+		if (writeflag == MEM_WRITE) {
+			if (ofs < dev->dyntrans_write_low)
+				dev->dyntrans_write_low = ofs;
+			if (ofs + *lenp - 1 > dev->dyntrans_write_high)
+				dev->dyntrans_write_high = ofs + *lenp - 1;
+		}
+
+		return dev->dyntrans_data + ofs;
+	}
+
+	if (paddr >= mem->physical_max)
+		return NULL;
+
+	/*  Plain RAM. (Memblocks are allocated, even when reading.)  */
+	hostptr = memory_paddr_to_hostaddr(mem, paddr, MEM_WRITE);
+
+	avail = (1 << BITS_PER_MEMBLOCK) - (paddr & memblock_mask);
+	if (avail > mem->physical_max - paddr)
+		avail = mem->physical_max - paddr;
+	if (avail > next_device - paddr)
+		avail = next_device - paddr;
+	if (*lenp > avail)
+		*lenp = avail;
+
+	return hostptr;
+}
+
+
 #define	UPDATE_CHECKSUM(value) {					\
 		internal_state -= 0x118c7771c0c0a77fULL;		\
 		internal_state = ((internal_state + (value)) << 7) ^	\
@@ -26,6 +26,14 @@
  *
  *
  *  Timer framework. This is used by emulated clocks.
+ *
+ *  Normally, timers are driven by a host interval timer (SIGALRM), and the
+ *  emulated time is synchronized with the host's time of day every now and
+ *  then. In deterministic mode, the emulated time is instead advanced
+ *  explicitly from the main loop, as a function of the number of executed
+ *  instructions, and timer_gettimeofday() returns a fixed start time plus
+ *  the emulated time. Two runs of the same program then see exactly the
+ *  same timer interrupts and clock values.
  */
 
 #include <stdio.h>
@@ -62,6 +70,8 @@ static double timer_current_time_step;
 
 static int timer_is_running;
 
+static double timer_deterministic_hz;	/*  0 = not deterministic  */
+
 #define	SECONDS_BETWEEN_GETTIMEOFDAY_SYNCH	1.65
 
 
@@ -144,6 +154,27 @@ void timer_update_frequency(struct timer *t, double new_freq)
 }
 
 
+/*
+ *  timer_run_ticks():
+ *
+ *  Calls the tick function of each timer once per interval that has passed,
+ *  up to timer_current_time.
+ */
+static void timer_run_ticks(void)
+{
+	struct timer *timer = first_timer;
+
+	while (timer != NULL) {
+		while (timer_current_time >= timer->next_tick_at) {
+			timer->timer_tick(timer, timer->extra);
+			timer->next_tick_at += timer->interval;
+		}
+
+		timer = timer->next;
+	}
+}
+
+
 /*
  *  timer_tick():
  *
@@ -151,7 +182,6 @@ void timer_update_frequency(struct timer *t, double new_freq)
  */
 static void timer_tick(int signal_nr)
 {
-	struct timer *timer = first_timer;
 	struct timeval tv;
 
 	timer_current_time += timer_current_time_step;
@@ -183,14 +213,7 @@ static void timer_tick(int signal_nr)
 		    SECONDS_BETWEEN_GETTIMEOFDAY_SYNCH);
 	}
 
-	while (timer != NULL) {
-		while (timer_current_time >= timer->next_tick_at) {
-			timer->timer_tick(timer, timer->extra);
-			timer->next_tick_at += timer->interval;
-		}
-
-		timer = timer->next;
-	}
+	timer_run_ticks();
 
 #ifdef TEST
 	printf("T"); fflush(stdout);
@@ -198,6 +221,108 @@ static void timer_tick(int signal_nr)
 }
 
 
+/*
+ *  timer_set_deterministic():
+ *
+ *  Switch to deterministic mode, where the emulated time advances by one
+ *  second for every instructions_per_second instructions passed to
+ *  timer_advance_instructions(). May be called again (before timer_start())
+ *  to change the rate, when the machine's emulated_hz is known.
+ */
+void timer_set_deterministic(double instructions_per_second)
+{
+	if (instructions_per_second < 1.0)
+		instructions_per_second = 1.0;
+
+	timer_deterministic_hz = instructions_per_second;
+	timer_start_tv.tv_sec = TIMER_DETERMINISTIC_START_TIME;
+	timer_start_tv.tv_usec = 0;
+}
+
+
+int timer_is_deterministic(void)
+{
+	return timer_deterministic_hz > 0;
+}
+
+
+/*
+ *  timer_advance_instructions():
+ *
+ *  In deterministic mode, advance the emulated time by n instructions, and
+ *  run the tick functions of any timers that have expired.
+ */
+void timer_advance_instructions(int64_t n)
+{
+	if (!timer_is_running || timer_deterministic_hz <= 0 || n <= 0)
+		return;
+
+	timer_current_time += n / timer_deterministic_hz;
+	timer_run_ticks();
+}
+
+
+/*
+ *  timer_time_to_next_tick():
+ *
+ *  Returns the number of seconds until the next timer expires, or limit if
+ *  that is sooner, but at least one host timer interval (since that is the
+ *  resolution of the emulated time), and at most one second. This is how
+ *  long the host may sleep when all emulated cpus are idle.
+ */
+double timer_time_to_next_tick(double limit)
+{
+	struct timer *timer = first_timer;
+	double t = limit < 1.0? limit : 1.0;
+
+	while (timer != NULL) {
+		if (timer->next_tick_at - timer_current_time < t)
+			t = timer->next_tick_at - timer_current_time;
+		timer = timer->next;
+	}
+
+	if (t < timer_current_time_step)
+		t = timer_current_time_step;
+
+	return t;
+}
+
+
+/*
+ *  timer_gettimeofday():
+ *
+ *  Replacement for gettimeofday(), for use by emulated clocks. In
+ *  deterministic mode, the time is derived from the emulated time only.
+ */
+void timer_gettimeofday(struct timeval *tv)
+{
+	double t;
+
+	if (timer_deterministic_hz <= 0) {
+		gettimeofday(tv, NULL);
+		return;
+	}
+
+	t = timer_current_time;
+	tv->tv_sec = timer_start_tv.tv_sec + (time_t) t;
+	tv->tv_usec = (suseconds_t) ((t - (time_t) t) * 1000000.0);
+}
+
+
+/*
+ *  timer_time():
+ *
+ *  Replacement for time(NULL), for use by emulated clocks.
+ */
+time_t timer_time(void)
+{
+	struct timeval tv;
+
+	timer_gettimeofday(&tv);
+	return tv.tv_sec;
+}
+
+
 /*
  *  timer_start():
  *
@@ -214,7 +339,8 @@ void timer_start(void)
 
 	timer_is_running = 1;
 
-	gettimeofday(&timer_start_tv, NULL);
+	if (timer_deterministic_hz <= 0)
+		gettimeofday(&timer_start_tv, NULL);
 	timer_current_time = 0.0;
 
 	/*  Reset all timers:  */
@@ -222,6 +348,11 @@ void timer_start(void)
 		timer->next_tick_at = timer->interval;
 		timer = timer->next;
 	}
+
+	/*  No host interval timer in deterministic mode:  */
+	if (timer_deterministic_hz > 0)
+		return;
+
 	val.it_interval.tv_sec = 0;
 	val.it_interval.tv_usec = (int) (1000000.0 / timer_freq);
 	val.it_value.tv_sec = 0;
@@ -251,6 +382,9 @@ void timer_stop(void)
 
 	timer_is_running = 0;
 
+	if (timer_deterministic_hz > 0)
+		return;
+
 	val.it_interval.tv_sec = 0;
 	val.it_interval.tv_usec = 0;
 	val.it_value.tv_sec = 0;
@@ -284,6 +418,7 @@ void timer_init(void)
 	timer_current_time = 0.0;
 	timer_is_running = 0;
 	timer_countdown_to_next_gettimeofday = 0;
+	timer_deterministic_hz = 0;
 
 	timer_freq = TIMER_BASE_FREQUENCY;
 	timer_current_time_step = 1.0 / timer_freq;
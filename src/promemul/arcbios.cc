@@ -46,6 +46,7 @@
 #include "machine_arc.h"
 #include "memory.h"
 #include "misc.h"
+#include "timer.h"
 
 #include "thirdparty/arcbios_other.h"
 
@@ -1453,7 +1454,7 @@ int arcbios_emul(struct cpu *cpu)
 		break;
 	case 0x54:		/*  GetRelativeTime()  */
 		debug("[ ARCBIOS GetRelativeTime() ]\n");
-		cpu->cd.mips.gpr[MIPS_GPR_V0] = (int64_t)(int32_t)time(NULL);
+		cpu->cd.mips.gpr[MIPS_GPR_V0] = (int64_t)(int32_t)timer_time();
 		break;
 	case 0x5c:  /*  Open(char *path, uint32_t mode, uint32_t *fileID)  */
 		debug("[ ARCBIOS Open(\"");
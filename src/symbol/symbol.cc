@@ -29,6 +29,13 @@
  *
  *  This module is (probably) independent from the rest of the emulator.
  *  symbol_init() must be called before any other function in this file is used.
+ *
+ *  Symbols are kept in one array. Before the first lookup after symbols
+ *  have been added, the array is sorted by address, and two indices are
+ *  built: a hash table of symbol names, for get_symbol_addr(), and a
+ *  running maximum of symbol end addresses, which lets address lookups
+ *  do a binary search even when symbols overlap. Lookups are then O(1)
+ *  and O(log n), respectively, also for kernels with 100k+ symbols.
  */
 
 #include <stdio.h>
@@ -52,36 +59,139 @@ int symbol_nsymbols(struct symbol_context *sc)
 }
 
 
+/*
+ *  sym_addr_compare():
+ *
+ *  Helper function for sorting symbols according to their address.
+ */
+int sym_addr_compare(const void *a, const void *b)
+{
+	struct symbol *p1 = (struct symbol *) a;
+	struct symbol *p2 = (struct symbol *) b;
+
+	if (p1->addr < p2->addr)
+		return -1;
+	if (p1->addr > p2->addr)
+		return 1;
+
+	return 0;
+}
+
+
+/*
+ *  symbol_name_hash():
+ *
+ *  FNV-1a hash of a symbol name.
+ */
+static uint32_t symbol_name_hash(const char *name)
+{
+	uint32_t h = 2166136261U;
+
+	while (*name) {
+		h ^= (unsigned char) *name++;
+		h *= 16777619U;
+	}
+
+	return h;
+}
+
+
+/*
+ *  symbol_index_intervals():
+ *
+ *  Recalculate max_end[], the highest end address of symbols 0..i, for
+ *  each i in the (sorted) symbol array.
+ */
+static void symbol_index_intervals(struct symbol_context *sc)
+{
+	uint64_t max_end = 0;
+	int i;
+
+	CHECK_ALLOCATION(sc->max_end = (uint64_t *) realloc(sc->max_end,
+	    sizeof(uint64_t) * (sc->n_symbols + 1)));
+
+	for (i=0; i<sc->n_symbols; i++) {
+		uint64_t end = sc->symbols[i].addr + sc->symbols[i].len;
+
+		/*  Symbols at the very top of the address space:  */
+		if (end < sc->symbols[i].addr)
+			end = (uint64_t) -1;
+
+		if (end > max_end)
+			max_end = end;
+
+		sc->max_end[i] = max_end;
+	}
+}
+
+
+/*
+ *  symbol_build_index():
+ *
+ *  Sort the symbol array by address, and rebuild the address and name
+ *  indices.
+ */
+static void symbol_build_index(struct symbol_context *sc)
+{
+	int i;
+
+	qsort(sc->symbols, sc->n_symbols, sizeof(struct symbol),
+	    sym_addr_compare);
+
+	symbol_index_intervals(sc);
+
+	/*
+	 *  Name hash table, with at least twice as many buckets as there are
+	 *  symbols. The chains are built backwards, so that if several
+	 *  symbols have the same name, the one with the lowest address is
+	 *  found first.
+	 */
+	sc->name_hash_size = 64;
+	while (sc->name_hash_size < sc->n_symbols * 2)
+		sc->name_hash_size <<= 1;
+
+	free(sc->name_hash);
+	CHECK_ALLOCATION(sc->name_hash = (int *) malloc(sizeof(int) *
+	    sc->name_hash_size));
+
+	for (i=0; i<sc->name_hash_size; i++)
+		sc->name_hash[i] = -1;
+
+	for (i=sc->n_symbols-1; i>=0; i--) {
+		uint32_t h = symbol_name_hash(sc->symbols[i].name)
+		    & (sc->name_hash_size - 1);
+		sc->symbols[i].next_by_name = sc->name_hash[h];
+		sc->name_hash[h] = i;
+	}
+
+	sc->sorted_array = 1;
+}
+
+
 /*
  *  get_symbol_addr():
  *
  *  Find a symbol by name. If addr is non-NULL, *addr is set to the symbol's
  *  address. Return value is 1 if the symbol is found, 0 otherwise.
- *
- *  NOTE:  This is O(n).
  */
 int get_symbol_addr(struct symbol_context *sc, const char *symbol, uint64_t *addr)
 {
-	struct symbol *s;
+	int i;
+
+	if (sc->n_symbols == 0)
+		return 0;
+
+	if (!sc->sorted_array)
+		symbol_build_index(sc);
 
-	if (sc->sorted_array) {
-		int i;
-		for (i=0; i<sc->n_symbols; i++)
-			if (strcmp(symbol, sc->first_symbol[i].name) == 0) {
-				if (addr != NULL)
-					*addr = sc->first_symbol[i].addr;
-				return 1;
-			}
-	} else {
-		s = sc->first_symbol;
-		while (s != NULL) {
-			if (strcmp(symbol, s->name) == 0) {
-				if (addr != NULL)
-					*addr = s->addr;
-				return 1;
-			}
-			s = s->next;
+	i = sc->name_hash[symbol_name_hash(symbol) & (sc->name_hash_size - 1)];
+	while (i >= 0) {
+		if (strcmp(symbol, sc->symbols[i].name) == 0) {
+			if (addr != NULL)
+				*addr = sc->symbols[i].addr;
+			return 1;
 		}
+		i = sc->symbols[i].next_by_name;
 	}
 
 	return 0;
@@ -89,90 +199,71 @@ int get_symbol_addr(struct symbol_context *sc, const char *symbol, uint64_t *add
 
 
 /*
- *  get_symbol_name_and_n_args():
+ *  get_symbol_name_and_n_args_r():
  *
- *  Translate an address into a symbol name.  The return value is a pointer
- *  to a static char array, containing the symbol name.  (In other words,
- *  this function is not reentrant. This removes the need for memory allocation
- *  at the caller's side.)
+ *  Translate an address into a symbol name. The name is written to buf
+ *  (at most bufsize bytes, including the terminating nul char), and buf is
+ *  returned. If no symbol was found, NULL is returned instead.
  *
  *  If offset is not a NULL pointer, *offset is set to the offset within
  *  the symbol. For example, if there is a symbol at address 0x1000 with
  *  length 0x100, and a caller wants to know the symbol name of address
- *  0x1008, the symbol's name will be found in the static char array, and
- *  *offset will be set to 0x8.
+ *  0x1008, then buf will contain "name+0x8", and *offset will be set to 0x8.
  *
  *  If n_argsp is non-NULL, *n_argsp is set to the symbol's n_args value.
  *
- *  If no symbol was found, NULL is returned instead.
+ *  If several symbols cover the address, the one starting closest to it is
+ *  used.
  */
-static char symbol_buf[SYMBOLBUF_MAX+1];
-char *get_symbol_name_and_n_args(struct symbol_context *sc, uint64_t addr,
-	uint64_t *offset, int *n_argsp)
+char *get_symbol_name_and_n_args_r(struct symbol_context *sc, uint64_t addr,
+	uint64_t *offset, int *n_argsp, char *buf, size_t bufsize)
 {
 	struct symbol *s;
+	int lowest, highest, i = -1;
 
 	if (sc->n_symbols == 0)
 		return NULL;
 
+	if (!sc->sorted_array)
+		symbol_build_index(sc);
+
 	if ((addr >> 32) == 0 && (addr & 0x80000000ULL))
 		addr |= 0xffffffff00000000ULL;
 
-	symbol_buf[0] = symbol_buf[SYMBOLBUF_MAX] = '\0';
 	if (offset != NULL)
 		*offset = 0;
 
-	if (!sc->sorted_array) {
-		/*  Slow, linear O(n) search:  */
-		s = sc->first_symbol;
-		while (s != NULL) {
-			/*  Found a match?  */
-			if (addr >= s->addr && addr < s->addr + s->len) {
-				if (addr == s->addr)
-					snprintf(symbol_buf, SYMBOLBUF_MAX,
-					    "%s", s->name);
-				else
-					snprintf(symbol_buf, SYMBOLBUF_MAX,
-					    "%s+0x%"PRIx64, s->name, (uint64_t)
-					    (addr - s->addr));
-				if (offset != NULL)
-					*offset = addr - s->addr;
-				if (n_argsp != NULL)
-					*n_argsp = s->n_args;
-				return symbol_buf;
-			}
-			s = s->next;
-		}
-	} else {
-		/*  Faster, O(log n) search:  */
-		int lowest = 0, highest = sc->n_symbols - 1;
-		while (lowest <= highest) {
-			int ofs = (lowest + highest) / 2;
-			s = sc->first_symbol + ofs;
-
-			/*  Found a match?  */
-			if (addr >= s->addr && addr < s->addr + s->len) {
-				if (addr == s->addr)
-					snprintf(symbol_buf, SYMBOLBUF_MAX,
-					    "%s", s->name);
-				else
-					snprintf(symbol_buf, SYMBOLBUF_MAX,
-					    "%s+0x%"PRIx64, s->name, (uint64_t)
-					    (addr - s->addr));
-
-				if (offset != NULL)
-					*offset = addr - s->addr;
-				if (n_argsp != NULL)
-					*n_argsp = s->n_args;
-
-				return symbol_buf;
-			}
-
-			if (addr < s->addr)
-				highest = ofs - 1;
-			else
-				lowest = ofs + 1;
-		}
+	/*  Find the last symbol starting at or below addr:  */
+	lowest = 0; highest = sc->n_symbols - 1;
+	while (lowest <= highest) {
+		int ofs = (lowest + highest) / 2;
+
+		if (sc->symbols[ofs].addr <= addr) {
+			i = ofs;
+			lowest = ofs + 1;
+		} else
+			highest = ofs - 1;
+	}
+
+	/*  Walk backwards, for as long as a symbol may still cover addr:  */
+	for (; i >= 0 && sc->max_end[i] > addr; i--) {
+		s = &sc->symbols[i];
+
+		if (addr - s->addr >= s->len)
+			continue;
+
+		if (addr == s->addr)
+			snprintf(buf, bufsize, "%s", s->name);
+		else
+			snprintf(buf, bufsize, "%s+0x%"PRIx64, s->name,
+			    (uint64_t) (addr - s->addr));
+
+		if (offset != NULL)
+			*offset = addr - s->addr;
+		if (n_argsp != NULL)
+			*n_argsp = s->n_args;
+
+		return buf;
 	}
 
 	/*  Not found? Then return NULL.  */
@@ -180,6 +271,22 @@ char *get_symbol_name_and_n_args(struct symbol_context *sc, uint64_t addr,
 }
 
 
+/*
+ *  get_symbol_name_and_n_args():
+ *
+ *  Like get_symbol_name_and_n_args_r(), but the return value is a pointer
+ *  to a static char array. (In other words, this function is not reentrant.
+ *  This removes the need for memory allocation at the caller's side.)
+ */
+static char symbol_buf[SYMBOLBUF_MAX+1];
+char *get_symbol_name_and_n_args(struct symbol_context *sc, uint64_t addr,
+	uint64_t *offset, int *n_argsp)
+{
+	return get_symbol_name_and_n_args_r(sc, addr, offset, n_argsp,
+	    symbol_buf, sizeof(symbol_buf));
+}
+
+
 /*
  *  get_symbol_name():
  *
@@ -191,22 +298,35 @@ char *get_symbol_name(struct symbol_context *sc, uint64_t addr, uint64_t *offs)
 }
 
 
+/*
+ *  symbol_reserve():
+ *
+ *  Make room for at least n symbols in total. Loaders which know how many
+ *  symbols they are about to add can call this first, to avoid growing the
+ *  symbol array step by step.
+ */
+void symbol_reserve(struct symbol_context *sc, int n)
+{
+	if (n <= sc->max_symbols)
+		return;
+
+	CHECK_ALLOCATION(sc->symbols = (struct symbol *) realloc(sc->symbols,
+	    sizeof(struct symbol) * n));
+	sc->max_symbols = n;
+}
+
+
 /*
  *  add_symbol_name():
  *
- *  Add a symbol to the symbol list.
+ *  Add a symbol to the symbol array. Symbols may be added at any time; the
+ *  array is sorted and indexed again the next time a lookup is done.
  */
 void add_symbol_name(struct symbol_context *sc,
 	uint64_t addr, uint64_t len, const char *name, int type, int n_args)
 {
 	struct symbol *s;
 
-	if (sc->sorted_array) {
-		fprintf(stderr, "add_symbol_name(): Internal error: the "
-		    "symbol array is already sorted\n");
-		exit(1);
-	}
-
 	if (name == NULL) {
 		fprintf(stderr, "add_symbol_name(): name = NULL\n");
 		exit(1);
@@ -251,7 +371,11 @@ void add_symbol_name(struct symbol_context *sc,
 	if ((addr >> 32) == 0 && (addr & 0x80000000ULL))
 		addr |= 0xffffffff00000000ULL;
 
-	CHECK_ALLOCATION(s = (struct symbol *) malloc(sizeof(struct symbol)));
+	if (sc->n_symbols >= sc->max_symbols)
+		symbol_reserve(sc, sc->max_symbols < 256? 256 :
+		    sc->max_symbols * 2);
+
+	s = &sc->symbols[sc->n_symbols ++];
 	memset(s, 0, sizeof(struct symbol));
 
 	s->name = symbol_demangle_cplusplus(name);
@@ -264,11 +388,8 @@ void add_symbol_name(struct symbol_context *sc,
 	s->type   = type;
 	s->n_args = n_args;
 
-	sc->n_symbols ++;
-
-	/*  Add first in list:  */
-	s->next = sc->first_symbol;
-	sc->first_symbol = s;
+	/*  The indices are rebuilt at the next lookup:  */
+	sc->sorted_array = 0;
 }
 
 
@@ -333,89 +454,49 @@ void symbol_readfile(struct symbol_context *sc, char *fname)
 }
 
 
-/*
- *  sym_addr_compare():
- *
- *  Helper function for sorting symbols according to their address.
- */
-int sym_addr_compare(const void *a, const void *b)
-{
-	struct symbol *p1 = (struct symbol *) a;
-	struct symbol *p2 = (struct symbol *) b;
-
-	if (p1->addr < p2->addr)
-		return -1;
-	if (p1->addr > p2->addr)
-		return 1;
-
-	return 0;
-}
-
-
 /*
  *  symbol_recalc_sizes():
  *
- *  Recalculate sizes of symbols that have size = 0, by creating an array
- *  containing all symbols, qsort()-ing that array according to address, and
- *  recalculating the size fields if necessary.
+ *  Recalculate sizes of symbols that have size = 0, by sorting the symbol
+ *  array according to address, and letting each such symbol extend up to
+ *  the next one.
  */
 void symbol_recalc_sizes(struct symbol_context *sc)
 {
-	struct symbol *tmp_array;
-	struct symbol *last_ptr;
-	struct symbol *tmp_ptr;
 	int i;
 
-	CHECK_ALLOCATION(tmp_array = (struct symbol *) malloc(sizeof (struct symbol) *
-	    sc->n_symbols));
-
-	/*  Copy first_symbol --> tmp_array, and remove the old
-		first_symbol at the same time:  */
-	tmp_ptr = sc->first_symbol;
-	i = 0;
-	while (tmp_ptr != NULL) {
-		tmp_array[i] = *tmp_ptr;
-		last_ptr = tmp_ptr;
-		tmp_ptr = tmp_ptr->next;
-		free(last_ptr);
-		i++;
-	}
-
-	qsort(tmp_array, sc->n_symbols, sizeof(struct symbol),
-	    sym_addr_compare);
-	sc->sorted_array = 1;
+	symbol_build_index(sc);
 
-	/*  Recreate the first_symbol chain:  */
-	sc->first_symbol = NULL;
 	for (i=0; i<sc->n_symbols; i++) {
 		/*  Recalculate size, if 0:  */
-		if (tmp_array[i].len == 0) {
+		if (sc->symbols[i].len == 0) {
 			uint64_t len;
 			if (i != sc->n_symbols-1)
-				len = tmp_array[i+1].addr
-				    - tmp_array[i].addr;
+				len = sc->symbols[i+1].addr
+				    - sc->symbols[i].addr;
 			else
 				len = 1;
 
-			tmp_array[i].len = len;
+			sc->symbols[i].len = len;
 		}
-
-		tmp_array[i].next = &tmp_array[i+1];
 	}
 
-	sc->first_symbol = tmp_array;
+	symbol_index_intervals(sc);
 }
 
 
 /*
  *  symbol_init():
  *
- *  Initialize the symbol hashtables.
+ *  Initialize the symbol context.
  */
 void symbol_init(struct symbol_context *sc)
 {
-	sc->first_symbol = NULL;
-	sc->sorted_array = 0;
+	sc->symbols = NULL;
 	sc->n_symbols = 0;
+	sc->max_symbols = 0;
+	sc->sorted_array = 0;
+	sc->max_end = NULL;
+	sc->name_hash = NULL;
+	sc->name_hash_size = 0;
 }
-
@@ -0,0 +1,127 @@
+#!/bin/sh
+#
+#  Benchmark suite: Runs the demos/bench programs (which must have been
+#  built beforehand, see demos/bench/README) in the legacy test machines,
+#  and a small loop in the component based test machine templates, and
+#  prints the results in CSV format:
+#
+#	mode,arch,benchmark,instructions,usec,mips,ns_per_instr
+#
+#  Start with:
+#
+#	make bench
+#
+#  or  test/bench.sh > results.csv  to keep the results for comparison.
+#
+#  The component based machines do not have the test devices yet, so the
+#  bench programs can not be run there. Instead, a self-contained
+#  loop (a few ALU instructions and a branch, without any device I/O) is
+#  run in the mips and m88k templates for BENCH_SECONDS seconds (default
+#  10), and reported as the benchmark "loop". The speed is taken from the
+#  emulator's once-per-second steps/second reports, skipping the first one,
+#  which includes startup. Legacy mode runs are aborted after BENCH_TIMEOUT
+#  seconds (default 600).
+#
+#  The loops are:
+#
+#	mips (at 0x80010000):		m88k (at 0x10000):
+#	loop:  addiu  t0,t0,1		loop:  addu  r2,r2,0x1
+#	       addu   t1,t1,t0		       addu  r3,r3,r2
+#	       b      loop		       xor   r4,r3,r2
+#	       xor    t2,t1,t0		       br    loop
+#
+
+GXEMUL=./gxemul
+BENCHDIR=demos/bench
+DISKIMAGE=_bench_disk.img
+LOOP=_bench_loop.bin
+BENCH_SECONDS=${BENCH_SECONDS:-10}
+BENCH_TIMEOUT=${BENCH_TIMEOUT:-600}
+
+rm -f $DISKIMAGE
+dd if=/dev/zero of=$DISKIMAGE bs=1024 count=1024 2> /dev/null
+
+echo "mode,arch,benchmark,instructions,usec,mips,ns_per_instr"
+
+FOUND=0
+
+for arch in arm m88k mips ppc sh; do
+	binary=$BENCHDIR/bench_$arch
+	if [ ! -f $binary ]; then
+		echo "$binary not built, skipping" 1>&2
+		continue
+	fi
+
+	FOUND=1
+
+	case $arch in
+	arm)	legacy="-E testarm" ;;
+	m88k)	legacy="-E oldtestm88k" ;;
+	mips)	legacy="-E oldtestmips" ;;
+	ppc)	legacy="-E testppc -C PPC750" ;;
+	sh)	legacy="-E testsh" ;;
+	esac
+
+	#  Legacy mode: one result line per "bench" line printed by the guest.
+	timeout $BENCH_TIMEOUT \
+	    $GXEMUL -q $legacy -d $DISKIMAGE $binary < /dev/null | tr -d '\r' | \
+	    awk -v arch=$arch '
+		function hex(s,    i, n, c) {
+			n = 0
+			for (i = 3; i <= length(s); i++) {
+				c = index("0123456789abcdef", substr(s, i, 1))
+				n = n * 16 + c - 1
+			}
+			return n
+		}
+		$1 == "bench" && NF == 8 {
+			n = hex($4) - hex($3)
+			if (n < 0)
+				n += 4294967296
+			usec = (hex($7) - hex($5)) * 1000000 + \
+			    hex($8) - hex($6)
+			if (n == 0 || usec <= 0)
+				next
+			printf("legacy,%s,%s,%d,%d,%.2f,%.3f\n", arch, $2,
+			    n, usec, n / usec, usec * 1000 / n)
+		}'
+done
+
+#  Component mode: the self-contained loop, for BENCH_SECONDS.
+for arch in m88k mips; do
+	case $arch in
+	m88k)	template=testm88k; loopaddr=0x10000
+		printf '\140\102\000\001\364\143\140\002\364\203\120\002' > $LOOP
+		printf '\303\377\377\375' >> $LOOP ;;
+	mips)	template=testmips; loopaddr=0xffffffff80010000
+		printf '\045\010\000\001\001\050\110\041\020\000\377\375' > $LOOP
+		printf '\001\050\120\046' >> $LOOP ;;
+	esac
+
+	{ sleep `expr $BENCH_SECONDS + 1`; echo quit; } | \
+	    timeout -k `expr $BENCH_SECONDS + 5` -s INT $BENCH_SECONDS \
+	    $GXEMUL -e $template raw:$loopaddr:0:$loopaddr:$LOOP \
+	    2>&1 | tr '\r' '\n' | \
+	    awk -v arch=$arch '
+		#  Each report covers the steps since the previous one.
+		$1 == "[" && $3 == "steps" {
+			rate = substr($4, 2) + 0
+			if (reports++ > 0 && rate > 0) {
+				n += $2 - last
+				usec += ($2 - last) * 1000000 / rate
+			}
+			last = $2
+		}
+		END {
+			if (n > 0 && usec > 0)
+				printf("component,%s,loop,%d,%d,%.2f,%.3f\n",
+				    arch, n, usec, n / usec,
+				    usec * 1000 / n)
+		}'
+done
+
+rm -f $DISKIMAGE $LOOP
+
+if [ z$FOUND = z0 ]; then
+	echo "No benchmark programs found; see $BENCHDIR/README" 1>&2
+fi
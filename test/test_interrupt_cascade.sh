@@ -0,0 +1,81 @@
+#!/bin/sh
+#
+#  Regression test  --  collapsed interrupt mask cascades in legacy mode
+#  Start with:
+#
+#	test/test_interrupt_cascade.sh
+#
+#  (This is also run by  make test.)
+#
+#  In the SGI O2 (IP32) machine, the serial ports interrupt on MACE lines,
+#  MACE's PERIPH output is a CRIME line, and CRIME interrupts the CPU on
+#  MIPS interrupt 2. Both MACE and CRIME are bitmask controllers, so the
+#  MACE -> CRIME cascade is collapsed.
+#
+#  A small MIPS program toggles the tty0 interrupt:
+#
+#	80010000:  lui   t0,0xb400		CRIME
+#	80010004:  li    t1,0x10
+#	80010008:  sw    t1,0x1c(t0)		enable MACE_PERIPH_SERIAL
+#	8001000c:  lui   t2,0xbf31		MACE
+#	80010010:  lui   t1,0x10
+#	80010014:  sw    t1,0x1c(t2)		enable mace irq 20 (tty0)
+#	80010018:  lui   t3,0xbf39		tty0 (ns16550)
+#	8001001c:  li    t1,8
+#	80010020:  sb    t1,0x400(t3)		mcr = MCR_IENABLE
+#	80010024:  li    t1,2
+#	80010028:  sb    t1,0x100(t3)		ier = IER_ETXRDY: assert
+#	8001002c:  sb    zero,0x100(t3)		ier = 0: deassert
+#	80010030:  lw    t4,0x14(t2)		mace status
+#	80010034:  sb    t1,0x100(t3)		ier = IER_ETXRDY: assert
+#	80010038:  lw    t5,0x14(t2)		mace status
+#	8001003c:  sw    zero,0x1c(t2)		mask all mace irqs
+#	80010040:  b     80010040
+#
+#  The program is single-stepped in the debugger, and the CPU's interrupt
+#  pin (cause bit 0x400) is checked after each interrupt change. The MACE
+#  status word, as seen by the guest, is checked at the end.
+#
+#  (-x is needed because the machine has more than one console; no slave
+#  xterm is started, since nothing is ever output.)
+#
+
+GXEMUL=./gxemul
+PROGRAM=_interrupt_cascade_test.bin
+
+printf '\074\010\264\000\044\011\000\020\255\011\000\034\074\012\277\061' \
+    > $PROGRAM
+printf '\074\011\000\020\255\111\000\034\074\013\277\071\044\011\000\010' \
+    >> $PROGRAM
+printf '\241\151\004\000\044\011\000\002\241\151\001\000\241\140\001\000' \
+    >> $PROGRAM
+printf '\215\114\000\024\241\151\001\000\215\115\000\024\255\100\000\034' \
+    >> $PROGRAM
+printf '\020\000\377\377\000\000\000\000' >> $PROGRAM
+
+output=`printf 'step 11\nreg ,0\nstep 2\nreg ,0\nstep 2\nreg ,0\nstep\nreg ,0\nreg\nquit\n' \
+    | $GXEMUL -q -x -V -E sgi -e o2 0xffffffff80010000:$PROGRAM 2>&1 \
+    | tr -d '\r'`
+
+#  1 = asserted, 0 = not asserted:
+levels=`echo "$output" | grep -o 'cause = 0x[0-9a-f]*' \
+    | sed -e 's/.*0x0*400$/1/' -e 's/.*0x.*/0/' | tr '\n' ' '`
+
+rm -f $PROGRAM
+
+if [ "z$levels" != "z1 0 1 0 " ]; then
+	echo "test_interrupt_cascade: FAILED (levels: $levels)"
+	echo "$output"
+	exit 1
+fi
+
+#  The deasserted line is cleared in the status word, the asserted is set:
+if ! echo "$output" | grep -q "t4 = 0x0000000000000000" ||
+   ! echo "$output" | grep -q "t5 = 0x0000000000100000"; then
+	echo "test_interrupt_cascade: FAILED (mace status)"
+	echo "$output"
+	exit 1
+fi
+
+echo "test_interrupt_cascade: ok"
+exit 0
@@ -0,0 +1,233 @@
+#!/bin/sh
+#
+#  Regression test  --  Dreamcast PVR2 tile renderer in legacy mode
+#  Start with:
+#
+#	test/test_pvr_render.sh
+#
+#  (This is also run by  make test.)
+#
+#  Each scene is a small SH4 program which stores a table of 32-bit
+#  (address, value) pairs, and then loops forever:
+#
+#	8c010000:  mova   8c010014,r0
+#	8c010002:  mov.l  @r0+,r1		loop:
+#	8c010004:  mov.l  @r0+,r2
+#	8c010006:  tst    r1,r1
+#	8c010008:  bt     8c01000e
+#	8c01000a:  bra    8c010002
+#	8c01000c:  mov.l  r2,@r1
+#	8c01000e:  bra    8c01000e		done:
+#	8c010010:  nop
+#	8c010012:  nop
+#	8c010014:  (table, ending with address 0)
+#
+#  The table sets up the PVR registers, feeds polygons to the Tile
+#  Accelerator, and starts a render. A breakpoint at the final loop enters
+#  the debugger, and the rendered 96 x 64 RGB565 framebuffer is dumped and
+#  compared against a golden checksum. The framebuffer is 3 x 2 tiles, and
+#  the scenes have polygons spanning several tiles and reaching outside the
+#  framebuffer, so binning, per-tile rasterization, and the framebuffer
+#  write-back are all covered.
+#
+#  If the renderer is changed on purpose, run with -v to see the new
+#  checksums.
+#
+#  (-x is needed because the machine has more than one console; no slave
+#  xterm is started, since nothing is ever output.)
+#
+
+GXEMUL=./gxemul
+PROGRAM=_pvr_render_test.bin
+FAILED=0
+VERBOSE=0
+if [ "z$1" = "z-v" ]; then
+	VERBOSE=1
+fi
+
+PVR=0xa05f8000
+TA=0x10000000
+VRAM=0xa5000000
+TEXVRAM=0xa4000000
+FB=0x200000
+
+#  IEEE single precision constants:
+F0=0x00000000; F025=0x3e800000; F05=0x3f000000; F075=0x3f400000
+F1=0x3f800000; F2=0x40000000; F4=0x40800000; F8=0x41000000
+F16=0x41800000; F20=0x41a00000; F30=0x41f00000; F40=0x42200000
+F56=0x42600000; F60=0x42700000; F64=0x42800000; F80=0x42a00000
+F88=0x42b00000; F120=0x42f00000; FM20=0xc1a00000; FM8=0xc1000000
+
+#  w value:  Outputs a 32-bit little-endian word.
+w()
+{
+	v=$(($1))
+	printf "\\$(printf %o $((v & 255)))\\$(printf %o $(((v >> 8) & 255)))"
+	printf "\\$(printf %o $(((v >> 16) & 255)))\\$(printf %o $(((v >> 24) & 255)))"
+}
+
+#  put addr value:  Adds a store to the table.
+put()
+{
+	w $1; w $2
+}
+
+#  ta word...:  Sends one 32-byte parameter to the Tile Accelerator.
+ta()
+{
+	ofs=0
+	for word in "$@"; do
+		put $((TA + ofs)) $word
+		ofs=$((ofs + 4))
+	done
+	while [ $ofs -lt 32 ]; do
+		put $((TA + ofs)) 0
+		ofs=$((ofs + 4))
+	done
+}
+
+#  vertex pcw x y z color:  Sends a packed color vertex.
+vertex()
+{
+	ta $1 $2 $3 $4 0 0 $5 0
+}
+
+#  setup:  Outputs the program, and the common register setup.
+setup()
+{
+	printf '\004\307\006\141\006\142\030\041\001\211\372\257\042\041'
+	printf '\376\257\011\000\011\000'
+
+	#  Background plane at 0x100000: ISP word, and the color of its
+	#  first vertex (word 6).
+	put $((VRAM + 0x100000)) 0
+	put $((VRAM + 0x100018)) 0xff203040
+	put $((PVR + 0x20)) 0x100000		# OB_ADDR
+	put $((PVR + 0x8c)) 0			# BGPLANE_CFG
+	put $((PVR + 0x88)) $F0			# BGPLANE_Z
+
+	put $((PVR + 0x60)) $FB			# FB_RENDER_ADDR1
+	put $((PVR + 0x48)) 1			# FB_RENDER_CFG: RGB565
+	put $((PVR + 0x4c)) 24			# FB_RENDER_MODULO: 192 bytes
+	put $((PVR + 0x68)) 0x005f0000		# FB_CLIP_X: 0..95
+	put $((PVR + 0x6c)) 0x003f0000		# FB_CLIP_Y: 0..63
+	put $((PVR + 0x13c)) 0x00010002		# TILEBUF_SIZE: 3 x 2 tiles
+	put $((PVR + 0x144)) 0x80000000		# TA_INIT
+}
+
+#  render:  Starts the render, and ends the table.
+render()
+{
+	put $((PVR + 0x14)) 1			# STARTRENDER
+	put 0 0
+}
+
+#  Opaque list: A Gouraud shaded quad, and a flat shaded triangle which
+#  intersects it in depth and reaches outside of the framebuffer.
+opaque()
+{
+	ta 0x80000000 0xc0800000 0 0		# Polygon, >=, Gouraud
+	vertex 0xe0000000 $F8 $F8 $F05 0xffff0000
+	vertex 0xe0000000 $F88 $F8 $F05 0xff00ff00
+	vertex 0xe0000000 $F8 $F56 $F05 0xff0000ff
+	vertex 0xf0000000 $F88 $F56 $F05 0xffffffff
+
+	ta 0x80000000 0xc0000000 0 0		# Polygon, >=, flat
+	vertex 0xe0000000 $FM20 $F30 $F075 0xffffff00
+	vertex 0xe0000000 $F120 $F20 $F025 0xffffff00
+	vertex 0xf0000000 $F40 $F80 $F025 0xffffff00
+
+	ta 0				# End of list
+}
+
+#  Translucent list: Two overlapping triangles with alpha 0.5, sent front
+#  to back, so that they have to be sorted before blending.
+translucent()
+{
+	ta 0x82000000 0xc4000000 0x94100000 0	# src = a, dst = 1 - a
+	vertex 0xe0000000 $F40 $F4 $F075 0x800000ff
+	vertex 0xe0000000 $F88 $F60 $F075 0x800000ff
+	vertex 0xf0000000 $F16 $F60 $F075 0x800000ff
+	vertex 0xe0000000 $F8 $F8 $F05 0x80ff0000
+	vertex 0xe0000000 $F64 $F8 $F05 0x80ff0000
+	vertex 0xf0000000 $F30 $F56 $F05 0x80ff0000
+
+	ta 0
+}
+
+#  Punch-through list: A quad with an 8 x 8 ARGB1555 checkerboard texture
+#  (opaque white / transparent red, 2 x 2 texel squares), repeated twice,
+#  and modulated with a vertex color.
+textured()
+{
+	for y in 0 1 2 3 4 5 6 7; do
+		for x in 0 1 2 3; do
+			if [ $(((x + (y >> 1)) & 1)) = 1 ]; then
+				t=0xffff
+			else
+				t=0x7c00
+			fi
+			put $((TEXVRAM + 0x80000 + y * 16 + x * 4)) \
+			    $((t | (t << 16)))
+		done
+	done
+
+	put $((PVR + 0x11c)) 0x80		# PT_ALPHA_REF
+
+	#  Polygon, textured, ISP: >=, texture. TSP: src = 1, use alpha,
+	#  modulate, 8 x 8. TCW: ARGB1555, non-twiddled, at 0x80000.
+	ta 0x84000008 0xc2000000 0x20100040 0x04010000
+	ta 0xe0000000 $FM8 $F4 $F05 $F0 $F0 0xff80ff80 0
+	ta 0xe0000000 $F80 $F4 $F05 $F2 $F0 0xff80ff80 0
+	ta 0xe0000000 $FM8 $F60 $F05 $F0 $F2 0xff80ff80 0
+	ta 0xf0000000 $F80 $F60 $F05 $F2 $F2 0xff80ff80 0
+
+	ta 0
+}
+
+#
+#  scene name checksum commands...
+#
+#  Runs the scene built by the commands, and compares the checksum of the
+#  framebuffer dump.
+#
+scene()
+{
+	name=$1; expected=$2; shift; shift
+
+	setup > $PROGRAM
+	for cmd in "$@"; do
+		$cmd >> $PROGRAM
+	done
+	render >> $PROGRAM
+
+	output=`printf 'dump 0xa5200000 0xa5203000\nquit\n' | \
+	    $GXEMUL -q -x -E dreamcast -p 0x8c01000e \
+	    0x8c010000:$PROGRAM 2>&1 | tr -d '\r'`
+
+	sum=`printf "%s\n" "$output" | grep '^0xa52' | cksum | cut -d ' ' -f 1`
+	nlines=`printf "%s\n" "$output" | grep -c '^0xa52'`
+
+	if [ $VERBOSE = 1 ]; then
+		echo "test_pvr_render: $name: $sum"
+	fi
+
+	if [ "z$nlines" != z768 ] || [ "z$sum" != "z$expected" ]; then
+		echo "test_pvr_render: $name: FAILED (checksum $sum," \
+		    "expected $expected)"
+		printf "%s\n" "$output" | grep -v '^0xa52'
+		FAILED=1
+		return
+	fi
+
+	echo "test_pvr_render: $name: ok"
+}
+
+
+scene background 3404026527
+scene opaque 434402990 opaque
+scene translucent 1672820981 opaque translucent
+scene textured 3140008378 textured
+
+rm -f $PROGRAM
+exit $FAILED
@@ -0,0 +1,122 @@
+#!/bin/sh
+#
+#  Regression test  --  debugger watchpoints in legacy mode
+#  Start with:
+#
+#	test/test_watchpoints.sh
+#
+#  (This is also run by  make test.)
+#
+#  A small MIPS program is run in the oldtestmips machine:
+#
+#	80010000:  lui   t0,0x8002
+#	80010004:  li    t1,0x55
+#	80010008:  sw    t1,0x100(t0)
+#	8001000c:  sw    t1,0x200(t0)
+#	80010010:  lw    t2,0x100(t0)
+#	80010014:  lui   t3,0xb000
+#	80010018:  sb    zero,0x10(t3)	(halt)
+#
+#  Watchpoints are added with -c, and the debugger is fed commands on stdin
+#  whenever it is entered.
+#
+
+GXEMUL=./gxemul
+PROGRAM=_watchpoints_test.bin
+FAILED=0
+
+printf '\074\010\200\002\044\011\000\125\255\011\001\000\255\011\002\000' \
+    > $PROGRAM
+printf '\215\012\001\000\074\013\260\000\241\140\000\020\000\000\000\000' \
+    >> $PROGRAM
+printf '\020\000\377\377\000\000\000\000' >> $PROGRAM
+
+#
+#  check name pattern... [-- pattern...]
+#
+#  Checks that $output contains all patterns before --, and none of the
+#  patterns after it.
+#
+check()
+{
+	name=$1; shift
+
+	expect_missing=0
+	for pattern in "$@"; do
+		if [ "z$pattern" = "z--" ]; then
+			expect_missing=1
+			continue
+		fi
+
+		if echo "$output" | grep -F -q -- "$pattern"; then
+			found=1
+		else
+			found=0
+		fi
+
+		if [ $found = $expect_missing ]; then
+			echo "test_watchpoints: $name: FAILED ($pattern)"
+			echo "$output"
+			FAILED=1
+			return
+		fi
+	done
+
+	echo "test_watchpoints: $name: ok"
+}
+
+run()
+{
+	input=$1; shift
+	output=`printf "$input" | $GXEMUL -q -E oldtestmips "$@" \
+	    0xffffffff80010000:$PROGRAM 2>&1 | tr -d '\r'`
+}
+
+
+#  Add: The new watchpoint is shown.
+run 'quit\n' -c "watchpoint add 0xffffffff80020200 4 w" -c "watchpoint show"
+check add "0: 0xffffffff80020200, 4 bytes, w"
+
+#  Hit: The debugger is entered right after the store, with the stored
+#  value already in memory, and with the pc at the next instruction.
+run 'print pc\ndump 0xffffffff80020200 0xffffffff80020204\nquit\n' \
+    -c "watchpoint add 0xffffffff80020200 4 w"
+check hit \
+    "WATCHPOINT 0: write of 4 bytes at 0xffffffff80020200, pc = 0xffffffff8001000c" \
+    "GXemul> print pc
+0xffffffff80010010" \
+    "00000055"
+
+#  Read only watchpoint: The store to the same address does not hit, but
+#  the load does. After continuing, the program runs to the end.
+run 'print pc\ncontinue\n' -c "watchpoint add 0xffffffff80020100 4 r"
+check read \
+    "WATCHPOINT 0: read of 4 bytes at 0xffffffff80020100, pc = 0xffffffff80010010" \
+    "0xffffffff80010014" \
+    -- "write of"
+
+#  Both accesses to a read/write watchpoint hit, one at a time.
+run 'print pc\ncontinue\nprint pc\ncontinue\n' \
+    -c "watchpoint add 0xffffffff80020100"
+check readwrite \
+    "write of 4 bytes at 0xffffffff80020100, pc = 0xffffffff80010008" \
+    "0xffffffff8001000c" \
+    "read of 4 bytes at 0xffffffff80020100, pc = 0xffffffff80010010" \
+    "0xffffffff80010014"
+
+#  Non-hit: A watchpoint on the same page, but not on the accessed words,
+#  does not stop the program.
+run 'quit\n' -c "watchpoint add 0xffffffff80020204 0x100"
+check nonhit -- "WATCHPOINT" "GXemul>"
+
+#  Delete: Only the remaining watchpoint is shown, and hit.
+run 'quit\n' -c "watchpoint add 0xffffffff80020100 4 w" \
+    -c "watchpoint add 0xffffffff80020200 4 w" -c "watchpoint delete 0" \
+    -c "watchpoint show"
+check delete \
+    "0: 0xffffffff80020200, 4 bytes, w" \
+    "WATCHPOINT 0: write of 4 bytes at 0xffffffff80020200" \
+    -- "at 0xffffffff80020100"
+
+rm -f $PROGRAM
+exit $FAILED
@@ -0,0 +1,34 @@
+// DO NOT EDIT. Automagically generated by the configure script.
+// Will be removed by  make clean_all
+
+	MachineComponent::RunUnitTests(nSucceeded, nFailed);
+	MainbusComponent::RunUnitTests(nSucceeded, nFailed);
+	DummyComponent::RunUnitTests(nSucceeded, nFailed);
+	RootComponent::RunUnitTests(nSucceeded, nFailed);
+	CPUComponent::RunUnitTests(nSucceeded, nFailed);
+	M88K_CPUComponent::RunUnitTests(nSucceeded, nFailed);
+	MIPS_CPUComponent::RunUnitTests(nSucceeded, nFailed);
+	CPUDyntransComponent::RunUnitTests(nSucceeded, nFailed);
+	RAMComponent::RunUnitTests(nSucceeded, nFailed);
+	Command::RunUnitTests(nSucceeded, nFailed);
+	EscapedString::RunUnitTests(nSucceeded, nFailed);
+	FileLoader::RunUnitTests(nSucceeded, nFailed);
+	FileLoader_aout::RunUnitTests(nSucceeded, nFailed);
+	FileLoader_ELF::RunUnitTests(nSucceeded, nFailed);
+	FileLoader_raw::RunUnitTests(nSucceeded, nFailed);
+	GXemul::RunUnitTests(nSucceeded, nFailed);
+	StateVariable::RunUnitTests(nSucceeded, nFailed);
+	Checksum::RunUnitTests(nSucceeded, nFailed);
+	CommandInterpreter::RunUnitTests(nSucceeded, nFailed);
+	SymbolRegistry::RunUnitTests(nSucceeded, nFailed);
+	ComponentFactory::RunUnitTests(nSucceeded, nFailed);
+	MoveComponentCommand::RunUnitTests(nSucceeded, nFailed);
+	VersionCommand::RunUnitTests(nSucceeded, nFailed);
+	StepCommand::RunUnitTests(nSucceeded, nFailed);
+	PauseCommand::RunUnitTests(nSucceeded, nFailed);
+	ResetCommand::RunUnitTests(nSucceeded, nFailed);
+	ContinueCommand::RunUnitTests(nSucceeded, nFailed);
+	BackwardStepCommand::RunUnitTests(nSucceeded, nFailed);
+	ContinueBackwardsCommand::RunUnitTests(nSucceeded, nFailed);
+	QuitCommand::RunUnitTests(nSucceeded, nFailed);
+	CopyComponentCommand::RunUnitTests(nSucceeded, nFailed);
@@ -0,0 +1,34 @@
+// DO NOT EDIT. Automagically generated by the configure script.
+// Will be removed by  make clean_all
+
+#include "components/MachineComponent.h"
+#include "components/MainbusComponent.h"
+#include "components/DummyComponent.h"
+#include "components/RootComponent.h"
+#include "components/CPUComponent.h"
+#include "components/M88K_CPUComponent.h"
+#include "components/MIPS_CPUComponent.h"
+#include "components/CPUDyntransComponent.h"
+#include "components/RAMComponent.h"
+#include "Command.h"
+#include "EscapedString.h"
+#include "FileLoader.h"
+#include "FileLoader_aout.h"
+#include "FileLoader_ELF.h"
+#include "FileLoader_raw.h"
+#include "GXemul.h"
+#include "StateVariable.h"
+#include "Checksum.h"
+#include "CommandInterpreter.h"
+#include "SymbolRegistry.h"
+#include "ComponentFactory.h"
+#include "commands/MoveComponentCommand.h"
+#include "commands/VersionCommand.h"
+#include "commands/StepCommand.h"
+#include "commands/PauseCommand.h"
+#include "commands/ResetCommand.h"
+#include "commands/ContinueCommand.h"
+#include "commands/BackwardStepCommand.h"
+#include "commands/ContinueBackwardsCommand.h"
+#include "commands/QuitCommand.h"
+#include "commands/CopyComponentCommand.h"